@@ -44,7 +44,8 @@
  * Includes
  *****************************************************************************/
 #include <StateMachine.h>
-#include <SimpleTimer.h>
+#include <Scheduler.h>
+#include <Profiler.h>
 #include <Arduino.h>
 
 /******************************************************************************
@@ -62,7 +63,7 @@ public:
     /**
      * Construct the calibration application.
      */
-    App() : m_systemStateMachine(), m_controlInterval()
+    App() : m_systemStateMachine(), m_scheduler()
     {
     }
 
@@ -90,11 +91,36 @@ private:
     /** Baudrate for Serial Communication */
     static const uint32_t SERIAL_BAUDRATE = 115200U;
 
+    /** Task priority of the differential drive control, which shall always run first. */
+    static const uint8_t CONTROL_TASK_PRIORITY = Scheduler::PRIORITY_HIGHEST;
+
+    /** Task priority of logging the profiler data. */
+    static const uint8_t PROFILE_TASK_PRIORITY = CONTROL_TASK_PRIORITY + 1U;
+
+    /** Profiler data logging period in ms. */
+    static const uint32_t LOG_PROFILE_DATA_PERIOD = 2000U;
+
     /** The system state machine. */
     StateMachine m_systemStateMachine;
 
-    /** Timer used for differential drive control processing. */
-    SimpleTimer m_controlInterval;
+    /** Scheduler for the periodic tasks. */
+    Scheduler m_scheduler;
+
+    /**
+     * Periodic differential drive control task.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void controlTask(void* userData);
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+    /**
+     * Periodic task to log the profiler statistics.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void profileTask(void* userData);
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
 
     /**
      * Copy construction of an instance.
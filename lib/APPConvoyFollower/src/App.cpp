@@ -39,6 +39,7 @@
 #include "LineSensorsCalibrationState.h"
 #include <Board.h>
 #include <Speedometer.h>
+#include <Profiler.h>
 #include <DifferentialDrive.h>
 #include <Odometry.h>
 #include <Logging.h>
@@ -62,7 +63,12 @@
 
 static void App_cmdChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData);
 static void App_motorSpeedSetpointsChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData);
+static void App_gapSetpointChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData);
 static void App_statusChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData);
+static void App_timeSyncResponseChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData);
+static void App_parameterChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData);
+static void App_parameterChangeCallback(uint8_t index, void* userData);
+static void App_parameterStoreCallback(void* userData);
 
 /******************************************************************************
  * Local Variables
@@ -76,16 +82,38 @@ App::App() :
     m_serialMuxProtChannelIdRemoteCtrlRsp(0U),
     m_serialMuxProtChannelIdCurrentVehicleData(0U),
     m_serialMuxProtChannelIdStatus(0U),
+    m_serialMuxProtChannelIdTimeSync(0U),
+    m_serialMuxProtChannelIdParameterRsp(0U),
     m_serialMuxProtChannelIdLineSensors(0U),
     m_systemStateMachine(),
-    m_controlInterval(),
-    m_reportTimer(),
-    m_statusTimer(),
+    m_scheduler(),
+    m_loadGovernor(MIN_CONTROL_SLACK),
+    m_reportTaskId(Scheduler::INVALID_TASK_ID),
+    m_lineSensorsTaskId(Scheduler::INVALID_TASK_ID),
     m_statusTimeoutTimer(),
-    m_sendLineSensorsDataInterval(),
     m_smpServer(Serial, this),
+    m_timeSync(),
+    m_parameterRegistry(),
+    m_parameterServer(m_parameterRegistry),
+    m_speedPIDFactors(),
+    m_maxMotorSpeed(0),
+#if (0 != CONFIG_LINE_SENSOR_BITMASK)
+    m_lineSensorsThreshold(LINE_SENSORS_THRESHOLD),
+#endif /* (0 != CONFIG_LINE_SENSOR_BITMASK) */
     m_isLineSensorCalibPending(false),
+    m_lineSensorsFilter(LINE_SENSORS_FILTER_VALUES, LINE_SENSORS_DEADBAND, LINE_SENSORS_MIN_SEND_INTERVAL,
+                        LINE_SENSORS_MAX_SEND_INTERVAL),
     m_movAvgProximitySensor()
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+    ,
+    m_vehicleDataBatch(SMPChannelPayload::VEHICLE_DATA_VALUE_COUNT),
+    m_vehicleDataTimeBase(0)
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
+#if (0 != CONFIG_PROFILER_ENABLE)
+    ,
+    m_serialMuxProtChannelIdProfile(0U),
+    m_profileSection(0U)
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
 {
 }
 
@@ -100,60 +128,38 @@ void App::setup()
         ErrorState::getInstance().setErrorMsg("SMP=0");
         m_systemStateMachine.setState(&ErrorState::getInstance());
     }
+    else if (false == setupParameters())
+    {
+        ErrorState::getInstance().setErrorMsg("PAR=0");
+        m_systemStateMachine.setState(&ErrorState::getInstance());
+    }
+    else if (false == setupScheduler())
+    {
+        ErrorState::getInstance().setErrorMsg("SCH=0");
+        m_systemStateMachine.setState(&ErrorState::getInstance());
+    }
     else
     {
-        m_reportTimer.start(REPORTING_PERIOD);
-        m_controlInterval.start(DIFFERENTIAL_DRIVE_CONTROL_PERIOD);
-        m_statusTimer.start(SEND_STATUS_TIMER_INTERVAL);
-        m_sendLineSensorsDataInterval.start(SEND_LINE_SENSORS_DATA_PERIOD);
         m_systemStateMachine.setState(&StartupState::getInstance());
     }
 }
 
 void App::loop()
 {
-    Board::getInstance().process();
-    Speedometer::getInstance().process();
-
-    if (true == m_controlInterval.isTimeout())
     {
-        /* The differential drive control needs the measured speed of the
-         * left and right wheel. Therefore it shall be processed after
-         * the speedometer.
-         */
-        DifferentialDrive::getInstance().process(DIFFERENTIAL_DRIVE_CONTROL_PERIOD);
-
-        /* The odometry unit needs to detect motor speed changes to be able to
-         * calculate correct values. Therefore it shall be processed right after
-         * the differential drive control.
-         */
-        Odometry::getInstance().process();
-
-        m_controlInterval.restart();
+        PROFILER_SCOPE(Profiler::SECTION_BOARD);
+        Board::getInstance().process();
     }
 
-    if ((true == m_reportTimer.isTimeout()) && (true == m_smpServer.isSynced()))
     {
-        /* Send current data to SerialMuxProt Client */
-        reportVehicleData();
-
-        m_reportTimer.restart();
+        PROFILER_SCOPE(Profiler::SECTION_SPEEDOMETER);
+        Speedometer::getInstance().process();
     }
 
-    if ((true == m_statusTimer.isTimeout()) && (true == m_smpServer.isSynced()))
-    {
-        Status payload = {SMPChannelPayload::Status::STATUS_FLAG_OK};
-
-        if (&ErrorState::getInstance() == m_systemStateMachine.getState())
-        {
-            payload.status = SMPChannelPayload::Status::STATUS_FLAG_ERROR;
-        }
-
-        /* Ignoring return value, as error handling is not available. */
-        (void)m_smpServer.sendData(m_serialMuxProtChannelIdStatus, &payload, sizeof(payload));
-
-        m_statusTimer.restart();
-    }
+    /* The scheduler runs the differential drive control first, because it has
+     * the highest priority. It needs the measured speed of the speedometer.
+     */
+    m_scheduler.process();
 
     if ((false == m_statusTimeoutTimer.isRunning()) && (true == m_smpServer.isSynced()))
     {
@@ -168,17 +174,15 @@ void App::loop()
         m_statusTimeoutTimer.stop();
     }
 
-    /* Send periodically line sensor data. */
-    if (true == m_sendLineSensorsDataInterval.isTimeout())
     {
-        sendLineSensorsData();
-
-        m_sendLineSensorsDataInterval.restart();
+        PROFILER_SCOPE(Profiler::SECTION_SMP);
+        m_smpServer.process(millis());
     }
 
-    m_smpServer.process(millis());
-
-    m_systemStateMachine.process();
+    {
+        PROFILER_SCOPE(Profiler::SECTION_STATE_MACHINE);
+        m_systemStateMachine.process();
+    }
 
     /* If line sensor calibration is completed, send response to the remote driver. */
     if ((true == m_isLineSensorCalibPending) &&
@@ -264,6 +268,34 @@ void App::systemStatusCallback(SMPChannelPayload::Status status)
     m_statusTimeoutTimer.start(STATUS_TIMEOUT_TIMER_INTERVAL);
 }
 
+void App::handleParameterRequest(const ParameterServer::Request& request)
+{
+    ParameterServer::Response response;
+
+    /* The owners may have changed the parameters since the last request. */
+    updateParameters();
+
+    m_parameterServer.handleRequest(request, response);
+
+    /* Ignoring return value, as error handling is not available. */
+    (void)m_smpServer.sendData(m_serialMuxProtChannelIdParameterRsp, &response, sizeof(response));
+}
+
+void App::applyParameters()
+{
+    DifferentialDrive& diffDrive = DifferentialDrive::getInstance();
+
+    diffDrive.setPIDFactors(m_speedPIDFactors);
+    diffDrive.setMaxMotorSpeed(m_maxMotorSpeed);
+}
+
+void App::handleTimeSyncResponse(const TimeSyncResponse& response, Timebase::Timestamp receiveTimestamp)
+{
+    /* A late or duplicated response is rejected by the time synchronization. */
+    (void)m_timeSync.processResponse(response.sequence, response.originTimestamp, response.receiveTimestamp,
+                                     response.transmitTimestamp, receiveTimestamp);
+}
+
 /******************************************************************************
  * Protected Methods
  *****************************************************************************/
@@ -274,40 +306,133 @@ void App::systemStatusCallback(SMPChannelPayload::Status status)
 
 void App::reportVehicleData()
 {
-    IProximitySensors& proximitySensors = Board::getInstance().getProximitySensors();
-    Odometry&          odometry         = Odometry::getInstance();
-    Speedometer&       speedometer      = Speedometer::getInstance();
-    VehicleData        payload;
-    int32_t            xPos          = 0;
-    int32_t            yPos          = 0;
-    uint8_t            maxCounts     = 0U;
-    uint8_t            averageCounts = 0U;
-    uint8_t            leftCounts    = 0U;
-    uint8_t            rightCounts   = 0U;
-    int16_t            leftSpeed     = speedometer.getLinearSpeedLeft();
-    int16_t            rightSpeed    = speedometer.getLinearSpeedRight();
-    int16_t            centerSpeed   = speedometer.getLinearSpeedCenter();
+    Odometry&    odometry    = Odometry::getInstance();
+    Speedometer& speedometer = Speedometer::getInstance();
+    int32_t      xPos        = 0;
+    int32_t      yPos        = 0;
+    int16_t      leftSpeed   = speedometer.getLinearSpeedLeft();
+    int16_t      rightSpeed  = speedometer.getLinearSpeedRight();
+    int16_t      centerSpeed = speedometer.getLinearSpeedCenter();
 
-    proximitySensors.read();
-    leftCounts  = proximitySensors.countsFrontWithLeftLeds();
-    rightCounts = proximitySensors.countsFrontWithRightLeds();
+    odometry.getPosition(xPos, yPos);
 
-    /* Use the sensor value with the maximum counts. */
-    maxCounts     = leftCounts > rightCounts ? leftCounts : rightCounts;
-    averageCounts = m_movAvgProximitySensor.write(maxCounts);
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+    int32_t  values[SMPChannelPayload::VEHICLE_DATA_VALUE_COUNT];
+    int32_t  timeBase = 0;
+    uint32_t timestamp;
+
+    /* The samples are stamped in DCS time like the single vehicle data, but in ms.
+     * The DCS time in us wraps around after 71 min, therefore the local time in ms
+     * is shifted by the clock offset. The offset is only known modulo 2^32 us,
+     * but that keeps the timestamps monotonic as long as the time base is equal.
+     */
+    if (true == m_timeSync.isSynced())
+    {
+        timeBase = static_cast<int32_t>(m_timeSync.getOffset()) / static_cast<int32_t>(Timebase::US_PER_MS);
+    }
+
+    /* The time differences in a batch can't express a jump of the time base. */
+    if (timeBase != m_vehicleDataTimeBase)
+    {
+        sendVehicleDataBatch();
+        m_vehicleDataBatch.startKeyframe();
+        m_vehicleDataTimeBase = timeBase;
+    }
+
+    timestamp = millis() + static_cast<uint32_t>(timeBase);
+
+    values[SMPChannelPayload::VEHICLE_DATA_X_POS]       = xPos;
+    values[SMPChannelPayload::VEHICLE_DATA_Y_POS]       = yPos;
+    values[SMPChannelPayload::VEHICLE_DATA_ORIENTATION] = odometry.getOrientation();
+    values[SMPChannelPayload::VEHICLE_DATA_LEFT]        = Util::stepsPerSecondToMillimetersPerSecond(leftSpeed);
+    values[SMPChannelPayload::VEHICLE_DATA_RIGHT]       = Util::stepsPerSecondToMillimetersPerSecond(rightSpeed);
+    values[SMPChannelPayload::VEHICLE_DATA_CENTER]      = Util::stepsPerSecondToMillimetersPerSecond(centerSpeed);
+    values[SMPChannelPayload::VEHICLE_DATA_PROXIMITY]   = m_movAvgProximitySensor.getResult();
+
+    /* If the batch is full, send it and add the sample to the next one. */
+    if (false == m_vehicleDataBatch.addSample(timestamp, values))
+    {
+        sendVehicleDataBatch();
+        (void)m_vehicleDataBatch.addSample(timestamp, values);
+    }
+
+    if (VEHICLE_DATA_BATCH_SAMPLES <= m_vehicleDataBatch.getSampleCount())
+    {
+        sendVehicleDataBatch();
+    }
+#else  /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
+    VehicleData payload;
 
-    odometry.getPosition(xPos, yPos);
     payload.xPos        = xPos;
     payload.yPos        = yPos;
     payload.orientation = odometry.getOrientation();
     payload.left        = Util::stepsPerSecondToMillimetersPerSecond(leftSpeed);
     payload.right       = Util::stepsPerSecondToMillimetersPerSecond(rightSpeed);
     payload.center      = Util::stepsPerSecondToMillimetersPerSecond(centerSpeed);
-    payload.proximity   = static_cast<SMPChannelPayload::Range>(averageCounts);
+    payload.proximity   = static_cast<SMPChannelPayload::Range>(m_movAvgProximitySensor.getResult());
+#if (0 != CONFIG_VEHICLE_DATA_TIMESTAMP)
+    payload.timestamp = (true == m_timeSync.isSynced()) ? m_timeSync.toPeerTime(Timebase::now()) : 0U;
+#endif /* (0 != CONFIG_VEHICLE_DATA_TIMESTAMP) */
 
     /* Ignoring return value, as error handling is not available. */
     (void)m_smpServer.sendData(m_serialMuxProtChannelIdCurrentVehicleData, &payload, sizeof(VehicleData));
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
+}
+
+void App::readProximitySensors()
+{
+    IProximitySensors& proximitySensors = Board::getInstance().getProximitySensors();
+    uint8_t            maxCounts        = 0U;
+    uint8_t            leftCounts       = 0U;
+    uint8_t            rightCounts      = 0U;
+
+    proximitySensors.read();
+    leftCounts  = proximitySensors.countsFrontWithLeftLeds();
+    rightCounts = proximitySensors.countsFrontWithRightLeds();
+
+    /* Use the sensor value with the maximum counts. */
+    maxCounts = leftCounts > rightCounts ? leftCounts : rightCounts;
+    (void)m_movAvgProximitySensor.write(maxCounts);
+}
+
+uint16_t App::getProximityGap() const
+{
+    /* Center of the range, which corresponds to the brightness level. */
+    static const uint16_t RANGE_GAPS[] = {
+        GapController::GAP_UNKNOWN, /* RANGE_NO_OBJECT */
+        275U,                       /* RANGE_25_30 */
+        225U,                       /* RANGE_20_25 */
+        175U,                       /* RANGE_15_20 */
+        125U,                       /* RANGE_10_15 */
+        75U,                        /* RANGE_5_10 */
+        25U                         /* RANGE_0_5 */
+    };
+    uint8_t  range = m_movAvgProximitySensor.getResult();
+    uint16_t gap   = 0U;
+
+    if ((sizeof(RANGE_GAPS) / sizeof(RANGE_GAPS[0])) > range)
+    {
+        gap = RANGE_GAPS[range];
+    }
+
+    return gap;
+}
+
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+void App::sendVehicleDataBatch()
+{
+    if (0U < m_vehicleDataBatch.getSampleCount())
+    {
+        /* Ignoring return value, as error handling is not available. The receiver detects
+         * a lost batch by the sequence number.
+         */
+        (void)m_smpServer.sendData(m_serialMuxProtChannelIdCurrentVehicleData, m_vehicleDataBatch.getFrame(),
+                                   VEHICLE_DATA_BATCH_CHANNEL_DLC);
+
+        m_vehicleDataBatch.nextFrame();
+    }
 }
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
 
 bool App::setupSerialMuxProt()
 {
@@ -316,15 +441,41 @@ bool App::setupSerialMuxProt()
     /* Channel subscription. */
     m_smpServer.subscribeToChannel(COMMAND_CHANNEL_NAME, App_cmdChannelCallback);
     m_smpServer.subscribeToChannel(SPEED_SETPOINT_CHANNEL_NAME, App_motorSpeedSetpointsChannelCallback);
+    m_smpServer.subscribeToChannel(GAP_SETPOINT_CHANNEL_NAME, App_gapSetpointChannelCallback);
     m_smpServer.subscribeToChannel(STATUS_CHANNEL_NAME, App_statusChannelCallback);
+    m_smpServer.subscribeToChannel(PARAMETER_CHANNEL_NAME, App_parameterChannelCallback);
+    m_smpServer.subscribeToChannel(TIME_SYNC_RESPONSE_CHANNEL_NAME, App_timeSyncResponseChannelCallback);
 
     /* Channel creation. */
     m_serialMuxProtChannelIdRemoteCtrlRsp =
         m_smpServer.createChannel(COMMAND_RESPONSE_CHANNEL_NAME, COMMAND_RESPONSE_CHANNEL_DLC);
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+    m_serialMuxProtChannelIdCurrentVehicleData =
+        m_smpServer.createChannel(VEHICLE_DATA_BATCH_CHANNEL_NAME, VEHICLE_DATA_BATCH_CHANNEL_DLC);
+#else  /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
     m_serialMuxProtChannelIdCurrentVehicleData =
         m_smpServer.createChannel(CURRENT_VEHICLE_DATA_CHANNEL_NAME, CURRENT_VEHICLE_DATA_CHANNEL_DLC);
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
     m_serialMuxProtChannelIdStatus      = m_smpServer.createChannel(STATUS_CHANNEL_NAME, STATUS_CHANNEL_DLC);
+#if (0 != CONFIG_LINE_SENSOR_BITMASK)
+    m_serialMuxProtChannelIdLineSensors =
+        m_smpServer.createChannel(LINE_SENSOR_BITMASK_CHANNEL_NAME, LINE_SENSOR_BITMASK_CHANNEL_DLC);
+#else  /* (0 != CONFIG_LINE_SENSOR_BITMASK) */
     m_serialMuxProtChannelIdLineSensors = m_smpServer.createChannel(LINE_SENSOR_CHANNEL_NAME, LINE_SENSOR_CHANNEL_DLC);
+#endif /* (0 != CONFIG_LINE_SENSOR_BITMASK) */
+
+    /* The clock synchronization is optional, therefore it is not considered below. */
+    m_serialMuxProtChannelIdTimeSync =
+        m_smpServer.createChannel(TIME_SYNC_REQUEST_CHANNEL_NAME, TIME_SYNC_REQUEST_CHANNEL_DLC);
+
+    /* The parameter tuning is optional, therefore it is not considered below. */
+    m_serialMuxProtChannelIdParameterRsp =
+        m_smpServer.createChannel(PARAMETER_RESPONSE_CHANNEL_NAME, PARAMETER_RESPONSE_CHANNEL_DLC);
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+    /* The profiler data is optional, therefore it is not considered below. */
+    m_serialMuxProtChannelIdProfile = m_smpServer.createChannel(PROFILE_CHANNEL_NAME, PROFILE_CHANNEL_DLC);
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
 
     /* Channels succesfully created? */
     if ((0U != m_serialMuxProtChannelIdCurrentVehicleData) && (0U != m_serialMuxProtChannelIdRemoteCtrlRsp) &&
@@ -336,25 +487,349 @@ bool App::setupSerialMuxProt()
     return isSuccessful;
 }
 
-void App::sendLineSensorsData() const
+void App::sendTimeSyncRequest()
+{
+    if (0U != m_serialMuxProtChannelIdTimeSync)
+    {
+        TimeSyncRequest payload;
+
+        payload.isSynced      = (true == m_timeSync.isSynced()) ? 1U : 0U;
+        payload.offset        = m_timeSync.getOffset();
+        payload.drift         = m_timeSync.getDrift();
+        payload.syncTimestamp = m_timeSync.getSyncTimestamp();
+
+        /* The transmit timestamp shall be taken as late as possible. */
+        payload.transmitTimestamp = Timebase::now();
+        payload.sequence          = m_timeSync.createRequest(payload.transmitTimestamp);
+
+        /* Ignoring return value, as a lost request is detected by the missing response. */
+        (void)m_smpServer.sendData(m_serialMuxProtChannelIdTimeSync, &payload, sizeof(payload));
+    }
+}
+
+bool App::setupParameters()
+{
+    bool isSuccessful = true;
+
+    updateParameters();
+    m_parameterRegistry.setChangeCallback(App_parameterChangeCallback, this);
+    m_parameterServer.setStoreCallback(App_parameterStoreCallback, this);
+
+    if ((false == m_parameterRegistry.add("maxSpeed", m_maxMotorSpeed, 1, INT16_MAX, true)) ||
+        (false == m_parameterRegistry.add("spdKpNum", m_speedPIDFactors.pNumerator, 0, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("spdKpDen", m_speedPIDFactors.pDenominator, 1, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("spdKiNum", m_speedPIDFactors.iNumerator, 0, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("spdKiDen", m_speedPIDFactors.iDenominator, 1, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("spdKdNum", m_speedPIDFactors.dNumerator, 0, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("spdKdDen", m_speedPIDFactors.dDenominator, 1, MAX_PID_FACTOR)))
+    {
+        isSuccessful = false;
+    }
+
+#if (0 != CONFIG_LINE_SENSOR_BITMASK)
+    if (false == m_parameterRegistry.add("lineThr", m_lineSensorsThreshold, 0U, LINE_SENSORS_VALUE_MAX))
+    {
+        isSuccessful = false;
+    }
+#endif /* (0 != CONFIG_LINE_SENSOR_BITMASK) */
+
+    return isSuccessful;
+}
+
+void App::updateParameters()
+{
+    DifferentialDrive& diffDrive = DifferentialDrive::getInstance();
+
+    diffDrive.getPIDFactors(m_speedPIDFactors);
+    m_maxMotorSpeed = diffDrive.getMaxMotorSpeed();
+}
+
+void App::storeParameters()
+{
+    /* Only the max. motor speed is part of the settings. All other parameters
+     * are registered as volatile, which is reported in the response to the
+     * store request. They shall be taken over into the source code after tuning.
+     */
+    Board::getInstance().getSettings().setMaxSpeed(m_maxMotorSpeed);
+}
+
+bool App::setupScheduler()
+{
+    bool    isSuccessful = true;
+    uint8_t controlTaskId =
+        m_scheduler.addTask(controlTask, this, DIFFERENTIAL_DRIVE_CONTROL_PERIOD, CONTROL_TASK_PRIORITY);
+    uint8_t proximityTaskId =
+        m_scheduler.addTask(proximityTask, this, PROXIMITY_READ_PERIOD, PROXIMITY_TASK_PRIORITY);
+    uint8_t statusTaskId;
+    uint8_t timeSyncTaskId;
+
+    m_reportTaskId = m_scheduler.addTask(reportTask, this, REPORTING_PERIOD, REPORT_TASK_PRIORITY);
+    m_lineSensorsTaskId =
+        m_scheduler.addTask(lineSensorsTask, this, SEND_LINE_SENSORS_DATA_PERIOD, LINE_SENSORS_TASK_PRIORITY);
+    statusTaskId   = m_scheduler.addTask(statusTask, this, SEND_STATUS_TIMER_INTERVAL, STATUS_TASK_PRIORITY);
+    timeSyncTaskId = m_scheduler.addTask(timeSyncTask, this, TIME_SYNC_PERIOD, TIME_SYNC_TASK_PRIORITY);
+
+    if ((Scheduler::INVALID_TASK_ID == controlTaskId) || (Scheduler::INVALID_TASK_ID == proximityTaskId) ||
+        (Scheduler::INVALID_TASK_ID == m_reportTaskId) || (Scheduler::INVALID_TASK_ID == m_lineSensorsTaskId) ||
+        (Scheduler::INVALID_TASK_ID == statusTaskId) || (Scheduler::INVALID_TASK_ID == timeSyncTaskId))
+    {
+        isSuccessful = false;
+    }
+    else
+    {
+        m_scheduler.start();
+    }
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+    /* Sending the profiler data is optional, therefore a missing task slot is ignored. */
+    (void)m_scheduler.addTask(profileTask, this, SEND_PROFILE_DATA_PERIOD, PROFILE_TASK_PRIORITY);
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+
+    return isSuccessful;
+}
+
+void App::applyDegradationLevel()
+{
+    /* The reporting period is doubled with every degradation level. The
+     * status is never degraded, because the DCS uses it for its timeout.
+     * The proximity sensors neither, because the gap control uses them,
+     * and the clock synchronization, because the timestamps depend on it.
+     */
+    uint32_t factor = static_cast<uint32_t>(1U) << m_loadGovernor.getLevel();
+
+    (void)m_scheduler.setPeriod(m_reportTaskId, REPORTING_PERIOD * factor);
+
+    /* The line sensors data is skipped on minimal level, see lineSensorsTask(). */
+    if (LoadGovernor::LEVEL_REDUCED == m_loadGovernor.getLevel())
+    {
+        factor = 2U;
+    }
+
+    (void)m_scheduler.setPeriod(m_lineSensorsTaskId, SEND_LINE_SENSORS_DATA_PERIOD * factor);
+}
+
+void App::controlTask(void* userData)
+{
+    App* application = reinterpret_cast<App*>(userData);
+
+    /* The gap control needs the measured speed and sets the differential
+     * drive setpoints. Therefore it shall be processed before the
+     * differential drive control.
+     */
+    if (nullptr != application)
+    {
+        DrivingState::getInstance().processGapControl(application->getProximityGap());
+    }
+
+    /* The differential drive control needs the measured speed of the
+     * left and right wheel. Therefore it shall be processed after
+     * the speedometer.
+     */
+    {
+        PROFILER_SCOPE(Profiler::SECTION_DIFFERENTIAL_DRIVE);
+        DifferentialDrive::getInstance().process(DIFFERENTIAL_DRIVE_CONTROL_PERIOD);
+    }
+
+    /* The odometry unit needs to detect motor speed changes to be able to
+     * calculate correct values. Therefore it shall be processed right after
+     * the differential drive control.
+     */
+    {
+        PROFILER_SCOPE(Profiler::SECTION_ODOMETRY);
+        Odometry::getInstance().process();
+    }
+
+#ifndef TARGET_NATIVE
+    /* In the simulation the time advances in steps, independent of the load.
+     * Therefore the slack is only observed on the target.
+     */
+    if (nullptr != application)
+    {
+        /* The slack is the remaining time from the end of the control until its
+         * deadline. The signed difference is negative, if the deadline was missed.
+         */
+        int32_t slack = static_cast<int32_t>(application->m_scheduler.getDeadline() - Timebase::now());
+
+        if (true == application->m_loadGovernor.update(slack))
+        {
+            application->applyDegradationLevel();
+        }
+    }
+#else  /* TARGET_NATIVE */
+    (void)application;
+#endif /* TARGET_NATIVE */
+}
+
+void App::proximityTask(void* userData)
+{
+    App* application = reinterpret_cast<App*>(userData);
+
+    if (nullptr != application)
+    {
+        application->readProximitySensors();
+    }
+}
+
+void App::reportTask(void* userData)
+{
+    App* application = reinterpret_cast<App*>(userData);
+
+    if ((nullptr != application) && (true == application->m_smpServer.isSynced()))
+    {
+        /* Send current data to SerialMuxProt Client */
+        application->reportVehicleData();
+    }
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+    else if (nullptr != application)
+    {
+        /* The client shall get a keyframe first, after it is synchronized again. */
+        application->m_vehicleDataBatch.reset();
+    }
+    else
+    {
+        ;
+    }
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
+}
+
+void App::statusTask(void* userData)
+{
+    App* application = reinterpret_cast<App*>(userData);
+
+    if ((nullptr != application) && (true == application->m_smpServer.isSynced()))
+    {
+        Status payload = {SMPChannelPayload::Status::STATUS_FLAG_OK, application->m_loadGovernor.getLevel()};
+
+        if (&ErrorState::getInstance() == application->m_systemStateMachine.getState())
+        {
+            payload.status = SMPChannelPayload::Status::STATUS_FLAG_ERROR;
+        }
+
+        /* Ignoring return value, as error handling is not available. */
+        (void)application->m_smpServer.sendData(application->m_serialMuxProtChannelIdStatus, &payload,
+                                                sizeof(payload));
+    }
+}
+
+void App::timeSyncTask(void* userData)
+{
+    App* application = reinterpret_cast<App*>(userData);
+
+    if ((nullptr != application) && (true == application->m_smpServer.isSynced()))
+    {
+        application->sendTimeSyncRequest();
+    }
+    else if (nullptr != application)
+    {
+        /* The DCS may be restarted, which invalidates the clock estimation. */
+        application->m_timeSync.reset();
+    }
+    else
+    {
+        ;
+    }
+}
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+void App::profileTask(void* userData)
+{
+    App* application = reinterpret_cast<App*>(userData);
+
+    /* Only a single section is sent per period to keep the channel load low. */
+    if ((nullptr != application) && (0U != application->m_serialMuxProtChannelIdProfile) &&
+        (true == application->m_smpServer.isSynced()))
+    {
+        Profiler::Section    section = static_cast<Profiler::Section>(application->m_profileSection);
+        Profiler::Statistics statistics;
+
+        if (true == Profiler::getStatistics(section, statistics))
+        {
+            ProfileData payload;
+            uint8_t     bin = 0U;
+
+            payload.section = section;
+            payload.count   = statistics.count;
+            payload.min     = statistics.min;
+            payload.max     = statistics.max;
+            payload.mean    = Profiler::getMean(statistics);
+
+            for (bin = 0U; bin < Profiler::HISTOGRAM_BINS; ++bin)
+            {
+                payload.histogram[bin] = statistics.histogram[bin];
+            }
+
+            /* Ignoring return value, as error handling is not available. */
+            (void)application->m_smpServer.sendData(application->m_serialMuxProtChannelIdProfile, &payload,
+                                                    sizeof(payload));
+
+            Profiler::reset(section);
+        }
+
+        ++application->m_profileSection;
+
+        if (Profiler::SECTION_COUNT <= application->m_profileSection)
+        {
+            application->m_profileSection = 0U;
+        }
+    }
+}
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+
+void App::lineSensorsTask(void* userData)
+{
+    App* application = reinterpret_cast<App*>(userData);
+
+    /* The line sensors data is not necessary for the control, therefore it is skipped if the deadline is at risk. */
+    if ((nullptr != application) && (LoadGovernor::LEVEL_MINIMAL > application->m_loadGovernor.getLevel()))
+    {
+        application->sendLineSensorsData();
+    }
+}
+
+void App::sendLineSensorsData()
 {
     ILineSensors&   lineSensors      = Board::getInstance().getLineSensors();
     uint8_t         maxLineSensors   = lineSensors.getNumLineSensors();
     const uint16_t* lineSensorValues = lineSensors.getSensorValues();
     uint8_t         lineSensorIdx    = 0U;
-    LineSensorData  payload;
 
-    if (LINE_SENSOR_CHANNEL_DLC == maxLineSensors * sizeof(uint16_t))
+#if (0 != CONFIG_LINE_SENSOR_BITMASK)
+    LineSensorBitmask payload = {0U};
+    uint16_t          lineSensorBits;
+
+    while ((maxLineSensors > lineSensorIdx) && (8U > lineSensorIdx))
+    {
+        if (m_lineSensorsThreshold <= lineSensorValues[lineSensorIdx])
+        {
+            payload.lineSensorBits |= static_cast<uint8_t>(1U << lineSensorIdx);
+        }
+
+        ++lineSensorIdx;
+    }
+
+    lineSensorBits = payload.lineSensorBits;
+
+    if (true == m_lineSensorsFilter.isSendRequired(millis(), &lineSensorBits))
     {
+        (void)m_smpServer.sendData(m_serialMuxProtChannelIdLineSensors, &payload, sizeof(payload));
+    }
+#else  /* (0 != CONFIG_LINE_SENSOR_BITMASK) */
+    /* The change filter needs all line sensor values, which are in the payload. */
+    if ((LINE_SENSOR_CHANNEL_DLC == maxLineSensors * sizeof(uint16_t)) &&
+        (true == m_lineSensorsFilter.isSendRequired(millis(), lineSensorValues)))
+    {
+        LineSensorData payload;
+
         while (maxLineSensors > lineSensorIdx)
         {
             payload.lineSensorData[lineSensorIdx] = lineSensorValues[lineSensorIdx];
 
             ++lineSensorIdx;
         }
-    }
 
-    (void)m_smpServer.sendData(m_serialMuxProtChannelIdLineSensors, &payload, sizeof(payload));
+        (void)m_smpServer.sendData(m_serialMuxProtChannelIdLineSensors, &payload, sizeof(payload));
+    }
+#endif /* (0 != CONFIG_LINE_SENSOR_BITMASK) */
 }
 
 /******************************************************************************
@@ -401,6 +876,28 @@ void App_motorSpeedSetpointsChannelCallback(const uint8_t* payload, const uint8_
     }
 }
 
+/**
+ * Receives the gap control setpoint over SerialMuxProt channel.
+ *
+ * @param[in] payload       Gap setpoint
+ * @param[in] payloadSize   Size of the gap setpoint
+ * @param[in] userData      User data
+ */
+void App_gapSetpointChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData)
+{
+    (void)userData;
+    if ((nullptr != payload) && (GAP_SETPOINT_CHANNEL_DLC == payloadSize))
+    {
+        const GapSetpoint* gapSetpoint = reinterpret_cast<const GapSetpoint*>(payload);
+        int32_t            leaderSpeed = gapSetpoint->leaderSpeed;
+
+        leaderSpeed = constrain(leaderSpeed, static_cast<int32_t>(INT16_MIN), static_cast<int32_t>(INT16_MAX));
+
+        DrivingState::getInstance().setGapTarget(static_cast<int16_t>(leaderSpeed), gapSetpoint->gap,
+                                                 gapSetpoint->timeGap);
+    }
+}
+
 /**
  * Receives current status of the DCS over SerialMuxProt channel.
  *
@@ -410,10 +907,83 @@ void App_motorSpeedSetpointsChannelCallback(const uint8_t* payload, const uint8_
  */
 void App_statusChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData)
 {
-    if ((nullptr != payload) && (STATUS_CHANNEL_DLC == payloadSize) && (nullptr != userData))
+    /* The degradation level is not evaluated. A peer, which sends only the status flag, is accepted too. */
+    if ((nullptr != payload) && (sizeof(SMPChannelPayload::Status) <= payloadSize) && (nullptr != userData))
     {
         const Status* currentStatus = reinterpret_cast<const Status*>(payload);
         App*          application   = reinterpret_cast<App*>(userData);
         application->systemStatusCallback(currentStatus->status);
     }
 }
+
+/**
+ * Receives the clock synchronization response of the DCS over SerialMuxProt channel.
+ *
+ * @param[in] payload       Clock synchronization response.
+ * @param[in] payloadSize   Size of the clock synchronization response.
+ * @param[in] userData      Instance of App class.
+ */
+void App_timeSyncResponseChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData)
+{
+    /* The receive timestamp shall be taken as early as possible. */
+    Timebase::Timestamp receiveTimestamp = Timebase::now();
+
+    if ((nullptr != payload) && (TIME_SYNC_RESPONSE_CHANNEL_DLC == payloadSize) && (nullptr != userData))
+    {
+        const TimeSyncResponse* response    = reinterpret_cast<const TimeSyncResponse*>(payload);
+        App*                    application = reinterpret_cast<App*>(userData);
+
+        application->handleTimeSyncResponse(*response, receiveTimestamp);
+    }
+}
+
+/**
+ * Receives parameter requests over SerialMuxProt channel.
+ *
+ * @param[in] payload       Parameter request.
+ * @param[in] payloadSize   Size of the parameter request.
+ * @param[in] userData      Instance of App class.
+ */
+void App_parameterChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData)
+{
+    if ((nullptr != payload) && (PARAMETER_CHANNEL_DLC == payloadSize) && (nullptr != userData))
+    {
+        const ParameterServer::Request* request     = reinterpret_cast<const ParameterServer::Request*>(payload);
+        App*                           application = reinterpret_cast<App*>(userData);
+
+        application->handleParameterRequest(*request);
+    }
+}
+
+/**
+ * Applies the parameters after a parameter was changed.
+ *
+ * @param[in] index     Index of the changed parameter.
+ * @param[in] userData  Instance of App class.
+ */
+void App_parameterChangeCallback(uint8_t index, void* userData)
+{
+    (void)index;
+
+    if (nullptr != userData)
+    {
+        App* application = reinterpret_cast<App*>(userData);
+
+        application->applyParameters();
+    }
+}
+
+/**
+ * Stores the persistent parameters on request of the DCS.
+ *
+ * @param[in] userData  Instance of App class.
+ */
+void App_parameterStoreCallback(void* userData)
+{
+    if (nullptr != userData)
+    {
+        App* application = reinterpret_cast<App*>(userData);
+
+        application->storeParameters();
+    }
+}
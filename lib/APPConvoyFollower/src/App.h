@@ -40,6 +40,23 @@
  * Compile Switches
  *****************************************************************************/
 
+#ifndef CONFIG_VEHICLE_DATA_BATCH
+/**
+ * Send the current vehicle data with a higher rate in batches on the "VEH_BATCH"
+ * channel, instead of single frames on the "CURR_DATA" channel.
+ * Disabled by default, because the existing hosts expect the "CURR_DATA" channel.
+ */
+#define CONFIG_VEHICLE_DATA_BATCH (0)
+#endif /* CONFIG_VEHICLE_DATA_BATCH */
+
+#ifndef CONFIG_LINE_SENSOR_BITMASK
+/**
+ * Send only whether the line sensors detect the line, as bitmask on the
+ * "LINE_BITS" channel, instead of the sensor values on the "LINE_SENS" channel.
+ */
+#define CONFIG_LINE_SENSOR_BITMASK (0)
+#endif /* CONFIG_LINE_SENSOR_BITMASK */
+
 /******************************************************************************
  * Includes
  *****************************************************************************/
@@ -47,7 +64,14 @@
 #include "SerialMuxChannels.h"
 #include <StateMachine.h>
 #include <SimpleTimer.h>
+#include <Scheduler.h>
+#include <LoadGovernor.h>
 #include <MovAvg.hpp>
+#include <DifferentialDrive.h>
+#include <ParameterRegistry.h>
+#include <ParameterServer.h>
+#include <TimeSync.h>
+#include <ChangeFilter.h>
 
 /******************************************************************************
  * Macros
@@ -97,30 +121,133 @@ public:
      */
     void systemStatusCallback(SMPChannelPayload::Status status);
 
+    /**
+     * Handle parameter request received via SerialMuxProt.
+     *
+     * @param[in] request   Parameter request to handle.
+     */
+    void handleParameterRequest(const ParameterServer::Request& request);
+
+    /**
+     * Apply the tunable parameters to their owners. It is called after a
+     * parameter was changed.
+     */
+    void applyParameters();
+
+    /**
+     * Store the persistent parameters in the settings.
+     */
+    void storeParameters();
+
+    /**
+     * Handle the clock synchronization response of the DCS.
+     *
+     * @param[in] response          Clock synchronization response.
+     * @param[in] receiveTimestamp  Local receive timestamp of the response in us.
+     */
+    void handleTimeSyncResponse(const TimeSyncResponse& response, Timebase::Timestamp receiveTimestamp);
+
 private:
     /** Differential drive control period in ms. */
     static const uint32_t DIFFERENTIAL_DRIVE_CONTROL_PERIOD = 5U;
 
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+    /** Current data sampling period in ms. The samples are reported in batches. */
+    static const uint32_t REPORTING_PERIOD = 10U;
+
+    /** Max. number of samples in a vehicle data batch, which limits the latency of the first sample. */
+    static const uint8_t VEHICLE_DATA_BATCH_SAMPLES = 5U;
+#else  /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
     /** Current data reporting period in ms. */
     static const uint32_t REPORTING_PERIOD = 50U;
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
 
     /** Baudrate for Serial Communication */
     static const uint32_t SERIAL_BAUDRATE = 115200U;
 
+    /** Task priority of the differential drive control, which shall always run first. */
+    static const uint8_t CONTROL_TASK_PRIORITY = Scheduler::PRIORITY_HIGHEST;
+
+    /** Task priority of reading the proximity sensors, which the gap control needs. */
+    static const uint8_t PROXIMITY_TASK_PRIORITY = CONTROL_TASK_PRIORITY + 1U;
+
+    /** Task priority of reporting the current vehicle data. */
+    static const uint8_t REPORT_TASK_PRIORITY = PROXIMITY_TASK_PRIORITY + 1U;
+
+    /** Task priority of sending the line sensors data. */
+    static const uint8_t LINE_SENSORS_TASK_PRIORITY = REPORT_TASK_PRIORITY + 1U;
+
+    /** Task priority of sending the system status. */
+    static const uint8_t STATUS_TASK_PRIORITY = LINE_SENSORS_TASK_PRIORITY + 1U;
+
+    /** Task priority of the clock synchronization with the DCS. */
+    static const uint8_t TIME_SYNC_TASK_PRIORITY = STATUS_TASK_PRIORITY + 1U;
+
+    /** Task priority of sending the profiler data. */
+    static const uint8_t PROFILE_TASK_PRIORITY = TIME_SYNC_TASK_PRIORITY + 1U;
+
+    /** Profiler data sending period in ms. */
+    static const uint32_t SEND_PROFILE_DATA_PERIOD = 100U;
+
+    /**
+     * Min. slack in us of the differential drive control. If the slack is
+     * too often lower, the telemetry is degraded.
+     */
+    static const int32_t MIN_CONTROL_SLACK = 3000;
+
     /** Send status timer interval in ms. */
     static const uint32_t SEND_STATUS_TIMER_INTERVAL = 1000U;
 
     /** Status timeout timer interval in ms. */
     static const uint32_t STATUS_TIMEOUT_TIMER_INTERVAL = 2U * SEND_STATUS_TIMER_INTERVAL;
 
-    /** Sending Data period in ms. */
-    static const uint32_t SEND_LINE_SENSORS_DATA_PERIOD = 20U;
+    /** Clock synchronization request period in ms. It is sufficient to follow the drift. */
+    static const uint32_t TIME_SYNC_PERIOD = 1000U;
+
+    /** Period in ms to check whether the line sensors data changed and shall be sent. */
+    static const uint32_t SEND_LINE_SENSORS_DATA_PERIOD = 10U;
+
+    /** Min. interval in ms between sending the line sensors data, which caps the link load. */
+    static const uint32_t LINE_SENSORS_MIN_SEND_INTERVAL = 20U;
+
+    /** Max. interval in ms between sending the line sensors data, even if nothing changed. */
+    static const uint32_t LINE_SENSORS_MAX_SEND_INTERVAL = 500U;
+
+#if (0 != CONFIG_LINE_SENSOR_BITMASK)
+    /** Default line sensor value in digits, from which on the line is detected. */
+    static const uint16_t LINE_SENSORS_THRESHOLD = 500U;
+
+    /** Max. line sensor value in digits, which is the upper bound of the tunable threshold. */
+    static const uint16_t LINE_SENSORS_VALUE_MAX = 1000U;
+
+    /** Number of values, which are checked for a change. Only the bitmask. */
+    static const uint8_t LINE_SENSORS_FILTER_VALUES = 1U;
+
+    /** Every change of the bitmask is sent. */
+    static const uint16_t LINE_SENSORS_DEADBAND = 0U;
+#else  /* (0 != CONFIG_LINE_SENSOR_BITMASK) */
+    /** Number of values, which are checked for a change. All line sensors. */
+    static const uint8_t LINE_SENSORS_FILTER_VALUES = sizeof(LineSensorData) / sizeof(uint16_t);
+
+    /** Max. change of a single line sensor value in digits, which is not sent. */
+    static const uint16_t LINE_SENSORS_DEADBAND = 20U;
+#endif /* (0 != CONFIG_LINE_SENSOR_BITMASK) */
 
     /**
      * Number of measurements for proximity sensors moving average filter.
      */
     static const uint8_t MOVAVG_PROXIMITY_SENSOR_NUM_MEASUREMENTS = 3U;
 
+    /**
+     * Proximity sensors reading period in ms. Reading them takes several ms,
+     * therefore it is done less often than the gap control runs. The period
+     * is never degraded, because the gap control depends on it.
+     */
+    static const uint32_t PROXIMITY_READ_PERIOD = 50U;
+
+    /** Upper bound of the tunable PID factor numerators and denominators. */
+    static const int16_t MAX_PID_FACTOR = 1000;
+
     /** SerialMuxProt Channel id for sending remote control command responses. */
     uint8_t m_serialMuxProtChannelIdRemoteCtrlRsp;
 
@@ -130,38 +257,83 @@ private:
     /** SerialMuxProt Channel id for sending system status. */
     uint8_t m_serialMuxProtChannelIdStatus;
 
+    /** SerialMuxProt Channel id for sending clock synchronization requests. */
+    uint8_t m_serialMuxProtChannelIdTimeSync;
+
+    /** SerialMuxProt Channel id for sending parameter responses. */
+    uint8_t m_serialMuxProtChannelIdParameterRsp;
+
     /** SerialMuxProt Channel id for sending line sensors data. */
     uint8_t m_serialMuxProtChannelIdLineSensors;
 
     /** The system state machine. */
     StateMachine m_systemStateMachine;
 
-    /** Timer used for differential drive control processing. */
-    SimpleTimer m_controlInterval;
+    /** Scheduler for the periodic tasks. */
+    Scheduler m_scheduler;
 
-    /** Timer for reporting current data through SerialMuxProt. */
-    SimpleTimer m_reportTimer;
+    /** Load governor, which degrades the telemetry if the control deadline is at risk. */
+    LoadGovernor m_loadGovernor;
 
-    /** Timer for sending system status to DCS. */
-    SimpleTimer m_statusTimer;
+    /** Task id of reporting the current vehicle data. */
+    uint8_t m_reportTaskId;
+
+    /** Task id of sending the line sensors data. */
+    uint8_t m_lineSensorsTaskId;
 
     /** Timer for timeout of system status of DCS. */
     SimpleTimer m_statusTimeoutTimer;
 
-    /** Timer used for sending data periodically. */
-    SimpleTimer m_sendLineSensorsDataInterval;
-
     /** SerialMuxProt Server Instance. */
     SMPServer m_smpServer;
 
+    /** Clock synchronization with the DCS. */
+    TimeSync m_timeSync;
+
+    /** Registry of the parameters, which can be tuned at runtime. */
+    ParameterRegistry m_parameterRegistry;
+
+    /** Server of the parameter protocol on the parameter channels. */
+    ParameterServer m_parameterServer;
+
+    /** Tunable PID factors of the motor speed control. */
+    DifferentialDrive::PIDFactors m_speedPIDFactors;
+
+    /** Tunable max. motor speed in [steps/s], which is persistent in the settings. */
+    int16_t m_maxMotorSpeed;
+
+#if (0 != CONFIG_LINE_SENSOR_BITMASK)
+    /** Tunable line sensor value in digits, from which on the line is detected. */
+    uint16_t m_lineSensorsThreshold;
+#endif /* (0 != CONFIG_LINE_SENSOR_BITMASK) */
+
     /** Indicates whether the line sensor calibration is pending or not. */
     bool m_isLineSensorCalibPending;
 
+    /** Decides whether the line sensors data changed enough to be sent. */
+    ChangeFilter m_lineSensorsFilter;
+
     /**
      * Moving average filter for proximity sensors.
      */
     MovAvg<uint8_t, uint16_t, MOVAVG_PROXIMITY_SENSOR_NUM_MEASUREMENTS> m_movAvgProximitySensor;
 
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+    /** Batch of vehicle data samples, which is under construction. */
+    TelemetryBatch m_vehicleDataBatch;
+
+    /** Time base of the vehicle data batch: Offset of the DCS time to the local time in ms. */
+    int32_t m_vehicleDataTimeBase;
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+    /** SerialMuxProt Channel id for sending the profiler data. */
+    uint8_t m_serialMuxProtChannelIdProfile;
+
+    /** Profiler section, which is sent next. */
+    uint8_t m_profileSection;
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+
     /**
      * Report the current vehicle data.
      * Report the current position and heading of the robot using the Odometry data.
@@ -170,6 +342,26 @@ private:
      */
     void reportVehicleData();
 
+    /**
+     * Read the proximity sensors and update the filtered range.
+     */
+    void readProximitySensors();
+
+    /**
+     * Get the gap to the vehicle ahead, derived from the filtered proximity sensor range.
+     *
+     * @return Gap in [mm] or GapController::GAP_UNKNOWN, if no object is detected.
+     */
+    uint16_t getProximityGap() const;
+
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+    /**
+     * Send the batch of vehicle data samples via SerialMuxProt, if it is not empty,
+     * and start the next one.
+     */
+    void sendVehicleDataBatch();
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
+
     /**
      * Setup the SerialMuxProt channels.
      *
@@ -178,9 +370,95 @@ private:
     bool setupSerialMuxProt();
 
     /**
-     * Send line sensors data via SerialMuxProt.
+     * Register the parameters, which can be tuned at runtime.
+     *
+     * @return If successful returns true, otherwise false.
+     */
+    bool setupParameters();
+
+    /**
+     * Update the tunable parameters from their owners, which may change them too.
+     */
+    void updateParameters();
+
+    /**
+     * Send the next clock synchronization request to the DCS. It contains the
+     * current clock estimation too.
+     */
+    void sendTimeSyncRequest();
+
+    /**
+     * Setup the scheduler with all periodic tasks and start it.
+     *
+     * @return If successful returns true, otherwise false.
+     */
+    bool setupScheduler();
+
+    /**
+     * Adapt the telemetry to the current degradation level of the load governor.
+     */
+    void applyDegradationLevel();
+
+    /**
+     * Periodic differential drive control task.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void controlTask(void* userData);
+
+    /**
+     * Periodic task to read the proximity sensors. It runs independent of the
+     * SerialMuxProt link and of the telemetry degradation, because the gap
+     * control uses the range.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void proximityTask(void* userData);
+
+    /**
+     * Periodic task to report the current vehicle data.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void reportTask(void* userData);
+
+    /**
+     * Periodic task to send the system status to the DCS.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void statusTask(void* userData);
+
+    /**
+     * Periodic task to synchronize the clock with the DCS. It runs independent
+     * of the status and is never degraded, because the timestamps of the
+     * vehicle data depend on it.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void timeSyncTask(void* userData);
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+    /**
+     * Periodic task to send the statistics of a single profiler section.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void profileTask(void* userData);
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+
+    /**
+     * Periodic task to send the line sensors data.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void lineSensorsTask(void* userData);
+
+    /**
+     * Send line sensors data via SerialMuxProt, if it changed or wasn't sent
+     * for a while.
      */
-    void sendLineSensorsData() const;
+    void sendLineSensorsData();
 
     /**
      * Copy construction of an instance.
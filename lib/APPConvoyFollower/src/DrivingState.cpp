@@ -35,6 +35,8 @@
 #include "DrivingState.h"
 #include <StateMachine.h>
 #include <DifferentialDrive.h>
+#include <Speedometer.h>
+#include <Util.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -64,7 +66,11 @@ void DrivingState::entry()
 {
     DifferentialDrive& diffDrive = DifferentialDrive::getInstance();
 
-    m_isActive = true;
+    m_isActive            = true;
+    m_isGapControlEnabled = false;
+    m_steeringSpeed       = 0;
+    m_gapController.setMaxSpeed(
+        static_cast<int16_t>(Util::stepsPerSecondToMillimetersPerSecond(diffDrive.getMaxMotorSpeed())));
     diffDrive.setLinearSpeed(0, 0);
     diffDrive.enable();
 }
@@ -79,7 +85,8 @@ void DrivingState::exit()
 {
     DifferentialDrive& diffDrive = DifferentialDrive::getInstance();
 
-    m_isActive = false;
+    m_isActive            = false;
+    m_isGapControlEnabled = false;
 
     /* Stop motors. */
     diffDrive.setLinearSpeed(0, 0);
@@ -90,7 +97,54 @@ void DrivingState::setTargetSpeeds(int16_t leftMotor, int16_t rightMotor)
 {
     if (true == m_isActive)
     {
-        DifferentialDrive::getInstance().setLinearSpeed(leftMotor, rightMotor);
+        if (true == m_isGapControlEnabled)
+        {
+            /* The speed is controlled onboard, only the steering is used. */
+            m_steeringSpeed = static_cast<int16_t>((static_cast<int32_t>(rightMotor) - leftMotor) / 2);
+        }
+        else
+        {
+            DifferentialDrive::getInstance().setLinearSpeed(leftMotor, rightMotor);
+        }
+    }
+}
+
+void DrivingState::setGapTarget(int16_t leaderSpeed, uint16_t standstillGap, uint16_t timeGap)
+{
+    if (true == m_isActive)
+    {
+        if (0U == standstillGap)
+        {
+            if (true == m_isGapControlEnabled)
+            {
+                /* Stop until the next speed setpoints are received. */
+                DifferentialDrive::getInstance().setLinearSpeed(0, 0);
+                m_isGapControlEnabled = false;
+            }
+        }
+        else
+        {
+            if (false == m_isGapControlEnabled)
+            {
+                m_gapController.reset();
+                m_steeringSpeed       = 0;
+                m_isGapControlEnabled = true;
+            }
+
+            m_gapController.setTarget(leaderSpeed, standstillGap, timeGap);
+        }
+    }
+}
+
+void DrivingState::processGapControl(uint16_t gap)
+{
+    if ((true == m_isActive) && (true == m_isGapControlEnabled))
+    {
+        int16_t ownSpeed = static_cast<int16_t>(
+            Util::stepsPerSecondToMillimetersPerSecond(Speedometer::getInstance().getLinearSpeedCenter()));
+        int16_t centerSpeed = Util::millimetersPerSecondToStepsPerSecond(m_gapController.process(gap, ownSpeed));
+
+        DifferentialDrive::getInstance().setLinearSpeed(centerSpeed - m_steeringSpeed, centerSpeed + m_steeringSpeed);
     }
 }
 
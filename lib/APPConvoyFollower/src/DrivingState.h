@@ -46,6 +46,7 @@
 #include <stdint.h>
 #include <IState.h>
 #include <SimpleTimer.h>
+#include <GapController.h>
 
 /******************************************************************************
  * Macros
@@ -98,15 +99,64 @@ public:
      */
     void setTargetSpeeds(int16_t leftMotor, int16_t rightMotor);
 
+    /**
+     * Set the target of the onboard gap control.
+     * In gap control mode the speed is controlled by the follower itself and
+     * only the steering is taken from the target motor speeds.
+     *
+     * @param[in] leaderSpeed   Speed of the vehicle ahead in [mm/s].
+     * @param[in] standstillGap Desired gap at standstill in [mm]. 0 disables the gap control.
+     * @param[in] timeGap       Desired time gap in [ms].
+     */
+    void setGapTarget(int16_t leaderSpeed, uint16_t standstillGap, uint16_t timeGap);
+
+    /**
+     * Is the onboard gap control enabled?
+     *
+     * @return If enabled, it will return true otherwise false.
+     */
+    bool isGapControlEnabled() const
+    {
+        return m_isGapControlEnabled;
+    }
+
+    /**
+     * Process the onboard gap control. It shall be called every control period
+     * before the differential drive is processed.
+     *
+     * @param[in] gap   Measured gap to the vehicle ahead in [mm] or GapController::GAP_UNKNOWN.
+     */
+    void processGapControl(uint16_t gap);
+
 protected:
 private:
+    /** Gap control period in ms. Shall be the same as the differential drive control period. */
+    static const uint32_t GAP_CONTROL_PERIOD = 5U;
+
+    /** Max. gap in mm, which the proximity sensors can measure. */
+    static const uint16_t MAX_MEASURABLE_GAP = 300U;
+
     /** Flag: State is active. */
     bool m_isActive;
 
+    /** Flag: The onboard gap control is enabled. */
+    bool m_isGapControlEnabled;
+
+    /** Gap controller, used in gap control mode. */
+    GapController m_gapController;
+
+    /** Steering part of the target motor speeds in [steps/s], used in gap control mode. */
+    int16_t m_steeringSpeed;
+
     /**
      * Default constructor.
      */
-    DrivingState() : IState(), m_isActive(false)
+    DrivingState() :
+        IState(),
+        m_isActive(false),
+        m_isGapControlEnabled(false),
+        m_gapController(GAP_CONTROL_PERIOD, MAX_MEASURABLE_GAP),
+        m_steeringSpeed(0)
     {
     }
 
@@ -32,12 +32,27 @@
 #ifndef SERIAL_MUX_CHANNELS_H_
 #define SERIAL_MUX_CHANNELS_H_
 
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/**
+ * Add the DCS timestamp to the "Current Vehicle Data" channel payload.
+ * It requires the clock synchronization with the DCS.
+ */
+#ifndef CONFIG_VEHICLE_DATA_TIMESTAMP
+#define CONFIG_VEHICLE_DATA_TIMESTAMP (0)
+#endif /* CONFIG_VEHICLE_DATA_TIMESTAMP */
+
 /******************************************************************************
  * Includes
  *****************************************************************************/
 
 #include <Arduino.h>
 #include <SerialMuxProtServer.hpp>
+#include <Profiler.h>
+#include <TelemetryBatch.h>
+#include <ParameterServer.h>
 
 /******************************************************************************
  * Macros
@@ -64,12 +79,28 @@
 /** DLC of Speedometer Channel */
 #define SPEED_SETPOINT_CHANNEL_DLC (sizeof(SpeedData))
 
+/** Name of Channel to receive the gap control setpoint from. */
+#define GAP_SETPOINT_CHANNEL_NAME "GAP_SET"
+
+/** DLC of Gap Setpoint Channel */
+#define GAP_SETPOINT_CHANNEL_DLC (sizeof(GapSetpoint))
+
 /** Name of Channel to send Current Vehicle Data to. */
 #define CURRENT_VEHICLE_DATA_CHANNEL_NAME "CURR_DATA"
 
 /** DLC of Current Vehicle Data Channel */
 #define CURRENT_VEHICLE_DATA_CHANNEL_DLC (sizeof(VehicleData))
 
+/** Name of Channel to send batched Vehicle Data samples to. */
+#define VEHICLE_DATA_BATCH_CHANNEL_NAME "VEH_BATCH"
+
+/**
+ * DLC of Vehicle Data Batch Channel, see TelemetryBatch for the frame format.
+ * The timestamps are in DCS time [ms], if the clock is synchronized, otherwise in robot time [ms].
+ * They are derived from the us clock and therefore wrap around after 2^32 us (~71.6 min).
+ */
+#define VEHICLE_DATA_BATCH_CHANNEL_DLC (TelemetryBatch::FRAME_SIZE)
+
 /** Name of Channel to send system status to. */
 #define STATUS_CHANNEL_NAME "STATUS"
 
@@ -82,6 +113,42 @@
 /** DLC of Line Sensor Channel */
 #define LINE_SENSOR_CHANNEL_DLC (sizeof(LineSensorData))
 
+/** Name of the Channel to receive the Line Sensor Bitmask from. */
+#define LINE_SENSOR_BITMASK_CHANNEL_NAME "LINE_BITS"
+
+/** DLC of Line Sensor Bitmask Channel */
+#define LINE_SENSOR_BITMASK_CHANNEL_DLC (sizeof(LineSensorBitmask))
+
+/** Name of Channel to send profiler data to. */
+#define PROFILE_CHANNEL_NAME "PROFILE"
+
+/** DLC of Profile Channel */
+#define PROFILE_CHANNEL_DLC (sizeof(ProfileData))
+
+/** Name of Channel to send clock synchronization requests to. */
+#define TIME_SYNC_REQUEST_CHANNEL_NAME "TIME_REQ"
+
+/** DLC of Time Sync Request Channel */
+#define TIME_SYNC_REQUEST_CHANNEL_DLC (sizeof(TimeSyncRequest))
+
+/** Name of Channel to receive clock synchronization responses from. */
+#define TIME_SYNC_RESPONSE_CHANNEL_NAME "TIME_RSP"
+
+/** DLC of Time Sync Response Channel */
+#define TIME_SYNC_RESPONSE_CHANNEL_DLC (sizeof(TimeSyncResponse))
+
+/** Name of Channel to receive parameter requests from. */
+#define PARAMETER_CHANNEL_NAME "PARAM"
+
+/** DLC of Parameter Channel */
+#define PARAMETER_CHANNEL_DLC (sizeof(ParameterServer::Request))
+
+/** Name of Channel to send parameter responses to. */
+#define PARAMETER_RESPONSE_CHANNEL_NAME "PARAM_RSP"
+
+/** DLC of Parameter Response Channel */
+#define PARAMETER_RESPONSE_CHANNEL_DLC (sizeof(ParameterServer::Response))
+
 /******************************************************************************
  * Types and Classes
  *****************************************************************************/
@@ -139,6 +206,20 @@ namespace SMPChannelPayload
 
     } Range; /**< Proximity Sensor Ranges */
 
+    /** Values of a single sample in the "Vehicle Data Batch" channel, in this order. */
+    typedef enum : uint8_t
+    {
+        VEHICLE_DATA_X_POS = 0,   /**< X position [mm]. */
+        VEHICLE_DATA_Y_POS,       /**< Y position [mm]. */
+        VEHICLE_DATA_ORIENTATION, /**< Orientation [mrad]. */
+        VEHICLE_DATA_LEFT,        /**< Left motor speed [mm/s]. */
+        VEHICLE_DATA_RIGHT,       /**< Right motor speed [mm/s]. */
+        VEHICLE_DATA_CENTER,      /**< Center speed [mm/s]. */
+        VEHICLE_DATA_PROXIMITY,   /**< Range at which object is found [range]. */
+        VEHICLE_DATA_VALUE_COUNT  /**< Number of values per sample. */
+
+    } VehicleDataValue; /**< Vehicle data sample value */
+
 } /* namespace SMPChannelPayload */
 
 /** Struct of the "Command" channel payload. */
@@ -181,6 +262,14 @@ typedef struct _SpeedData
     int32_t center; /**< Center motor speed [mm/s] */
 } __attribute__((packed)) SpeedData;
 
+/** Struct of the "Gap Setpoint" channel payload. */
+typedef struct _GapSetpoint
+{
+    int32_t  leaderSpeed; /**< Speed of the vehicle ahead [mm/s]. */
+    uint16_t gap;         /**< Desired gap at standstill [mm]. 0 disables the onboard gap control. */
+    uint16_t timeGap;     /**< Desired time gap [ms]. */
+} __attribute__((packed)) GapSetpoint;
+
 /** Struct of the "Current Vehicle Data" channel payload. */
 typedef struct _VehicleData
 {
@@ -191,12 +280,16 @@ typedef struct _VehicleData
     int32_t                  right;       /**< Right motor speed [mm/s]. */
     int32_t                  center;      /**< Center speed [mm/s]. */
     SMPChannelPayload::Range proximity;   /**< Range at which object is found [range]. */
+#if (0 != CONFIG_VEHICLE_DATA_TIMESTAMP)
+    uint32_t timestamp; /**< Sample timestamp in DCS time [us]. 0 if the clock is not synchronized. */
+#endif                  /* (0 != CONFIG_VEHICLE_DATA_TIMESTAMP) */
 } __attribute__((packed)) VehicleData;
 
 /** Struct of the "Status" channel payload. */
 typedef struct _Status
 {
-    SMPChannelPayload::Status status; /**< Status */
+    SMPChannelPayload::Status status;      /**< Status */
+    uint8_t                   degradation; /**< Telemetry degradation level, see LoadGovernor::Level. */
 } __attribute__((packed)) Status;
 
 /** Struct of the "Line Sensor" channel payload. */
@@ -205,6 +298,47 @@ typedef struct _LineSensorData
     uint16_t lineSensorData[5U]; /**< Line sensor data [digits] normalized to max 1000 digits. */
 } __attribute__((packed)) LineSensorData;
 
+/** Struct of the "Line Sensor Bitmask" channel payload. */
+typedef struct _LineSensorBitmask
+{
+    uint8_t lineSensorBits; /**< Bit n is set, if line sensor n detects the line. */
+} __attribute__((packed)) LineSensorBitmask;
+
+/** Struct of the "Profile" channel payload. */
+typedef struct _ProfileData
+{
+    uint8_t  section;                             /**< Profiler section, see Profiler::Section. */
+    uint16_t count;                               /**< Number of measurements. */
+    uint16_t min;                                 /**< Min. execution time [us]. */
+    uint16_t max;                                 /**< Max. execution time [us]. */
+    uint16_t mean;                                /**< Mean execution time [us]. */
+    uint16_t histogram[Profiler::HISTOGRAM_BINS]; /**< Number of measurements per histogram bin. */
+} __attribute__((packed)) ProfileData;
+
+/**
+ * Struct of the "Time Sync Request" channel payload.
+ * Besides the request, it contains the current clock estimation of the robot,
+ * which allows the DCS to convert robot timestamps to DCS time.
+ */
+typedef struct _TimeSyncRequest
+{
+    uint8_t  sequence;          /**< Sequence number, which is mirrored by the response. */
+    uint32_t transmitTimestamp; /**< T1: Transmit timestamp in robot time [us]. */
+    uint8_t  isSynced;          /**< 1 if the following estimation is valid, otherwise 0. */
+    uint32_t offset;            /**< Clock offset (DCS - robot) [us]. */
+    int32_t  drift;             /**< Drift of the DCS clock relative to the robot clock [ppm]. */
+    uint32_t syncTimestamp;     /**< Robot timestamp of the estimation [us]. */
+} __attribute__((packed)) TimeSyncRequest;
+
+/** Struct of the "Time Sync Response" channel payload. */
+typedef struct _TimeSyncResponse
+{
+    uint8_t  sequence;          /**< Sequence number of the request. */
+    uint32_t originTimestamp;   /**< T1: Transmit timestamp of the request in robot time [us]. */
+    uint32_t receiveTimestamp;  /**< T2: Receive timestamp of the request in DCS time [us]. */
+    uint32_t transmitTimestamp; /**< T3: Transmit timestamp of the response in DCS time [us]. */
+} __attribute__((packed)) TimeSyncResponse;
+
 /******************************************************************************
  * Functions
  *****************************************************************************/
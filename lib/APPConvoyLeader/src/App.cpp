@@ -39,10 +39,12 @@
 #include "ParameterSets.h"
 #include <Board.h>
 #include <Speedometer.h>
+#include <Profiler.h>
 #include <DifferentialDrive.h>
 #include <Odometry.h>
 #include <Logging.h>
 #include <Util.h>
+#include <Sound.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -63,6 +65,10 @@
 static void App_cmdChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData);
 static void App_motorSpeedSetpointsChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData);
 static void App_statusChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData);
+static void App_timeSyncResponseChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData);
+static void App_parameterChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData);
+static void App_parameterChangeCallback(uint8_t index, void* userData);
+static void App_parameterStoreCallback(void* userData);
 
 /******************************************************************************
  * Local Variables
@@ -100,60 +106,42 @@ void App::setup()
         ErrorState::getInstance().setErrorMsg("SMP=0");
         m_systemStateMachine.setState(&ErrorState::getInstance());
     }
+    else if (false == setupParameters())
+    {
+        ErrorState::getInstance().setErrorMsg("PAR=0");
+        m_systemStateMachine.setState(&ErrorState::getInstance());
+    }
+    else if (false == setupScheduler())
+    {
+        ErrorState::getInstance().setErrorMsg("SCH=0");
+        m_systemStateMachine.setState(&ErrorState::getInstance());
+    }
     else
     {
-        m_reportTimer.start(REPORTING_PERIOD);
-        m_controlInterval.start(DIFFERENTIAL_DRIVE_CONTROL_PERIOD);
-        m_statusTimer.start(SEND_STATUS_TIMER_INTERVAL);
         m_systemStateMachine.setState(&StartupState::getInstance());
     }
 }
 
 void App::loop()
 {
-    Board::getInstance().process();
-    Speedometer::getInstance().process();
-
-    if (true == m_controlInterval.isTimeout())
     {
-        /* The differential drive control needs the measured speed of the
-         * left and right wheel. Therefore it shall be processed after
-         * the speedometer.
-         */
-        DifferentialDrive::getInstance().process(DIFFERENTIAL_DRIVE_CONTROL_PERIOD);
-
-        /* The odometry unit needs to detect motor speed changes to be able to
-         * calculate correct values. Therefore it shall be processed right after
-         * the differential drive control.
-         */
-        Odometry::getInstance().process();
-
-        m_controlInterval.restart();
+        PROFILER_SCOPE(Profiler::SECTION_BOARD);
+        Board::getInstance().process();
     }
 
-    if ((true == m_reportTimer.isTimeout()) && (true == m_smpServer.isSynced()))
-    {
-        /* Send current data to SerialMuxProt Client */
-        reportVehicleData();
-
-        m_reportTimer.restart();
-    }
+    /* Play the queued tones without blocking. */
+    Sound::process();
 
-    if ((true == m_statusTimer.isTimeout()) && (true == m_smpServer.isSynced()))
     {
-        Status payload = {SMPChannelPayload::Status::STATUS_FLAG_OK};
-
-        if (&ErrorState::getInstance() == m_systemStateMachine.getState())
-        {
-            payload.status = SMPChannelPayload::Status::STATUS_FLAG_ERROR;
-        }
-
-        /* Ignoring return value, as error handling is not available. */
-        (void)m_smpServer.sendData(m_serialMuxProtChannelIdStatus, &payload, sizeof(payload));
-
-        m_statusTimer.restart();
+        PROFILER_SCOPE(Profiler::SECTION_SPEEDOMETER);
+        Speedometer::getInstance().process();
     }
 
+    /* The scheduler runs the differential drive control first, because it has
+     * the highest priority. It needs the measured speed of the speedometer.
+     */
+    m_scheduler.process();
+
     if ((false == m_statusTimeoutTimer.isRunning()) && (true == m_smpServer.isSynced()))
     {
         /* Start status timeout timer once SMP is synced the first time. */
@@ -171,9 +159,15 @@ void App::loop()
         /* Nothing to do. */
     }
 
-    m_smpServer.process(millis());
+    {
+        PROFILER_SCOPE(Profiler::SECTION_SMP);
+        m_smpServer.process(millis());
+    }
 
-    m_systemStateMachine.process();
+    {
+        PROFILER_SCOPE(Profiler::SECTION_STATE_MACHINE);
+        m_systemStateMachine.process();
+    }
 }
 
 void App::handleRemoteCommand(const Command& cmd)
@@ -227,6 +221,39 @@ void App::systemStatusCallback(SMPChannelPayload::Status status)
     m_statusTimeoutTimer.start(STATUS_TIMEOUT_TIMER_INTERVAL);
 }
 
+void App::handleParameterRequest(const ParameterServer::Request& request)
+{
+    ParameterServer::Response response;
+
+    /* The owners may have changed the parameters since the last request. */
+    updateParameters();
+
+    m_parameterServer.handleRequest(request, response);
+
+    /* Ignoring return value, as error handling is not available. */
+    (void)m_smpServer.sendData(m_serialMuxProtChannelIdParameterRsp, &response, sizeof(response));
+}
+
+void App::applyParameters()
+{
+    DifferentialDrive& diffDrive = DifferentialDrive::getInstance();
+
+    diffDrive.setPIDFactors(m_speedPIDFactors);
+    diffDrive.setMaxMotorSpeed(m_maxMotorSpeed);
+
+    DrivingState::getInstance().setMaxDistance(static_cast<uint32_t>(m_maxDistance));
+
+    /* The parameter set is changed directly by the registry. */
+    DrivingState::getInstance().applyParameterSet();
+}
+
+void App::handleTimeSyncResponse(const TimeSyncResponse& response, Timebase::Timestamp receiveTimestamp)
+{
+    /* A late or duplicated response is rejected by the time synchronization. */
+    (void)m_timeSync.processResponse(response.sequence, response.originTimestamp, response.receiveTimestamp,
+                                     response.transmitTimestamp, receiveTimestamp);
+}
+
 /******************************************************************************
  * Protected Methods
  *****************************************************************************/
@@ -237,40 +264,151 @@ void App::systemStatusCallback(SMPChannelPayload::Status status)
 
 void App::reportVehicleData()
 {
-    IProximitySensors& proximitySensors = Board::getInstance().getProximitySensors();
-    Odometry&          odometry         = Odometry::getInstance();
-    Speedometer&       speedometer      = Speedometer::getInstance();
-    VehicleData        payload;
-    int32_t            xPos          = 0;
-    int32_t            yPos          = 0;
-    uint8_t            maxCounts     = 0U;
-    uint8_t            averageCounts = 0U;
-    uint8_t            leftCounts    = 0U;
-    uint8_t            rightCounts   = 0U;
-    int16_t            leftSpeed     = speedometer.getLinearSpeedLeft();
-    int16_t            rightSpeed    = speedometer.getLinearSpeedRight();
-    int16_t            centerSpeed   = speedometer.getLinearSpeedCenter();
-
-    proximitySensors.read();
-    leftCounts  = proximitySensors.countsFrontWithLeftLeds();
-    rightCounts = proximitySensors.countsFrontWithRightLeds();
-
-    /* Use the sensor value with the maximum counts. */
-    maxCounts     = leftCounts > rightCounts ? leftCounts : rightCounts;
-    averageCounts = m_movAvgProximitySensor.write(maxCounts);
+    Odometry&    odometry    = Odometry::getInstance();
+    Speedometer& speedometer = Speedometer::getInstance();
+    int32_t      xPos        = 0;
+    int32_t      yPos        = 0;
+    int16_t      leftSpeed   = speedometer.getLinearSpeedLeft();
+    int16_t      rightSpeed  = speedometer.getLinearSpeedRight();
+    int16_t      centerSpeed = speedometer.getLinearSpeedCenter();
+
+    if (0U < m_proximityReadCountdown)
+    {
+        --m_proximityReadCountdown;
+    }
+    else
+    {
+        IProximitySensors& proximitySensors = Board::getInstance().getProximitySensors();
+        uint8_t            maxCounts        = 0U;
+        uint8_t            leftCounts       = 0U;
+        uint8_t            rightCounts      = 0U;
+
+        proximitySensors.read();
+        leftCounts  = proximitySensors.countsFrontWithLeftLeds();
+        rightCounts = proximitySensors.countsFrontWithRightLeds();
+
+        /* Use the sensor value with the maximum counts. */
+        maxCounts = leftCounts > rightCounts ? leftCounts : rightCounts;
+        (void)m_movAvgProximitySensor.write(maxCounts);
+
+        m_proximityReadCountdown = (PROXIMITY_READ_PERIOD / REPORTING_PERIOD) - 1U;
+    }
 
     odometry.getPosition(xPos, yPos);
+
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+    int32_t  values[SMPChannelPayload::VEHICLE_DATA_VALUE_COUNT];
+    int32_t  timeBase = 0;
+    uint32_t timestamp;
+
+    /* The samples are stamped in DCS time like the single vehicle data, but in ms.
+     * The DCS time in us wraps around after 71 min, therefore the local time in ms
+     * is shifted by the clock offset. The offset is only known modulo 2^32 us,
+     * but that keeps the timestamps monotonic as long as the time base is equal.
+     */
+    if (true == m_timeSync.isSynced())
+    {
+        timeBase = static_cast<int32_t>(m_timeSync.getOffset()) / static_cast<int32_t>(Timebase::US_PER_MS);
+    }
+
+    /* The time differences in a batch can't express a jump of the time base. */
+    if (timeBase != m_vehicleDataTimeBase)
+    {
+        sendVehicleDataBatch();
+        m_vehicleDataBatch.startKeyframe();
+        m_vehicleDataTimeBase = timeBase;
+    }
+
+    timestamp = millis() + static_cast<uint32_t>(timeBase);
+
+    values[SMPChannelPayload::VEHICLE_DATA_X_POS]       = xPos;
+    values[SMPChannelPayload::VEHICLE_DATA_Y_POS]       = yPos;
+    values[SMPChannelPayload::VEHICLE_DATA_ORIENTATION] = odometry.getOrientation();
+    values[SMPChannelPayload::VEHICLE_DATA_LEFT]        = Util::stepsPerSecondToMillimetersPerSecond(leftSpeed);
+    values[SMPChannelPayload::VEHICLE_DATA_RIGHT]       = Util::stepsPerSecondToMillimetersPerSecond(rightSpeed);
+    values[SMPChannelPayload::VEHICLE_DATA_CENTER]      = Util::stepsPerSecondToMillimetersPerSecond(centerSpeed);
+    values[SMPChannelPayload::VEHICLE_DATA_PROXIMITY]   = m_movAvgProximitySensor.getResult();
+
+    /* If the batch is full, send it and add the sample to the next one. */
+    if (false == m_vehicleDataBatch.addSample(timestamp, values))
+    {
+        sendVehicleDataBatch();
+        (void)m_vehicleDataBatch.addSample(timestamp, values);
+    }
+
+    if (VEHICLE_DATA_BATCH_SAMPLES <= m_vehicleDataBatch.getSampleCount())
+    {
+        sendVehicleDataBatch();
+    }
+#else  /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
+    VehicleData payload;
+
     payload.xPos        = xPos;
     payload.yPos        = yPos;
     payload.orientation = odometry.getOrientation();
     payload.left        = Util::stepsPerSecondToMillimetersPerSecond(leftSpeed);
     payload.right       = Util::stepsPerSecondToMillimetersPerSecond(rightSpeed);
     payload.center      = Util::stepsPerSecondToMillimetersPerSecond(centerSpeed);
-    payload.proximity   = static_cast<SMPChannelPayload::Range>(averageCounts);
+    payload.proximity   = static_cast<SMPChannelPayload::Range>(m_movAvgProximitySensor.getResult());
+#if (0 != CONFIG_VEHICLE_DATA_TIMESTAMP)
+    payload.timestamp = (true == m_timeSync.isSynced()) ? m_timeSync.toPeerTime(Timebase::now()) : 0U;
+#endif /* (0 != CONFIG_VEHICLE_DATA_TIMESTAMP) */
 
     /* Ignoring return value, as error handling is not available. */
     (void)m_smpServer.sendData(m_serialMuxProtChannelIdCurrentVehicleData, &payload, sizeof(VehicleData));
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
+}
+
+void App::sendSpeedPreview()
+{
+    if (0U < m_speedPreviewCountdown)
+    {
+        --m_speedPreviewCountdown;
+    }
+    else
+    {
+        DrivingState& drivingState = DrivingState::getInstance();
+
+        if (&drivingState == m_systemStateMachine.getState())
+        {
+            SpeedPreview payload;
+            int16_t      speeds[SPEED_PREVIEW_SAMPLES];
+            uint8_t      idx = 0U;
+
+            drivingState.getSpeedPreview(speeds, SPEED_PREVIEW_SAMPLES, SPEED_PREVIEW_INTERVAL);
+
+            payload.timestamp = (true == m_timeSync.isSynced()) ? m_timeSync.toPeerTime(Timebase::now()) : 0U;
+            payload.events    = drivingState.takeTrackEvents();
+            payload.interval  = SPEED_PREVIEW_INTERVAL;
+
+            for (idx = 0U; idx < SPEED_PREVIEW_SAMPLES; ++idx)
+            {
+                payload.speeds[idx] = static_cast<int16_t>(Util::stepsPerSecondToMillimetersPerSecond(speeds[idx]));
+            }
+
+            /* Ignoring return value, as error handling is not available. */
+            (void)m_smpServer.sendData(m_serialMuxProtChannelIdSpeedPreview, &payload, sizeof(SpeedPreview));
+        }
+
+        m_speedPreviewCountdown = (SPEED_PREVIEW_PERIOD / REPORTING_PERIOD) - 1U;
+    }
+}
+
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+void App::sendVehicleDataBatch()
+{
+    if (0U < m_vehicleDataBatch.getSampleCount())
+    {
+        /* Ignoring return value, as error handling is not available. The receiver detects
+         * a lost batch by the sequence number.
+         */
+        (void)m_smpServer.sendData(m_serialMuxProtChannelIdCurrentVehicleData, m_vehicleDataBatch.getFrame(),
+                                   VEHICLE_DATA_BATCH_CHANNEL_DLC);
+
+        m_vehicleDataBatch.nextFrame();
+    }
 }
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
 
 bool App::setupSerialMuxProt()
 {
@@ -280,14 +418,38 @@ bool App::setupSerialMuxProt()
     m_smpServer.subscribeToChannel(COMMAND_CHANNEL_NAME, App_cmdChannelCallback);
     m_smpServer.subscribeToChannel(SPEED_SETPOINT_CHANNEL_NAME, App_motorSpeedSetpointsChannelCallback);
     m_smpServer.subscribeToChannel(STATUS_CHANNEL_NAME, App_statusChannelCallback);
+    m_smpServer.subscribeToChannel(PARAMETER_CHANNEL_NAME, App_parameterChannelCallback);
+    m_smpServer.subscribeToChannel(TIME_SYNC_RESPONSE_CHANNEL_NAME, App_timeSyncResponseChannelCallback);
 
     /* Channel creation. */
     m_serialMuxProtChannelIdRemoteCtrlRsp =
         m_smpServer.createChannel(COMMAND_RESPONSE_CHANNEL_NAME, COMMAND_RESPONSE_CHANNEL_DLC);
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+    m_serialMuxProtChannelIdCurrentVehicleData =
+        m_smpServer.createChannel(VEHICLE_DATA_BATCH_CHANNEL_NAME, VEHICLE_DATA_BATCH_CHANNEL_DLC);
+#else  /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
     m_serialMuxProtChannelIdCurrentVehicleData =
         m_smpServer.createChannel(CURRENT_VEHICLE_DATA_CHANNEL_NAME, CURRENT_VEHICLE_DATA_CHANNEL_DLC);
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
     m_serialMuxProtChannelIdStatus = m_smpServer.createChannel(STATUS_CHANNEL_NAME, STATUS_CHANNEL_DLC);
 
+    /* The speed preview is optional, therefore it is not considered below. */
+    m_serialMuxProtChannelIdSpeedPreview =
+        m_smpServer.createChannel(SPEED_PREVIEW_CHANNEL_NAME, SPEED_PREVIEW_CHANNEL_DLC);
+
+    /* The clock synchronization is optional, therefore it is not considered below. */
+    m_serialMuxProtChannelIdTimeSync =
+        m_smpServer.createChannel(TIME_SYNC_REQUEST_CHANNEL_NAME, TIME_SYNC_REQUEST_CHANNEL_DLC);
+
+    /* The parameter tuning is optional, therefore it is not considered below. */
+    m_serialMuxProtChannelIdParameterRsp =
+        m_smpServer.createChannel(PARAMETER_RESPONSE_CHANNEL_NAME, PARAMETER_RESPONSE_CHANNEL_DLC);
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+    /* The profiler data is optional, therefore it is not considered below. */
+    m_serialMuxProtChannelIdProfile = m_smpServer.createChannel(PROFILE_CHANNEL_NAME, PROFILE_CHANNEL_DLC);
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+
     /* Channels succesfully created? */
     if ((0U != m_serialMuxProtChannelIdCurrentVehicleData) && (0U != m_serialMuxProtChannelIdRemoteCtrlRsp) &&
         (0U != m_serialMuxProtChannelIdStatus))
@@ -298,6 +460,270 @@ bool App::setupSerialMuxProt()
     return isSuccessful;
 }
 
+void App::sendTimeSyncRequest()
+{
+    if (0U != m_serialMuxProtChannelIdTimeSync)
+    {
+        TimeSyncRequest payload;
+
+        payload.isSynced      = (true == m_timeSync.isSynced()) ? 1U : 0U;
+        payload.offset        = m_timeSync.getOffset();
+        payload.drift         = m_timeSync.getDrift();
+        payload.syncTimestamp = m_timeSync.getSyncTimestamp();
+
+        /* The transmit timestamp shall be taken as late as possible. */
+        payload.transmitTimestamp = Timebase::now();
+        payload.sequence          = m_timeSync.createRequest(payload.transmitTimestamp);
+
+        /* Ignoring return value, as a lost request is detected by the missing response. */
+        (void)m_smpServer.sendData(m_serialMuxProtChannelIdTimeSync, &payload, sizeof(payload));
+    }
+}
+
+bool App::setupParameters()
+{
+    bool                         isSuccessful = true;
+    ParameterSets::ParameterSet& parSet       = ParameterSets::getInstance().getParameterSet();
+
+    updateParameters();
+    m_parameterRegistry.setChangeCallback(App_parameterChangeCallback, this);
+    m_parameterServer.setStoreCallback(App_parameterStoreCallback, this);
+
+    if ((false == m_parameterRegistry.add("maxSpeed", m_maxMotorSpeed, 1, INT16_MAX, true)) ||
+        (false == m_parameterRegistry.add("spdKpNum", m_speedPIDFactors.pNumerator, 0, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("spdKpDen", m_speedPIDFactors.pDenominator, 1, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("spdKiNum", m_speedPIDFactors.iNumerator, 0, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("spdKiDen", m_speedPIDFactors.iDenominator, 1, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("spdKdNum", m_speedPIDFactors.dNumerator, 0, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("spdKdDen", m_speedPIDFactors.dDenominator, 1, MAX_PID_FACTOR)))
+    {
+        isSuccessful = false;
+    }
+
+    /* The line following parameters of the selected parameter set. */
+    if ((false == m_parameterRegistry.add("topSpeed", parSet.topSpeed, 0, INT16_MAX)) ||
+        (false == m_parameterRegistry.add("lineKpNum", parSet.kPNumerator, 0, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("lineKpDen", parSet.kPDenominator, 1, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("lineKiNum", parSet.kINumerator, 0, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("lineKiDen", parSet.kIDenominator, 1, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("lineKdNum", parSet.kDNumerator, 0, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("lineKdDen", parSet.kDDenominator, 1, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("maxDist", m_maxDistance, 0, MAX_DISTANCE_LIMIT)))
+    {
+        isSuccessful = false;
+    }
+
+    return isSuccessful;
+}
+
+void App::updateParameters()
+{
+    DifferentialDrive& diffDrive = DifferentialDrive::getInstance();
+
+    diffDrive.getPIDFactors(m_speedPIDFactors);
+    m_maxMotorSpeed = diffDrive.getMaxMotorSpeed();
+    m_maxDistance   = static_cast<int32_t>(DrivingState::getInstance().getMaxDistance());
+}
+
+void App::storeParameters()
+{
+    /* Only the max. motor speed is part of the settings. All other parameters
+     * are registered as volatile, which is reported in the response to the
+     * store request. They shall be taken over into the source code after tuning.
+     */
+    Board::getInstance().getSettings().setMaxSpeed(m_maxMotorSpeed);
+}
+
+bool App::setupScheduler()
+{
+    bool    isSuccessful = true;
+    uint8_t controlTaskId =
+        m_scheduler.addTask(controlTask, this, DIFFERENTIAL_DRIVE_CONTROL_PERIOD, CONTROL_TASK_PRIORITY);
+    uint8_t statusTaskId;
+    uint8_t timeSyncTaskId;
+
+    m_reportTaskId = m_scheduler.addTask(reportTask, this, REPORTING_PERIOD, REPORT_TASK_PRIORITY);
+    statusTaskId   = m_scheduler.addTask(statusTask, this, SEND_STATUS_TIMER_INTERVAL, STATUS_TASK_PRIORITY);
+    timeSyncTaskId = m_scheduler.addTask(timeSyncTask, this, TIME_SYNC_PERIOD, TIME_SYNC_TASK_PRIORITY);
+
+    if ((Scheduler::INVALID_TASK_ID == controlTaskId) || (Scheduler::INVALID_TASK_ID == m_reportTaskId) ||
+        (Scheduler::INVALID_TASK_ID == statusTaskId) || (Scheduler::INVALID_TASK_ID == timeSyncTaskId))
+    {
+        isSuccessful = false;
+    }
+    else
+    {
+        m_scheduler.start();
+    }
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+    /* Sending the profiler data is optional, therefore a missing task slot is ignored. */
+    (void)m_scheduler.addTask(profileTask, this, SEND_PROFILE_DATA_PERIOD, PROFILE_TASK_PRIORITY);
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+
+    return isSuccessful;
+}
+
+void App::applyDegradationLevel()
+{
+    /* The reporting period is doubled with every degradation level. The
+     * status is never degraded, because the DCS uses it for its timeout.
+     * The clock synchronization neither, because the timestamps depend on it.
+     */
+    uint32_t factor = static_cast<uint32_t>(1U) << m_loadGovernor.getLevel();
+
+    (void)m_scheduler.setPeriod(m_reportTaskId, REPORTING_PERIOD * factor);
+}
+
+void App::controlTask(void* userData)
+{
+    App* application = reinterpret_cast<App*>(userData);
+
+    /* The differential drive control needs the measured speed of the
+     * left and right wheel. Therefore it shall be processed after
+     * the speedometer.
+     */
+    {
+        PROFILER_SCOPE(Profiler::SECTION_DIFFERENTIAL_DRIVE);
+        DifferentialDrive::getInstance().process(DIFFERENTIAL_DRIVE_CONTROL_PERIOD);
+    }
+
+    /* The odometry unit needs to detect motor speed changes to be able to
+     * calculate correct values. Therefore it shall be processed right after
+     * the differential drive control.
+     */
+    {
+        PROFILER_SCOPE(Profiler::SECTION_ODOMETRY);
+        Odometry::getInstance().process();
+    }
+
+#ifndef TARGET_NATIVE
+    /* In the simulation the time advances in steps, independent of the load.
+     * Therefore the slack is only observed on the target.
+     */
+    if (nullptr != application)
+    {
+        /* The slack is the remaining time from the end of the control until its
+         * deadline. The signed difference is negative, if the deadline was missed.
+         */
+        int32_t slack = static_cast<int32_t>(application->m_scheduler.getDeadline() - Timebase::now());
+
+        if (true == application->m_loadGovernor.update(slack))
+        {
+            application->applyDegradationLevel();
+        }
+    }
+#else  /* TARGET_NATIVE */
+    (void)application;
+#endif /* TARGET_NATIVE */
+}
+
+void App::reportTask(void* userData)
+{
+    App* application = reinterpret_cast<App*>(userData);
+
+    if ((nullptr != application) && (true == application->m_smpServer.isSynced()))
+    {
+        /* Send current data to SerialMuxProt Client */
+        application->reportVehicleData();
+        application->sendSpeedPreview();
+    }
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+    else if (nullptr != application)
+    {
+        /* The client shall get a keyframe first, after it is synchronized again. */
+        application->m_vehicleDataBatch.reset();
+    }
+    else
+    {
+        ;
+    }
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
+}
+
+void App::statusTask(void* userData)
+{
+    App* application = reinterpret_cast<App*>(userData);
+
+    if ((nullptr != application) && (true == application->m_smpServer.isSynced()))
+    {
+        Status payload = {SMPChannelPayload::Status::STATUS_FLAG_OK, application->m_loadGovernor.getLevel()};
+
+        if (&ErrorState::getInstance() == application->m_systemStateMachine.getState())
+        {
+            payload.status = SMPChannelPayload::Status::STATUS_FLAG_ERROR;
+        }
+
+        /* Ignoring return value, as error handling is not available. */
+        (void)application->m_smpServer.sendData(application->m_serialMuxProtChannelIdStatus, &payload,
+                                                sizeof(payload));
+    }
+}
+
+void App::timeSyncTask(void* userData)
+{
+    App* application = reinterpret_cast<App*>(userData);
+
+    if ((nullptr != application) && (true == application->m_smpServer.isSynced()))
+    {
+        application->sendTimeSyncRequest();
+    }
+    else if (nullptr != application)
+    {
+        /* The DCS may be restarted, which invalidates the clock estimation. */
+        application->m_timeSync.reset();
+    }
+    else
+    {
+        ;
+    }
+}
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+void App::profileTask(void* userData)
+{
+    App* application = reinterpret_cast<App*>(userData);
+
+    /* Only a single section is sent per period to keep the channel load low. */
+    if ((nullptr != application) && (0U != application->m_serialMuxProtChannelIdProfile) &&
+        (true == application->m_smpServer.isSynced()))
+    {
+        Profiler::Section    section = static_cast<Profiler::Section>(application->m_profileSection);
+        Profiler::Statistics statistics;
+
+        if (true == Profiler::getStatistics(section, statistics))
+        {
+            ProfileData payload;
+            uint8_t     bin = 0U;
+
+            payload.section = section;
+            payload.count   = statistics.count;
+            payload.min     = statistics.min;
+            payload.max     = statistics.max;
+            payload.mean    = Profiler::getMean(statistics);
+
+            for (bin = 0U; bin < Profiler::HISTOGRAM_BINS; ++bin)
+            {
+                payload.histogram[bin] = statistics.histogram[bin];
+            }
+
+            /* Ignoring return value, as error handling is not available. */
+            (void)application->m_smpServer.sendData(application->m_serialMuxProtChannelIdProfile, &payload,
+                                                    sizeof(payload));
+
+            Profiler::reset(section);
+        }
+
+        ++application->m_profileSection;
+
+        if (Profiler::SECTION_COUNT <= application->m_profileSection)
+        {
+            application->m_profileSection = 0U;
+        }
+    }
+}
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -350,10 +776,83 @@ void App_motorSpeedSetpointsChannelCallback(const uint8_t* payload, const uint8_
  */
 void App_statusChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData)
 {
-    if ((nullptr != payload) && (STATUS_CHANNEL_DLC == payloadSize) && (nullptr != userData))
+    /* The degradation level is not evaluated. A peer, which sends only the status flag, is accepted too. */
+    if ((nullptr != payload) && (sizeof(SMPChannelPayload::Status) <= payloadSize) && (nullptr != userData))
     {
         const Status* currentStatus = reinterpret_cast<const Status*>(payload);
         App*          application   = reinterpret_cast<App*>(userData);
         application->systemStatusCallback(currentStatus->status);
     }
 }
+
+/**
+ * Receives the clock synchronization response of the DCS over SerialMuxProt channel.
+ *
+ * @param[in] payload       Clock synchronization response.
+ * @param[in] payloadSize   Size of the clock synchronization response.
+ * @param[in] userData      Instance of App class.
+ */
+void App_timeSyncResponseChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData)
+{
+    /* The receive timestamp shall be taken as early as possible. */
+    Timebase::Timestamp receiveTimestamp = Timebase::now();
+
+    if ((nullptr != payload) && (TIME_SYNC_RESPONSE_CHANNEL_DLC == payloadSize) && (nullptr != userData))
+    {
+        const TimeSyncResponse* response    = reinterpret_cast<const TimeSyncResponse*>(payload);
+        App*                    application = reinterpret_cast<App*>(userData);
+
+        application->handleTimeSyncResponse(*response, receiveTimestamp);
+    }
+}
+
+/**
+ * Receives parameter requests over SerialMuxProt channel.
+ *
+ * @param[in] payload       Parameter request.
+ * @param[in] payloadSize   Size of the parameter request.
+ * @param[in] userData      Instance of App class.
+ */
+void App_parameterChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData)
+{
+    if ((nullptr != payload) && (PARAMETER_CHANNEL_DLC == payloadSize) && (nullptr != userData))
+    {
+        const ParameterServer::Request* request     = reinterpret_cast<const ParameterServer::Request*>(payload);
+        App*                           application = reinterpret_cast<App*>(userData);
+
+        application->handleParameterRequest(*request);
+    }
+}
+
+/**
+ * Applies the parameters after a parameter was changed.
+ *
+ * @param[in] index     Index of the changed parameter.
+ * @param[in] userData  Instance of App class.
+ */
+void App_parameterChangeCallback(uint8_t index, void* userData)
+{
+    (void)index;
+
+    if (nullptr != userData)
+    {
+        App* application = reinterpret_cast<App*>(userData);
+
+        application->applyParameters();
+    }
+}
+
+/**
+ * Stores the persistent parameters on request of the DCS.
+ *
+ * @param[in] userData  Instance of App class.
+ */
+void App_parameterStoreCallback(void* userData)
+{
+    if (nullptr != userData)
+    {
+        App* application = reinterpret_cast<App*>(userData);
+
+        application->storeParameters();
+    }
+}
@@ -40,15 +40,30 @@
  * Compile Switches
  *****************************************************************************/
 
+#ifndef CONFIG_VEHICLE_DATA_BATCH
+/**
+ * Send the current vehicle data with a higher rate in batches on the "VEH_BATCH"
+ * channel, instead of single frames on the "CURR_DATA" channel.
+ * Disabled by default, because the existing hosts expect the "CURR_DATA" channel.
+ */
+#define CONFIG_VEHICLE_DATA_BATCH (0)
+#endif /* CONFIG_VEHICLE_DATA_BATCH */
+
 /******************************************************************************
  * Includes
  *****************************************************************************/
 #include <StateMachine.h>
 #include <SimpleTimer.h>
+#include <Scheduler.h>
+#include <LoadGovernor.h>
 #include <SerialMuxProtServer.hpp>
 #include "SerialMuxChannels.h"
 #include <Arduino.h>
 #include <MovAvg.hpp>
+#include <DifferentialDrive.h>
+#include <ParameterRegistry.h>
+#include <ParameterServer.h>
+#include <TimeSync.h>
 
 /******************************************************************************
  * Macros
@@ -69,13 +84,34 @@ public:
         m_serialMuxProtChannelIdRemoteCtrlRsp(0U),
         m_serialMuxProtChannelIdCurrentVehicleData(0U),
         m_serialMuxProtChannelIdStatus(0U),
+        m_serialMuxProtChannelIdSpeedPreview(0U),
+        m_serialMuxProtChannelIdTimeSync(0U),
+        m_serialMuxProtChannelIdParameterRsp(0U),
         m_systemStateMachine(),
-        m_controlInterval(),
-        m_reportTimer(),
-        m_statusTimer(),
+        m_scheduler(),
+        m_loadGovernor(MIN_CONTROL_SLACK),
+        m_reportTaskId(Scheduler::INVALID_TASK_ID),
         m_statusTimeoutTimer(),
         m_smpServer(Serial, this),
-        m_movAvgProximitySensor()
+        m_timeSync(),
+        m_parameterRegistry(),
+        m_parameterServer(m_parameterRegistry),
+        m_speedPIDFactors(),
+        m_maxMotorSpeed(0),
+        m_maxDistance(0),
+        m_movAvgProximitySensor(),
+        m_proximityReadCountdown(0U),
+        m_speedPreviewCountdown(0U)
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+        ,
+        m_vehicleDataBatch(SMPChannelPayload::VEHICLE_DATA_VALUE_COUNT),
+        m_vehicleDataTimeBase(0)
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
+#if (0 != CONFIG_PROFILER_ENABLE)
+        ,
+        m_serialMuxProtChannelIdProfile(0U),
+        m_profileSection(0U)
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
     {
     }
 
@@ -110,6 +146,32 @@ public:
      */
     void systemStatusCallback(SMPChannelPayload::Status status);
 
+    /**
+     * Handle parameter request received via SerialMuxProt.
+     *
+     * @param[in] request   Parameter request to handle.
+     */
+    void handleParameterRequest(const ParameterServer::Request& request);
+
+    /**
+     * Apply the tunable parameters to their owners. It is called after a
+     * parameter was changed.
+     */
+    void applyParameters();
+
+    /**
+     * Store the persistent parameters in the settings.
+     */
+    void storeParameters();
+
+    /**
+     * Handle the clock synchronization response of the DCS.
+     *
+     * @param[in] response          Clock synchronization response.
+     * @param[in] receiveTimestamp  Local receive timestamp of the response in us.
+     */
+    void handleTimeSyncResponse(const TimeSyncResponse& response, Timebase::Timestamp receiveTimestamp);
+
 private:
     /**
      * Duration in ms how long the team id or team name shall be shown at startup.
@@ -119,23 +181,73 @@ private:
     /** Differential drive control period in ms. */
     static const uint32_t DIFFERENTIAL_DRIVE_CONTROL_PERIOD = 5U;
 
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+    /** Current data sampling period in ms. The samples are reported in batches. */
+    static const uint32_t REPORTING_PERIOD = 10U;
+
+    /** Max. number of samples in a vehicle data batch, which limits the latency of the first sample. */
+    static const uint8_t VEHICLE_DATA_BATCH_SAMPLES = 5U;
+#else  /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
     /** Current data reporting period in ms. */
     static const uint32_t REPORTING_PERIOD = 50U;
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
 
     /** Baudrate for Serial Communication */
     static const uint32_t SERIAL_BAUDRATE = 115200U;
 
+    /** Task priority of the differential drive control, which shall always run first. */
+    static const uint8_t CONTROL_TASK_PRIORITY = Scheduler::PRIORITY_HIGHEST;
+
+    /** Task priority of reporting the current vehicle data. */
+    static const uint8_t REPORT_TASK_PRIORITY = CONTROL_TASK_PRIORITY + 1U;
+
+    /** Task priority of sending the system status. */
+    static const uint8_t STATUS_TASK_PRIORITY = REPORT_TASK_PRIORITY + 1U;
+
+    /** Task priority of the clock synchronization with the DCS. */
+    static const uint8_t TIME_SYNC_TASK_PRIORITY = STATUS_TASK_PRIORITY + 1U;
+
+    /** Task priority of sending the profiler data. */
+    static const uint8_t PROFILE_TASK_PRIORITY = TIME_SYNC_TASK_PRIORITY + 1U;
+
+    /** Profiler data sending period in ms. */
+    static const uint32_t SEND_PROFILE_DATA_PERIOD = 100U;
+
+    /**
+     * Min. slack in us of the differential drive control. If the slack is
+     * too often lower, the telemetry is degraded.
+     */
+    static const int32_t MIN_CONTROL_SLACK = 3000;
+
     /** Send status timer interval in ms. */
     static const uint32_t SEND_STATUS_TIMER_INTERVAL = 1000U;
 
     /** Status timeout timer interval in ms. */
     static const uint32_t STATUS_TIMEOUT_TIMER_INTERVAL = 2U * SEND_STATUS_TIMER_INTERVAL;
 
+    /** Clock synchronization request period in ms. It is sufficient to follow the drift. */
+    static const uint32_t TIME_SYNC_PERIOD = 1000U;
+
     /**
      * Number of measurements for proximity sensors moving average filter.
      */
     static const uint8_t MOVAVG_PROXIMITY_SENSOR_NUM_MEASUREMENTS = 3U;
 
+    /**
+     * Proximity sensors reading period in ms. Reading them takes several ms,
+     * therefore it is done less often than the vehicle data is sampled.
+     */
+    static const uint32_t PROXIMITY_READ_PERIOD = 50U;
+
+    /** Speed preview sending period in ms. */
+    static const uint32_t SPEED_PREVIEW_PERIOD = 50U;
+
+    /** Upper bound of the tunable PID factor numerators and denominators. */
+    static const int16_t MAX_PID_FACTOR = 1000;
+
+    /** Upper bound of the tunable max. distance in mm after a lost track must be found again. */
+    static const int32_t MAX_DISTANCE_LIMIT = 2000;
+
     /** SerialMuxProt Channel id for sending remote control command responses. */
     uint8_t m_serialMuxProtChannelIdRemoteCtrlRsp;
 
@@ -145,19 +257,26 @@ private:
     /** SerialMuxProt Channel id for sending system status. */
     uint8_t m_serialMuxProtChannelIdStatus;
 
+    /** SerialMuxProt Channel id for sending the speed preview. */
+    uint8_t m_serialMuxProtChannelIdSpeedPreview;
+
+    /** SerialMuxProt Channel id for sending clock synchronization requests. */
+    uint8_t m_serialMuxProtChannelIdTimeSync;
+
+    /** SerialMuxProt Channel id for sending parameter responses. */
+    uint8_t m_serialMuxProtChannelIdParameterRsp;
+
     /** The system state machine. */
     StateMachine m_systemStateMachine;
 
-    /** Timer used for differential drive control processing. */
-    SimpleTimer m_controlInterval;
+    /** Scheduler for the periodic tasks. */
+    Scheduler m_scheduler;
 
-    /** Timer for reporting current data through SerialMuxProt. */
-    SimpleTimer m_reportTimer;
+    /** Load governor, which degrades the telemetry if the control deadline is at risk. */
+    LoadGovernor m_loadGovernor;
 
-    /**
-     * Timer for sending system status to DCS.
-     */
-    SimpleTimer m_statusTimer;
+    /** Task id of reporting the current vehicle data. */
+    uint8_t m_reportTaskId;
 
     /**
      * Timer for timeout of system status of DCS.
@@ -169,11 +288,51 @@ private:
      */
     SMPServer m_smpServer;
 
+    /** Clock synchronization with the DCS. */
+    TimeSync m_timeSync;
+
+    /** Registry of the parameters, which can be tuned at runtime. */
+    ParameterRegistry m_parameterRegistry;
+
+    /** Server of the parameter protocol on the parameter channels. */
+    ParameterServer m_parameterServer;
+
+    /** Tunable PID factors of the motor speed control. */
+    DifferentialDrive::PIDFactors m_speedPIDFactors;
+
+    /** Tunable max. motor speed in [steps/s], which is persistent in the settings. */
+    int16_t m_maxMotorSpeed;
+
+    /** Tunable max. distance in [mm] after a lost track must be found again. */
+    int32_t m_maxDistance;
+
     /**
      * Moving average filter for proximity sensors.
      */
     MovAvg<uint8_t, uint16_t, MOVAVG_PROXIMITY_SENSOR_NUM_MEASUREMENTS> m_movAvgProximitySensor;
 
+    /** Number of vehicle data reports until the proximity sensors are read again. */
+    uint8_t m_proximityReadCountdown;
+
+    /** Number of vehicle data reports until the speed preview is sent again. */
+    uint8_t m_speedPreviewCountdown;
+
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+    /** Batch of vehicle data samples, which is under construction. */
+    TelemetryBatch m_vehicleDataBatch;
+
+    /** Time base of the vehicle data batch: Offset of the DCS time to the local time in ms. */
+    int32_t m_vehicleDataTimeBase;
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+    /** SerialMuxProt Channel id for sending the profiler data. */
+    uint8_t m_serialMuxProtChannelIdProfile;
+
+    /** Profiler section, which is sent next. */
+    uint8_t m_profileSection;
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+
     /**
      * Report the current vehicle data.
      * Report the current position and heading of the robot using the Odometry data.
@@ -182,6 +341,20 @@ private:
      */
     void reportVehicleData();
 
+    /**
+     * Send the planned speeds of the near future and the track events via
+     * SerialMuxProt, while driving.
+     */
+    void sendSpeedPreview();
+
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+    /**
+     * Send the batch of vehicle data samples via SerialMuxProt, if it is not empty,
+     * and start the next one.
+     */
+    void sendVehicleDataBatch();
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
+
     /**
      * Setup the SerialMuxProt channels.
      *
@@ -189,6 +362,75 @@ private:
      */
     bool setupSerialMuxProt();
 
+    /**
+     * Register the parameters, which can be tuned at runtime.
+     *
+     * @return If successful returns true, otherwise false.
+     */
+    bool setupParameters();
+
+    /**
+     * Update the tunable parameters from their owners, which may change them too.
+     */
+    void updateParameters();
+
+    /**
+     * Send the next clock synchronization request to the DCS. It contains the
+     * current clock estimation too.
+     */
+    void sendTimeSyncRequest();
+
+    /**
+     * Setup the scheduler with all periodic tasks and start it.
+     *
+     * @return If successful returns true, otherwise false.
+     */
+    bool setupScheduler();
+
+    /**
+     * Adapt the telemetry to the current degradation level of the load governor.
+     */
+    void applyDegradationLevel();
+
+    /**
+     * Periodic differential drive control task.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void controlTask(void* userData);
+
+    /**
+     * Periodic task to report the current vehicle data.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void reportTask(void* userData);
+
+    /**
+     * Periodic task to send the system status to the DCS.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void statusTask(void* userData);
+
+    /**
+     * Periodic task to synchronize the clock with the DCS. It runs independent
+     * of the status and is never degraded, because the timestamps of the
+     * vehicle data depend on it.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void timeSyncTask(void* userData);
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+    /**
+     * Periodic task to send the statistics of a single profiler section.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void profileTask(void* userData);
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+
     /**
      * Copy construction of an instance.
      * Not allowed.
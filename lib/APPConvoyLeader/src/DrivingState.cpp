@@ -38,6 +38,8 @@
 #include <DifferentialDrive.h>
 #include <StateMachine.h>
 #include <Odometry.h>
+#include <Speedometer.h>
+#include <Util.h>
 #include "ErrorState.h"
 #include "ParameterSets.h"
 
@@ -67,10 +69,9 @@
 
 void DrivingState::entry()
 {
-    IDisplay&                          display   = Board::getInstance().getDisplay();
-    const ParameterSets::ParameterSet& parSet    = ParameterSets::getInstance().getParameterSet();
-    DifferentialDrive&                 diffDrive = DifferentialDrive::getInstance();
-    const int16_t                      maxSpeed  = diffDrive.getMaxMotorSpeed(); /* [steps/s] */
+    IDisplay&          display   = Board::getInstance().getDisplay();
+    DifferentialDrive& diffDrive = DifferentialDrive::getInstance();
+    const int16_t      maxSpeed  = diffDrive.getMaxMotorSpeed(); /* [steps/s] */
 
     diffDrive.enable();
 
@@ -78,6 +79,7 @@ void DrivingState::entry()
     m_pidProcessTime.start(0); /* Immediate */
     m_lineStatus  = LINE_STATUS_FIND_START_LINE;
     m_trackStatus = TRACK_STATUS_ON_TRACK; /* Assume that the robot is placed on track. */
+    m_trackEvents = 0U;
     m_posMovAvg.clear();
 
     /* Top speed is 0, and can only be set externally by DCS. */
@@ -85,9 +87,7 @@ void DrivingState::entry()
 
     /* Configure PID controller with selected parameter set. */
     m_pidCtrl.clear();
-    m_pidCtrl.setPFactor(parSet.kPNumerator, parSet.kPDenominator);
-    m_pidCtrl.setIFactor(parSet.kINumerator, parSet.kIDenominator);
-    m_pidCtrl.setDFactor(parSet.kDNumerator, parSet.kDDenominator);
+    applyParameterSet();
     m_pidCtrl.setSampleTime(PID_PROCESS_PERIOD);
     m_pidCtrl.setLimits(-maxSpeed, maxSpeed);
     m_pidCtrl.setDerivativeOnMeasurement(true);
@@ -135,6 +135,7 @@ void DrivingState::process(StateMachine& sm)
     if ((TRACK_STATUS_FINISHED != m_trackStatus) && (true == m_observationTimer.isTimeout()))
     {
         m_trackStatus = TRACK_STATUS_FINISHED;
+        m_trackEvents |= TRACK_EVENT_ABORTED;
 
         /* Stop motors immediately. Don't move this to a later position,
          * as this would extend the driven length.
@@ -151,6 +152,47 @@ void DrivingState::exit()
     Board::getInstance().getYellowLed().enable(false);
 }
 
+void DrivingState::applyParameterSet()
+{
+    const ParameterSets::ParameterSet& parSet = ParameterSets::getInstance().getParameterSet();
+
+    m_pidCtrl.setPFactor(parSet.kPNumerator, parSet.kPDenominator);
+    m_pidCtrl.setIFactor(parSet.kINumerator, parSet.kIDenominator);
+    m_pidCtrl.setDFactor(parSet.kDNumerator, parSet.kDDenominator);
+}
+
+void DrivingState::getSpeedPreview(int16_t* speeds, uint8_t count, uint32_t interval) const
+{
+    if (nullptr != speeds)
+    {
+        int16_t  plannedSpeed = DifferentialDrive::getInstance().getLinearSpeed();
+        uint32_t timeToStop   = getTimeToStop();
+        uint8_t  idx          = 0U;
+
+        if (TRACK_STATUS_LOST == m_trackStatus)
+        {
+            /* Drives straight on with top speed. */
+            plannedSpeed = m_topSpeed;
+        }
+        else if (m_topSpeed < plannedSpeed)
+        {
+            /* The top speed was just reduced and is considered by the next line following cycle. */
+            plannedSpeed = m_topSpeed;
+        }
+        else
+        {
+            ;
+        }
+
+        for (idx = 0U; idx < count; ++idx)
+        {
+            uint32_t time = static_cast<uint32_t>(idx) * interval;
+
+            speeds[idx] = (timeToStop > time) ? plannedSpeed : 0;
+        }
+    }
+}
+
 /******************************************************************************
  * Protected Methods
  *****************************************************************************/
@@ -170,6 +212,7 @@ void DrivingState::processOnTrack(int16_t position, const uint16_t* lineSensorVa
     if (true == isTrackGapDetected(m_posMovAvg.getResult()))
     {
         m_trackStatus = TRACK_STATUS_LOST;
+        m_trackEvents |= TRACK_EVENT_TRACK_LOST;
 
         /* Set mileage to 0, to be able to measure the max. distance, till
          * the track must be found again.
@@ -188,6 +231,7 @@ void DrivingState::processOnTrack(int16_t position, const uint16_t* lineSensorVa
             if (LINE_STATUS_FIND_START_LINE == m_lineStatus)
             {
                 m_lineStatus = LINE_STATUS_START_LINE_DETECTED;
+                m_trackEvents |= TRACK_EVENT_START_LINE;
 
                 Sound::playBeep();
 
@@ -206,6 +250,7 @@ void DrivingState::processOnTrack(int16_t position, const uint16_t* lineSensorVa
 
                 Sound::playBeep();
                 m_trackStatus = TRACK_STATUS_FINISHED;
+                m_trackEvents |= TRACK_EVENT_END_LINE;
             }
             else
             {
@@ -225,9 +270,15 @@ void DrivingState::processOnTrack(int16_t position, const uint16_t* lineSensorVa
         {
             if (true == m_pidProcessTime.isTimeout())
             {
+                /* Except the immediate first run, the controller uses the real elapsed time since its last run. */
+                if (0U < m_pidProcessTime.getDuration())
+                {
+                    m_pidCtrl.setSampleTime(Timebase::toMs(m_pidProcessTime.getCurrentDuration()));
+                }
+
                 adaptDriving(position);
 
-                m_pidProcessTime.start(PID_PROCESS_PERIOD);
+                m_pidProcessTime.start(Timebase::fromMs(PID_PROCESS_PERIOD));
             }
         }
     }
@@ -246,12 +297,13 @@ void DrivingState::processTrackLost(int16_t position, const uint16_t* lineSensor
     if (false == isTrackGapDetected(position))
     {
         m_trackStatus = TRACK_STATUS_ON_TRACK;
+        m_trackEvents |= TRACK_EVENT_TRACK_FOUND;
         m_pidCtrl.resync();
 
         Board::getInstance().getYellowLed().enable(false);
     }
     /* Max. distance driven, but track still not found? */
-    else if (MAX_DISTANCE < Odometry::getInstance().getMileageCenter())
+    else if (m_maxDistance < Odometry::getInstance().getMileageCenter())
     {
         /* Stop motors immediately. Don't move this to a later position,
          * as this would extend the driven length.
@@ -260,6 +312,7 @@ void DrivingState::processTrackLost(int16_t position, const uint16_t* lineSensor
 
         Sound::playAlarm();
         m_trackStatus = TRACK_STATUS_FINISHED;
+        m_trackEvents |= TRACK_EVENT_ABORTED;
     }
     else
     {
@@ -368,6 +421,55 @@ void DrivingState::adaptDriving(int16_t position)
     diffDrive.setLinearSpeed(leftSpeed, rightSpeed);
 }
 
+uint32_t DrivingState::getTimeToStop() const
+{
+    uint32_t timeToStop = UINT32_MAX;
+
+    if (TRACK_STATUS_FINISHED == m_trackStatus)
+    {
+        timeToStop = 0U;
+    }
+    else
+    {
+        /* The max. time for finishing the track. */
+        if (true == m_observationTimer.isRunning())
+        {
+            uint32_t elapsed = m_observationTimer.getCurrentDuration();
+
+            timeToStop = (OBSERVATION_DURATION > elapsed) ? (OBSERVATION_DURATION - elapsed) : 0U;
+        }
+
+        /* The max. distance to find a lost track again. */
+        if (TRACK_STATUS_LOST == m_trackStatus)
+        {
+            uint32_t mileage           = Odometry::getInstance().getMileageCenter();
+            uint32_t timeToMaxDistance = UINT32_MAX;
+            int32_t  speed =
+                Util::stepsPerSecondToMillimetersPerSecond(Speedometer::getInstance().getLinearSpeedCenter());
+
+            if (m_maxDistance <= mileage)
+            {
+                timeToMaxDistance = 0U;
+            }
+            else if (0 < speed)
+            {
+                timeToMaxDistance = ((m_maxDistance - mileage) * 1000U) / static_cast<uint32_t>(speed);
+            }
+            else
+            {
+                ;
+            }
+
+            if (timeToStop > timeToMaxDistance)
+            {
+                timeToStop = timeToMaxDistance;
+            }
+        }
+    }
+
+    return timeToStop;
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
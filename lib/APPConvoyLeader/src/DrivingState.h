@@ -46,6 +46,7 @@
 #include <stdint.h>
 #include <IState.h>
 #include <SimpleTimer.h>
+#include <MicroTimer.h>
 #include <PIDController.h>
 #include <MovAvg.hpp>
 
@@ -61,6 +62,18 @@
 class DrivingState : public IState
 {
 public:
+    /**
+     * Track events, which are reported as bit flags.
+     */
+    enum TrackEvent : uint8_t
+    {
+        TRACK_EVENT_START_LINE  = 0x01U, /**< Start line detected. */
+        TRACK_EVENT_END_LINE    = 0x02U, /**< End line detected, the robot stops. */
+        TRACK_EVENT_TRACK_LOST  = 0x04U, /**< Track lost, the robot drives straight on. */
+        TRACK_EVENT_TRACK_FOUND = 0x08U, /**< Track found again. */
+        TRACK_EVENT_ABORTED     = 0x10U  /**< Drive aborted, because the track was not found or the time is over. */
+    };
+
     /**
      * Get state instance.
      *
@@ -102,6 +115,57 @@ public:
         m_topSpeed = topSpeed;
     }
 
+    /**
+     * Get the max. distance after a lost track must be found again.
+     *
+     * @return Max. distance in [mm]
+     */
+    uint32_t getMaxDistance() const
+    {
+        return m_maxDistance;
+    }
+
+    /**
+     * Set the max. distance after a lost track must be found again.
+     *
+     * @param[in] maxDistance   Max. distance in [mm]
+     */
+    void setMaxDistance(uint32_t maxDistance)
+    {
+        m_maxDistance = maxDistance;
+    }
+
+    /**
+     * Apply the PID factors of the selected parameter set to the line
+     * following controller, e.g. after they were tuned.
+     */
+    void applyParameterSet();
+
+    /**
+     * Get the track events, which happened since the last call.
+     *
+     * @return Track events as bit flags, see TrackEvent.
+     */
+    uint8_t takeTrackEvents()
+    {
+        uint8_t trackEvents = m_trackEvents;
+
+        m_trackEvents = 0U;
+
+        return trackEvents;
+    }
+
+    /**
+     * Get the planned center speed for the near future. It considers the
+     * current differential drive setpoint, the top speed and the stops, which
+     * are already known, like the end of the max. distance to find a lost track.
+     *
+     * @param[out] speeds   Planned center speeds in [steps/s], the first one is the current.
+     * @param[in]  count    Number of planned speeds.
+     * @param[in]  interval Time between two planned speeds in [ms].
+     */
+    void getSpeedPreview(int16_t* speeds, uint8_t count, uint32_t interval) const;
+
 protected:
 private:
     /**
@@ -127,7 +191,7 @@ private:
     /** Observation duration in ms. This is the max. time within the robot must be finished its drive. */
     static const uint32_t OBSERVATION_DURATION = 3000000;
 
-    /** Max. distance in mm after a lost track must be found again. */
+    /** Default max. distance in mm after a lost track must be found again. */
     static const uint32_t MAX_DISTANCE = 200;
 
     /** Period in ms for PID processing. */
@@ -135,13 +199,15 @@ private:
 
     SimpleTimer            m_observationTimer; /**< Observation timer to observe the max. time per challenge. */
     SimpleTimer            m_lapTime;          /**< Timer used to calculate the lap time. */
-    SimpleTimer            m_pidProcessTime;   /**< Timer used for periodically PID processing. */
+    MicroTimer             m_pidProcessTime;   /**< Timer used for periodically PID processing. */
     PIDController<int16_t> m_pidCtrl;          /**< PID controller, used for driving. */
     int16_t                m_topSpeed;    /**< Top speed in [steps/s]. It might be lower or equal to the max. speed! */
     LineStatus             m_lineStatus;  /**< Status of start-/end line detection */
     TrackStatus            m_trackStatus; /**< Status of track which means on track or track lost, etc. */
     uint8_t m_startEndLineDebounce;       /**< Counter used for easys debouncing of the start-/end line detection. */
     MovAvg<int16_t, uint32_t, 2U> m_posMovAvg; /**< The moving average of the position over 2 calling cycles. */
+    uint32_t m_maxDistance;                    /**< Max. distance in [mm] after a lost track must be found again. */
+    uint8_t  m_trackEvents;                    /**< Track events since they were taken last, see TrackEvent. */
 
     /**
      * Default constructor.
@@ -155,7 +221,9 @@ private:
         m_lineStatus(LINE_STATUS_FIND_START_LINE),
         m_trackStatus(TRACK_STATUS_ON_TRACK),
         m_startEndLineDebounce(0),
-        m_posMovAvg()
+        m_posMovAvg(),
+        m_maxDistance(MAX_DISTANCE),
+        m_trackEvents(0U)
     {
     }
 
@@ -228,6 +296,13 @@ private:
      * @param[in] position  Position in digits
      */
     void adaptDriving(int16_t position);
+
+    /**
+     * Get the time until the robot stops, as far as it is already known.
+     *
+     * @return Time until stop in [ms] or UINT32_MAX if no stop is planned.
+     */
+    uint32_t getTimeToStop() const;
 };
 
 /******************************************************************************
@@ -82,6 +82,11 @@ const ParameterSets::ParameterSet& ParameterSets::getParameterSet() const
     return m_parSets[m_currentSetId];
 }
 
+ParameterSets::ParameterSet& ParameterSets::getParameterSet()
+{
+    return m_parSets[m_currentSetId];
+}
+
 /******************************************************************************
  * Protected Methods
  *****************************************************************************/
@@ -114,6 +114,13 @@ public:
      */
     const ParameterSet& getParameterSet() const;
 
+    /**
+     * Get selected parameter set for modification, e.g. to tune it at runtime.
+     *
+     * @return Parameter set
+     */
+    ParameterSet& getParameterSet();
+
     /** Max. number of parameter sets. */
     static const uint8_t MAX_SETS = 4U;
 
@@ -32,12 +32,27 @@
 #ifndef SERIAL_MUX_CHANNELS_H_
 #define SERIAL_MUX_CHANNELS_H_
 
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/**
+ * Add the DCS timestamp to the "Current Vehicle Data" channel payload.
+ * It requires the clock synchronization with the DCS.
+ */
+#ifndef CONFIG_VEHICLE_DATA_TIMESTAMP
+#define CONFIG_VEHICLE_DATA_TIMESTAMP (0)
+#endif /* CONFIG_VEHICLE_DATA_TIMESTAMP */
+
 /******************************************************************************
  * Includes
  *****************************************************************************/
 
 #include <Arduino.h>
 #include <SerialMuxProtServer.hpp>
+#include <Profiler.h>
+#include <TelemetryBatch.h>
+#include <ParameterServer.h>
 
 /******************************************************************************
  * Macros
@@ -70,12 +85,64 @@
 /** DLC of Current Vehicle Data Channel */
 #define CURRENT_VEHICLE_DATA_CHANNEL_DLC (sizeof(VehicleData))
 
+/** Name of Channel to send batched Vehicle Data samples to. */
+#define VEHICLE_DATA_BATCH_CHANNEL_NAME "VEH_BATCH"
+
+/**
+ * DLC of Vehicle Data Batch Channel, see TelemetryBatch for the frame format.
+ * The timestamps are in DCS time [ms], if the clock is synchronized, otherwise in robot time [ms].
+ * They are derived from the us clock and therefore wrap around after 2^32 us (~71.6 min).
+ */
+#define VEHICLE_DATA_BATCH_CHANNEL_DLC (TelemetryBatch::FRAME_SIZE)
+
+/** Name of Channel to send the speed preview to. */
+#define SPEED_PREVIEW_CHANNEL_NAME "SPEED_PREV"
+
+/** DLC of Speed Preview Channel */
+#define SPEED_PREVIEW_CHANNEL_DLC (sizeof(SpeedPreview))
+
+/** Number of planned speeds in the speed preview. */
+#define SPEED_PREVIEW_SAMPLES (10U)
+
+/** Time between two planned speeds in the speed preview in ms. */
+#define SPEED_PREVIEW_INTERVAL (50U)
+
 /** Name of Channel to send system status to. */
 #define STATUS_CHANNEL_NAME "STATUS"
 
 /** DLC of Status Channel */
 #define STATUS_CHANNEL_DLC (sizeof(Status))
 
+/** Name of Channel to send profiler data to. */
+#define PROFILE_CHANNEL_NAME "PROFILE"
+
+/** DLC of Profile Channel */
+#define PROFILE_CHANNEL_DLC (sizeof(ProfileData))
+
+/** Name of Channel to send clock synchronization requests to. */
+#define TIME_SYNC_REQUEST_CHANNEL_NAME "TIME_REQ"
+
+/** DLC of Time Sync Request Channel */
+#define TIME_SYNC_REQUEST_CHANNEL_DLC (sizeof(TimeSyncRequest))
+
+/** Name of Channel to receive clock synchronization responses from. */
+#define TIME_SYNC_RESPONSE_CHANNEL_NAME "TIME_RSP"
+
+/** DLC of Time Sync Response Channel */
+#define TIME_SYNC_RESPONSE_CHANNEL_DLC (sizeof(TimeSyncResponse))
+
+/** Name of Channel to receive parameter requests from. */
+#define PARAMETER_CHANNEL_NAME "PARAM"
+
+/** DLC of Parameter Channel */
+#define PARAMETER_CHANNEL_DLC (sizeof(ParameterServer::Request))
+
+/** Name of Channel to send parameter responses to. */
+#define PARAMETER_RESPONSE_CHANNEL_NAME "PARAM_RSP"
+
+/** DLC of Parameter Response Channel */
+#define PARAMETER_RESPONSE_CHANNEL_DLC (sizeof(ParameterServer::Response))
+
 /******************************************************************************
  * Types and Classes
  *****************************************************************************/
@@ -133,6 +200,20 @@ namespace SMPChannelPayload
 
     } Range; /**< Proximity Sensor Ranges */
 
+    /** Values of a single sample in the "Vehicle Data Batch" channel, in this order. */
+    typedef enum : uint8_t
+    {
+        VEHICLE_DATA_X_POS = 0,   /**< X position [mm]. */
+        VEHICLE_DATA_Y_POS,       /**< Y position [mm]. */
+        VEHICLE_DATA_ORIENTATION, /**< Orientation [mrad]. */
+        VEHICLE_DATA_LEFT,        /**< Left motor speed [mm/s]. */
+        VEHICLE_DATA_RIGHT,       /**< Right motor speed [mm/s]. */
+        VEHICLE_DATA_CENTER,      /**< Center speed [mm/s]. */
+        VEHICLE_DATA_PROXIMITY,   /**< Range at which object is found [range]. */
+        VEHICLE_DATA_VALUE_COUNT  /**< Number of values per sample. */
+
+    } VehicleDataValue; /**< Vehicle data sample value */
+
 } /* namespace SMPChannelPayload */
 
 /** Struct of the "Command" channel payload. */
@@ -185,14 +266,67 @@ typedef struct _VehicleData
     int32_t                  right;       /**< Right motor speed [mm/s]. */
     int32_t                  center;      /**< Center speed [mm/s]. */
     SMPChannelPayload::Range proximity;   /**< Range at which object is found [range]. */
+#if (0 != CONFIG_VEHICLE_DATA_TIMESTAMP)
+    uint32_t timestamp; /**< Sample timestamp in DCS time [us]. 0 if the clock is not synchronized. */
+#endif                  /* (0 != CONFIG_VEHICLE_DATA_TIMESTAMP) */
 } __attribute__((packed)) VehicleData;
 
+/**
+ * Struct of the "Speed Preview" channel payload.
+ * It contains the planned center speed of the leader for the next
+ * SPEED_PREVIEW_SAMPLES * SPEED_PREVIEW_INTERVAL ms, which can be used
+ * by the followers for feed forward.
+ */
+typedef struct _SpeedPreview
+{
+    uint32_t timestamp; /**< DCS time of the first planned speed [us]. 0 if the clock is not synchronized. */
+    uint8_t  events;    /**< Track events since the last preview, see DrivingState::TrackEvent. */
+    uint8_t  interval;  /**< Time between two planned speeds [ms]. */
+    int16_t  speeds[SPEED_PREVIEW_SAMPLES]; /**< Planned center speeds [mm/s], the first one is the current. */
+} __attribute__((packed)) SpeedPreview;
+
 /** Struct of the "Status" channel payload. */
 typedef struct _Status
 {
-    SMPChannelPayload::Status status; /**< Status */
+    SMPChannelPayload::Status status;      /**< Status */
+    uint8_t                   degradation; /**< Telemetry degradation level, see LoadGovernor::Level. */
 } __attribute__((packed)) Status;
 
+/** Struct of the "Profile" channel payload. */
+typedef struct _ProfileData
+{
+    uint8_t  section;                             /**< Profiler section, see Profiler::Section. */
+    uint16_t count;                               /**< Number of measurements. */
+    uint16_t min;                                 /**< Min. execution time [us]. */
+    uint16_t max;                                 /**< Max. execution time [us]. */
+    uint16_t mean;                                /**< Mean execution time [us]. */
+    uint16_t histogram[Profiler::HISTOGRAM_BINS]; /**< Number of measurements per histogram bin. */
+} __attribute__((packed)) ProfileData;
+
+/**
+ * Struct of the "Time Sync Request" channel payload.
+ * Besides the request, it contains the current clock estimation of the robot,
+ * which allows the DCS to convert robot timestamps to DCS time.
+ */
+typedef struct _TimeSyncRequest
+{
+    uint8_t  sequence;          /**< Sequence number, which is mirrored by the response. */
+    uint32_t transmitTimestamp; /**< T1: Transmit timestamp in robot time [us]. */
+    uint8_t  isSynced;          /**< 1 if the following estimation is valid, otherwise 0. */
+    uint32_t offset;            /**< Clock offset (DCS - robot) [us]. */
+    int32_t  drift;             /**< Drift of the DCS clock relative to the robot clock [ppm]. */
+    uint32_t syncTimestamp;     /**< Robot timestamp of the estimation [us]. */
+} __attribute__((packed)) TimeSyncRequest;
+
+/** Struct of the "Time Sync Response" channel payload. */
+typedef struct _TimeSyncResponse
+{
+    uint8_t  sequence;          /**< Sequence number of the request. */
+    uint32_t originTimestamp;   /**< T1: Transmit timestamp of the request in robot time [us]. */
+    uint32_t receiveTimestamp;  /**< T2: Receive timestamp of the request in DCS time [us]. */
+    uint32_t transmitTimestamp; /**< T3: Transmit timestamp of the response in DCS time [us]. */
+} __attribute__((packed)) TimeSyncResponse;
+
 /******************************************************************************
  * Functions
  *****************************************************************************/
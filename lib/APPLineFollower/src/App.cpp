@@ -36,9 +36,11 @@
 #include "StartupState.h"
 #include <Board.h>
 #include <Speedometer.h>
+#include <Profiler.h>
 #include <DifferentialDrive.h>
 #include <Odometry.h>
 #include <Util.h>
+#include <Logging.h>
 #include <Sound.h>
 
 /******************************************************************************
@@ -75,13 +77,19 @@ void App::setup()
     /* Setup the state machine with the first state. */
     m_systemStateMachine.setState(&StartupState::getInstance());
 
-    /* Setup the periodically processing of robot control.  */
-    m_controlInterval.start(DIFFERENTIAL_DRIVE_CONTROL_PERIOD);
+    /* Setup the periodically processing of robot control. The number of tasks
+     * is below the scheduler limit, therefore the task id is not checked.
+     */
+    (void)m_scheduler.addTask(controlTask, this, DIFFERENTIAL_DRIVE_CONTROL_PERIOD, CONTROL_TASK_PRIORITY);
+#if (0 != CONFIG_PROFILER_ENABLE)
+    (void)m_scheduler.addTask(profileTask, this, LOG_PROFILE_DATA_PERIOD, PROFILE_TASK_PRIORITY);
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+    m_scheduler.start();
 
 #if CONFIG_SUPERVISOR != 0
 #if CONFIG_ODOMETRY_TO_SUPERVISOR != 0
     /* Reset supervisor which set its observed position and orientation to 0. */
-    Board::getInstance().getSupervisorSerialDrv().print("RST");
+    m_poseTelemetry.sendReset();
 #endif /* CONFIG_ODOMETRY_TO_SUPERVISOR != 0 */
 #endif /* CONFIG_SUPERVISOR != 0 */
 
@@ -91,46 +99,31 @@ void App::setup()
 
 void App::loop()
 {
-    Board::getInstance().process();
-    Speedometer::getInstance().process();
-
-    if (true == m_controlInterval.isTimeout())
     {
-        /* The differential drive control needs the measured speed of the
-         * left and right wheel. Therefore it shall be processed after
-         * the speedometer.
-         */
-        DifferentialDrive::getInstance().process(DIFFERENTIAL_DRIVE_CONTROL_PERIOD);
-
-        /* The odometry unit needs to detect motor speed changes to be able to
-         * calculate correct values. Therefore it shall be processed right after
-         * the differential drive control.
-         */
-        Odometry::getInstance().process();
-
-#if CONFIG_SUPERVISOR != 0
-#if CONFIG_ODOMETRY_TO_SUPERVISOR != 0
-        {
-            Odometry&    odo         = Odometry::getInstance();
-            int32_t      posX        = 0;
-            int32_t      posY        = 0;
-            int32_t      orientation = odo.getOrientation();
-            const size_t BUFFER_SIZE = 128U;
-            char         buffer[BUFFER_SIZE];
+        PROFILER_SCOPE(Profiler::SECTION_BOARD);
+        Board::getInstance().process();
+    }
 
-            odo.getPosition(posX, posY);
+    /* Play the queued tones without blocking. */
+    Sound::process();
 
-            snprintf(buffer, BUFFER_SIZE, "ODO,%d,%d,%d", posX, posY, orientation);
+    {
+        PROFILER_SCOPE(Profiler::SECTION_SPEEDOMETER);
+        Speedometer::getInstance().process();
+    }
 
-            Board::getInstance().getSupervisorSerialDrv().print(buffer);
-        }
-#endif /* CONFIG_ODOMETRY_TO_SUPERVISOR != 0 */
-#endif /* CONFIG_SUPERVISOR != 0 */
+    /* The scheduler runs the differential drive control first, because it has
+     * the highest priority. It needs the measured speed of the speedometer.
+     */
+    m_scheduler.process();
 
-        m_controlInterval.restart();
+    {
+        PROFILER_SCOPE(Profiler::SECTION_STATE_MACHINE);
+        m_systemStateMachine.process();
     }
 
-    m_systemStateMachine.process();
+    /* Send the buffered log records, if the binary logging backend is used. */
+    Logging::process();
 }
 
 /******************************************************************************
@@ -141,6 +134,57 @@ void App::loop()
  * Private Methods
  *****************************************************************************/
 
+void App::controlTask(void* userData)
+{
+#if (CONFIG_SUPERVISOR != 0) && (CONFIG_ODOMETRY_TO_SUPERVISOR != 0)
+    App* application = reinterpret_cast<App*>(userData);
+#else  /* (CONFIG_SUPERVISOR != 0) && (CONFIG_ODOMETRY_TO_SUPERVISOR != 0) */
+    (void)userData;
+#endif /* (CONFIG_SUPERVISOR != 0) && (CONFIG_ODOMETRY_TO_SUPERVISOR != 0) */
+
+    /* The differential drive control needs the measured speed of the
+     * left and right wheel. Therefore it shall be processed after
+     * the speedometer.
+     */
+    {
+        PROFILER_SCOPE(Profiler::SECTION_DIFFERENTIAL_DRIVE);
+        DifferentialDrive::getInstance().process(DIFFERENTIAL_DRIVE_CONTROL_PERIOD);
+    }
+
+    /* The odometry unit needs to detect motor speed changes to be able to
+     * calculate correct values. Therefore it shall be processed right after
+     * the differential drive control.
+     */
+    {
+        PROFILER_SCOPE(Profiler::SECTION_ODOMETRY);
+        Odometry::getInstance().process();
+    }
+
+#if CONFIG_SUPERVISOR != 0
+#if CONFIG_ODOMETRY_TO_SUPERVISOR != 0
+    if (nullptr != application)
+    {
+        Odometry& odo  = Odometry::getInstance();
+        int32_t   posX = 0;
+        int32_t   posY = 0;
+
+        odo.getPosition(posX, posY);
+
+        application->m_poseTelemetry.sendPose(millis(), posX, posY, odo.getOrientation());
+    }
+#endif /* CONFIG_ODOMETRY_TO_SUPERVISOR != 0 */
+#endif /* CONFIG_SUPERVISOR != 0 */
+}
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+void App::profileTask(void* userData)
+{
+    (void)userData;
+
+    Profiler::logAll();
+}
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -44,9 +44,17 @@
  * Includes
  *****************************************************************************/
 #include <StateMachine.h>
-#include <SimpleTimer.h>
+#include <Scheduler.h>
+#include <Profiler.h>
 #include <Arduino.h>
 
+#if CONFIG_SUPERVISOR != 0
+#if CONFIG_ODOMETRY_TO_SUPERVISOR != 0
+#include <Board.h>
+#include <PoseTelemetry.h>
+#endif /* CONFIG_ODOMETRY_TO_SUPERVISOR != 0 */
+#endif /* CONFIG_SUPERVISOR != 0 */
+
 /******************************************************************************
  * Macros
  *****************************************************************************/
@@ -62,7 +70,15 @@ public:
     /**
      * Construct the line follower application.
      */
-    App() : m_systemStateMachine(), m_controlInterval()
+    App() :
+        m_systemStateMachine(),
+        m_scheduler()
+#if CONFIG_SUPERVISOR != 0
+#if CONFIG_ODOMETRY_TO_SUPERVISOR != 0
+        ,
+        m_poseTelemetry(Board::getInstance().getSupervisorSerialDrv())
+#endif /* CONFIG_ODOMETRY_TO_SUPERVISOR != 0 */
+#endif /* CONFIG_SUPERVISOR != 0 */
     {
     }
 
@@ -90,11 +106,43 @@ private:
     /** Baudrate for Serial Communication */
     static const uint32_t SERIAL_BAUDRATE = 115200U;
 
+    /** Task priority of the differential drive control, which shall always run first. */
+    static const uint8_t CONTROL_TASK_PRIORITY = Scheduler::PRIORITY_HIGHEST;
+
+    /** Task priority of logging the profiler data. */
+    static const uint8_t PROFILE_TASK_PRIORITY = CONTROL_TASK_PRIORITY + 1U;
+
+    /** Profiler data logging period in ms. */
+    static const uint32_t LOG_PROFILE_DATA_PERIOD = 2000U;
+
     /** The system state machine. */
     StateMachine m_systemStateMachine;
 
-    /** Timer used for differential drive control processing. */
-    SimpleTimer m_controlInterval;
+    /** Scheduler for the periodic tasks. */
+    Scheduler m_scheduler;
+
+#if CONFIG_SUPERVISOR != 0
+#if CONFIG_ODOMETRY_TO_SUPERVISOR != 0
+    /** Pose telemetry to the supervisor. */
+    PoseTelemetry m_poseTelemetry;
+#endif /* CONFIG_ODOMETRY_TO_SUPERVISOR != 0 */
+#endif /* CONFIG_SUPERVISOR != 0 */
+
+    /**
+     * Periodic differential drive control task.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void controlTask(void* userData);
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+    /**
+     * Periodic task to log the profiler statistics.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void profileTask(void* userData);
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
 
     /**
      * Copy construction of an instance.
@@ -41,6 +41,7 @@
 #include "ReadyState.h"
 #include "ParameterSets.h"
 #include <Util.h>
+#include <Logging.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -70,6 +71,11 @@ static void logCsvDataSpeed(int16_t leftSpeed, int16_t rightSpeed);
  * Local Variables
  *****************************************************************************/
 
+/**
+ * Logging source.
+ */
+LOG_TAG("DState");
+
 #ifdef DEBUG_ALGORITHM
 static int16_t gSpeedLeft  = 0;
 static int16_t gSpeedRight = 0;
@@ -246,7 +252,7 @@ void DrivingState::process(StateMachine& sm)
          */
         diffDrive.setLinearSpeed(0, 0);
 
-        Sound::playAlarm(); /* Blocking! */
+        Sound::playAlarm();
 
         /* Clear lap time. */
         ReadyState::getInstance().setLapTime(0);
@@ -268,9 +274,15 @@ void DrivingState::process(StateMachine& sm)
         /* Process the line follower PID controller periodically to adapt driving. */
         if (true == m_pidProcessTime.isTimeout())
         {
+            /* Except the immediate first run, the controller uses the real elapsed time since its last run. */
+            if (0U < m_pidProcessTime.getDuration())
+            {
+                m_pidCtrl.setSampleTime(Timebase::toMs(m_pidProcessTime.getCurrentDuration()));
+            }
+
             adaptDriving(position, allowNegativeMotorSpeed);
 
-            m_pidProcessTime.start(PID_PROCESS_PERIOD);
+            m_pidProcessTime.start(Timebase::fromMs(PID_PROCESS_PERIOD));
         }
     }
     /* Finished. */
@@ -738,6 +750,7 @@ bool DrivingState::isAbortRequired()
         /* Max. distance driven, but track still not found? */
         if (MAX_DISTANCE < Odometry::getInstance().getMileageCenter())
         {
+            LOG_WARNING("Abort: Track lost.");
             isAbort = true;
         }
     }
@@ -747,6 +760,7 @@ bool DrivingState::isAbortRequired()
     {
         if (true == m_observationTimer.isTimeout())
         {
+            LOG_WARNING("Abort: Lap timeout.");
             isAbort = true;
         }
     }
@@ -36,9 +36,11 @@
 #include "StartupState.h"
 #include <Board.h>
 #include <Speedometer.h>
+#include <Profiler.h>
 #include <DifferentialDrive.h>
 #include <Odometry.h>
 #include <Util.h>
+#include <Logging.h>
 #include <Sound.h>
 
 /******************************************************************************
@@ -75,16 +77,45 @@ void App::setup()
     /* Setup the state machine with the first state. */
     m_systemStateMachine.setState(&StartupState::getInstance());
 
+#if (0 != CONFIG_PROFILER_ENABLE)
+    m_profileTimer.start(LOG_PROFILE_DATA_PERIOD);
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+
     /* Surprise the audience. */
     Sound::playMelody(Sound::MELODY_WELCOME);
 }
 
 void App::loop()
 {
-    Board::getInstance().process();
-    Speedometer::getInstance().process();
-
-    m_systemStateMachine.process();
+    {
+        PROFILER_SCOPE(Profiler::SECTION_BOARD);
+        Board::getInstance().process();
+    }
+
+    /* Play the queued tones without blocking. */
+    Sound::process();
+
+    {
+        PROFILER_SCOPE(Profiler::SECTION_SPEEDOMETER);
+        Speedometer::getInstance().process();
+    }
+
+    {
+        PROFILER_SCOPE(Profiler::SECTION_STATE_MACHINE);
+        m_systemStateMachine.process();
+    }
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+    if (true == m_profileTimer.isTimeout())
+    {
+        Profiler::logAll();
+
+        m_profileTimer.restart();
+    }
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+
+    /* Send the buffered log records, if the binary logging backend is used. */
+    Logging::process();
 }
 
 /******************************************************************************
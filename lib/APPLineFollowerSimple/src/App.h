@@ -44,6 +44,8 @@
  * Includes
  *****************************************************************************/
 #include <StateMachine.h>
+#include <Profiler.h>
+#include <SimpleTimer.h>
 #include <Arduino.h>
 
 /******************************************************************************
@@ -61,7 +63,12 @@ public:
     /**
      * Construct the line follower application.
      */
-    App() : m_systemStateMachine()
+    App() :
+        m_systemStateMachine()
+#if (0 != CONFIG_PROFILER_ENABLE)
+        ,
+        m_profileTimer()
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
     {
     }
 
@@ -86,9 +93,17 @@ private:
     /** Baudrate for Serial Communication */
     static const uint32_t SERIAL_BAUDRATE = 115200U;
 
+    /** Profiler data logging period in ms. */
+    static const uint32_t LOG_PROFILE_DATA_PERIOD = 2000U;
+
     /** The system state machine. */
     StateMachine m_systemStateMachine;
 
+#if (0 != CONFIG_PROFILER_ENABLE)
+    /** Timer used for logging the profiler data periodically. */
+    SimpleTimer m_profileTimer;
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+
     /**
      * Copy construction of an instance.
      * Not allowed.
@@ -39,6 +39,7 @@
 #include "LineSensorsCalibrationState.h"
 #include <Board.h>
 #include <Speedometer.h>
+#include <Profiler.h>
 #include <DifferentialDrive.h>
 #include <Odometry.h>
 #include <Logging.h>
@@ -64,6 +65,11 @@ static void App_cmdChannelCallback(const uint8_t* payload, const uint8_t payload
 static void App_motorSpeedSetpointsChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData);
 static void App_statusChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData);
 static void App_robotSpeedSetpointChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData);
+static void App_motionScriptChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData);
+static void App_waypointsChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData);
+static void App_parameterChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData);
+static void App_parameterChangeCallback(uint8_t index, void* userData);
+static void App_parameterStoreCallback(void* userData);
 
 /******************************************************************************
  * Local Variables
@@ -78,15 +84,53 @@ App::App() :
     m_serialMuxProtChannelIdCurrentVehicleData(0U),
     m_serialMuxProtChannelIdStatus(0U),
     m_serialMuxProtChannelIdLineSensors(0U),
+    m_serialMuxProtChannelIdParameterRsp(0U),
     m_systemStateMachine(),
-    m_controlInterval(),
-    m_reportTimer(),
-    m_statusTimer(),
+    m_scheduler(),
+    m_loadGovernor(MIN_CONTROL_SLACK),
+    m_reportTaskId(Scheduler::INVALID_TASK_ID),
+    m_lineSensorsTaskId(Scheduler::INVALID_TASK_ID),
     m_statusTimeoutTimer(),
-    m_sendLineSensorsDataInterval(),
     m_smpServer(Serial, this),
+    m_parameterRegistry(),
+    m_parameterServer(m_parameterRegistry),
+    m_speedPIDFactors(),
+    m_maxMotorSpeed(0),
+    m_setpointDelay(0U),
+    m_setpointMaxExtrapolation(0U),
+    m_setpointTimeout(0U),
+    m_setpointRampDuration(0U),
+    m_waypointLookahead(0U),
+    m_waypointSpeed(0),
+#if (0 != CONFIG_LINE_SENSOR_BITMASK)
+    m_lineSensorsThreshold(LINE_SENSORS_THRESHOLD),
+#endif /* (0 != CONFIG_LINE_SENSOR_BITMASK) */
     m_isLineSensorCalibPending(false),
-    m_movAvgProximitySensor()
+    m_isMotionScriptValid(false),
+    m_isMotionScriptReported(false),
+    m_motionScriptStep(0U),
+    m_isWaypointsValid(false),
+    m_isWaypointsReported(false),
+    m_waypoint(0U),
+    m_lineSensorsFilter(LINE_SENSORS_FILTER_VALUES, LINE_SENSORS_DEADBAND, LINE_SENSORS_MIN_SEND_INTERVAL,
+                        LINE_SENSORS_MAX_SEND_INTERVAL),
+    m_movAvgProximitySensor(),
+    m_proximityReadCountdown(0U)
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+    ,
+    m_vehicleDataBatch(SMPChannelPayload::VEHICLE_DATA_VALUE_COUNT)
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
+#if (0 != CONFIG_PROFILER_ENABLE)
+    ,
+    m_serialMuxProtChannelIdProfile(0U),
+    m_profileSection(0U)
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+#if CONFIG_SUPERVISOR != 0
+#if CONFIG_ODOMETRY_TO_SUPERVISOR != 0
+    ,
+    m_poseTelemetry(Board::getInstance().getSupervisorSerialDrv())
+#endif /* CONFIG_ODOMETRY_TO_SUPERVISOR != 0 */
+#endif /* CONFIG_SUPERVISOR != 0 */
 {
 }
 
@@ -101,18 +145,24 @@ void App::setup()
         ErrorState::getInstance().setErrorMsg("SMP=0");
         m_systemStateMachine.setState(&ErrorState::getInstance());
     }
+    else if (false == setupParameters())
+    {
+        ErrorState::getInstance().setErrorMsg("PAR=0");
+        m_systemStateMachine.setState(&ErrorState::getInstance());
+    }
+    else if (false == setupScheduler())
+    {
+        ErrorState::getInstance().setErrorMsg("SCH=0");
+        m_systemStateMachine.setState(&ErrorState::getInstance());
+    }
     else
     {
-        m_reportTimer.start(REPORTING_PERIOD);
-        m_controlInterval.start(DIFFERENTIAL_DRIVE_CONTROL_PERIOD);
-        m_statusTimer.start(SEND_STATUS_TIMER_INTERVAL);
-        m_sendLineSensorsDataInterval.start(SEND_LINE_SENSORS_DATA_PERIOD);
         m_systemStateMachine.setState(&StartupState::getInstance());
 
 #if CONFIG_SUPERVISOR != 0
 #if CONFIG_ODOMETRY_TO_SUPERVISOR != 0
         /* Reset supervisor which set its observed position and orientation to 0. */
-        Board::getInstance().getSupervisorSerialDrv().print("RST");
+        m_poseTelemetry.sendReset();
 #endif /* CONFIG_ODOMETRY_TO_SUPERVISOR != 0 */
 #endif /* CONFIG_SUPERVISOR != 0 */
     }
@@ -120,67 +170,20 @@ void App::setup()
 
 void App::loop()
 {
-    Board::getInstance().process();
-    Speedometer::getInstance().process();
-
-    if (true == m_controlInterval.isTimeout())
     {
-        /* The differential drive control needs the measured speed of the
-         * left and right wheel. Therefore it shall be processed after
-         * the speedometer.
-         */
-        DifferentialDrive::getInstance().process(DIFFERENTIAL_DRIVE_CONTROL_PERIOD);
-
-        /* The odometry unit needs to detect motor speed changes to be able to
-         * calculate correct values. Therefore it shall be processed right after
-         * the differential drive control.
-         */
-        Odometry::getInstance().process();
-
-#if CONFIG_SUPERVISOR != 0
-#if CONFIG_ODOMETRY_TO_SUPERVISOR != 0
-        {
-            Odometry&    odo         = Odometry::getInstance();
-            int32_t      posX        = 0;
-            int32_t      posY        = 0;
-            int32_t      orientation = odo.getOrientation();
-            const size_t BUFFER_SIZE = 128U;
-            char         buffer[BUFFER_SIZE];
-
-            odo.getPosition(posX, posY);
-
-            snprintf(buffer, BUFFER_SIZE, "ODO,%d,%d,%d", posX, posY, orientation);
-
-            Board::getInstance().getSupervisorSerialDrv().print(buffer);
-        }
-#endif /* CONFIG_ODOMETRY_TO_SUPERVISOR != 0 */
-#endif /* CONFIG_SUPERVISOR != 0 */
-
-        m_controlInterval.restart();
+        PROFILER_SCOPE(Profiler::SECTION_BOARD);
+        Board::getInstance().process();
     }
 
-    if ((true == m_reportTimer.isTimeout()) && (true == m_smpServer.isSynced()))
     {
-        /* Send current data to SerialMuxProt Client */
-        reportVehicleData();
-
-        m_reportTimer.restart();
+        PROFILER_SCOPE(Profiler::SECTION_SPEEDOMETER);
+        Speedometer::getInstance().process();
     }
 
-    if ((true == m_statusTimer.isTimeout()) && (true == m_smpServer.isSynced()))
-    {
-        Status payload = {SMPChannelPayload::Status::STATUS_FLAG_OK};
-
-        if (&ErrorState::getInstance() == m_systemStateMachine.getState())
-        {
-            payload.status = SMPChannelPayload::Status::STATUS_FLAG_ERROR;
-        }
-
-        /* Ignoring return value, as error handling is not available. */
-        (void)m_smpServer.sendData(m_serialMuxProtChannelIdStatus, &payload, sizeof(payload));
-
-        m_statusTimer.restart();
-    }
+    /* The scheduler runs the differential drive control first, because it has
+     * the highest priority. It needs the measured speed of the speedometer.
+     */
+    m_scheduler.process();
 
     if (true == m_statusTimeoutTimer.isTimeout())
     {
@@ -198,17 +201,15 @@ void App::loop()
         }
     }
 
-    /* Send periodically line sensor data. */
-    if ((true == m_sendLineSensorsDataInterval.isTimeout()) && (true == m_smpServer.isSynced()))
     {
-        sendLineSensorsData();
-
-        m_sendLineSensorsDataInterval.restart();
+        PROFILER_SCOPE(Profiler::SECTION_SMP);
+        m_smpServer.process(millis());
     }
 
-    m_smpServer.process(millis());
-
-    m_systemStateMachine.process();
+    {
+        PROFILER_SCOPE(Profiler::SECTION_STATE_MACHINE);
+        m_systemStateMachine.process();
+    }
 
     /* If line sensor calibration is completed, send response to the remote driver. */
     if ((true == m_isLineSensorCalibPending) &&
@@ -276,6 +277,56 @@ void App::handleRemoteCommand(const Command& cmd)
         Odometry::getInstance().setOrientation(cmd.orientation);
         break;
 
+    case SMPChannelPayload::CmdId::CMD_ID_START_SCRIPT:
+        if ((true == m_isMotionScriptValid) && (true == DrivingState::getInstance().startMotionScript()))
+        {
+            MotionScript& script = DrivingState::getInstance().getMotionScript();
+
+            /* The progress is reported from now on. */
+            m_isMotionScriptReported = true;
+            m_motionScriptStep       = script.getCurrentStep();
+            rsp.responseId           = SMPChannelPayload::RSP_ID_PENDING;
+            rsp.scriptStep           = m_motionScriptStep;
+            rsp.scriptLength         = script.getLength();
+        }
+        else
+        {
+            rsp.responseId = SMPChannelPayload::RSP_ID_ERROR;
+        }
+        break;
+
+    case SMPChannelPayload::CmdId::CMD_ID_STOP_SCRIPT:
+        DrivingState::getInstance().stopMotionScript();
+
+        /* The stop is confirmed by this response, not by the progress. */
+        m_isMotionScriptReported = false;
+        break;
+
+    case SMPChannelPayload::CmdId::CMD_ID_START_WAYPOINTS:
+        if ((true == m_isWaypointsValid) && (true == DrivingState::getInstance().startWaypoints()))
+        {
+            WaypointFollower& follower = DrivingState::getInstance().getWaypointFollower();
+
+            /* The progress is reported from now on. */
+            m_isWaypointsReported = true;
+            m_waypoint            = follower.getCurrentWaypoint();
+            rsp.responseId        = SMPChannelPayload::RSP_ID_PENDING;
+            rsp.waypoint          = m_waypoint;
+            rsp.waypointCount     = follower.getLength();
+        }
+        else
+        {
+            rsp.responseId = SMPChannelPayload::RSP_ID_ERROR;
+        }
+        break;
+
+    case SMPChannelPayload::CmdId::CMD_ID_STOP_WAYPOINTS:
+        DrivingState::getInstance().stopWaypoints();
+
+        /* The stop is confirmed by this response, not by the progress. */
+        m_isWaypointsReported = false;
+        break;
+
     default:
         /* Command not known/relevant to the application. */
         rsp.responseId = SMPChannelPayload::RSP_ID_ERROR;
@@ -307,6 +358,126 @@ void App::systemStatusCallback(SMPChannelPayload::Status status)
     m_statusTimeoutTimer.start(STATUS_TIMEOUT_TIMER_INTERVAL);
 }
 
+void App::handleMotionScriptData(const MotionScriptData& data)
+{
+    MotionScript& script = DrivingState::getInstance().getMotionScript();
+
+    /* The running script can't be replaced. */
+    if (true == script.isRunning())
+    {
+        m_isMotionScriptValid = false;
+    }
+    else
+    {
+        uint8_t idx = 0U;
+
+        /* The first frame starts a new script. */
+        if (0U == data.index)
+        {
+            script.clear();
+            m_isMotionScriptValid = true;
+        }
+
+        /* The frames shall be uploaded in order, without gaps. */
+        if ((data.index != script.getLength()) || (MOTION_SCRIPT_STEPS_PER_FRAME < data.count))
+        {
+            m_isMotionScriptValid = false;
+        }
+
+        while ((true == m_isMotionScriptValid) && (data.count > idx))
+        {
+            MotionScript::Step step;
+
+            step.type         = static_cast<MotionScript::StepType>(data.steps[idx].type);
+            step.target       = data.steps[idx].target;
+            step.linearSpeed  = data.steps[idx].linearSpeed;
+            step.angularSpeed = data.steps[idx].angularSpeed;
+
+            if (false == script.addStep(step))
+            {
+                m_isMotionScriptValid = false;
+            }
+
+            ++idx;
+        }
+    }
+}
+
+void App::handleWaypointData(const WaypointData& data)
+{
+    WaypointFollower& follower = DrivingState::getInstance().getWaypointFollower();
+
+    /* The followed waypoints can't be replaced. */
+    if (true == follower.isRunning())
+    {
+        m_isWaypointsValid = false;
+    }
+    else
+    {
+        uint8_t idx = 0U;
+
+        /* The first frame starts a new path. */
+        if (0U == data.index)
+        {
+            follower.clear();
+            m_isWaypointsValid = true;
+        }
+
+        /* The frames shall be uploaded in order, without gaps. */
+        if ((data.index != follower.getLength()) || (WAYPOINTS_PER_FRAME < data.count))
+        {
+            m_isWaypointsValid = false;
+        }
+
+        while ((true == m_isWaypointsValid) && (data.count > idx))
+        {
+            WaypointFollower::Waypoint waypoint;
+
+            waypoint.x     = data.waypoints[idx].xPos;
+            waypoint.y     = data.waypoints[idx].yPos;
+            waypoint.speed = data.waypoints[idx].speed;
+
+            if (false == follower.addWaypoint(waypoint))
+            {
+                m_isWaypointsValid = false;
+            }
+
+            ++idx;
+        }
+    }
+}
+
+void App::handleParameterRequest(const ParameterServer::Request& request)
+{
+    ParameterServer::Response response;
+
+    /* The owners may have changed the parameters since the last request. */
+    updateParameters();
+
+    m_parameterServer.handleRequest(request, response);
+
+    /* Ignoring return value, as error handling is not available. */
+    (void)m_smpServer.sendData(m_serialMuxProtChannelIdParameterRsp, &response, sizeof(response));
+}
+
+void App::applyParameters()
+{
+    DifferentialDrive&   diffDrive   = DifferentialDrive::getInstance();
+    SetpointConditioner& conditioner = DrivingState::getInstance().getSetpointConditioner();
+    WaypointFollower&    follower    = DrivingState::getInstance().getWaypointFollower();
+
+    diffDrive.setPIDFactors(m_speedPIDFactors);
+    diffDrive.setMaxMotorSpeed(m_maxMotorSpeed);
+
+    conditioner.setDelay(m_setpointDelay);
+    conditioner.setMaxExtrapolation(m_setpointMaxExtrapolation);
+    conditioner.setTimeout(m_setpointTimeout);
+    conditioner.setRampDuration(m_setpointRampDuration);
+
+    follower.setLookaheadDistance(m_waypointLookahead);
+    follower.setDefaultSpeed(m_waypointSpeed);
+}
+
 /******************************************************************************
  * Protected Methods
  *****************************************************************************/
@@ -317,41 +488,167 @@ void App::systemStatusCallback(SMPChannelPayload::Status status)
 
 void App::reportVehicleData()
 {
-    IProximitySensors& proximitySensors = Board::getInstance().getProximitySensors();
-    Odometry&          odometry         = Odometry::getInstance();
-    Speedometer&       speedometer      = Speedometer::getInstance();
-    VehicleData        payload;
-    int32_t            xPos          = 0;
-    int32_t            yPos          = 0;
-    uint8_t            maxCounts     = 0U;
-    uint8_t            averageCounts = 0U;
-    uint8_t            leftCounts    = 0U;
-    uint8_t            rightCounts   = 0U;
-    int16_t            leftSpeed     = speedometer.getLinearSpeedLeft();
-    int16_t            rightSpeed    = speedometer.getLinearSpeedRight();
-    int16_t            centerSpeed   = speedometer.getLinearSpeedCenter();
-
-    proximitySensors.read();
-    leftCounts  = proximitySensors.countsFrontWithLeftLeds();
-    rightCounts = proximitySensors.countsFrontWithRightLeds();
-
-    /* Use the sensor value with the maximum counts. */
-    maxCounts     = leftCounts > rightCounts ? leftCounts : rightCounts;
-    averageCounts = m_movAvgProximitySensor.write(maxCounts);
+    Odometry&    odometry    = Odometry::getInstance();
+    Speedometer& speedometer = Speedometer::getInstance();
+    int32_t      xPos        = 0;
+    int32_t      yPos        = 0;
+    int16_t      leftSpeed   = speedometer.getLinearSpeedLeft();
+    int16_t      rightSpeed  = speedometer.getLinearSpeedRight();
+    int16_t      centerSpeed = speedometer.getLinearSpeedCenter();
+
+    if (0U < m_proximityReadCountdown)
+    {
+        --m_proximityReadCountdown;
+    }
+    else
+    {
+        IProximitySensors& proximitySensors = Board::getInstance().getProximitySensors();
+        uint8_t            maxCounts        = 0U;
+        uint8_t            leftCounts       = 0U;
+        uint8_t            rightCounts      = 0U;
+
+        proximitySensors.read();
+        leftCounts  = proximitySensors.countsFrontWithLeftLeds();
+        rightCounts = proximitySensors.countsFrontWithRightLeds();
+
+        /* Use the sensor value with the maximum counts. */
+        maxCounts = leftCounts > rightCounts ? leftCounts : rightCounts;
+        (void)m_movAvgProximitySensor.write(maxCounts);
+
+        m_proximityReadCountdown = (PROXIMITY_READ_PERIOD / REPORTING_PERIOD) - 1U;
+    }
 
     odometry.getPosition(xPos, yPos);
+
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+    int32_t  values[SMPChannelPayload::VEHICLE_DATA_VALUE_COUNT];
+    uint32_t timestamp = millis();
+
+    values[SMPChannelPayload::VEHICLE_DATA_X_POS]       = xPos;
+    values[SMPChannelPayload::VEHICLE_DATA_Y_POS]       = yPos;
+    values[SMPChannelPayload::VEHICLE_DATA_ORIENTATION] = odometry.getOrientation();
+    values[SMPChannelPayload::VEHICLE_DATA_LEFT]        = Util::stepsPerSecondToMillimetersPerSecond(leftSpeed);
+    values[SMPChannelPayload::VEHICLE_DATA_RIGHT]       = Util::stepsPerSecondToMillimetersPerSecond(rightSpeed);
+    values[SMPChannelPayload::VEHICLE_DATA_CENTER]      = Util::stepsPerSecondToMillimetersPerSecond(centerSpeed);
+    values[SMPChannelPayload::VEHICLE_DATA_PROXIMITY]   = m_movAvgProximitySensor.getResult();
+
+    /* If the batch is full, send it and add the sample to the next one. */
+    if (false == m_vehicleDataBatch.addSample(timestamp, values))
+    {
+        sendVehicleDataBatch();
+        (void)m_vehicleDataBatch.addSample(timestamp, values);
+    }
+
+    if (VEHICLE_DATA_BATCH_SAMPLES <= m_vehicleDataBatch.getSampleCount())
+    {
+        sendVehicleDataBatch();
+    }
+#else  /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
+    VehicleData payload;
+
     payload.xPos        = xPos;
     payload.yPos        = yPos;
     payload.orientation = odometry.getOrientation();
     payload.left        = Util::stepsPerSecondToMillimetersPerSecond(leftSpeed);
     payload.right       = Util::stepsPerSecondToMillimetersPerSecond(rightSpeed);
     payload.center      = Util::stepsPerSecondToMillimetersPerSecond(centerSpeed);
-    payload.proximity   = static_cast<SMPChannelPayload::Range>(averageCounts);
+    payload.proximity   = static_cast<SMPChannelPayload::Range>(m_movAvgProximitySensor.getResult());
 
     /* Ignoring return value, as error handling is not available. */
     (void)m_smpServer.sendData(m_serialMuxProtChannelIdCurrentVehicleData, &payload, sizeof(VehicleData));
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
 }
 
+void App::reportMotionScriptProgress()
+{
+    if (true == m_isMotionScriptReported)
+    {
+        const MotionScript& script = DrivingState::getInstance().getMotionScript();
+
+        if (true == script.isRunning())
+        {
+            if (m_motionScriptStep != script.getCurrentStep())
+            {
+                m_motionScriptStep = script.getCurrentStep();
+                sendMotionScriptResponse(SMPChannelPayload::RSP_ID_PENDING);
+            }
+        }
+        else
+        {
+            /* Not finished means aborted, e.g. because the driving state was left. */
+            m_motionScriptStep = script.getCurrentStep();
+            sendMotionScriptResponse((true == script.isFinished()) ? SMPChannelPayload::RSP_ID_OK
+                                                                   : SMPChannelPayload::RSP_ID_ERROR);
+
+            m_isMotionScriptReported = false;
+        }
+    }
+}
+
+void App::sendMotionScriptResponse(SMPChannelPayload::RspId responseId)
+{
+    CommandResponse rsp = {SMPChannelPayload::CMD_ID_START_SCRIPT, responseId};
+
+    rsp.scriptStep   = m_motionScriptStep;
+    rsp.scriptLength = DrivingState::getInstance().getMotionScript().getLength();
+
+    /* Ignoring return value, as error handling is not available. */
+    (void)m_smpServer.sendData(m_serialMuxProtChannelIdRemoteCtrlRsp, &rsp, sizeof(rsp));
+}
+
+void App::reportWaypointProgress()
+{
+    if (true == m_isWaypointsReported)
+    {
+        const WaypointFollower& follower = DrivingState::getInstance().getWaypointFollower();
+
+        if (true == follower.isRunning())
+        {
+            if (m_waypoint != follower.getCurrentWaypoint())
+            {
+                m_waypoint = follower.getCurrentWaypoint();
+                sendWaypointResponse(SMPChannelPayload::RSP_ID_PENDING);
+            }
+        }
+        else
+        {
+            /* Not finished means aborted, e.g. because the driving state was left. */
+            m_waypoint = follower.getCurrentWaypoint();
+            sendWaypointResponse((true == follower.isFinished()) ? SMPChannelPayload::RSP_ID_OK
+                                                                 : SMPChannelPayload::RSP_ID_ERROR);
+
+            m_isWaypointsReported = false;
+        }
+    }
+}
+
+void App::sendWaypointResponse(SMPChannelPayload::RspId responseId)
+{
+    CommandResponse rsp = {SMPChannelPayload::CMD_ID_START_WAYPOINTS, responseId};
+
+    rsp.waypoint      = m_waypoint;
+    rsp.waypointCount = DrivingState::getInstance().getWaypointFollower().getLength();
+
+    /* Ignoring return value, as error handling is not available. */
+    (void)m_smpServer.sendData(m_serialMuxProtChannelIdRemoteCtrlRsp, &rsp, sizeof(rsp));
+}
+
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+void App::sendVehicleDataBatch()
+{
+    if (0U < m_vehicleDataBatch.getSampleCount())
+    {
+        /* Ignoring return value, as error handling is not available. The receiver detects
+         * a lost batch by the sequence number.
+         */
+        (void)m_smpServer.sendData(m_serialMuxProtChannelIdCurrentVehicleData, m_vehicleDataBatch.getFrame(),
+                                   VEHICLE_DATA_BATCH_CHANNEL_DLC);
+
+        m_vehicleDataBatch.nextFrame();
+    }
+}
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
+
 bool App::setupSerialMuxProt()
 {
     bool isSuccessful = false;
@@ -360,15 +657,37 @@ bool App::setupSerialMuxProt()
     m_smpServer.subscribeToChannel(COMMAND_CHANNEL_NAME, App_cmdChannelCallback);
     m_smpServer.subscribeToChannel(MOTOR_SPEED_SETPOINT_CHANNEL_NAME, App_motorSpeedSetpointsChannelCallback);
     m_smpServer.subscribeToChannel(STATUS_CHANNEL_NAME, App_statusChannelCallback);
+    m_smpServer.subscribeToChannel(PARAMETER_CHANNEL_NAME, App_parameterChannelCallback);
     m_smpServer.subscribeToChannel(ROBOT_SPEED_SETPOINT_CHANNEL_NAME, App_robotSpeedSetpointChannelCallback);
+    m_smpServer.subscribeToChannel(MOTION_SCRIPT_CHANNEL_NAME, App_motionScriptChannelCallback);
+    m_smpServer.subscribeToChannel(WAYPOINTS_CHANNEL_NAME, App_waypointsChannelCallback);
 
     /* Channel creation. */
     m_serialMuxProtChannelIdRemoteCtrlRsp =
         m_smpServer.createChannel(COMMAND_RESPONSE_CHANNEL_NAME, COMMAND_RESPONSE_CHANNEL_DLC);
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+    m_serialMuxProtChannelIdCurrentVehicleData =
+        m_smpServer.createChannel(VEHICLE_DATA_BATCH_CHANNEL_NAME, VEHICLE_DATA_BATCH_CHANNEL_DLC);
+#else  /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
     m_serialMuxProtChannelIdCurrentVehicleData =
         m_smpServer.createChannel(CURRENT_VEHICLE_DATA_CHANNEL_NAME, CURRENT_VEHICLE_DATA_CHANNEL_DLC);
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
     m_serialMuxProtChannelIdStatus      = m_smpServer.createChannel(STATUS_CHANNEL_NAME, STATUS_CHANNEL_DLC);
+#if (0 != CONFIG_LINE_SENSOR_BITMASK)
+    m_serialMuxProtChannelIdLineSensors =
+        m_smpServer.createChannel(LINE_SENSOR_BITMASK_CHANNEL_NAME, LINE_SENSOR_BITMASK_CHANNEL_DLC);
+#else  /* (0 != CONFIG_LINE_SENSOR_BITMASK) */
     m_serialMuxProtChannelIdLineSensors = m_smpServer.createChannel(LINE_SENSOR_CHANNEL_NAME, LINE_SENSOR_CHANNEL_DLC);
+#endif /* (0 != CONFIG_LINE_SENSOR_BITMASK) */
+
+    /* The parameter tuning is optional, therefore it is not considered below. */
+    m_serialMuxProtChannelIdParameterRsp =
+        m_smpServer.createChannel(PARAMETER_RESPONSE_CHANNEL_NAME, PARAMETER_RESPONSE_CHANNEL_DLC);
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+    /* The profiler data is optional, therefore it is not considered below. */
+    m_serialMuxProtChannelIdProfile = m_smpServer.createChannel(PROFILE_CHANNEL_NAME, PROFILE_CHANNEL_DLC);
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
 
     /* Channels succesfully created? */
     if ((0U != m_serialMuxProtChannelIdCurrentVehicleData) && (0U != m_serialMuxProtChannelIdRemoteCtrlRsp) &&
@@ -380,25 +699,333 @@ bool App::setupSerialMuxProt()
     return isSuccessful;
 }
 
-void App::sendLineSensorsData() const
+bool App::setupParameters()
+{
+    bool isSuccessful = true;
+
+    updateParameters();
+    m_parameterRegistry.setChangeCallback(App_parameterChangeCallback, this);
+    m_parameterServer.setStoreCallback(App_parameterStoreCallback, this);
+
+    if ((false == m_parameterRegistry.add("maxSpeed", m_maxMotorSpeed, 1, INT16_MAX, true)) ||
+        (false == m_parameterRegistry.add("spdKpNum", m_speedPIDFactors.pNumerator, 0, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("spdKpDen", m_speedPIDFactors.pDenominator, 1, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("spdKiNum", m_speedPIDFactors.iNumerator, 0, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("spdKiDen", m_speedPIDFactors.iDenominator, 1, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("spdKdNum", m_speedPIDFactors.dNumerator, 0, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("spdKdDen", m_speedPIDFactors.dDenominator, 1, MAX_PID_FACTOR)) ||
+        (false == m_parameterRegistry.add("spDelay", m_setpointDelay, 0U, MAX_SETPOINT_TIME)) ||
+        (false == m_parameterRegistry.add("spExtrap", m_setpointMaxExtrapolation, 0U, MAX_SETPOINT_TIME)) ||
+        (false == m_parameterRegistry.add("spTimeout", m_setpointTimeout, 0U, MAX_SETPOINT_TIME)) ||
+        (false == m_parameterRegistry.add("spRamp", m_setpointRampDuration, 0U, MAX_SETPOINT_TIME)) ||
+        (false == m_parameterRegistry.add("wpLookahead", m_waypointLookahead, 1U, MAX_WAYPOINT_LOOKAHEAD)) ||
+        (false == m_parameterRegistry.add("wpSpeed", m_waypointSpeed, 1, INT16_MAX)))
+    {
+        isSuccessful = false;
+    }
+
+#if (0 != CONFIG_LINE_SENSOR_BITMASK)
+    if (false == m_parameterRegistry.add("lineThr", m_lineSensorsThreshold, 0U, LINE_SENSORS_VALUE_MAX))
+    {
+        isSuccessful = false;
+    }
+#endif /* (0 != CONFIG_LINE_SENSOR_BITMASK) */
+
+    return isSuccessful;
+}
+
+void App::updateParameters()
+{
+    DifferentialDrive&         diffDrive   = DifferentialDrive::getInstance();
+    const SetpointConditioner& conditioner = DrivingState::getInstance().getSetpointConditioner();
+    const WaypointFollower&    follower    = DrivingState::getInstance().getWaypointFollower();
+
+    diffDrive.getPIDFactors(m_speedPIDFactors);
+    m_maxMotorSpeed = diffDrive.getMaxMotorSpeed();
+
+    /* The limits of the parameters ensure that the times fit into 16 bit. */
+    m_setpointDelay            = static_cast<uint16_t>(conditioner.getDelay());
+    m_setpointMaxExtrapolation = static_cast<uint16_t>(conditioner.getMaxExtrapolation());
+    m_setpointTimeout          = static_cast<uint16_t>(conditioner.getTimeout());
+    m_setpointRampDuration     = static_cast<uint16_t>(conditioner.getRampDuration());
+
+    m_waypointLookahead = follower.getLookaheadDistance();
+    m_waypointSpeed     = follower.getDefaultSpeed();
+}
+
+void App::storeParameters()
+{
+    /* Only the max. motor speed is part of the settings. All other parameters
+     * are registered as volatile, which is reported in the response to the
+     * store request. They shall be taken over into the source code after tuning.
+     */
+    Board::getInstance().getSettings().setMaxSpeed(m_maxMotorSpeed);
+}
+
+bool App::setupScheduler()
+{
+    bool    isSuccessful = true;
+    uint8_t controlTaskId =
+        m_scheduler.addTask(controlTask, this, DIFFERENTIAL_DRIVE_CONTROL_PERIOD, CONTROL_TASK_PRIORITY);
+    uint8_t statusTaskId;
+
+    m_reportTaskId = m_scheduler.addTask(reportTask, this, REPORTING_PERIOD, REPORT_TASK_PRIORITY);
+    m_lineSensorsTaskId =
+        m_scheduler.addTask(lineSensorsTask, this, SEND_LINE_SENSORS_DATA_PERIOD, LINE_SENSORS_TASK_PRIORITY);
+    statusTaskId = m_scheduler.addTask(statusTask, this, SEND_STATUS_TIMER_INTERVAL, STATUS_TASK_PRIORITY);
+
+    if ((Scheduler::INVALID_TASK_ID == controlTaskId) || (Scheduler::INVALID_TASK_ID == m_reportTaskId) ||
+        (Scheduler::INVALID_TASK_ID == m_lineSensorsTaskId) || (Scheduler::INVALID_TASK_ID == statusTaskId))
+    {
+        isSuccessful = false;
+    }
+    else
+    {
+        m_scheduler.start();
+    }
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+    /* Sending the profiler data is optional, therefore a missing task slot is ignored. */
+    (void)m_scheduler.addTask(profileTask, this, SEND_PROFILE_DATA_PERIOD, PROFILE_TASK_PRIORITY);
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+
+    return isSuccessful;
+}
+
+void App::applyDegradationLevel()
+{
+    /* The reporting period is doubled with every degradation level. The
+     * status is never degraded, because the DCS uses it for its timeout.
+     */
+    uint32_t factor = static_cast<uint32_t>(1U) << m_loadGovernor.getLevel();
+
+    (void)m_scheduler.setPeriod(m_reportTaskId, REPORTING_PERIOD * factor);
+
+    /* The line sensors data is skipped on minimal level, see lineSensorsTask(). */
+    if (LoadGovernor::LEVEL_REDUCED == m_loadGovernor.getLevel())
+    {
+        factor = 2U;
+    }
+
+    (void)m_scheduler.setPeriod(m_lineSensorsTaskId, SEND_LINE_SENSORS_DATA_PERIOD * factor);
+}
+
+void App::controlTask(void* userData)
+{
+    App* application = reinterpret_cast<App*>(userData);
+
+    /* The conditioned speed setpoints are the input of the differential drive
+     * control. Therefore they shall be applied before it.
+     */
+    DrivingState::getInstance().processSetpoints();
+
+    /* The differential drive control needs the measured speed of the
+     * left and right wheel. Therefore it shall be processed after
+     * the speedometer.
+     */
+    {
+        PROFILER_SCOPE(Profiler::SECTION_DIFFERENTIAL_DRIVE);
+        DifferentialDrive::getInstance().process(DIFFERENTIAL_DRIVE_CONTROL_PERIOD);
+    }
+
+    /* The odometry unit needs to detect motor speed changes to be able to
+     * calculate correct values. Therefore it shall be processed right after
+     * the differential drive control.
+     */
+    {
+        PROFILER_SCOPE(Profiler::SECTION_ODOMETRY);
+        Odometry::getInstance().process();
+    }
+
+#if CONFIG_SUPERVISOR != 0
+#if CONFIG_ODOMETRY_TO_SUPERVISOR != 0
+    if (nullptr != application)
+    {
+        Odometry& odo  = Odometry::getInstance();
+        int32_t   posX = 0;
+        int32_t   posY = 0;
+
+        odo.getPosition(posX, posY);
+
+        application->m_poseTelemetry.sendPose(millis(), posX, posY, odo.getOrientation());
+    }
+#endif /* CONFIG_ODOMETRY_TO_SUPERVISOR != 0 */
+#endif /* CONFIG_SUPERVISOR != 0 */
+
+#ifndef TARGET_NATIVE
+    /* In the simulation the time advances in steps, independent of the load.
+     * Therefore the slack is only observed on the target.
+     */
+    if (nullptr != application)
+    {
+        /* The slack is the remaining time from the end of the control until its
+         * deadline. The signed difference is negative, if the deadline was missed.
+         */
+        int32_t slack = static_cast<int32_t>(application->m_scheduler.getDeadline() - Timebase::now());
+
+        if (true == application->m_loadGovernor.update(slack))
+        {
+            application->applyDegradationLevel();
+        }
+    }
+#else  /* TARGET_NATIVE */
+    (void)application;
+#endif /* TARGET_NATIVE */
+}
+
+void App::reportTask(void* userData)
+{
+    App* application = reinterpret_cast<App*>(userData);
+
+    if ((nullptr != application) && (true == application->m_smpServer.isSynced()))
+    {
+        /* Send current data to SerialMuxProt Client */
+        application->reportVehicleData();
+        application->reportMotionScriptProgress();
+        application->reportWaypointProgress();
+    }
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+    else if (nullptr != application)
+    {
+        /* The client shall get a keyframe first, after it is synchronized again. */
+        application->m_vehicleDataBatch.reset();
+    }
+    else
+    {
+        ;
+    }
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
+}
+
+void App::statusTask(void* userData)
+{
+    App* application = reinterpret_cast<App*>(userData);
+
+    if ((nullptr != application) && (true == application->m_smpServer.isSynced()))
+    {
+        Status payload = {SMPChannelPayload::Status::STATUS_FLAG_OK, application->m_loadGovernor.getLevel()};
+
+        if (&ErrorState::getInstance() == application->m_systemStateMachine.getState())
+        {
+            payload.status = SMPChannelPayload::Status::STATUS_FLAG_ERROR;
+        }
+
+        /* Ignoring return value, as error handling is not available. */
+        (void)application->m_smpServer.sendData(application->m_serialMuxProtChannelIdStatus, &payload,
+                                                sizeof(payload));
+    }
+}
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+void App::profileTask(void* userData)
+{
+    App* application = reinterpret_cast<App*>(userData);
+
+    /* Only a single section is sent per period to keep the channel load low. */
+    if ((nullptr != application) && (0U != application->m_serialMuxProtChannelIdProfile) &&
+        (true == application->m_smpServer.isSynced()))
+    {
+        Profiler::Section    section = static_cast<Profiler::Section>(application->m_profileSection);
+        Profiler::Statistics statistics;
+
+        if (true == Profiler::getStatistics(section, statistics))
+        {
+            ProfileData payload;
+            uint8_t     bin = 0U;
+
+            payload.section = section;
+            payload.count   = statistics.count;
+            payload.min     = statistics.min;
+            payload.max     = statistics.max;
+            payload.mean    = Profiler::getMean(statistics);
+
+            for (bin = 0U; bin < Profiler::HISTOGRAM_BINS; ++bin)
+            {
+                payload.histogram[bin] = statistics.histogram[bin];
+            }
+
+            /* Ignoring return value, as error handling is not available. */
+            (void)application->m_smpServer.sendData(application->m_serialMuxProtChannelIdProfile, &payload,
+                                                    sizeof(payload));
+
+            Profiler::reset(section);
+        }
+
+        ++application->m_profileSection;
+
+        if (Profiler::SECTION_COUNT <= application->m_profileSection)
+        {
+            application->m_profileSection = 0U;
+        }
+    }
+}
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+
+void App::lineSensorsTask(void* userData)
+{
+    App* application = reinterpret_cast<App*>(userData);
+
+    /* The line sensors data is not necessary for the control, therefore it is skipped if the deadline is at risk. */
+    if ((nullptr != application) && (true == application->m_smpServer.isSynced()) &&
+        (LoadGovernor::LEVEL_MINIMAL > application->m_loadGovernor.getLevel()))
+    {
+        application->sendLineSensorsData();
+    }
+    else if ((nullptr != application) && (false == application->m_smpServer.isSynced()))
+    {
+        /* The client shall get the current line sensors data, after it is synchronized again. */
+        application->m_lineSensorsFilter.reset();
+    }
+    else
+    {
+        ;
+    }
+}
+
+void App::sendLineSensorsData()
 {
     ILineSensors&   lineSensors      = Board::getInstance().getLineSensors();
     uint8_t         maxLineSensors   = lineSensors.getNumLineSensors();
     const uint16_t* lineSensorValues = lineSensors.getSensorValues();
     uint8_t         lineSensorIdx    = 0U;
-    LineSensorData  payload;
 
-    if (LINE_SENSOR_CHANNEL_DLC == maxLineSensors * sizeof(uint16_t))
+#if (0 != CONFIG_LINE_SENSOR_BITMASK)
+    LineSensorBitmask payload = {0U};
+    uint16_t          lineSensorBits;
+
+    while ((maxLineSensors > lineSensorIdx) && (8U > lineSensorIdx))
+    {
+        if (m_lineSensorsThreshold <= lineSensorValues[lineSensorIdx])
+        {
+            payload.lineSensorBits |= static_cast<uint8_t>(1U << lineSensorIdx);
+        }
+
+        ++lineSensorIdx;
+    }
+
+    lineSensorBits = payload.lineSensorBits;
+
+    if (true == m_lineSensorsFilter.isSendRequired(millis(), &lineSensorBits))
+    {
+        (void)m_smpServer.sendData(m_serialMuxProtChannelIdLineSensors, &payload, sizeof(payload));
+    }
+#else  /* (0 != CONFIG_LINE_SENSOR_BITMASK) */
+    /* The change filter needs all line sensor values, which are in the payload. */
+    if ((LINE_SENSOR_CHANNEL_DLC == maxLineSensors * sizeof(uint16_t)) &&
+        (true == m_lineSensorsFilter.isSendRequired(millis(), lineSensorValues)))
     {
+        LineSensorData payload;
+
         while (maxLineSensors > lineSensorIdx)
         {
             payload.lineSensorData[lineSensorIdx] = lineSensorValues[lineSensorIdx];
 
             ++lineSensorIdx;
         }
-    }
 
-    (void)m_smpServer.sendData(m_serialMuxProtChannelIdLineSensors, &payload, sizeof(payload));
+        (void)m_smpServer.sendData(m_serialMuxProtChannelIdLineSensors, &payload, sizeof(payload));
+    }
+#endif /* (0 != CONFIG_LINE_SENSOR_BITMASK) */
 }
 
 /******************************************************************************
@@ -454,7 +1081,8 @@ void App_motorSpeedSetpointsChannelCallback(const uint8_t* payload, const uint8_
  */
 void App_statusChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData)
 {
-    if ((nullptr != payload) && (STATUS_CHANNEL_DLC == payloadSize) && (nullptr != userData))
+    /* The degradation level is not evaluated. A peer, which sends only the status flag, is accepted too. */
+    if ((nullptr != payload) && (sizeof(SMPChannelPayload::Status) <= payloadSize) && (nullptr != userData))
     {
         const Status* currentStatus = reinterpret_cast<const Status*>(payload);
         App*          application   = reinterpret_cast<App*>(userData);
@@ -483,4 +1111,91 @@ void App_robotSpeedSetpointChannelCallback(const uint8_t* payload, const uint8_t
         /* Set the robot speeds. */
         DrivingState::getInstance().setRobotSpeeds(centerSpeed, angularSpeed);
     }
-}
\ No newline at end of file
+}
+
+/**
+ * Receives motion script steps over SerialMuxProt channel.
+ *
+ * @param[in] payload       Motion script steps.
+ * @param[in] payloadSize   Size of the motion script steps.
+ * @param[in] userData      Instance of App class.
+ */
+void App_motionScriptChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData)
+{
+    if ((nullptr != payload) && (MOTION_SCRIPT_CHANNEL_DLC == payloadSize) && (nullptr != userData))
+    {
+        const MotionScriptData* data        = reinterpret_cast<const MotionScriptData*>(payload);
+        App*                    application = reinterpret_cast<App*>(userData);
+
+        application->handleMotionScriptData(*data);
+    }
+}
+
+/**
+ * Receives waypoints over SerialMuxProt channel.
+ *
+ * @param[in] payload       Waypoints.
+ * @param[in] payloadSize   Size of the waypoints.
+ * @param[in] userData      Instance of App class.
+ */
+void App_waypointsChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData)
+{
+    if ((nullptr != payload) && (WAYPOINTS_CHANNEL_DLC == payloadSize) && (nullptr != userData))
+    {
+        const WaypointData* data        = reinterpret_cast<const WaypointData*>(payload);
+        App*                application = reinterpret_cast<App*>(userData);
+
+        application->handleWaypointData(*data);
+    }
+}
+
+/**
+ * Receives parameter requests over SerialMuxProt channel.
+ *
+ * @param[in] payload       Parameter request.
+ * @param[in] payloadSize   Size of the parameter request.
+ * @param[in] userData      Instance of App class.
+ */
+void App_parameterChannelCallback(const uint8_t* payload, const uint8_t payloadSize, void* userData)
+{
+    if ((nullptr != payload) && (PARAMETER_CHANNEL_DLC == payloadSize) && (nullptr != userData))
+    {
+        const ParameterServer::Request* request     = reinterpret_cast<const ParameterServer::Request*>(payload);
+        App*                           application = reinterpret_cast<App*>(userData);
+
+        application->handleParameterRequest(*request);
+    }
+}
+
+/**
+ * Applies the parameters after a parameter was changed.
+ *
+ * @param[in] index     Index of the changed parameter.
+ * @param[in] userData  Instance of App class.
+ */
+void App_parameterChangeCallback(uint8_t index, void* userData)
+{
+    (void)index;
+
+    if (nullptr != userData)
+    {
+        App* application = reinterpret_cast<App*>(userData);
+
+        application->applyParameters();
+    }
+}
+
+/**
+ * Stores the persistent parameters on request of the DCS.
+ *
+ * @param[in] userData  Instance of App class.
+ */
+void App_parameterStoreCallback(void* userData)
+{
+    if (nullptr != userData)
+    {
+        App* application = reinterpret_cast<App*>(userData);
+
+        application->storeParameters();
+    }
+}
@@ -40,6 +40,23 @@
  * Compile Switches
  *****************************************************************************/
 
+#ifndef CONFIG_VEHICLE_DATA_BATCH
+/**
+ * Send the current vehicle data with a higher rate in batches on the "VEH_BATCH"
+ * channel, instead of single frames on the "CURR_DATA" channel.
+ * Disabled by default, because the existing hosts expect the "CURR_DATA" channel.
+ */
+#define CONFIG_VEHICLE_DATA_BATCH (0)
+#endif /* CONFIG_VEHICLE_DATA_BATCH */
+
+#ifndef CONFIG_LINE_SENSOR_BITMASK
+/**
+ * Send only whether the line sensors detect the line, as bitmask on the
+ * "LINE_BITS" channel, instead of the sensor values on the "LINE_SENS" channel.
+ */
+#define CONFIG_LINE_SENSOR_BITMASK (0)
+#endif /* CONFIG_LINE_SENSOR_BITMASK */
+
 /******************************************************************************
  * Includes
  *****************************************************************************/
@@ -47,7 +64,20 @@
 #include "SerialMuxChannels.h"
 #include <StateMachine.h>
 #include <SimpleTimer.h>
+#include <Scheduler.h>
+#include <LoadGovernor.h>
 #include <MovAvg.hpp>
+#include <DifferentialDrive.h>
+#include <ParameterRegistry.h>
+#include <ParameterServer.h>
+#include <ChangeFilter.h>
+
+#if CONFIG_SUPERVISOR != 0
+#if CONFIG_ODOMETRY_TO_SUPERVISOR != 0
+#include <Board.h>
+#include <PoseTelemetry.h>
+#endif /* CONFIG_ODOMETRY_TO_SUPERVISOR != 0 */
+#endif /* CONFIG_SUPERVISOR != 0 */
 
 /******************************************************************************
  * Macros
@@ -97,30 +127,135 @@ public:
      */
     void systemStatusCallback(SMPChannelPayload::Status status);
 
+    /**
+     * Handle parameter request received via SerialMuxProt.
+     *
+     * @param[in] request   Parameter request to handle.
+     */
+    void handleParameterRequest(const ParameterServer::Request& request);
+
+    /**
+     * Handle motion script steps received via SerialMuxProt.
+     *
+     * @param[in] data  Motion script steps to handle.
+     */
+    void handleMotionScriptData(const MotionScriptData& data);
+
+    /**
+     * Handle waypoints received via SerialMuxProt.
+     *
+     * @param[in] data  Waypoints to handle.
+     */
+    void handleWaypointData(const WaypointData& data);
+
+    /**
+     * Apply the tunable parameters to their owners. It is called after a
+     * parameter was changed.
+     */
+    void applyParameters();
+
+    /**
+     * Store the persistent parameters in the settings.
+     */
+    void storeParameters();
+
 private:
     /** Differential drive control period in ms. */
     static const uint32_t DIFFERENTIAL_DRIVE_CONTROL_PERIOD = 5U;
 
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+    /** Current data sampling period in ms. The samples are reported in batches. */
+    static const uint32_t REPORTING_PERIOD = 10U;
+
+    /** Max. number of samples in a vehicle data batch, which limits the latency of the first sample. */
+    static const uint8_t VEHICLE_DATA_BATCH_SAMPLES = 5U;
+#else  /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
     /** Current data reporting period in ms. */
     static const uint32_t REPORTING_PERIOD = 50U;
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
 
     /** Baudrate for Serial Communication */
     static const uint32_t SERIAL_BAUDRATE = 115200U;
 
+    /** Task priority of the differential drive control, which shall always run first. */
+    static const uint8_t CONTROL_TASK_PRIORITY = Scheduler::PRIORITY_HIGHEST;
+
+    /** Task priority of reporting the current vehicle data. */
+    static const uint8_t REPORT_TASK_PRIORITY = CONTROL_TASK_PRIORITY + 1U;
+
+    /** Task priority of sending the line sensors data. */
+    static const uint8_t LINE_SENSORS_TASK_PRIORITY = REPORT_TASK_PRIORITY + 1U;
+
+    /** Task priority of sending the system status. */
+    static const uint8_t STATUS_TASK_PRIORITY = LINE_SENSORS_TASK_PRIORITY + 1U;
+
+    /** Task priority of sending the profiler data. */
+    static const uint8_t PROFILE_TASK_PRIORITY = STATUS_TASK_PRIORITY + 1U;
+
+    /** Profiler data sending period in ms. */
+    static const uint32_t SEND_PROFILE_DATA_PERIOD = 100U;
+
+    /**
+     * Min. slack in us of the differential drive control. If the slack is
+     * too often lower, the telemetry is degraded.
+     */
+    static const int32_t MIN_CONTROL_SLACK = 3000;
+
     /** Send status timer interval in ms. */
     static const uint32_t SEND_STATUS_TIMER_INTERVAL = 1000U;
 
     /** Status timeout timer interval in ms. */
     static const uint32_t STATUS_TIMEOUT_TIMER_INTERVAL = 2U * SEND_STATUS_TIMER_INTERVAL;
 
-    /** Sending Data period in ms. */
-    static const uint32_t SEND_LINE_SENSORS_DATA_PERIOD = 20U;
+    /** Period in ms to check whether the line sensors data changed and shall be sent. */
+    static const uint32_t SEND_LINE_SENSORS_DATA_PERIOD = 10U;
+
+    /** Min. interval in ms between sending the line sensors data, which caps the link load. */
+    static const uint32_t LINE_SENSORS_MIN_SEND_INTERVAL = 20U;
+
+    /** Max. interval in ms between sending the line sensors data, even if nothing changed. */
+    static const uint32_t LINE_SENSORS_MAX_SEND_INTERVAL = 500U;
+
+#if (0 != CONFIG_LINE_SENSOR_BITMASK)
+    /** Default line sensor value in digits, from which on the line is detected. */
+    static const uint16_t LINE_SENSORS_THRESHOLD = 500U;
+
+    /** Max. line sensor value in digits, which is the upper bound of the tunable threshold. */
+    static const uint16_t LINE_SENSORS_VALUE_MAX = 1000U;
+
+    /** Number of values, which are checked for a change. Only the bitmask. */
+    static const uint8_t LINE_SENSORS_FILTER_VALUES = 1U;
+
+    /** Every change of the bitmask is sent. */
+    static const uint16_t LINE_SENSORS_DEADBAND = 0U;
+#else  /* (0 != CONFIG_LINE_SENSOR_BITMASK) */
+    /** Number of values, which are checked for a change. All line sensors. */
+    static const uint8_t LINE_SENSORS_FILTER_VALUES = sizeof(LineSensorData) / sizeof(uint16_t);
+
+    /** Max. change of a single line sensor value in digits, which is not sent. */
+    static const uint16_t LINE_SENSORS_DEADBAND = 20U;
+#endif /* (0 != CONFIG_LINE_SENSOR_BITMASK) */
 
     /**
      * Number of measurements for proximity sensors moving average filter.
      */
     static const uint8_t MOVAVG_PROXIMITY_SENSOR_NUM_MEASUREMENTS = 3U;
 
+    /**
+     * Proximity sensors reading period in ms. Reading them takes several ms,
+     * therefore it is done less often than the vehicle data is sampled.
+     */
+    static const uint32_t PROXIMITY_READ_PERIOD = 50U;
+
+    /** Upper bound of the tunable PID factor numerators and denominators. */
+    static const int16_t MAX_PID_FACTOR = 1000;
+
+    /** Upper bound of the tunable setpoint conditioning times in ms. */
+    static const uint16_t MAX_SETPOINT_TIME = 5000U;
+
+    /** Upper bound of the tunable waypoint lookahead distance in mm. */
+    static const uint16_t MAX_WAYPOINT_LOOKAHEAD = 1000U;
+
     /** SerialMuxProt Channel id for sending remote control command responses. */
     uint8_t m_serialMuxProtChannelIdRemoteCtrlRsp;
 
@@ -133,35 +268,117 @@ private:
     /** SerialMuxProt Channel id for sending line sensors data. */
     uint8_t m_serialMuxProtChannelIdLineSensors;
 
+    /** SerialMuxProt Channel id for sending parameter responses. */
+    uint8_t m_serialMuxProtChannelIdParameterRsp;
+
     /** The system state machine. */
     StateMachine m_systemStateMachine;
 
-    /** Timer used for differential drive control processing. */
-    SimpleTimer m_controlInterval;
+    /** Scheduler for the periodic tasks. */
+    Scheduler m_scheduler;
 
-    /** Timer for reporting current data through SerialMuxProt. */
-    SimpleTimer m_reportTimer;
+    /** Load governor, which degrades the telemetry if the control deadline is at risk. */
+    LoadGovernor m_loadGovernor;
 
-    /** Timer for sending system status to DCS. */
-    SimpleTimer m_statusTimer;
+    /** Task id of reporting the current vehicle data. */
+    uint8_t m_reportTaskId;
+
+    /** Task id of sending the line sensors data. */
+    uint8_t m_lineSensorsTaskId;
 
     /** Timer for timeout of system status of DCS. */
     SimpleTimer m_statusTimeoutTimer;
 
-    /** Timer used for sending data periodically. */
-    SimpleTimer m_sendLineSensorsDataInterval;
-
     /** SerialMuxProt Server Instance. */
     SMPServer m_smpServer;
 
+    /** Registry of the parameters, which can be tuned at runtime. */
+    ParameterRegistry m_parameterRegistry;
+
+    /** Server of the parameter protocol on the parameter channels. */
+    ParameterServer m_parameterServer;
+
+    /** Tunable PID factors of the motor speed control. */
+    DifferentialDrive::PIDFactors m_speedPIDFactors;
+
+    /** Tunable max. motor speed in [steps/s], which is persistent in the settings. */
+    int16_t m_maxMotorSpeed;
+
+    /** Tunable interpolation delay in [ms] of the speed setpoints. */
+    uint16_t m_setpointDelay;
+
+    /** Tunable max. extrapolation time in [ms] of the speed setpoints. */
+    uint16_t m_setpointMaxExtrapolation;
+
+    /** Tunable watchdog timeout in [ms] of the speed setpoints. 0 disables it. */
+    uint16_t m_setpointTimeout;
+
+    /** Tunable ramp duration in [ms] to stop after the speed setpoint watchdog timeout. */
+    uint16_t m_setpointRampDuration;
+
+    /** Tunable lookahead distance in [mm] of the waypoint follower. */
+    uint16_t m_waypointLookahead;
+
+    /** Tunable default linear speed in [mm/s] of the waypoint follower. */
+    int16_t m_waypointSpeed;
+
+#if (0 != CONFIG_LINE_SENSOR_BITMASK)
+    /** Tunable line sensor value in digits, from which on the line is detected. */
+    uint16_t m_lineSensorsThreshold;
+#endif /* (0 != CONFIG_LINE_SENSOR_BITMASK) */
+
     /** Indicates whether the line sensor calibration is pending or not. */
     bool m_isLineSensorCalibPending;
 
+    /** Is the uploaded motion script complete and valid? */
+    bool m_isMotionScriptValid;
+
+    /** Is the progress of a started motion script reported? */
+    bool m_isMotionScriptReported;
+
+    /** Last reported motion script step. */
+    uint8_t m_motionScriptStep;
+
+    /** Are the uploaded waypoints complete and valid? */
+    bool m_isWaypointsValid;
+
+    /** Is the progress of the started waypoint following reported? */
+    bool m_isWaypointsReported;
+
+    /** Last reported waypoint index. */
+    uint8_t m_waypoint;
+
+    /** Decides whether the line sensors data changed enough to be sent. */
+    ChangeFilter m_lineSensorsFilter;
+
     /**
      * Moving average filter for proximity sensors.
      */
     MovAvg<uint8_t, uint16_t, MOVAVG_PROXIMITY_SENSOR_NUM_MEASUREMENTS> m_movAvgProximitySensor;
 
+    /** Number of vehicle data reports until the proximity sensors are read again. */
+    uint8_t m_proximityReadCountdown;
+
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+    /** Batch of vehicle data samples, which is under construction. */
+    TelemetryBatch m_vehicleDataBatch;
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+    /** SerialMuxProt Channel id for sending the profiler data. */
+    uint8_t m_serialMuxProtChannelIdProfile;
+
+    /** Profiler section, which is sent next. */
+    uint8_t m_profileSection;
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+
+#if CONFIG_SUPERVISOR != 0
+#if CONFIG_ODOMETRY_TO_SUPERVISOR != 0
+    /** Pose telemetry to the supervisor. */
+    PoseTelemetry m_poseTelemetry;
+#endif /* CONFIG_ODOMETRY_TO_SUPERVISOR != 0 */
+#endif /* CONFIG_SUPERVISOR != 0 */
+
     /**
      * Report the current vehicle data.
      * Report the current position and heading of the robot using the Odometry data.
@@ -170,6 +387,42 @@ private:
      */
     void reportVehicleData();
 
+    /**
+     * Report the progress of a started motion script via the command response
+     * channel. A step change is reported as pending, the completion as ok and
+     * an abort as error.
+     */
+    void reportMotionScriptProgress();
+
+    /**
+     * Send the motion script progress via the command response channel.
+     *
+     * @param[in] responseId    Response ID
+     */
+    void sendMotionScriptResponse(SMPChannelPayload::RspId responseId);
+
+    /**
+     * Report the progress of the started waypoint following via the command
+     * response channel. A waypoint change is reported as pending, reaching the
+     * last waypoint as ok and an abort as error.
+     */
+    void reportWaypointProgress();
+
+    /**
+     * Send the waypoint following progress via the command response channel.
+     *
+     * @param[in] responseId    Response ID
+     */
+    void sendWaypointResponse(SMPChannelPayload::RspId responseId);
+
+#if (0 != CONFIG_VEHICLE_DATA_BATCH)
+    /**
+     * Send the batch of vehicle data samples via SerialMuxProt, if it is not empty,
+     * and start the next one.
+     */
+    void sendVehicleDataBatch();
+#endif /* (0 != CONFIG_VEHICLE_DATA_BATCH) */
+
     /**
      * Setup the SerialMuxProt channels.
      *
@@ -178,9 +431,71 @@ private:
     bool setupSerialMuxProt();
 
     /**
-     * Send line sensors data via SerialMuxProt.
+     * Register the parameters, which can be tuned at runtime.
+     *
+     * @return If successful returns true, otherwise false.
+     */
+    bool setupParameters();
+
+    /**
+     * Update the tunable parameters from their owners, which may change them too.
+     */
+    void updateParameters();
+
+    /**
+     * Setup the scheduler with all periodic tasks and start it.
+     *
+     * @return If successful returns true, otherwise false.
+     */
+    bool setupScheduler();
+
+    /**
+     * Adapt the telemetry to the current degradation level of the load governor.
+     */
+    void applyDegradationLevel();
+
+    /**
+     * Periodic differential drive control task.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void controlTask(void* userData);
+
+    /**
+     * Periodic task to report the current vehicle data.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void reportTask(void* userData);
+
+    /**
+     * Periodic task to send the system status to the DCS.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void statusTask(void* userData);
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+    /**
+     * Periodic task to send the statistics of a single profiler section.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void profileTask(void* userData);
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+
+    /**
+     * Periodic task to send the line sensors data.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void lineSensorsTask(void* userData);
+
+    /**
+     * Send line sensors data via SerialMuxProt, if it changed or wasn't sent
+     * for a while.
      */
-    void sendLineSensorsData() const;
+    void sendLineSensorsData();
 
     /**
      * Copy construction of an instance.
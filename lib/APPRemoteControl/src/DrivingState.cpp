@@ -36,6 +36,8 @@
 #include <StateMachine.h>
 #include <DifferentialDrive.h>
 #include <Board.h>
+#include <Odometry.h>
+#include <Util.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -70,6 +72,7 @@ void DrivingState::entry()
     display.print("Drv");
 
     m_isActive = true;
+    m_setpointConditioner.reset();
     diffDrive.setLinearSpeed(0, 0);
     diffDrive.enable();
 }
@@ -86,6 +89,8 @@ void DrivingState::exit()
     DifferentialDrive& diffDrive = DifferentialDrive::getInstance();
     
     m_isActive = false;
+    m_motionScript.stop();
+    m_waypointFollower.stop();
 
     /* Stop motors. */
     diffDrive.setLinearSpeed(0, 0);
@@ -96,24 +101,128 @@ void DrivingState::exit()
 }
 
 void DrivingState::setMotorSpeeds(int16_t leftMotor, int16_t rightMotor)
+{
+    writeSetpoint(SETPOINT_TYPE_MOTOR_SPEEDS, leftMotor, rightMotor);
+}
+
+void DrivingState::setRobotSpeeds(int16_t linearSpeed, int16_t angularSpeed)
+{
+    writeSetpoint(SETPOINT_TYPE_ROBOT_SPEEDS, linearSpeed, angularSpeed);
+}
+
+void DrivingState::processSetpoints()
 {
     if (true == m_isActive)
     {
-        DifferentialDrive::getInstance().setLinearSpeed(leftMotor, rightMotor);
+        DifferentialDrive& diffDrive = DifferentialDrive::getInstance();
+
+        if (true == m_motionScript.isRunning())
+        {
+            const Odometry& odometry     = Odometry::getInstance();
+            int16_t         linearSpeed  = 0; /* [mm/s] */
+            int16_t         angularSpeed = 0; /* [mrad/s] */
+
+            m_motionScript.process(millis(), odometry.getMileageCenter(), odometry.getOrientation(), linearSpeed,
+                                   angularSpeed);
+
+            setLocalSpeeds(linearSpeed, angularSpeed);
+        }
+        else if (true == m_waypointFollower.isRunning())
+        {
+            const Odometry& odometry     = Odometry::getInstance();
+            int32_t         posX         = 0; /* [mm] */
+            int32_t         posY         = 0; /* [mm] */
+            int16_t         linearSpeed  = 0; /* [mm/s] */
+            int16_t         angularSpeed = 0; /* [mrad/s] */
+
+            odometry.getPosition(posX, posY);
+            m_waypointFollower.process(posX, posY, odometry.getOrientation(), linearSpeed, angularSpeed);
+
+            setLocalSpeeds(linearSpeed, angularSpeed);
+        }
+        else
+        {
+            int16_t value0 = 0;
+            int16_t value1 = 0;
+
+            m_setpointConditioner.process(Timebase::now(), value0, value1);
+
+            if (SETPOINT_TYPE_MOTOR_SPEEDS == m_setpointType)
+            {
+                diffDrive.setLinearSpeed(value0, value1);
+            }
+            else
+            {
+                /* Linear speed is set first. Overwrites all speed setpoints. */
+                diffDrive.setLinearSpeed(value0);
+
+                /* Angular speed is set on-top of the linear speed. Must be called after setLinearSpeed(). */
+                diffDrive.setAngularSpeed(value1);
+            }
+        }
     }
 }
 
-void DrivingState::setRobotSpeeds(int16_t linearSpeed, int16_t angularSpeed)
+bool DrivingState::startMotionScript()
 {
+    bool isSuccessful = false;
+
     if (true == m_isActive)
     {
-        DifferentialDrive& diffDrive = DifferentialDrive::getInstance();
+        const Odometry& odometry = Odometry::getInstance();
 
-        /* Linear speed is set first. Overwrites all speed setpoints. */
-        diffDrive.setLinearSpeed(linearSpeed);
+        if (false == m_waypointFollower.isRunning())
+        {
+            isSuccessful = m_motionScript.start(millis(), odometry.getMileageCenter(), odometry.getOrientation());
+        }
 
-        /* Angular speed is set on-top of the linear speed. Must be called after setLinearSpeed(). */
-        diffDrive.setAngularSpeed(angularSpeed);
+        /* The previous speed setpoints shall not be continued after the script. */
+        if (true == isSuccessful)
+        {
+            m_setpointConditioner.reset();
+        }
+    }
+
+    return isSuccessful;
+}
+
+void DrivingState::stopMotionScript()
+{
+    if (true == m_motionScript.isRunning())
+    {
+        m_motionScript.stop();
+        m_setpointConditioner.reset();
+    }
+}
+
+bool DrivingState::startWaypoints()
+{
+    bool isSuccessful = false;
+
+    if ((true == m_isActive) && (false == m_motionScript.isRunning()))
+    {
+        int32_t posX = 0; /* [mm] */
+        int32_t posY = 0; /* [mm] */
+
+        Odometry::getInstance().getPosition(posX, posY);
+        isSuccessful = m_waypointFollower.start(posX, posY);
+
+        /* The previous speed setpoints shall not be continued after the waypoints. */
+        if (true == isSuccessful)
+        {
+            m_setpointConditioner.reset();
+        }
+    }
+
+    return isSuccessful;
+}
+
+void DrivingState::stopWaypoints()
+{
+    if (true == m_waypointFollower.isRunning())
+    {
+        m_waypointFollower.stop();
+        m_setpointConditioner.reset();
     }
 }
 
@@ -125,6 +234,32 @@ void DrivingState::setRobotSpeeds(int16_t linearSpeed, int16_t angularSpeed)
  * Private Methods
  *****************************************************************************/
 
+void DrivingState::setLocalSpeeds(int16_t linearSpeed, int16_t angularSpeed)
+{
+    DifferentialDrive& diffDrive = DifferentialDrive::getInstance();
+
+    /* Linear speed is set first. Overwrites all speed setpoints. */
+    diffDrive.setLinearSpeed(Util::millimetersPerSecondToStepsPerSecond(linearSpeed));
+
+    /* Angular speed is set on-top of the linear speed. Must be called after setLinearSpeed(). */
+    diffDrive.setAngularSpeed(angularSpeed);
+}
+
+void DrivingState::writeSetpoint(SetpointType type, int16_t value0, int16_t value1)
+{
+    if ((true == m_isActive) && (false == m_motionScript.isRunning()) && (false == m_waypointFollower.isRunning()))
+    {
+        /* Setpoints of different kinds can't be interpolated. */
+        if (type != m_setpointType)
+        {
+            m_setpointConditioner.reset();
+            m_setpointType = type;
+        }
+
+        m_setpointConditioner.write(value0, value1, Timebase::now());
+    }
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -46,6 +46,9 @@
 #include <stdint.h>
 #include <IState.h>
 #include <SimpleTimer.h>
+#include <SetpointConditioner.h>
+#include <MotionScript.h>
+#include <WaypointFollower.h>
 
 /******************************************************************************
  * Macros
@@ -91,7 +94,8 @@ public:
     void exit() final;
 
     /**
-     * Set the motor speeds.
+     * Set the motor speeds. They are conditioned before they are applied.
+     * They are ignored while a motion script is running or waypoints are followed.
      *
      * @param[in] leftMotor  Left motor speed. [steps/s]
      * @param[in] rightMotor Right motor speed. [steps/s]
@@ -99,25 +103,131 @@ public:
     void setMotorSpeeds(int16_t leftMotor, int16_t rightMotor);
 
     /**
-     * Set the robot speeds.
+     * Set the robot speeds. They are conditioned before they are applied.
+     * They are ignored while a motion script is running or waypoints are followed.
      *
      * @param[in] linearSpeed   Linear speed in [steps/s]
      * @param[in] angularSpeed  Angular speed in [mrad/s]
      */
     void setRobotSpeeds(int16_t linearSpeed, int16_t angularSpeed);
 
+    /**
+     * Apply the conditioned speed setpoints, the speeds of the running motion
+     * script or the speeds to follow the waypoints. It shall be called every
+     * control period before the differential drive is processed.
+     */
+    void processSetpoints();
+
+    /**
+     * Get the motion script, e.g. to upload it.
+     *
+     * @return Motion script
+     */
+    MotionScript& getMotionScript()
+    {
+        return m_motionScript;
+    }
+
+    /**
+     * Start the uploaded motion script.
+     * It is not possible while waypoints are followed.
+     *
+     * @return If successful started, it will return true otherwise false.
+     */
+    bool startMotionScript();
+
+    /**
+     * Stop the running motion script. The robot stops.
+     */
+    void stopMotionScript();
+
+    /**
+     * Get the waypoint follower, e.g. to upload the waypoints.
+     *
+     * @return Waypoint follower
+     */
+    WaypointFollower& getWaypointFollower()
+    {
+        return m_waypointFollower;
+    }
+
+    /**
+     * Start following the uploaded waypoints from the current position.
+     * It is not possible while a motion script is running.
+     *
+     * @return If successful started, it will return true otherwise false.
+     */
+    bool startWaypoints();
+
+    /**
+     * Stop following the waypoints. The robot stops.
+     */
+    void stopWaypoints();
+
+    /**
+     * Get the setpoint conditioner, e.g. to configure it.
+     *
+     * @return Setpoint conditioner
+     */
+    SetpointConditioner& getSetpointConditioner()
+    {
+        return m_setpointConditioner;
+    }
+
 protected:
 private:
+    /** The kind of the speed setpoints. */
+    enum SetpointType
+    {
+        SETPOINT_TYPE_MOTOR_SPEEDS = 0, /**< Left and right motor speed. */
+        SETPOINT_TYPE_ROBOT_SPEEDS      /**< Linear and angular speed. */
+    };
+
     /** Flag: State is active. */
     bool m_isActive;
 
+    /** Conditions the received speed setpoints for the control. */
+    SetpointConditioner m_setpointConditioner;
+
+    /** Kind of the conditioned speed setpoints. */
+    SetpointType m_setpointType;
+
+    /** Motion script, which is executed locally. */
+    MotionScript m_motionScript;
+
+    /** Waypoint follower, which drives locally along the uploaded waypoints. */
+    WaypointFollower m_waypointFollower;
+
     /**
      * Default constructor.
      */
-    DrivingState() : IState(), m_isActive(false)
+    DrivingState() :
+        IState(),
+        m_isActive(false),
+        m_setpointConditioner(),
+        m_setpointType(SETPOINT_TYPE_MOTOR_SPEEDS),
+        m_motionScript(),
+        m_waypointFollower()
     {
     }
 
+    /**
+     * Apply the speeds of the locally executed motion.
+     *
+     * @param[in] linearSpeed   Linear speed in [mm/s]
+     * @param[in] angularSpeed  Angular speed in [mrad/s]
+     */
+    void setLocalSpeeds(int16_t linearSpeed, int16_t angularSpeed);
+
+    /**
+     * Write a speed setpoint to the conditioner.
+     *
+     * @param[in] type      Kind of the speed setpoint.
+     * @param[in] value0    Left motor speed or linear speed.
+     * @param[in] value1    Right motor speed or angular speed.
+     */
+    void writeSetpoint(SetpointType type, int16_t value0, int16_t value1);
+
     /**
      * Default destructor.
      */
@@ -38,6 +38,9 @@
 
 #include <Arduino.h>
 #include <SerialMuxProtServer.hpp>
+#include <Profiler.h>
+#include <TelemetryBatch.h>
+#include <ParameterServer.h>
 
 /******************************************************************************
  * Macros
@@ -70,12 +73,36 @@
 /** DLC of Robot Speed Setpoint Channel */
 #define ROBOT_SPEED_SETPOINT_CHANNEL_DLC (sizeof(RobotSpeed))
 
+/** Name of the Channel to receive Motion Script steps from. */
+#define MOTION_SCRIPT_CHANNEL_NAME "SCRIPT"
+
+/** DLC of Motion Script Channel */
+#define MOTION_SCRIPT_CHANNEL_DLC (sizeof(MotionScriptData))
+
+/** Max. number of motion script steps in a single frame of the Motion Script Channel. */
+#define MOTION_SCRIPT_STEPS_PER_FRAME (3U)
+
+/** Name of the Channel to receive Waypoints from. */
+#define WAYPOINTS_CHANNEL_NAME "WAYPOINTS"
+
+/** DLC of Waypoints Channel */
+#define WAYPOINTS_CHANNEL_DLC (sizeof(WaypointData))
+
+/** Max. number of waypoints in a single frame of the Waypoints Channel. */
+#define WAYPOINTS_PER_FRAME (3U)
+
 /** Name of Channel to send Current Vehicle Data to. */
 #define CURRENT_VEHICLE_DATA_CHANNEL_NAME "CURR_DATA"
 
 /** DLC of Current Vehicle Data Channel */
 #define CURRENT_VEHICLE_DATA_CHANNEL_DLC (sizeof(VehicleData))
 
+/** Name of Channel to send batched Vehicle Data samples to. */
+#define VEHICLE_DATA_BATCH_CHANNEL_NAME "VEH_BATCH"
+
+/** DLC of Vehicle Data Batch Channel, see TelemetryBatch for the frame format. */
+#define VEHICLE_DATA_BATCH_CHANNEL_DLC (TelemetryBatch::FRAME_SIZE)
+
 /** Name of Channel to send system status to. */
 #define STATUS_CHANNEL_NAME "STATUS"
 
@@ -88,6 +115,30 @@
 /** DLC of Line Sensor Channel */
 #define LINE_SENSOR_CHANNEL_DLC (sizeof(LineSensorData))
 
+/** Name of the Channel to receive the Line Sensor Bitmask from. */
+#define LINE_SENSOR_BITMASK_CHANNEL_NAME "LINE_BITS"
+
+/** DLC of Line Sensor Bitmask Channel */
+#define LINE_SENSOR_BITMASK_CHANNEL_DLC (sizeof(LineSensorBitmask))
+
+/** Name of Channel to send profiler data to. */
+#define PROFILE_CHANNEL_NAME "PROFILE"
+
+/** DLC of Profile Channel */
+#define PROFILE_CHANNEL_DLC (sizeof(ProfileData))
+
+/** Name of Channel to receive parameter requests from. */
+#define PARAMETER_CHANNEL_NAME "PARAM"
+
+/** DLC of Parameter Channel */
+#define PARAMETER_CHANNEL_DLC (sizeof(ParameterServer::Request))
+
+/** Name of Channel to send parameter responses to. */
+#define PARAMETER_RESPONSE_CHANNEL_NAME "PARAM_RSP"
+
+/** DLC of Parameter Response Channel */
+#define PARAMETER_RESPONSE_CHANNEL_DLC (sizeof(ParameterServer::Response))
+
 /******************************************************************************
  * Types and Classes
  *****************************************************************************/
@@ -107,7 +158,11 @@ namespace SMPChannelPayload
         CMD_ID_REINIT_BOARD,            /**< Re-initialize the board. Required for webots simulation. */
         CMD_ID_GET_MAX_SPEED,           /**< Get maximum speed. */
         CMD_ID_START_DRIVING,           /**< Start driving. */
-        CMD_ID_SET_INIT_POS             /**< Set initial position. */
+        CMD_ID_SET_INIT_POS,            /**< Set initial position. */
+        CMD_ID_START_SCRIPT,            /**< Start the uploaded motion script. */
+        CMD_ID_STOP_SCRIPT,             /**< Stop the running motion script. */
+        CMD_ID_START_WAYPOINTS,         /**< Start following the uploaded waypoints. */
+        CMD_ID_STOP_WAYPOINTS           /**< Stop following the waypoints. */
 
     } CmdId; /**< Command ID */
 
@@ -145,6 +200,20 @@ namespace SMPChannelPayload
 
     } Range; /**< Proximity Sensor Ranges */
 
+    /** Values of a single sample in the "Vehicle Data Batch" channel, in this order. */
+    typedef enum : uint8_t
+    {
+        VEHICLE_DATA_X_POS = 0,   /**< X position [mm]. */
+        VEHICLE_DATA_Y_POS,       /**< Y position [mm]. */
+        VEHICLE_DATA_ORIENTATION, /**< Orientation [mrad]. */
+        VEHICLE_DATA_LEFT,        /**< Left motor speed [mm/s]. */
+        VEHICLE_DATA_RIGHT,       /**< Right motor speed [mm/s]. */
+        VEHICLE_DATA_CENTER,      /**< Center speed [mm/s]. */
+        VEHICLE_DATA_PROXIMITY,   /**< Range at which object is found [range]. */
+        VEHICLE_DATA_VALUE_COUNT  /**< Number of values per sample. */
+
+    } VehicleDataValue; /**< Vehicle data sample value */
+
 } /* namespace SMPChannelPayload */
 
 /** Struct of the "Command" channel payload. */
@@ -176,6 +245,20 @@ typedef struct _CommandResponse
     union
     {
         int32_t maxMotorSpeed; /**< Max speed [mm/s]. */
+
+        /** Motion script progress. */
+        struct
+        {
+            uint8_t scriptStep;   /**< Index of the current step. */
+            uint8_t scriptLength; /**< Number of steps. */
+        };
+
+        /** Waypoint following progress. */
+        struct
+        {
+            uint8_t waypoint;      /**< Index of the waypoint, which is currently driven to. */
+            uint8_t waypointCount; /**< Number of waypoints. */
+        };
     };
 } __attribute__((packed)) CommandResponse;
 
@@ -193,6 +276,47 @@ typedef struct _RobotSpeed
     int32_t angular;      /**< Angular speed. [mrad/s] */
 } __attribute__((packed)) RobotSpeed;
 
+/** Struct of a single step in the "Motion Script" channel payload. */
+typedef struct _MotionScriptStep
+{
+    uint8_t type;         /**< Step type, see MotionScript::StepType. */
+    int32_t target;       /**< Duration [ms], distance [mm] or angle [mrad], depending on the type. */
+    int16_t linearSpeed;  /**< Linear speed [mm/s] */
+    int16_t angularSpeed; /**< Angular speed [mrad/s] */
+} __attribute__((packed)) MotionScriptStep;
+
+/**
+ * Struct of the "Motion Script" channel payload.
+ * A script with more steps than fit into a single frame is uploaded with
+ * several frames in order.
+ */
+typedef struct _MotionScriptData
+{
+    uint8_t          index;                                /**< Index of the first step. 0 starts a new script. */
+    uint8_t          count;                                /**< Number of steps in this frame. */
+    MotionScriptStep steps[MOTION_SCRIPT_STEPS_PER_FRAME]; /**< Steps */
+} __attribute__((packed)) MotionScriptData;
+
+/** Struct of a single waypoint in the "Waypoints" channel payload. */
+typedef struct _WaypointItem
+{
+    int32_t xPos;  /**< X position [mm] */
+    int32_t yPos;  /**< Y position [mm] */
+    int16_t speed; /**< Linear speed [mm/s]. 0 selects the default speed. */
+} __attribute__((packed)) WaypointItem;
+
+/**
+ * Struct of the "Waypoints" channel payload.
+ * A path with more waypoints than fit into a single frame is uploaded with
+ * several frames in order.
+ */
+typedef struct _WaypointData
+{
+    uint8_t      index;                          /**< Index of the first waypoint. 0 starts a new path. */
+    uint8_t      count;                          /**< Number of waypoints in this frame. */
+    WaypointItem waypoints[WAYPOINTS_PER_FRAME]; /**< Waypoints */
+} __attribute__((packed)) WaypointData;
+
 /** Struct of the "Current Vehicle Data" channel payload. */
 typedef struct _VehicleData
 {
@@ -208,7 +332,8 @@ typedef struct _VehicleData
 /** Struct of the "Status" channel payload. */
 typedef struct _Status
 {
-    SMPChannelPayload::Status status; /**< Status */
+    SMPChannelPayload::Status status;      /**< Status */
+    uint8_t                   degradation; /**< Telemetry degradation level, see LoadGovernor::Level. */
 } __attribute__((packed)) Status;
 
 /** Struct of the "Line Sensor" channel payload. */
@@ -217,6 +342,23 @@ typedef struct _LineSensorData
     uint16_t lineSensorData[5U]; /**< Line sensor data [digits] normalized to max 1000 digits. */
 } __attribute__((packed)) LineSensorData;
 
+/** Struct of the "Line Sensor Bitmask" channel payload. */
+typedef struct _LineSensorBitmask
+{
+    uint8_t lineSensorBits; /**< Bit n is set, if line sensor n detects the line. */
+} __attribute__((packed)) LineSensorBitmask;
+
+/** Struct of the "Profile" channel payload. */
+typedef struct _ProfileData
+{
+    uint8_t  section;                             /**< Profiler section, see Profiler::Section. */
+    uint16_t count;                               /**< Number of measurements. */
+    uint16_t min;                                 /**< Min. execution time [us]. */
+    uint16_t max;                                 /**< Max. execution time [us]. */
+    uint16_t mean;                                /**< Mean execution time [us]. */
+    uint16_t histogram[Profiler::HISTOGRAM_BINS]; /**< Number of measurements per histogram bin. */
+} __attribute__((packed)) ProfileData;
+
 /******************************************************************************
  * Functions
  *****************************************************************************/
@@ -36,9 +36,11 @@
 #include "StartupState.h"
 #include <Board.h>
 #include <Speedometer.h>
+#include <Profiler.h>
 #include <DifferentialDrive.h>
 #include <Odometry.h>
 #include <Util.h>
+#include <Sound.h>
 #include <Logging.h>
 
 /******************************************************************************
@@ -74,60 +76,65 @@ void App::setup()
     Board::getInstance().init();
 
     /* Setup the state machine with the first state. */
+    GyroCalibrationState::getInstance().setBiasEstimator(&m_gyroBiasEstimator);
     m_systemStateMachine.setState(&StartupState::getInstance());
 
-    /* Setup the periodically processing of robot control.  */
-    m_controlInterval.start(DIFFERENTIAL_DRIVE_CONTROL_PERIOD);
-
-    /* Periodically send Send Data via SerialMuxProt. */
-    m_sendSensorDataInterval.start(SEND_SENSOR_DATA_PERIOD);
+    /* Setup the periodically processing of robot control and send the sensor data
+     * periodically via SerialMuxProt. The number of tasks is below the scheduler
+     * limit, therefore the task ids are not checked.
+     */
+    (void)m_scheduler.addTask(controlTask, this, DIFFERENTIAL_DRIVE_CONTROL_PERIOD, CONTROL_TASK_PRIORITY);
+    (void)m_scheduler.addTask(sendSensorDataTask, this, SEND_SENSOR_DATA_PERIOD, SEND_SENSOR_DATA_TASK_PRIORITY);
+    m_scheduler.start();
 
     /* Providing Sensor data */
     m_smpChannelIdSensorData = m_smpServer.createChannel(SENSORDATA_CHANNEL_NAME, SENSORDATA_CHANNEL_DLC);
+    m_smpChannelIdFusedPose  = m_smpServer.createChannel(FUSED_POSE_CHANNEL_NAME, FUSED_POSE_CHANNEL_DLC);
+
+#if (0 != CONFIG_IMU_DATA_BATCH)
+    m_smpChannelIdImuDataBatch = m_smpServer.createChannel(IMU_DATA_BATCH_CHANNEL_NAME, IMU_DATA_BATCH_CHANNEL_DLC);
+#endif /* (0 != CONFIG_IMU_DATA_BATCH) */
+
+    /* The first IMU sample period starts now. */
+    m_imuTimestamp        = millis();
+    m_sensorDataTimestamp = m_imuTimestamp;
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+    /* Providing profiler data, which is optional. */
+    m_serialMuxProtChannelIdProfile = m_smpServer.createChannel(PROFILE_CHANNEL_NAME, PROFILE_CHANNEL_DLC);
+    (void)m_scheduler.addTask(profileTask, this, SEND_PROFILE_DATA_PERIOD, PROFILE_TASK_PRIORITY);
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
 }
 
 void App::loop()
 {
-    Board::getInstance().process();
-    m_smpServer.process(millis());
-    Speedometer::getInstance().process();
-
-    if (true == m_controlInterval.isTimeout())
     {
-        /* The differential drive control needs the measured speed of the
-         * left and right wheel. Therefore it shall be processed after
-         * the speedometer.
-         */
-        DifferentialDrive::getInstance().process(DIFFERENTIAL_DRIVE_CONTROL_PERIOD);
-
-        /* The odometry unit needs to detect motor speed changes to be able to
-         * calculate correct values. Therefore it shall be processed right after
-         * the differential drive control.
-         */
-        Odometry::getInstance().process();
+        PROFILER_SCOPE(Profiler::SECTION_BOARD);
+        Board::getInstance().process();
+    }
 
-        /* Read the IMU so when the Measurement Timer runs out the Sensor Data can be accessed directly without having
-         * to wait for the reading. */
-        IIMU& imu = Board::getInstance().getIMU();
-        imu.readGyro();
-        imu.readAccelerometer();
+    /* Play the queued tones without blocking. */
+    Sound::process();
 
-        m_controlInterval.restart();
+    {
+        PROFILER_SCOPE(Profiler::SECTION_SMP);
+        m_smpServer.process(millis());
     }
 
-    /* Send sensor data periodically if new data is available. */
-    if (true == m_sendSensorDataInterval.isTimeout())
     {
-        m_sendSensorDataInterval.restart();
-
-        /* Send Sensor Data if the application is currently in the Driving state. */
-        if (&DrivingState::getInstance() == m_systemStateMachine.getState())
-        {
-            sendSensorData();
-        }
+        PROFILER_SCOPE(Profiler::SECTION_SPEEDOMETER);
+        Speedometer::getInstance().process();
     }
 
-    m_systemStateMachine.process();
+    /* The scheduler runs the differential drive control first, because it has
+     * the highest priority. It needs the measured speed of the speedometer.
+     */
+    m_scheduler.process();
+
+    {
+        PROFILER_SCOPE(Profiler::SECTION_STATE_MACHINE);
+        m_systemStateMachine.process();
+    }
 }
 
 /******************************************************************************
@@ -138,36 +145,301 @@ void App::loop()
  * Private Methods
  *****************************************************************************/
 
+void App::controlTask(void* userData)
+{
+    App* application = reinterpret_cast<App*>(userData);
+
+    /* The differential drive control needs the measured speed of the
+     * left and right wheel. Therefore it shall be processed after
+     * the speedometer.
+     */
+    {
+        PROFILER_SCOPE(Profiler::SECTION_DIFFERENTIAL_DRIVE);
+        DifferentialDrive::getInstance().process(DIFFERENTIAL_DRIVE_CONTROL_PERIOD);
+    }
+
+    /* The odometry unit needs to detect motor speed changes to be able to
+     * calculate correct values. Therefore it shall be processed right after
+     * the differential drive control.
+     */
+    {
+        PROFILER_SCOPE(Profiler::SECTION_ODOMETRY);
+        Odometry::getInstance().process();
+    }
+
+    /* The pose filter needs the current odometry, therefore it shall be
+     * processed right after it.
+     */
+    if (nullptr != application)
+    {
+        application->processImu();
+    }
+}
+
+void App::sendSensorDataTask(void* userData)
+{
+    App* application = reinterpret_cast<App*>(userData);
+
+    if (nullptr != application)
+    {
+        /* Send Sensor Data if the application is currently in the Driving state. */
+        if (&DrivingState::getInstance() == application->m_systemStateMachine.getState())
+        {
+            application->sendSensorData();
+#if (0 != CONFIG_IMU_DATA_BATCH)
+            application->sendImuDataBatch();
+#endif /* (0 != CONFIG_IMU_DATA_BATCH) */
+            application->sendFusedPose();
+        }
+        else
+        {
+            application->discardImuSamples();
+
+            /* The slip events are counted per drive. */
+            application->m_slipDetector.clearSlipEventCount();
+
+#if (0 != CONFIG_IMU_DATA_BATCH)
+            /* The client shall get a keyframe first, after driving is started again. */
+            application->m_imuDataBatch.reset();
+#endif /* (0 != CONFIG_IMU_DATA_BATCH) */
+        }
+    }
+}
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+void App::profileTask(void* userData)
+{
+    App* application = reinterpret_cast<App*>(userData);
+
+    /* Only a single section is sent per period to keep the channel load low. */
+    if ((nullptr != application) && (0U != application->m_serialMuxProtChannelIdProfile) &&
+        (true == application->m_smpServer.isSynced()))
+    {
+        Profiler::Section    section = static_cast<Profiler::Section>(application->m_profileSection);
+        Profiler::Statistics statistics;
+
+        if (true == Profiler::getStatistics(section, statistics))
+        {
+            ProfileData payload;
+            uint8_t     bin = 0U;
+
+            payload.section = section;
+            payload.count   = statistics.count;
+            payload.min     = statistics.min;
+            payload.max     = statistics.max;
+            payload.mean    = Profiler::getMean(statistics);
+
+            for (bin = 0U; bin < Profiler::HISTOGRAM_BINS; ++bin)
+            {
+                payload.histogram[bin] = statistics.histogram[bin];
+            }
+
+            /* Ignoring return value, as error handling is not available. */
+            (void)application->m_smpServer.sendData(application->m_serialMuxProtChannelIdProfile, &payload,
+                                                    sizeof(payload));
+
+            Profiler::reset(section);
+        }
+
+        ++application->m_profileSection;
+
+        if (Profiler::SECTION_COUNT <= application->m_profileSection)
+        {
+            application->m_profileSection = 0U;
+        }
+    }
+}
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+
 void App::sendSensorData()
 {
     SensorData payload;
-    IIMU&      imu      = Board::getInstance().getIMU();
     Odometry&  odometry = Odometry::getInstance();
     int32_t    positionOdometryX;
     int32_t    positionOdometryY;
+    int16_t    accelerationX = 0;
+    int16_t    turnRate      = 0;
 
     /* Get the current values from the Odometry. */
     odometry.getPosition(positionOdometryX, positionOdometryY);
 
-    /* Access the Accelerometer Data (the Accelerometer is read out during the Control Interval Timeout). */
-    IMUData accelerationValues;
-    imu.getAccelerationValues(&accelerationValues);
-
-    /* Access the Gyro Data (the Gyro is read out during the Control Interval Timeout). */
-    IMUData turnRates;
-    imu.getTurnRates(&turnRates);
+    /* The mean of the accumulated samples fits into the range of a single sample. */
+    if (0U < m_imuSampleCount)
+    {
+        accelerationX = static_cast<int16_t>(m_accelerationSum / m_imuSampleCount);
+        turnRate      = static_cast<int16_t>(m_turnRateSum / m_imuSampleCount);
+    }
 
     /* Write the sensor data in the SensorData Struct. */
     payload.positionOdometryX   = positionOdometryX;
     payload.positionOdometryY   = positionOdometryY;
     payload.orientationOdometry = odometry.getOrientation();
-    payload.accelerationX       = accelerationValues.valueX;
-    payload.turnRate            = turnRates.valueZ;
-    payload.timePeriod          = static_cast<uint16_t>(SEND_SENSOR_DATA_PERIOD);
+    payload.accelerationX       = accelerationX;
+    payload.turnRate            = turnRate;
+    payload.timePeriod          = static_cast<uint16_t>(m_imuTimestamp - m_sensorDataTimestamp);
+    payload.turnAngle           = m_turnAngle;
+    payload.timestamp           = m_imuTimestamp;
+    payload.sequenceNumber      = m_sensorDataSequenceNumber;
+    payload.sampleCount         = m_imuSampleCount;
 
     /* Send the sensor data via the SerialMuxProt. */
     (void)m_smpServer.sendData(m_smpChannelIdSensorData, reinterpret_cast<uint8_t*>(&payload), sizeof(payload));
+
+    /* The receiver detects a lost sensor data by the sequence number. */
+    ++m_sensorDataSequenceNumber;
+    discardImuSamples();
+}
+
+void App::sendFusedPose()
+{
+    FusedPose payload;
+    int32_t   positionX;
+    int32_t   positionY;
+
+    m_poseFilter.getPosition(positionX, positionY);
+
+    payload.positionX           = positionX;
+    payload.positionY           = positionY;
+    payload.orientation         = m_poseFilter.getOrientation();
+    payload.positionVariance    = m_poseFilter.getPositionVariance();
+    payload.orientationVariance = m_poseFilter.getOrientationVariance();
+    payload.isSlipDetected      = (true == m_isSlipDetected) ? 1U : 0U;
+    payload.slipEventCount      = m_slipDetector.getSlipEventCount();
+
+    /* Send the fused pose via the SerialMuxProt. */
+    if (true == m_smpServer.sendData(m_smpChannelIdFusedPose, reinterpret_cast<uint8_t*>(&payload), sizeof(payload)))
+    {
+        m_isSlipDetected = false;
+    }
+}
+
+void App::processImu()
+{
+    IIMU&     imu       = Board::getInstance().getIMU();
+    Odometry& odometry  = Odometry::getInstance();
+    uint32_t  timestamp = millis();
+    uint16_t  period    = static_cast<uint16_t>(timestamp - m_imuTimestamp); /* [ms] */
+    IMUData   turnRates;
+    IMUData   accelerationValues;
+    int32_t   positionOdometryX;
+    int32_t   positionOdometryY;
+    int16_t   correctedTurnRate; /* [digits] */
+    int32_t   turnRate;          /* [mrad/s] */
+
+    imu.readGyro();
+    imu.readAccelerometer();
+
+    imu.getTurnRates(&turnRates);
+    imu.getAccelerationValues(&accelerationValues);
+
+    /* The gyro bias is estimated in the standstill phases and subtracted before
+     * the turn rate is fused or sent.
+     */
+    m_gyroBiasEstimator.process(turnRates.valueZ, odometry.isStandStill());
+    correctedTurnRate = m_gyroBiasEstimator.correct(turnRates.valueZ);
+    turnRate          = (static_cast<int32_t>(correctedTurnRate) * GYRO_SENSITIVITY) / 1000;
+
+    /* In case of wheel slip, the odometry orientation follows the gyro. It shall
+     * be done before the pose filter uses the odometry.
+     */
+    detectSlip(period, turnRate, accelerationValues.valueX);
+
+    odometry.getPosition(positionOdometryX, positionOdometryY);
+
+    {
+        PROFILER_SCOPE(Profiler::SECTION_POSE_FILTER);
+        m_poseFilter.process(period, turnRate, positionOdometryX, positionOdometryY, odometry.getOrientation(),
+                             m_slipDetector.isSlipDetected());
+    }
+
+    /* The slip is kept until it is reported. */
+    if (true == m_slipDetector.isSlipDetected())
+    {
+        m_isSlipDetected = true;
+    }
+
+    /* Every sample is used for the sensor data, not only the last one before sending.
+     * The sensor data is only sent in the driving state.
+     */
+    if (&DrivingState::getInstance() == m_systemStateMachine.getState())
+    {
+        accumulateImuSample(timestamp, period, correctedTurnRate, accelerationValues.valueX);
+    }
+
+    m_imuTimestamp = timestamp;
+}
+
+void App::detectSlip(uint16_t period, int32_t turnRate, int16_t acceleration)
+{
+    Speedometer&  speedometer     = Speedometer::getInstance();
+    const int32_t STEPS_PER_M     = static_cast<int32_t>(RobotConstants::ENCODER_STEPS_PER_M);
+    const int32_t WHEEL_BASE      = static_cast<int32_t>(RobotConstants::WHEEL_BASE);
+    int32_t       speedLeft       = (static_cast<int32_t>(speedometer.getLinearSpeedLeft()) * 1000) / STEPS_PER_M;
+    int32_t       speedRight      = (static_cast<int32_t>(speedometer.getLinearSpeedRight()) * 1000) / STEPS_PER_M;
+    int32_t       speedCenter     = (static_cast<int32_t>(speedometer.getLinearSpeedCenter()) * 1000) / STEPS_PER_M;
+    int32_t       encoderTurnRate = ((speedRight - speedLeft) * 1000) / WHEEL_BASE; /* [mrad/s] */
+
+    m_slipDetector.process(period, encoderTurnRate, turnRate, speedCenter,
+                           (static_cast<int32_t>(acceleration) * ACCELERATION_SENSITIVITY) / 1000);
+
+    /* The encoders can not be trusted during slip, therefore the gyro is used for the heading. */
+    if (true == m_slipDetector.isSlipDetected())
+    {
+        Odometry::getInstance().substituteOrientationChange(turnRate * static_cast<int32_t>(period));
+    }
+}
+
+void App::accumulateImuSample(uint32_t timestamp, uint16_t period, int16_t turnRate, int16_t acceleration)
+{
+    /* The sample count is limited by its type. If the sensor data is not sent
+     * in time, the older samples are kept.
+     */
+    if (UINT8_MAX > m_imuSampleCount)
+    {
+        m_turnRateSum += turnRate;
+        m_accelerationSum += acceleration;
+        m_turnAngle += static_cast<int32_t>(turnRate) * static_cast<int32_t>(period);
+        ++m_imuSampleCount;
+
+#if (0 != CONFIG_IMU_DATA_BATCH)
+        int32_t values[SMPChannelPayload::IMU_DATA_VALUE_COUNT];
+
+        values[SMPChannelPayload::IMU_DATA_TURN_RATE]      = turnRate;
+        values[SMPChannelPayload::IMU_DATA_ACCELERATION_X] = acceleration;
+
+        /* If the batch is full, send it and add the sample to the next one. */
+        if (false == m_imuDataBatch.addSample(timestamp, values))
+        {
+            sendImuDataBatch();
+            (void)m_imuDataBatch.addSample(timestamp, values);
+        }
+#endif /* (0 != CONFIG_IMU_DATA_BATCH) */
+    }
+}
+
+void App::discardImuSamples()
+{
+    m_sensorDataTimestamp = m_imuTimestamp;
+    m_imuSampleCount      = 0U;
+    m_turnRateSum         = 0;
+    m_accelerationSum     = 0;
+    m_turnAngle           = 0;
+}
+
+#if (0 != CONFIG_IMU_DATA_BATCH)
+void App::sendImuDataBatch()
+{
+    if (0U < m_imuDataBatch.getSampleCount())
+    {
+        /* Ignoring return value, as error handling is not available. The receiver detects
+         * a lost batch by the sequence number.
+         */
+        (void)m_smpServer.sendData(m_smpChannelIdImuDataBatch, m_imuDataBatch.getFrame(), IMU_DATA_BATCH_CHANNEL_DLC);
+
+        m_imuDataBatch.nextFrame();
+    }
 }
+#endif /* (0 != CONFIG_IMU_DATA_BATCH) */
 
 /******************************************************************************
  * External Functions
@@ -40,11 +40,22 @@
  * Compile Switches
  *****************************************************************************/
 
+#ifndef CONFIG_IMU_DATA_BATCH
+/**
+ * Send every IMU sample with its timestamp in batches on the "IMU_BATCH"
+ * channel, additional to the accumulated samples in the sensor data.
+ */
+#define CONFIG_IMU_DATA_BATCH (1)
+#endif /* CONFIG_IMU_DATA_BATCH */
+
 /******************************************************************************
  * Includes
  *****************************************************************************/
 #include <StateMachine.h>
-#include <SimpleTimer.h>
+#include <Scheduler.h>
+#include <PoseFilter.h>
+#include <GyroBiasEstimator.h>
+#include <SlipDetector.h>
 #include <Arduino.h>
 #include <SerialMuxProtServer.hpp>
 #include "SerialMuxChannels.h"
@@ -67,10 +78,31 @@ public:
      */
     App() :
         m_smpChannelIdSensorData(0U),
+        m_smpChannelIdFusedPose(0U),
         m_systemStateMachine(),
-        m_controlInterval(),
-        m_sendSensorDataInterval(),
-        m_smpServer(Serial)
+        m_scheduler(),
+        m_smpServer(Serial),
+        m_poseFilter(),
+        m_gyroBiasEstimator(),
+        m_slipDetector(),
+        m_isSlipDetected(false),
+        m_imuTimestamp(0U),
+        m_sensorDataTimestamp(0U),
+        m_sensorDataSequenceNumber(0U),
+        m_imuSampleCount(0U),
+        m_turnRateSum(0),
+        m_accelerationSum(0),
+        m_turnAngle(0)
+#if (0 != CONFIG_IMU_DATA_BATCH)
+        ,
+        m_smpChannelIdImuDataBatch(0U),
+        m_imuDataBatch(SMPChannelPayload::IMU_DATA_VALUE_COUNT)
+#endif /* (0 != CONFIG_IMU_DATA_BATCH) */
+#if (0 != CONFIG_PROFILER_ENABLE)
+        ,
+        m_serialMuxProtChannelIdProfile(0U),
+        m_profileSection(0U)
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
     {
     }
 
@@ -101,17 +133,41 @@ private:
     /** Baudrate for Serial Communication */
     static const uint32_t SERIAL_BAUDRATE = 115200U;
 
+    /** Task priority of the differential drive control, which shall always run first. */
+    static const uint8_t CONTROL_TASK_PRIORITY = Scheduler::PRIORITY_HIGHEST;
+
+    /** Task priority of sending the sensor data. */
+    static const uint8_t SEND_SENSOR_DATA_TASK_PRIORITY = CONTROL_TASK_PRIORITY + 1U;
+
+    /** Task priority of sending the profiler data. */
+    static const uint8_t PROFILE_TASK_PRIORITY = SEND_SENSOR_DATA_TASK_PRIORITY + 1U;
+
+    /**
+     * Gyro sensitivity in mrad/s per 1000 digits. The gyro is configured for
+     * turn sensing with a full scale of 1000 dps, which results in 35 mdps/digit.
+     */
+    static const int32_t GYRO_SENSITIVITY = 611;
+
+    /**
+     * Accelerometer sensitivity in mm/s^2 per 1000 digits. The accelerometer is
+     * configured with a full scale of 2 g, which results in 0.061 mg/digit.
+     */
+    static const int32_t ACCELERATION_SENSITIVITY = 598;
+
+    /** Profiler data sending period in ms. */
+    static const uint32_t SEND_PROFILE_DATA_PERIOD = 100U;
+
     /** Channel id for sending sensor data used for sensor fusion. */
     uint8_t m_smpChannelIdSensorData;
 
+    /** Channel id for sending the fused pose. */
+    uint8_t m_smpChannelIdFusedPose;
+
     /** The system state machine. */
     StateMachine m_systemStateMachine;
 
-    /** Timer used for differential drive control processing. */
-    SimpleTimer m_controlInterval;
-
-    /** Timer used for sending data periodically. */
-    SimpleTimer m_sendSensorDataInterval;
+    /** Scheduler for the periodic tasks. */
+    Scheduler m_scheduler;
 
     /**
      * SerialMuxProt Server Instance
@@ -120,11 +176,128 @@ private:
      */
     SerialMuxProtServer<MAX_CHANNELS> m_smpServer;
 
+    /** Pose filter, which fuses the gyro turn rate with the odometry every control period. */
+    PoseFilter m_poseFilter;
+
+    /** Gyro bias estimator, which is updated whenever the odometry reports standstill. */
+    GyroBiasEstimator m_gyroBiasEstimator;
+
+    /** Wheel slip detector, which cross-checks the encoders with the IMU every control period. */
+    SlipDetector m_slipDetector;
+
+    /** Wheel slip detected since the last sent fused pose? */
+    bool m_isSlipDetected;
+
+    /** Timestamp of the last IMU sample in ms. */
+    uint32_t m_imuTimestamp;
+
+    /** Timestamp of the last IMU sample in the previous sensor data in ms. */
+    uint32_t m_sensorDataTimestamp;
+
+    /** Sequence number of the next sensor data. */
+    uint8_t m_sensorDataSequenceNumber;
+
+    /** Number of IMU samples, accumulated for the next sensor data. */
+    uint8_t m_imuSampleCount;
+
+    /** Sum of the accumulated gyro values around z axis in digits. */
+    int32_t m_turnRateSum;
+
+    /** Sum of the accumulated acceleration values in x direction in digits. */
+    int32_t m_accelerationSum;
+
+    /** Integrated gyro values around z axis in digits * ms. */
+    int32_t m_turnAngle;
+
+#if (0 != CONFIG_IMU_DATA_BATCH)
+    /** Channel id for sending the batched IMU data samples. */
+    uint8_t m_smpChannelIdImuDataBatch;
+
+    /** Batch of IMU data samples. */
+    TelemetryBatch m_imuDataBatch;
+#endif /* (0 != CONFIG_IMU_DATA_BATCH) */
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+    /** SerialMuxProt Channel id for sending the profiler data. */
+    uint8_t m_serialMuxProtChannelIdProfile;
+
+    /** Profiler section, which is sent next. */
+    uint8_t m_profileSection;
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+
     /**
      * Send the Sensor data as a SensorData struct via SerialMuxProt.
      */
     void sendSensorData();
 
+    /**
+     * Send the fused pose as a FusedPose struct via SerialMuxProt.
+     */
+    void sendFusedPose();
+
+    /**
+     * Read the IMU, process the pose filter with the current gyro turn rate
+     * and odometry and accumulate the sample for the sensor data.
+     */
+    void processImu();
+
+    /**
+     * Detect wheel slip by cross-checking the encoders with the IMU. During slip
+     * the odometry orientation follows the gyro.
+     *
+     * @param[in] period        Time since the previous sample in ms.
+     * @param[in] turnRate      Gyro turn rate in mrad/s.
+     * @param[in] acceleration  Acceleration in x direction in digits.
+     */
+    void detectSlip(uint16_t period, int32_t turnRate, int16_t acceleration);
+
+    /**
+     * Accumulate an IMU sample for the next sensor data.
+     *
+     * @param[in] timestamp     Timestamp of the sample in ms.
+     * @param[in] period        Time since the previous sample in ms.
+     * @param[in] turnRate      Gyro value around z axis in digits.
+     * @param[in] acceleration  Acceleration in x direction in digits.
+     */
+    void accumulateImuSample(uint32_t timestamp, uint16_t period, int16_t turnRate, int16_t acceleration);
+
+    /**
+     * Discard the accumulated IMU samples. The next sensor data starts with
+     * the next sample.
+     */
+    void discardImuSamples();
+
+#if (0 != CONFIG_IMU_DATA_BATCH)
+    /**
+     * Send the batch of IMU data samples via SerialMuxProt, if it is not empty,
+     * and start the next one.
+     */
+    void sendImuDataBatch();
+#endif /* (0 != CONFIG_IMU_DATA_BATCH) */
+
+    /**
+     * Periodic differential drive control task.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void controlTask(void* userData);
+
+    /**
+     * Periodic task to send the sensor data.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void sendSensorDataTask(void* userData);
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+    /**
+     * Periodic task to send the statistics of a single profiler section.
+     *
+     * @param[in] userData  Instance of App class.
+     */
+    static void profileTask(void* userData);
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+
     /**
      * Copy construction of an instance.
      * Not allowed.
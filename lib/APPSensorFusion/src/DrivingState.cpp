@@ -220,7 +220,7 @@ void DrivingState::process(StateMachine& sm)
          */
         diffDrive.setLinearSpeed(0, 0);
 
-        Sound::playAlarm(); /* Blocking! */
+        Sound::playAlarm();
 
         /* Clear lap time. */
         ReadyState::getInstance().setLapTime(0);
@@ -242,9 +242,15 @@ void DrivingState::process(StateMachine& sm)
         /* Process the line follower PID controller periodically to adapt driving. */
         if (true == m_pidProcessTime.isTimeout())
         {
+            /* Except the immediate first run, the controller uses the real elapsed time since its last run. */
+            if (0U < m_pidProcessTime.getDuration())
+            {
+                m_pidCtrl.setSampleTime(Timebase::toMs(m_pidProcessTime.getCurrentDuration()));
+            }
+
             adaptDriving(position, allowNegativeMotorSpeed);
 
-            m_pidProcessTime.start(PID_PROCESS_PERIOD);
+            m_pidProcessTime.start(Timebase::fromMs(PID_PROCESS_PERIOD));
         }
     }
     /* Finished. */
@@ -46,6 +46,7 @@
 #include <stdint.h>
 #include <IState.h>
 #include <SimpleTimer.h>
+#include <MicroTimer.h>
 #include <PIDController.h>
 
 /******************************************************************************
@@ -185,7 +186,7 @@ private:
 
     SimpleTimer            m_observationTimer; /**< Observation timer to observe the max. time per challenge. */
     SimpleTimer            m_lapTime;          /**< Timer used to calculate the lap time. */
-    SimpleTimer            m_pidProcessTime;   /**< Timer used for periodically PID processing. */
+    MicroTimer             m_pidProcessTime;   /**< Timer used for periodically PID processing. */
     PIDController<int16_t> m_pidCtrl;          /**< PID controller, used for driving. */
     int16_t                m_topSpeed;    /**< Top speed in [steps/s]. It might be lower or equal to the max. speed! */
     LineStatus             m_lineStatus;  /**< Status of start-/end line detection */
@@ -0,0 +1,117 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Gyro calibration state
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "GyroCalibrationState.h"
+#include <StateMachine.h>
+#include <Logging.h>
+#include "LineSensorsCalibrationState.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/**
+ * Logging source.
+ */
+LOG_TAG("GCState");
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+void GyroCalibrationState::entry()
+{
+    /* The calibration starts with the next standstill sample. */
+    if (nullptr != m_biasEstimator)
+    {
+        m_biasEstimator->reset();
+    }
+
+    m_timer.start(CALIBRATION_TIMEOUT);
+}
+
+void GyroCalibrationState::process(StateMachine& sm)
+{
+    if ((nullptr == m_biasEstimator) || (true == m_biasEstimator->isCalibrated()))
+    {
+        sm.setState(&LineSensorsCalibrationState::getInstance());
+    }
+    else if (true == m_timer.isTimeout())
+    {
+        /* Not fatal, because the bias is calibrated at the next standstill. */
+        LOG_WARNING("Gyro bias not calibrated.");
+        sm.setState(&LineSensorsCalibrationState::getInstance());
+    }
+    else
+    {
+        ;
+    }
+}
+
+void GyroCalibrationState::exit()
+{
+    m_timer.stop();
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
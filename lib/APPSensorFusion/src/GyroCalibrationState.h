@@ -0,0 +1,156 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Gyro calibration state
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup Application
+ *
+ * @{
+ */
+
+#ifndef GYRO_CALIBRATION_STATE_H
+#define GYRO_CALIBRATION_STATE_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <IState.h>
+#include <SimpleTimer.h>
+#include <GyroBiasEstimator.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The gyro calibration state waits until the gyro bias is calibrated, while the
+ * robot stands still. The gyro bias estimator itself is processed with every
+ * IMU sample by the application.
+ */
+class GyroCalibrationState : public IState
+{
+public:
+    /**
+     * Get state instance.
+     *
+     * @return State instance.
+     */
+    static GyroCalibrationState& getInstance()
+    {
+        static GyroCalibrationState instance;
+
+        /* Singleton idiom to force initialization during first usage. */
+
+        return instance;
+    }
+
+    /**
+     * If the state is entered, this method will called once.
+     */
+    void entry() final;
+
+    /**
+     * Processing the state.
+     *
+     * @param[in] sm State machine, which is calling this state.
+     */
+    void process(StateMachine& sm) final;
+
+    /**
+     * If the state is left, this method will be called once.
+     */
+    void exit() final;
+
+    /**
+     * Set the gyro bias estimator, which shall be calibrated.
+     *
+     * @param[in] estimator Gyro bias estimator
+     */
+    void setBiasEstimator(GyroBiasEstimator* estimator)
+    {
+        m_biasEstimator = estimator;
+    }
+
+protected:
+private:
+    /**
+     * Max. duration of the calibration in ms. Afterwards the calibration continues
+     * with the next standstill of the robot.
+     */
+    static const uint32_t CALIBRATION_TIMEOUT = 3000U;
+
+    SimpleTimer        m_timer;         /**< Timer used for the calibration timeout. */
+    GyroBiasEstimator* m_biasEstimator; /**< Gyro bias estimator, which shall be calibrated. */
+
+    /**
+     * Default constructor.
+     */
+    GyroCalibrationState() : m_timer(), m_biasEstimator(nullptr)
+    {
+    }
+
+    /**
+     * Default destructor.
+     */
+    ~GyroCalibrationState()
+    {
+    }
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] state Source instance.
+     */
+    GyroCalibrationState(const GyroCalibrationState& state);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] state Source instance.
+     *
+     * @returns Reference to GyroCalibrationState.
+     */
+    GyroCalibrationState& operator=(const GyroCalibrationState& state);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* GYRO_CALIBRATION_STATE_H */
+/** @} */
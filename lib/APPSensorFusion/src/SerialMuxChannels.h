@@ -38,6 +38,8 @@
  *****************************************************************************/
 
 #include <stdint.h>
+#include <Profiler.h>
+#include <TelemetryBatch.h>
 
 /******************************************************************************
  * Macros
@@ -52,11 +54,47 @@
 /** DLC of Sensordata Channel */
 #define SENSORDATA_CHANNEL_DLC (sizeof(SensorData))
 
+/** Name of Channel to send batched IMU Data samples to. */
+#define IMU_DATA_BATCH_CHANNEL_NAME "IMU_BATCH"
+
+/** DLC of IMU Data Batch Channel, see TelemetryBatch for the frame format. */
+#define IMU_DATA_BATCH_CHANNEL_DLC (TelemetryBatch::FRAME_SIZE)
+
+/** Name of Channel to send the Fused Pose to. */
+#define FUSED_POSE_CHANNEL_NAME "FUSED_POSE"
+
+/** DLC of Fused Pose Channel */
+#define FUSED_POSE_CHANNEL_DLC (sizeof(FusedPose))
+
+/** Name of Channel to send profiler data to. */
+#define PROFILE_CHANNEL_NAME "PROFILE"
+
+/** DLC of Profile Channel */
+#define PROFILE_CHANNEL_DLC (sizeof(ProfileData))
+
 /******************************************************************************
  * Types and Classes
  *****************************************************************************/
 
-/** Struct of the Sensor Data channel payload. */
+/** SerialMuxProt channel payload definitions. */
+namespace SMPChannelPayload
+{
+    /** Values of a single sample in the "IMU Data Batch" channel, in this order. */
+    typedef enum : uint8_t
+    {
+        IMU_DATA_TURN_RATE = 0,  /**< Gyro value around z axis without bias [digits]. */
+        IMU_DATA_ACCELERATION_X, /**< Acceleration in x direction [digits]. */
+        IMU_DATA_VALUE_COUNT     /**< Number of values per sample. */
+
+    } ImuDataValue; /**< IMU data sample value */
+
+} /* namespace SMPChannelPayload */
+
+/**
+ * Struct of the Sensor Data channel payload.
+ * The IMU is sampled every control period. All samples since the last sensor
+ * data are accumulated, so none is lost.
+ */
 typedef struct _SensorData
 {
     /** Position in x direction in mm calculated by odometry. */
@@ -68,22 +106,62 @@ typedef struct _SensorData
     /** Orientation in mrad calculated by odometry. */
     int32_t orientationOdometry;
 
-    /** Acceleration in x direction as a raw sensor value in digits.
+    /** Mean acceleration in x direction of all samples as a raw sensor value in digits.
      * It can be converted into a physical acceleration value in mm/s^2 via the
      * multiplication with a sensitivity factor in mm/s^2/digit.
      */
     int16_t accelerationX;
 
-    /** Gyro value around z axis as a raw sensor value in digits.
-     * It can be converted into a physical turn rate in mrad/s via the multiplication
-     * with a sensitivity factor in mrad/s/digit.
+    /** Mean gyro value around z axis of all samples as a raw sensor value in digits,
+     * with the gyro bias already subtracted. It can be converted into a physical
+     * turn rate in mrad/s via the multiplication with a sensitivity factor in mrad/s/digit.
      */
     int16_t turnRate;
 
-    /** Time passed since the last sensor value in milliseconds. */
+    /** Time in milliseconds, which is covered by the samples. It is the time passed
+     * since the last sample of the previous sensor data.
+     */
     uint16_t timePeriod;
+
+    /** Gyro value around z axis of all samples, integrated over the time period in digits * ms.
+     * It can be converted into a turn angle in urad via the multiplication with a
+     * sensitivity factor in mrad/s/digit.
+     */
+    int32_t turnAngle;
+
+    /** Timestamp of the last sample in milliseconds. */
+    uint32_t timestamp;
+
+    /** Sequence number, which is incremented with every sensor data. */
+    uint8_t sequenceNumber;
+
+    /** Number of accumulated IMU samples. */
+    uint8_t sampleCount;
 } __attribute__((packed)) SensorData;
 
+/** Struct of the "Fused Pose" channel payload. */
+typedef struct _FusedPose
+{
+    int32_t  positionX;           /**< Fused position in x direction [mm]. */
+    int32_t  positionY;           /**< Fused position in y direction [mm]. */
+    int32_t  orientation;         /**< Fused orientation [mrad], in the range (-PI; PI]. */
+    uint32_t positionVariance;    /**< Variance of the position in x and y direction [mm^2]. */
+    uint32_t orientationVariance; /**< Variance of the orientation [urad^2]. */
+    uint8_t  isSlipDetected;      /**< Wheel slip detected since the last pose (1) or not (0). */
+    uint16_t slipEventCount;      /**< Number of wheel slip events since driving started. */
+} __attribute__((packed)) FusedPose;
+
+/** Struct of the "Profile" channel payload. */
+typedef struct _ProfileData
+{
+    uint8_t  section;                             /**< Profiler section, see Profiler::Section. */
+    uint16_t count;                               /**< Number of measurements. */
+    uint16_t min;                                 /**< Min. execution time [us]. */
+    uint16_t max;                                 /**< Max. execution time [us]. */
+    uint16_t mean;                                /**< Mean execution time [us]. */
+    uint16_t histogram[Profiler::HISTOGRAM_BINS]; /**< Number of measurements per histogram bin. */
+} __attribute__((packed)) ProfileData;
+
 
 /******************************************************************************
  * Functions
@@ -91,7 +91,7 @@ void StartupState::process(StateMachine& sm)
 
         /* Differential drive can now be used. */
         diffDrive.enable();
-        sm.setState(&LineSensorsCalibrationState::getInstance());
+        sm.setState(&GyroCalibrationState::getInstance());
     }
 }
 
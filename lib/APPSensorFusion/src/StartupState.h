@@ -45,7 +45,7 @@
  *****************************************************************************/
 #include <stdint.h>
 #include <IState.h>
-#include "LineSensorsCalibrationState.h"
+#include "GyroCalibrationState.h"
 /******************************************************************************
  * Macros
  *****************************************************************************/
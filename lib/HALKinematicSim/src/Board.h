@@ -0,0 +1,353 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  The headless kinematic simulation robot board realization.
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup HALKinematicSim
+ *
+ * @{
+ */
+#ifndef BOARD_H
+#define BOARD_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <IBoard.h>
+#include <Button.h>
+#include <Buzzer.h>
+#include <Display.h>
+#include <Encoders.h>
+#include <LineSensors.h>
+#include <Motors.h>
+#include <LedRed.h>
+#include <LedYellow.h>
+#include <LedGreen.h>
+#include <Settings.h>
+#include <KinematicPlant.h>
+#include <Track.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The concrete headless simulation robot board.
+ * It runs without Webots, the devices work on a kinematic plant and a track bitmap.
+ */
+class Board : public IBoard
+{
+public:
+    /**
+     * Get board instance.
+     *
+     * @return Board instance
+     */
+    static Board& getInstance()
+    {
+        static Board instance; /* idiom */
+
+        return instance;
+    }
+
+    /**
+     * Initialize the hardware.
+     */
+    void init() final;
+
+    /**
+     * Get button A driver.
+     *
+     * @return Button A driver.
+     */
+    IButton& getButtonA() final
+    {
+        return m_buttonA;
+    }
+
+    /**
+     * Get button B driver.
+     *
+     * @return Button B driver.
+     */
+    IButton& getButtonB() final
+    {
+        return m_buttonB;
+    }
+
+    /**
+     * Get button C driver.
+     *
+     * @return Button C driver.
+     */
+    IButton& getButtonC() final
+    {
+        return m_buttonC;
+    }
+
+    /**
+     * Get buzzer driver.
+     *
+     * @return Buzzer driver.
+     */
+    IBuzzer& getBuzzer() final
+    {
+        return m_buzzer;
+    }
+
+    /**
+     * Get LCD driver.
+     *
+     * @return LCD driver.
+     */
+    IDisplay& getDisplay() final
+    {
+        return m_display;
+    }
+
+    /**
+     * Get encoders.
+     *
+     * @return Encoders driver.
+     */
+    IEncoders& getEncoders() final
+    {
+        return m_encoders;
+    }
+
+    /**
+     * Get line sensors driver.
+     *
+     * @return Line sensor driver.
+     */
+    ILineSensors& getLineSensors() final
+    {
+        return m_lineSensors;
+    }
+
+    /**
+     * Get motor driver.
+     *
+     * @return Motor driver.
+     */
+    IMotors& getMotors() final
+    {
+        return m_motors;
+    }
+
+    /**
+     * Get red LED driver.
+     *
+     * @return Red LED driver.
+     */
+    ILed& getRedLed() final
+    {
+        return m_ledRed;
+    }
+
+    /**
+     * Get yellow LED driver.
+     *
+     * @return Yellow LED driver.
+     */
+    ILed& getYellowLed() final
+    {
+        return m_ledYellow;
+    }
+
+    /**
+     * Get green LED driver.
+     *
+     * @return Green LED driver.
+     */
+    ILed& getGreenLed() final
+    {
+        return m_ledGreen;
+    }
+
+    /**
+     * Get the settings.
+     *
+     * @return Settings
+     */
+    ISettings& getSettings() final
+    {
+        return m_settings;
+    }
+
+    /**
+     * Process actuators and sensors.
+     */
+    void process() final
+    {
+        m_buzzer.process();
+    }
+
+private:
+    /** Kinematic plant of the robot, which owns the virtual time. */
+    KinematicPlant m_plant;
+
+    /** Track below the robot. */
+    Track m_track;
+
+    /** Button A driver */
+    Button m_buttonA;
+
+    /** Button B driver */
+    Button m_buttonB;
+
+    /** Button C driver */
+    Button m_buttonC;
+
+    /** Buzzer driver */
+    Buzzer m_buzzer;
+
+    /** Display driver */
+    Display m_display;
+
+    /** Encoders driver */
+    Encoders m_encoders;
+
+    /** Line sensors driver */
+    LineSensors m_lineSensors;
+
+    /** Motors driver */
+    Motors m_motors;
+
+    /** Red LED driver */
+    LedRed m_ledRed;
+
+    /** Yellow LED driver */
+    LedYellow m_ledYellow;
+
+    /** Green LED driver */
+    LedGreen m_ledGreen;
+
+    /** Settings */
+    Settings m_settings;
+
+    /**
+     * Constructs the concrete board.
+     */
+    Board();
+
+    /**
+     * Destroys the concrete board.
+     */
+    ~Board()
+    {
+    }
+
+    /**
+     * Get the kinematic plant of the robot.
+     *
+     * @return Kinematic plant
+     */
+    KinematicPlant& getPlant()
+    {
+        return m_plant;
+    }
+
+    /**
+     * Get the track below the robot.
+     *
+     * @return Track
+     */
+    Track& getTrack()
+    {
+        return m_track;
+    }
+
+    /**
+     * Get the scripted button A.
+     *
+     * @return Button A
+     */
+    Button& getScriptedButtonA()
+    {
+        return m_buttonA;
+    }
+
+    /**
+     * Get the scripted button B.
+     *
+     * @return Button B
+     */
+    Button& getScriptedButtonB()
+    {
+        return m_buttonB;
+    }
+
+    /**
+     * Get the scripted button C.
+     *
+     * @return Button C
+     */
+    Button& getScriptedButtonC()
+    {
+        return m_buttonC;
+    }
+
+    /**
+     * Get the simulated line sensors, which provide the noise setup.
+     *
+     * @return Line sensors
+     */
+    LineSensors& getSimulatedLineSensors()
+    {
+        return m_lineSensors;
+    }
+
+    /**
+     * The main entry needs access to the kinematic plant, the track, the buttons and the line sensors.
+     * But all other application parts shall have no access, which is
+     * solved by this friend.
+     *
+     * @param[in] argc  Number of arguments
+     * @param[in] argv  Arguments
+     *
+     * @return Exit code
+     */
+    friend int main(int argc, char** argv);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* BOARD_H */
+/** @} */
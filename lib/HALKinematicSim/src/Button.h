@@ -0,0 +1,137 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Scripted button realization of the headless simulation
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup HALKinematicSim
+ *
+ * @{
+ */
+
+#ifndef BUTTON_H
+#define BUTTON_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IButton.h"
+#include "KinematicPlant.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * This class provides a button, which is pressed according to a script.
+ * Every press starts at a given virtual time and lasts a fixed duration.
+ */
+class Button : public IButton
+{
+public:
+    /** Max. number of scripted presses. */
+    static const uint8_t MAX_PRESSES = 16U;
+
+    /** Duration of a single press in ms. */
+    static const uint32_t PRESS_DURATION = 100U;
+
+    /**
+     * Constructs the button adapter.
+     *
+     * @param[in] plant Kinematic plant, which provides the virtual time.
+     */
+    Button(const KinematicPlant& plant) : IButton(), m_plant(plant), m_pressCount(0U)
+    {
+    }
+
+    /**
+     * Destroys the button adapter.
+     */
+    ~Button()
+    {
+    }
+
+    /**
+     * Is button pressed or not
+     *
+     * @return If button is pressed, returns true otherwise false.
+     */
+    bool isPressed() final;
+
+    /**
+     * Add a press to the script.
+     *
+     * @param[in] timestamp Virtual time in ms, when the button shall be pressed.
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addPress(uint32_t timestamp);
+
+private:
+    const KinematicPlant& m_plant;                /**< Kinematic plant, which provides the virtual time */
+    uint32_t              m_presses[MAX_PRESSES]; /**< Start of every press as virtual time in ms */
+    uint8_t               m_pressCount;           /**< Number of scripted presses */
+
+    /**
+     * Default constructor.
+     * Not allowed.
+     */
+    Button();
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] button Source instance.
+     */
+    Button(const Button& button);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] button Source instance.
+     *
+     * @returns Reference to Button instance.
+     */
+    Button& operator=(const Button& button);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* BUTTON_H */
+/** @} */
@@ -0,0 +1,129 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Encoders realization of the headless simulation
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "Encoders.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static int16_t toCounts(int32_t steps, int32_t reference);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+void Encoders::init()
+{
+    m_leftReference  = m_plant.getLeftEncoderSteps();
+    m_rightReference = m_plant.getRightEncoderSteps();
+}
+
+int16_t Encoders::getCountsLeft()
+{
+    return toCounts(m_plant.getLeftEncoderSteps(), m_leftReference);
+}
+
+int16_t Encoders::getCountsRight()
+{
+    return toCounts(m_plant.getRightEncoderSteps(), m_rightReference);
+}
+
+int16_t Encoders::getCountsAndResetLeft()
+{
+    int32_t steps  = m_plant.getLeftEncoderSteps();
+    int16_t counts = toCounts(steps, m_leftReference);
+
+    m_leftReference = steps;
+
+    return counts;
+}
+
+int16_t Encoders::getCountsAndResetRight()
+{
+    int32_t steps  = m_plant.getRightEncoderSteps();
+    int16_t counts = toCounts(steps, m_rightReference);
+
+    m_rightReference = steps;
+
+    return counts;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Get the 16-bit encoder counts since the reference, with the same overflow
+ * behaviour as on the robot.
+ *
+ * @param[in] steps     Encoder steps of the plant
+ * @param[in] reference Encoder steps of the plant at the last reset
+ *
+ * @return Encoder counts
+ */
+static int16_t toCounts(int32_t steps, int32_t reference)
+{
+    uint16_t counts = static_cast<uint16_t>(static_cast<uint32_t>(steps) - static_cast<uint32_t>(reference));
+
+    return static_cast<int16_t>(counts);
+}
@@ -0,0 +1,159 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Encoders realization of the headless simulation
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup HALKinematicSim
+ *
+ * @{
+ */
+
+#ifndef ENCODERS_H
+#define ENCODERS_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "IEncoders.h"
+#include "KinematicPlant.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * This class provides the simulated encoders. They count the whole steps of the
+ * kinematic plant wheels and overflow like the 16-bit counters of the robot.
+ */
+class Encoders : public IEncoders
+{
+public:
+    /**
+     * Constructs the encoders adapter.
+     *
+     * @param[in] plant Kinematic plant, which drives the wheels.
+     */
+    Encoders(const KinematicPlant& plant) : IEncoders(), m_plant(plant), m_leftReference(0), m_rightReference(0)
+    {
+    }
+
+    /**
+     * Destroys the encoders adapter.
+     */
+    ~Encoders()
+    {
+    }
+
+    /**
+     * Initializes the encoders and resets the counts.
+     */
+    void init() final;
+
+    /**
+     * Returns the number of counts that have been detected from the left-side
+     * encoder.  These counts start at 0. Positive counts correspond to forward
+     * movement of the left side of the robot, while negative counts correspond
+     * to backwards movement.
+     *
+     * The count is returned as a signed 16-bit integer. When the count goes
+     * over 32767, it will overflow down to -32768. When the count goes below
+     * -32768, it will overflow up to 32767.
+     *
+     * @return Encoder counts left
+     */
+    int16_t getCountsLeft() final;
+
+    /**
+     * This function is just like getCountsLeft() except it applies to the
+     * right-side encoder.
+     *
+     * @return Encoder counts right
+     */
+    int16_t getCountsRight() final;
+
+    /**
+     * This function is just like getCountsLeft() except it also clears the
+     * counts before returning.  If you call this frequently enough, you will
+     * not have to worry about the count overflowing.
+     *
+     * @return Encoder counts left
+     */
+    int16_t getCountsAndResetLeft() final;
+
+    /**
+     * This function is just like getCountsAndResetLeft() except it applies to
+     * the right-side encoder.
+     *
+     * @return Encoder counts right
+     */
+    int16_t getCountsAndResetRight() final;
+
+private:
+    const KinematicPlant& m_plant;          /**< Kinematic plant, which drives the wheels */
+    int32_t               m_leftReference;  /**< Left plant encoder steps at the last reset */
+    int32_t               m_rightReference; /**< Right plant encoder steps at the last reset */
+
+    /**
+     * Default constructor.
+     * Not allowed.
+     */
+    Encoders();
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] encoders Source instance.
+     */
+    Encoders(const Encoders& encoders);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] encoders Source instance.
+     *
+     * @returns Reference to Encoders instance.
+     */
+    Encoders& operator=(const Encoders& encoders);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* ENCODERS_H */
+/** @} */
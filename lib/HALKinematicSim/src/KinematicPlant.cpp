@@ -0,0 +1,150 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Kinematic differential drive plant of the headless simulation
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "KinematicPlant.h"
+#include "RobotConstants.h"
+#include <math.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Encoder steps per mm driven distance. */
+static const double STEPS_PER_MM = static_cast<double>(RobotConstants::ENCODER_STEPS_PER_M) / 1000.0;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+KinematicPlant::KinematicPlant() :
+    m_xPos(0.0),
+    m_yPos(0.0),
+    m_orientation(0.0),
+    m_leftTargetSpeed(0.0),
+    m_rightTargetSpeed(0.0),
+    m_leftSpeed(0.0),
+    m_rightSpeed(0.0),
+    m_leftSteps(0.0),
+    m_rightSteps(0.0),
+    m_time(0U)
+{
+}
+
+void KinematicPlant::setPose(double xPos, double yPos, double orientation)
+{
+    m_xPos        = xPos;
+    m_yPos        = yPos;
+    m_orientation = orientation;
+}
+
+int32_t KinematicPlant::getLeftEncoderSteps() const
+{
+    return static_cast<int32_t>(floor(m_leftSteps));
+}
+
+int32_t KinematicPlant::getRightEncoderSteps() const
+{
+    return static_cast<int32_t>(floor(m_rightSteps));
+}
+
+void KinematicPlant::step(uint16_t timeStep)
+{
+    const double DURATION       = static_cast<double>(timeStep) / 1000.0; /* s */
+    const double LAG_CONST      = 1.0 - exp(-static_cast<double>(timeStep) / MOTOR_TIME_CONSTANT);
+    double       leftSpeedPrev  = m_leftSpeed;
+    double       rightSpeedPrev = m_rightSpeed;
+    double       leftSteps      = 0.0;
+    double       rightSteps     = 0.0;
+    double       leftDistance   = 0.0; /* mm */
+    double       rightDistance  = 0.0; /* mm */
+    double       distance       = 0.0; /* mm */
+    double       turnAngle      = 0.0; /* rad */
+
+    /* The exact discrete solution of the first order lag element keeps the
+     * motor model stable for every time step.
+     */
+    m_leftSpeed += (m_leftTargetSpeed - m_leftSpeed) * LAG_CONST;
+    m_rightSpeed += (m_rightTargetSpeed - m_rightSpeed) * LAG_CONST;
+
+    /* Trapezoidal integration of the wheel speeds. */
+    leftSteps  = (leftSpeedPrev + m_leftSpeed) * DURATION / 2.0;
+    rightSteps = (rightSpeedPrev + m_rightSpeed) * DURATION / 2.0;
+
+    m_leftSteps += leftSteps;
+    m_rightSteps += rightSteps;
+
+    leftDistance  = leftSteps / STEPS_PER_MM;
+    rightDistance = rightSteps / STEPS_PER_MM;
+    distance      = (leftDistance + rightDistance) / 2.0;
+    turnAngle     = (rightDistance - leftDistance) / static_cast<double>(RobotConstants::WHEEL_BASE);
+
+    /* Integrate the pose along the mean orientation of the time step. */
+    m_xPos += distance * cos(m_orientation + (turnAngle / 2.0));
+    m_yPos += distance * sin(m_orientation + (turnAngle / 2.0));
+    m_orientation += turnAngle;
+
+    m_time += timeStep;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
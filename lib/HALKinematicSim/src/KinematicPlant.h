@@ -0,0 +1,229 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Kinematic differential drive plant of the headless simulation
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup HALKinematicSim
+ *
+ * @{
+ */
+
+#ifndef KINEMATIC_PLANT_H
+#define KINEMATIC_PLANT_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Kinematic model of the differential drive robot, without any Webots dependency.
+ *
+ * The motors are modelled as first order lag element, the wheels roll without slip
+ * and the encoders deliver only whole steps. The plant owns the virtual time, which
+ * advances only by stepping it. Therefore every run with the same inputs results
+ * in the same outputs.
+ */
+class KinematicPlant
+{
+public:
+    /**
+     * Wheel speed in steps/s at max. motor speed.
+     * It corresponds to the max. motor velocity in the Webots robot model.
+     */
+    static const int16_t MAX_WHEEL_SPEED = 4222;
+
+    /** Time constant of the motors in ms. */
+    static const uint16_t MOTOR_TIME_CONSTANT = 50U;
+
+    /**
+     * Constructs the plant. The robot stands still at the origin and looks
+     * in direction of the x-axis.
+     */
+    KinematicPlant();
+
+    /**
+     * Destroys the plant.
+     */
+    ~KinematicPlant()
+    {
+    }
+
+    /**
+     * Set the robot pose. The wheel speeds and the encoders are not changed.
+     *
+     * @param[in] xPos          x-coordinate in mm
+     * @param[in] yPos          y-coordinate in mm
+     * @param[in] orientation   Orientation in rad
+     */
+    void setPose(double xPos, double yPos, double orientation);
+
+    /**
+     * Get the x-coordinate of the robot center.
+     *
+     * @return x-coordinate in mm
+     */
+    double getXPos() const
+    {
+        return m_xPos;
+    }
+
+    /**
+     * Get the y-coordinate of the robot center.
+     *
+     * @return y-coordinate in mm
+     */
+    double getYPos() const
+    {
+        return m_yPos;
+    }
+
+    /**
+     * Get the orientation of the robot.
+     *
+     * @return Orientation in rad
+     */
+    double getOrientation() const
+    {
+        return m_orientation;
+    }
+
+    /**
+     * Set the target wheel speeds, which the motors will follow delayed.
+     *
+     * @param[in] leftSpeed     Left wheel target speed in steps/s
+     * @param[in] rightSpeed    Right wheel target speed in steps/s
+     */
+    void setTargetSpeeds(double leftSpeed, double rightSpeed)
+    {
+        m_leftTargetSpeed  = leftSpeed;
+        m_rightTargetSpeed = rightSpeed;
+    }
+
+    /**
+     * Get the current left wheel speed.
+     *
+     * @return Left wheel speed in steps/s
+     */
+    double getLeftSpeed() const
+    {
+        return m_leftSpeed;
+    }
+
+    /**
+     * Get the current right wheel speed.
+     *
+     * @return Right wheel speed in steps/s
+     */
+    double getRightSpeed() const
+    {
+        return m_rightSpeed;
+    }
+
+    /**
+     * Get the left encoder steps since start.
+     * Only whole steps are provided, like a real encoder does.
+     *
+     * @return Left encoder steps
+     */
+    int32_t getLeftEncoderSteps() const;
+
+    /**
+     * Get the right encoder steps since start.
+     * Only whole steps are provided, like a real encoder does.
+     *
+     * @return Right encoder steps
+     */
+    int32_t getRightEncoderSteps() const;
+
+    /**
+     * Get the virtual time since start.
+     *
+     * @return Virtual time in ms
+     */
+    uint32_t getTime() const
+    {
+        return m_time;
+    }
+
+    /**
+     * Advance the plant and the virtual time by one time step.
+     *
+     * @param[in] timeStep  Time step in ms
+     */
+    void step(uint16_t timeStep);
+
+private:
+    double   m_xPos;             /**< x-coordinate of the robot center in mm */
+    double   m_yPos;             /**< y-coordinate of the robot center in mm */
+    double   m_orientation;      /**< Orientation in rad */
+    double   m_leftTargetSpeed;  /**< Left wheel target speed in steps/s */
+    double   m_rightTargetSpeed; /**< Right wheel target speed in steps/s */
+    double   m_leftSpeed;        /**< Left wheel speed in steps/s */
+    double   m_rightSpeed;       /**< Right wheel speed in steps/s */
+    double   m_leftSteps;        /**< Left wheel driven steps, incl. the fraction of a step */
+    double   m_rightSteps;       /**< Right wheel driven steps, incl. the fraction of a step */
+    uint32_t m_time;             /**< Virtual time in ms */
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] plant Source instance.
+     */
+    KinematicPlant(const KinematicPlant& plant);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] plant Source instance.
+     *
+     * @returns Reference to KinematicPlant instance.
+     */
+    KinematicPlant& operator=(const KinematicPlant& plant);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* KINEMATIC_PLANT_H */
+/** @} */
@@ -0,0 +1,283 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Line sensors realization of the headless simulation
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "LineSensors.h"
+#include <math.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Distance of the sensors in front of the robot center in mm, like in the Webots robot model. */
+static const double SENSOR_X_POS = 45.0;
+
+/**
+ * Lateral position of every sensor in mm, like in the Webots robot model.
+ * Positive values are on the left side. The first sensor is the most left one.
+ */
+static const double SENSOR_Y_POS[] = {46.0, 11.0, 1.0, -9.0, -44.0};
+
+/** Calibrated sensor value in digits, above the sensor is considered over the line. */
+static const uint16_t ON_LINE_THRESHOLD = 200U;
+
+/** Calibrated sensor value in digits, below the sensor is considered as noise. */
+static const uint16_t NOISE_THRESHOLD = 50U;
+
+/** Max. sensor noise in raw digits, if the noise is enabled. */
+static const int32_t NOISE_AMPLITUDE = 20;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+LineSensors::LineSensors(const KinematicPlant& plant, const Track& track) :
+    ILineSensors(),
+    m_plant(plant),
+    m_track(track),
+    m_sensorValues(),
+    m_calibMinimum(),
+    m_calibMaximum(),
+    m_isCalibrated(false),
+    m_calibErrorInfo(CALIB_ERROR_INFO_NOT_DONE),
+    m_lastPosition(0),
+    m_noiseState(0U)
+{
+    resetCalibration();
+}
+
+void LineSensors::init()
+{
+    resetCalibration();
+}
+
+void LineSensors::calibrate()
+{
+    uint16_t values[MAX_SENSORS];
+    uint8_t  index = 0U;
+
+    readRaw(values);
+
+    for (index = 0U; index < MAX_SENSORS; ++index)
+    {
+        if (m_calibMinimum[index] > values[index])
+        {
+            m_calibMinimum[index] = values[index];
+        }
+
+        if (m_calibMaximum[index] < values[index])
+        {
+            m_calibMaximum[index] = values[index];
+        }
+    }
+
+    m_isCalibrated = true;
+}
+
+int16_t LineSensors::readLine()
+{
+    bool     isOnLine = false;
+    uint32_t average  = 0U;
+    uint32_t sum      = 0U;
+    uint8_t  index    = 0U;
+
+    readRaw(m_sensorValues);
+
+    for (index = 0U; index < MAX_SENSORS; ++index)
+    {
+        uint16_t value = m_sensorValues[index];
+
+        /* Scale the raw value to the calibration range, as long as it is valid. */
+        if ((true == m_isCalibrated) && (m_calibMaximum[index] > m_calibMinimum[index]))
+        {
+            int32_t range      = m_calibMaximum[index] - m_calibMinimum[index];
+            int32_t calibValue = ((static_cast<int32_t>(value) - m_calibMinimum[index]) * SENSOR_MAX_VALUE) / range;
+
+            if (0 > calibValue)
+            {
+                calibValue = 0;
+            }
+            else if (SENSOR_MAX_VALUE < calibValue)
+            {
+                calibValue = SENSOR_MAX_VALUE;
+            }
+            else
+            {
+                ;
+            }
+
+            value                 = static_cast<uint16_t>(calibValue);
+            m_sensorValues[index] = value;
+        }
+
+        if (ON_LINE_THRESHOLD < value)
+        {
+            isOnLine = true;
+        }
+
+        if (NOISE_THRESHOLD < value)
+        {
+            average += static_cast<uint32_t>(value) * (static_cast<uint32_t>(index) * SENSOR_MAX_VALUE);
+            sum += value;
+        }
+    }
+
+    /* If the line is lost, the last position decides on which side it was lost. */
+    if (false == isOnLine)
+    {
+        const int16_t POSITION_MAX = (MAX_SENSORS - 1) * SENSOR_MAX_VALUE;
+
+        m_lastPosition = ((POSITION_MAX / 2) > m_lastPosition) ? 0 : POSITION_MAX;
+    }
+    else
+    {
+        m_lastPosition = static_cast<int16_t>(average / sum);
+    }
+
+    return m_lastPosition;
+}
+
+bool LineSensors::isCalibrationSuccessful()
+{
+    uint8_t index = 0U;
+
+    if (false == m_isCalibrated)
+    {
+        m_calibErrorInfo = CALIB_ERROR_INFO_NOT_DONE;
+    }
+    else
+    {
+        m_calibErrorInfo = CALIB_ERROR_INFO_OK;
+
+        while ((MAX_SENSORS > index) && (CALIB_ERROR_INFO_OK == m_calibErrorInfo))
+        {
+            if ((m_calibMaximum[index] < m_calibMinimum[index]) ||
+                (CALIB_MIN_RANGE > (m_calibMaximum[index] - m_calibMinimum[index])))
+            {
+                m_calibErrorInfo = index;
+            }
+
+            ++index;
+        }
+    }
+
+    return (CALIB_ERROR_INFO_OK == m_calibErrorInfo);
+}
+
+void LineSensors::resetCalibration()
+{
+    uint8_t index = 0U;
+
+    for (index = 0U; index < MAX_SENSORS; ++index)
+    {
+        m_calibMinimum[index] = SENSOR_MAX_VALUE;
+        m_calibMaximum[index] = 0U;
+    }
+
+    m_isCalibrated   = false;
+    m_calibErrorInfo = CALIB_ERROR_INFO_NOT_DONE;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void LineSensors::readRaw(uint16_t values[MAX_SENSORS])
+{
+    double  robotXPos      = m_plant.getXPos();
+    double  robotYPos      = m_plant.getYPos();
+    double  cosOrientation = cos(m_plant.getOrientation());
+    double  sinOrientation = sin(m_plant.getOrientation());
+    uint8_t index          = 0U;
+
+    for (index = 0U; index < MAX_SENSORS; ++index)
+    {
+        double   xPos     = robotXPos + (SENSOR_X_POS * cosOrientation) - (SENSOR_Y_POS[index] * sinOrientation);
+        double   yPos     = robotYPos + (SENSOR_X_POS * sinOrientation) + (SENSOR_Y_POS[index] * cosOrientation);
+        uint32_t darkness = m_track.getDarkness(xPos, yPos);
+        int32_t  value    = static_cast<int32_t>((darkness * SENSOR_MAX_VALUE) / Track::DARKNESS_MAX);
+
+        if (0U != m_noiseState)
+        {
+            /* Xorshift generator, it never reaches the state 0, which disables the noise. */
+            m_noiseState ^= m_noiseState << 13U;
+            m_noiseState ^= m_noiseState >> 17U;
+            m_noiseState ^= m_noiseState << 5U;
+
+            value += static_cast<int32_t>(m_noiseState % ((2U * NOISE_AMPLITUDE) + 1U)) - NOISE_AMPLITUDE;
+
+            if (0 > value)
+            {
+                value = 0;
+            }
+            else if (SENSOR_MAX_VALUE < value)
+            {
+                value = SENSOR_MAX_VALUE;
+            }
+            else
+            {
+                ;
+            }
+        }
+
+        values[index] = static_cast<uint16_t>(value);
+    }
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,254 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Line sensors realization of the headless simulation
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup HALKinematicSim
+ *
+ * @{
+ */
+
+#ifndef LINESENSORS_H
+#define LINESENSORS_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "ILineSensors.h"
+#include "KinematicPlant.h"
+#include "Track.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * This class provides the simulated line sensors. Every sensor measures the
+ * darkness of the track below its position, which depends on the pose of the
+ * kinematic plant. The calibration and the line position estimation follow the
+ * Zumo32U4 line sensors library.
+ */
+class LineSensors : public ILineSensors
+{
+public:
+    /**
+     * Constructs the line sensors adapter.
+     *
+     * @param[in] plant Kinematic plant, which provides the robot pose.
+     * @param[in] track Track, which is below the robot.
+     */
+    LineSensors(const KinematicPlant& plant, const Track& track);
+
+    /**
+     * Destroys the line sensors adapter.
+     */
+    ~LineSensors()
+    {
+    }
+
+    /**
+     * Initializes the line sensors.
+     */
+    void init() final;
+
+    /**
+     * Reads the sensors for calibration. Call this method several times during
+     * turning the sensors over the line to determine the minimum and maximum
+     * values.
+     *
+     * The calibration factors are stored internally.
+     */
+    void calibrate() final;
+
+    /**
+     * Determines the deviation and returns an estimated position of the robot
+     * with respect to a line. The estimate is made using a weighted average of
+     * the sensor indices multiplied by 1000, so that a return value of 0
+     * indicates that the line is directly below sensor 0, a return value of
+     * 1000 indicates that the line is directly below sensor 1, 2000
+     * indicates that it's below sensor 2000, etc.  Intermediate values
+     * indicate that the line is between two sensors. The formula is:
+     *
+     *   0*value0 + 1000*value1 + 2000*value2 + ...
+     *  --------------------------------------------
+     *      value0  +  value1  +  value2 + ...
+     *
+     * This function assumes a dark line (high values) surrounded by white
+     * (low values).
+     */
+    int16_t readLine() final;
+
+    /**
+     * Get last line sensor values.
+     *
+     * @return Line sensor values
+     */
+    const uint16_t* getSensorValues() final
+    {
+        return m_sensorValues;
+    }
+
+    /**
+     * Checks whether the calibration was successful or not.
+     * It assumes that the environment brightness compensation is active.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool isCalibrationSuccessful() final;
+
+    /**
+     * It will return the index of the sensor, which caused to fail the calibration.
+     * If calibration was successful, it will return 0xFF.
+     * If calibration was not not done yet, it will return 0xFE.
+     *
+     * @return Sensor index, starting with 0. Note the other cases in description.
+     */
+    uint8_t getCalibErrorInfo() const final
+    {
+        return m_calibErrorInfo;
+    }
+
+    /**
+     * Get number of used line sensors.
+     *
+     * @return Number of used line sensors
+     */
+    uint8_t getNumLineSensors() const final
+    {
+        return MAX_SENSORS;
+    }
+
+    /**
+     * Get max. value of a single line sensor in digits.
+     * The sensor value is indirect proportional to the reflectance.
+     *
+     * @return Max. line sensor value
+     */
+    int16_t getSensorValueMax() const final
+    {
+        return SENSOR_MAX_VALUE;
+    }
+
+    /**
+     * Resets the maximum and minimum values measured by each sensor.
+     */
+    void resetCalibration() final;
+
+    /**
+     * Set the seed of the sensor noise. The same seed results always in the
+     * same noise. With seed 0 the sensors measure exact without any noise.
+     *
+     * @param[in] seed  Seed of the sensor noise
+     */
+    void setNoiseSeed(uint32_t seed)
+    {
+        m_noiseState = seed;
+    }
+
+private:
+    /**
+     * Number of used line sensors. This depends on the Zumo hardware configuration.
+     */
+    static const uint8_t MAX_SENSORS = 5;
+
+    /**
+     * Max. value of a single line sensor in digits (calibration already considered).
+     * It depends on the Zumo32U4LineSensors implementation.
+     * See Zumo32U4\QTRSensors.cpp @ readCalibrated()
+     */
+    static const int16_t SENSOR_MAX_VALUE = 1000;
+
+    /**
+     * Min. difference between the max. and min. calibration value of every sensor
+     * in digits. Otherwise the sensor was not moved over the line and the background.
+     */
+    static const uint16_t CALIB_MIN_RANGE = SENSOR_MAX_VALUE / 2;
+
+    /** Calibration error info, if the calibration is successful. */
+    static const uint8_t CALIB_ERROR_INFO_OK = 0xFFU;
+
+    /** Calibration error info, if the calibration is not done yet. */
+    static const uint8_t CALIB_ERROR_INFO_NOT_DONE = 0xFEU;
+
+    const KinematicPlant& m_plant;                     /**< Kinematic plant, which provides the robot pose */
+    const Track&          m_track;                     /**< Track, which is below the robot */
+    uint16_t              m_sensorValues[MAX_SENSORS]; /**< Last calibrated sensor values in digits */
+    uint16_t              m_calibMinimum[MAX_SENSORS]; /**< Min. raw value of every sensor during calibration */
+    uint16_t              m_calibMaximum[MAX_SENSORS]; /**< Max. raw value of every sensor during calibration */
+    bool                  m_isCalibrated;              /**< Is the calibration done? */
+    uint8_t               m_calibErrorInfo;            /**< Calibration error info */
+    int16_t               m_lastPosition;              /**< Last line position in digits */
+    uint32_t              m_noiseState;                /**< State of the noise generator, 0 means no noise */
+
+    /**
+     * Read the raw values of all sensors, which are proportional to the darkness
+     * of the track below them, optional with noise.
+     *
+     * @param[out] values   Raw sensor values in digits
+     */
+    void readRaw(uint16_t values[MAX_SENSORS]);
+
+    /**
+     * Default constructor.
+     * Not allowed.
+     */
+    LineSensors();
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] lineSensors Source instance.
+     */
+    LineSensors(const LineSensors& lineSensors);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] lineSensors Source instance.
+     *
+     * @returns Reference to LineSensors instance.
+     */
+    LineSensors& operator=(const LineSensors& lineSensors);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* LINESENSORS_H */
+/** @} */
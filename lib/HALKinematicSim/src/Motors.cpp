@@ -0,0 +1,121 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Motors realization of the headless simulation
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "Motors.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static int16_t limitSpeed(int16_t speed, int16_t maxSpeed);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+void Motors::init()
+{
+    setSpeeds(0, 0);
+}
+
+void Motors::setSpeeds(int16_t leftSpeed, int16_t rightSpeed)
+{
+    const double STEPS_PER_DIGIT =
+        static_cast<double>(KinematicPlant::MAX_WHEEL_SPEED) / static_cast<double>(MAX_SPEED);
+
+    m_speedLeft  = limitSpeed(leftSpeed, MAX_SPEED);
+    m_speedRight = limitSpeed(rightSpeed, MAX_SPEED);
+
+    m_plant.setTargetSpeeds(m_speedLeft * STEPS_PER_DIGIT, m_speedRight * STEPS_PER_DIGIT);
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Limit the speed to the range of the motor driver.
+ *
+ * @param[in] speed     Speed in digits
+ * @param[in] maxSpeed  Max. speed in digits
+ *
+ * @return Limited speed in digits
+ */
+static int16_t limitSpeed(int16_t speed, int16_t maxSpeed)
+{
+    int16_t limitedSpeed = speed;
+
+    if (maxSpeed < speed)
+    {
+        limitedSpeed = maxSpeed;
+    }
+    else if (-maxSpeed > speed)
+    {
+        limitedSpeed = -maxSpeed;
+    }
+    else
+    {
+        ;
+    }
+
+    return limitedSpeed;
+}
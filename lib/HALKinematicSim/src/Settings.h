@@ -0,0 +1,113 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Settings realization
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup HALKinematicSim
+ *
+ * @{
+ */
+
+#ifndef SETTINGS_H
+#define SETTINGS_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "ISettings.h"
+#include "KinematicPlant.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * This class handles the settings. They are kept in memory only, therefore every
+ * run starts deterministic with the default values.
+ */
+class Settings : public ISettings
+{
+public:
+    /**
+     * Constructs the settings adapter.
+     */
+    Settings() : ISettings(), m_maxSpeed(DEFAULT_MAX_SPEED)
+    {
+    }
+
+    /**
+     * Destroys the settings adapter.
+     */
+    ~Settings()
+    {
+    }
+
+    /**
+     * Initialize the settings.
+     */
+    void init() final;
+
+    /**
+     * Get the max. speed.
+     *
+     * @return Max. speed in steps/s.
+     */
+    int16_t getMaxSpeed() const final;
+
+    /**
+     * Set the max. speed.
+     *
+     * @param[in] maxSpeed  Max. speed in steps/s.
+     */
+    void setMaxSpeed(int16_t maxSpeed) final;
+
+private:
+
+    /**
+     * Max. speed default values in steps/s.
+     * It is the max. speed of the plant, like it would be found by the motor speed calibration.
+     */
+    static const int16_t DEFAULT_MAX_SPEED = KinematicPlant::MAX_WHEEL_SPEED;
+
+    int16_t m_maxSpeed; /**< Max. speed in steps/s. */
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* SETTINGS_H */
+/** @} */
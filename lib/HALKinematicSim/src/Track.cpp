@@ -0,0 +1,1223 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Track of the headless simulation
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "Track.h"
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static uint8_t* readBitmap(const char* fileName, uint32_t& width, uint32_t& height);
+static bool     readHeaderValue(FILE* fd, uint32_t& value);
+static uint32_t calculateHash(const uint8_t* data, size_t length);
+static void     thinSkeleton(uint8_t* image, uint32_t width, uint32_t height);
+static bool     thinSkeletonStep(uint8_t* image, uint32_t width, uint32_t height, bool isFirstStep);
+static void     pruneSkeleton(uint8_t* image, uint32_t width, uint32_t height, uint32_t length);
+static void     bridgeGaps(uint8_t* image, uint32_t width, uint32_t height, uint32_t maxGap, uint32_t directionLength);
+static bool     getEndDirection(const uint8_t* image, uint32_t width, uint32_t column, uint32_t row,
+                                uint32_t directionLength, double& xDirection, double& yDirection);
+static void     getNeighbours(const uint8_t* image, uint32_t width, size_t index, uint8_t neighbours[8U]);
+static uint8_t  countNeighbours(const uint8_t* image, uint32_t width, size_t index);
+static void     drawLine(uint8_t* image, uint32_t width, int32_t column0, int32_t row0, int32_t column1,
+                         int32_t row1);
+static void     distanceTransform(float* grid, uint32_t width, uint32_t height);
+static void     distanceTransform1D(const double* input, double* output, int32_t* parabolas, double* bounds,
+                                    uint32_t length);
+static double   getIntersection(const double* input, int32_t first, uint32_t second);
+static void     putUInt16(uint8_t* buffer, uint16_t value);
+static void     putUInt32(uint8_t* buffer, uint32_t value);
+static uint16_t getUInt16(const uint8_t* buffer);
+static uint32_t getUInt32(const uint8_t* buffer);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Max. supported bitmap width and height in pixel. */
+static const uint32_t MAX_BITMAP_SIZE = 16384U;
+
+/** Width of the transition from the line to the background in mm, like a line sensor sees it. */
+static const double EDGE_WIDTH = 2.0;
+
+/** Squared distance of a pixel, which has no feature pixel in reach. */
+static const double INFINITE_DISTANCE = 1e20;
+
+/** File name extension of the distance field cache. */
+static const char CACHE_EXTENSION[] = ".sdf";
+
+/** Magic number at the begin of the distance field cache. */
+static const char CACHE_MAGIC[] = "RSDF";
+
+/** Version of the distance field cache format. */
+static const uint16_t CACHE_VERSION = 2U;
+
+/** Number of distance fields in the cache: line edge and centerline. */
+static const size_t CACHE_FIELD_COUNT = 2U;
+
+/** Length of the skeleton spurs in mm, which are removed. It is about the line width. */
+static const double PRUNE_LENGTH = 16.0;
+
+/** Max. gap in the line in mm, which is bridged. */
+static const double MAX_GAP = 200.0;
+
+/** Length of a line end in mm, which determines its direction. */
+static const double DIRECTION_LENGTH = 20.0;
+
+/** Min. cosine of the angle between the line end directions and a bridge over a gap. */
+static const double MIN_BRIDGE_ALIGNMENT = 0.9;
+
+/**
+ * Column and row offsets of the 8 neighbours of a pixel, clockwise and
+ * beginning with the upper one.
+ */
+static const int8_t NEIGHBOUR_OFFSETS[8U][2U] = {{0, -1}, {1, -1}, {1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}, {-1, -1}};
+
+/**
+ * Size of the distance field cache header in byte:
+ * magic, version, distance units per mm, width, height, size in mm and hash of the bitmap.
+ */
+static const size_t CACHE_HEADER_SIZE = 24U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+Track::Track() :
+    m_distanceField(nullptr),
+    m_centerlineField(nullptr),
+    m_width(0U),
+    m_height(0U),
+    m_size(0U),
+    m_pixelSize(0.0),
+    m_isFromCache(false)
+{
+}
+
+Track::~Track()
+{
+    delete[] m_distanceField;
+    delete[] m_centerlineField;
+}
+
+bool Track::load(const char* fileName, uint32_t size)
+{
+    bool     isSuccessful = false;
+    uint32_t width        = 0U;
+    uint32_t height       = 0U;
+    uint8_t* bitmap       = (0U < size) ? readBitmap(fileName, width, height) : nullptr;
+
+    if (nullptr != bitmap)
+    {
+        uint32_t hash      = calculateHash(bitmap, static_cast<size_t>(width) * height);
+        char*    cacheName = new char[strlen(fileName) + sizeof(CACHE_EXTENSION)];
+
+        strcpy(cacheName, fileName);
+        strcat(cacheName, CACHE_EXTENSION);
+
+        delete[] m_distanceField;
+        delete[] m_centerlineField;
+
+        m_distanceField   = nullptr;
+        m_centerlineField = nullptr;
+        m_width           = width;
+        m_height          = height;
+        m_size            = size;
+        m_pixelSize       = static_cast<double>(size) / static_cast<double>(width);
+        m_isFromCache     = readCache(cacheName, hash);
+
+        if (false == m_isFromCache)
+        {
+            calculateDistanceField(bitmap);
+            calculateCenterlineField(bitmap);
+
+            /* Without cache the next load just takes longer. */
+            (void)writeCache(cacheName, hash);
+        }
+
+        delete[] cacheName;
+        delete[] bitmap;
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+double Track::getDistance(double xPos, double yPos) const
+{
+    return interpolate(m_distanceField, xPos, yPos);
+}
+
+double Track::getCenterlineDistance(double xPos, double yPos) const
+{
+    return interpolate(m_centerlineField, xPos, yPos);
+}
+
+uint8_t Track::getDarkness(double xPos, double yPos) const
+{
+    /* The part of the sensor view, which is covered by the line. */
+    double coverage = 0.5 - (getDistance(xPos, yPos) / EDGE_WIDTH);
+
+    if (0.0 > coverage)
+    {
+        coverage = 0.0;
+    }
+    else if (1.0 < coverage)
+    {
+        coverage = 1.0;
+    }
+    else
+    {
+        ;
+    }
+
+    return static_cast<uint8_t>((coverage * DARKNESS_MAX) + 0.5);
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+int16_t Track::getPixelDistance(const int16_t* field, int32_t column, int32_t row) const
+{
+    int16_t distance = INT16_MAX;
+
+    if ((0 <= column) && (static_cast<int32_t>(m_width) > column) && (0 <= row) &&
+        (static_cast<int32_t>(m_height) > row))
+    {
+        distance = field[(static_cast<size_t>(row) * m_width) + static_cast<size_t>(column)];
+    }
+
+    return distance;
+}
+
+double Track::interpolate(const int16_t* field, double xPos, double yPos) const
+{
+    double distance = static_cast<double>(INT16_MAX) / DISTANCE_UNITS_PER_MM;
+
+    if (nullptr != field)
+    {
+        /* Position in pixel, relative to the center of the first pixel. */
+        double  column     = (xPos / m_pixelSize) + (static_cast<double>(m_width) / 2.0) - 0.5;
+        double  row        = (static_cast<double>(m_height) / 2.0) - 0.5 - (yPos / m_pixelSize);
+        double  columnBase = floor(column);
+        double  rowBase    = floor(row);
+        double  columnFrac = column - columnBase;
+        double  rowFrac    = row - rowBase;
+        int32_t columnIdx  = static_cast<int32_t>(columnBase);
+        int32_t rowIdx     = static_cast<int32_t>(rowBase);
+        double  top        = 0.0;
+        double  bottom     = 0.0;
+
+        top = (1.0 - columnFrac) * getPixelDistance(field, columnIdx, rowIdx);
+        top += columnFrac * getPixelDistance(field, columnIdx + 1, rowIdx);
+
+        bottom = (1.0 - columnFrac) * getPixelDistance(field, columnIdx, rowIdx + 1);
+        bottom += columnFrac * getPixelDistance(field, columnIdx + 1, rowIdx + 1);
+
+        distance = (((1.0 - rowFrac) * top) + (rowFrac * bottom)) / DISTANCE_UNITS_PER_MM;
+    }
+
+    return distance;
+}
+
+void Track::calculateDistanceField(const uint8_t* bitmap)
+{
+    const size_t PIXEL_COUNT = static_cast<size_t>(m_width) * m_height;
+    const double UNITS       = m_pixelSize * DISTANCE_UNITS_PER_MM; /* Distance units per pixel */
+    float*       grid        = new float[PIXEL_COUNT];
+    size_t       index       = 0U;
+    uint8_t      pass        = 0U;
+
+    m_distanceField = new int16_t[PIXEL_COUNT];
+
+    /* The first pass calculates the distance of the background pixels to the line,
+     * the second pass the distance of the line pixels to the background.
+     */
+    for (pass = 0U; pass < 2U; ++pass)
+    {
+        bool isLinePass = (1U == pass);
+
+        for (index = 0U; index < PIXEL_COUNT; ++index)
+        {
+            bool isLine = (DARKNESS_THRESHOLD <= bitmap[index]);
+
+            grid[index] = (isLine == isLinePass) ? static_cast<float>(INFINITE_DISTANCE) : 0.0f;
+        }
+
+        distanceTransform(grid, m_width, m_height);
+
+        for (index = 0U; index < PIXEL_COUNT; ++index)
+        {
+            bool isLine = (DARKNESS_THRESHOLD <= bitmap[index]);
+
+            if (isLine == isLinePass)
+            {
+                /* The line edge lies half a pixel before the nearest pixel center. */
+                double distance = (sqrt(static_cast<double>(grid[index])) - 0.5) * UNITS;
+
+                if (static_cast<double>(INT16_MAX) < distance)
+                {
+                    distance = static_cast<double>(INT16_MAX);
+                }
+
+                m_distanceField[index] = static_cast<int16_t>(lround(distance));
+
+                if (true == isLinePass)
+                {
+                    m_distanceField[index] = -m_distanceField[index];
+                }
+            }
+        }
+    }
+
+    delete[] grid;
+}
+
+void Track::calculateCenterlineField(const uint8_t* bitmap)
+{
+    const size_t PIXEL_COUNT = static_cast<size_t>(m_width) * m_height;
+    const double UNITS       = m_pixelSize * DISTANCE_UNITS_PER_MM; /* Distance units per pixel */
+    uint8_t*     skeleton    = new uint8_t[PIXEL_COUNT];
+    float*       grid        = new float[PIXEL_COUNT];
+    size_t       index       = 0U;
+    uint32_t     column      = 0U;
+    uint32_t     row         = 0U;
+
+    /* The border stays empty, which keeps all neighbours of a skeleton pixel inside the bitmap. */
+    for (row = 0U; row < m_height; ++row)
+    {
+        for (column = 0U; column < m_width; ++column)
+        {
+            bool isBorder = (0U == column) || ((m_width - 1U) == column) || (0U == row) || ((m_height - 1U) == row);
+
+            index           = (static_cast<size_t>(row) * m_width) + column;
+            skeleton[index] = ((false == isBorder) && (DARKNESS_THRESHOLD <= bitmap[index])) ? 1U : 0U;
+        }
+    }
+
+    thinSkeleton(skeleton, m_width, m_height);
+    pruneSkeleton(skeleton, m_width, m_height, static_cast<uint32_t>(lround(PRUNE_LENGTH / m_pixelSize)));
+    bridgeGaps(skeleton, m_width, m_height, static_cast<uint32_t>(lround(MAX_GAP / m_pixelSize)),
+               static_cast<uint32_t>(lround(DIRECTION_LENGTH / m_pixelSize)));
+
+    for (index = 0U; index < PIXEL_COUNT; ++index)
+    {
+        grid[index] = (0U != skeleton[index]) ? 0.0f : static_cast<float>(INFINITE_DISTANCE);
+    }
+
+    distanceTransform(grid, m_width, m_height);
+
+    m_centerlineField = new int16_t[PIXEL_COUNT];
+
+    for (index = 0U; index < PIXEL_COUNT; ++index)
+    {
+        double distance = sqrt(static_cast<double>(grid[index])) * UNITS;
+
+        if (static_cast<double>(INT16_MAX) < distance)
+        {
+            distance = static_cast<double>(INT16_MAX);
+        }
+
+        m_centerlineField[index] = static_cast<int16_t>(lround(distance));
+    }
+
+    delete[] skeleton;
+    delete[] grid;
+}
+
+bool Track::readCache(const char* cacheName, uint32_t hash)
+{
+    bool         isSuccessful = false;
+    FILE*        fd           = fopen(cacheName, "rb");
+    const size_t PIXEL_COUNT  = static_cast<size_t>(m_width) * m_height;
+    uint8_t      header[CACHE_HEADER_SIZE];
+
+    if (nullptr == fd)
+    {
+        ;
+    }
+    else if (CACHE_HEADER_SIZE != fread(header, 1U, CACHE_HEADER_SIZE, fd))
+    {
+        ;
+    }
+    /* The cache must belong to the bitmap and its size. */
+    else if ((0 != memcmp(header, CACHE_MAGIC, 4U)) || (CACHE_VERSION != getUInt16(&header[4U])) ||
+             (DISTANCE_UNITS_PER_MM != getUInt16(&header[6U])) || (m_width != getUInt32(&header[8U])) ||
+             (m_height != getUInt32(&header[12U])) || (m_size != getUInt32(&header[16U])) ||
+             (hash != getUInt32(&header[20U])))
+    {
+        ;
+    }
+    else
+    {
+        const size_t BUFFER_SIZE = CACHE_FIELD_COUNT * PIXEL_COUNT * sizeof(int16_t);
+        uint8_t*     buffer      = new uint8_t[BUFFER_SIZE];
+
+        if (BUFFER_SIZE == fread(buffer, 1U, BUFFER_SIZE, fd))
+        {
+            const uint8_t* centerlineBuffer = &buffer[PIXEL_COUNT * sizeof(int16_t)];
+            size_t         index            = 0U;
+
+            m_distanceField   = new int16_t[PIXEL_COUNT];
+            m_centerlineField = new int16_t[PIXEL_COUNT];
+
+            for (index = 0U; index < PIXEL_COUNT; ++index)
+            {
+                m_distanceField[index]   = static_cast<int16_t>(getUInt16(&buffer[index * sizeof(int16_t)]));
+                m_centerlineField[index] = static_cast<int16_t>(getUInt16(&centerlineBuffer[index * sizeof(int16_t)]));
+            }
+
+            isSuccessful = true;
+        }
+
+        delete[] buffer;
+    }
+
+    if (nullptr != fd)
+    {
+        (void)fclose(fd);
+    }
+
+    return isSuccessful;
+}
+
+bool Track::writeCache(const char* cacheName, uint32_t hash) const
+{
+    bool         isSuccessful = false;
+    FILE*        fd           = fopen(cacheName, "wb");
+    const size_t PIXEL_COUNT  = static_cast<size_t>(m_width) * m_height;
+
+    if (nullptr != fd)
+    {
+        const size_t BUFFER_SIZE      = CACHE_FIELD_COUNT * PIXEL_COUNT * sizeof(int16_t);
+        uint8_t*     buffer           = new uint8_t[BUFFER_SIZE];
+        uint8_t*     centerlineBuffer = &buffer[PIXEL_COUNT * sizeof(int16_t)];
+        size_t       index            = 0U;
+        uint8_t      header[CACHE_HEADER_SIZE];
+
+        memcpy(header, CACHE_MAGIC, 4U);
+        putUInt16(&header[4U], CACHE_VERSION);
+        putUInt16(&header[6U], DISTANCE_UNITS_PER_MM);
+        putUInt32(&header[8U], m_width);
+        putUInt32(&header[12U], m_height);
+        putUInt32(&header[16U], m_size);
+        putUInt32(&header[20U], hash);
+
+        /* Little endian independent of the host. */
+        for (index = 0U; index < PIXEL_COUNT; ++index)
+        {
+            putUInt16(&buffer[index * sizeof(int16_t)], static_cast<uint16_t>(m_distanceField[index]));
+            putUInt16(&centerlineBuffer[index * sizeof(int16_t)], static_cast<uint16_t>(m_centerlineField[index]));
+        }
+
+        isSuccessful = (CACHE_HEADER_SIZE == fwrite(header, 1U, CACHE_HEADER_SIZE, fd)) &&
+                       (BUFFER_SIZE == fwrite(buffer, 1U, BUFFER_SIZE, fd));
+
+        delete[] buffer;
+
+        if (0 != fclose(fd))
+        {
+            isSuccessful = false;
+        }
+
+        /* Don't leave a broken cache behind. */
+        if (false == isSuccessful)
+        {
+            (void)remove(cacheName);
+        }
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Read the bitmap from a binary PGM file (P5) and convert the gray values to
+ * darkness, because the line sensors measure the darkness.
+ *
+ * @param[in]   fileName    Name of the PGM file
+ * @param[out]  width       Bitmap width in pixel
+ * @param[out]  height      Bitmap height in pixel
+ *
+ * @return If successful, it will return the bitmap, which must be released by the caller. Otherwise nullptr.
+ */
+static uint8_t* readBitmap(const char* fileName, uint32_t& width, uint32_t& height)
+{
+    uint8_t* bitmap   = nullptr;
+    FILE*    fd       = (nullptr != fileName) ? fopen(fileName, "rb") : nullptr;
+    uint32_t maxValue = 0U;
+
+    if (nullptr == fd)
+    {
+        ;
+    }
+    /* Magic number of a binary PGM file. */
+    else if (('P' != fgetc(fd)) || ('5' != fgetc(fd)))
+    {
+        ;
+    }
+    else if ((false == readHeaderValue(fd, width)) || (false == readHeaderValue(fd, height)) ||
+             (false == readHeaderValue(fd, maxValue)))
+    {
+        ;
+    }
+    /* Only 8 bit per pixel are supported. */
+    else if ((0U == width) || (MAX_BITMAP_SIZE < width) || (0U == height) || (MAX_BITMAP_SIZE < height) ||
+             (0U == maxValue) || (UINT8_MAX < maxValue))
+    {
+        ;
+    }
+    else
+    {
+        const size_t BITMAP_SIZE = static_cast<size_t>(width) * height;
+
+        bitmap = new uint8_t[BITMAP_SIZE];
+
+        /* A single whitespace character separates the header from the pixel data.
+         * It was already consumed by reading the max. value.
+         */
+        if (BITMAP_SIZE != fread(bitmap, 1U, BITMAP_SIZE, fd))
+        {
+            delete[] bitmap;
+            bitmap = nullptr;
+        }
+        else
+        {
+            size_t index = 0U;
+
+            for (index = 0U; index < BITMAP_SIZE; ++index)
+            {
+                uint32_t gray = (bitmap[index] < maxValue) ? bitmap[index] : maxValue;
+
+                bitmap[index] = static_cast<uint8_t>(((maxValue - gray) * Track::DARKNESS_MAX) / maxValue);
+            }
+        }
+    }
+
+    if (nullptr != fd)
+    {
+        (void)fclose(fd);
+    }
+
+    return bitmap;
+}
+
+/**
+ * Read a decimal value of the PGM header. Leading whitespaces and comments are
+ * skipped and the single whitespace after the value is consumed.
+ *
+ * @param[in]   fd      File descriptor
+ * @param[out]  value   Read value
+ *
+ * @return If successful read, it will return true otherwise false.
+ */
+static bool readHeaderValue(FILE* fd, uint32_t& value)
+{
+    bool isSuccessful = false;
+    int  character    = fgetc(fd);
+
+    /* Skip whitespaces and comments. */
+    while ((EOF != character) && ((0 != isspace(character)) || ('#' == character)))
+    {
+        if ('#' == character)
+        {
+            while ((EOF != character) && ('\n' != character))
+            {
+                character = fgetc(fd);
+            }
+        }
+
+        character = fgetc(fd);
+    }
+
+    value = 0U;
+
+    while ((EOF != character) && (0 != isdigit(character)) && (MAX_BITMAP_SIZE >= value))
+    {
+        value        = (value * 10U) + static_cast<uint32_t>(character - '0');
+        isSuccessful = true;
+        character    = fgetc(fd);
+    }
+
+    /* The value must be terminated by a whitespace. */
+    if ((EOF == character) || (0 == isspace(character)))
+    {
+        isSuccessful = false;
+    }
+
+    return isSuccessful;
+}
+
+/**
+ * Calculate the FNV-1a hash of the data.
+ *
+ * @param[in] data      Data
+ * @param[in] length    Data length in byte
+ *
+ * @return Hash
+ */
+static uint32_t calculateHash(const uint8_t* data, size_t length)
+{
+    uint32_t hash  = 2166136261U;
+    size_t   index = 0U;
+
+    for (index = 0U; index < length; ++index)
+    {
+        hash ^= data[index];
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
+
+/**
+ * Calculate the exact euclidean distance transform of the grid.
+ * See Felzenszwalb and Huttenlocher, "Distance Transforms of Sampled Functions".
+ *
+ * @param[in,out] grid      Input: 0 for feature pixels, otherwise infinite. Output: Squared distance to the
+ *                          nearest feature pixel in pixel.
+ * @param[in]     width     Grid width
+ * @param[in]     height    Grid height
+ */
+static void distanceTransform(float* grid, uint32_t width, uint32_t height)
+{
+    const uint32_t LENGTH    = (width > height) ? width : height;
+    double*        input     = new double[LENGTH];
+    double*        output    = new double[LENGTH];
+    int32_t*       parabolas = new int32_t[LENGTH];
+    double*        bounds    = new double[LENGTH + 1U];
+    uint32_t       column    = 0U;
+    uint32_t       row       = 0U;
+
+    /* Transform the columns first and then the rows. */
+    for (column = 0U; column < width; ++column)
+    {
+        for (row = 0U; row < height; ++row)
+        {
+            input[row] = grid[(static_cast<size_t>(row) * width) + column];
+        }
+
+        distanceTransform1D(input, output, parabolas, bounds, height);
+
+        for (row = 0U; row < height; ++row)
+        {
+            grid[(static_cast<size_t>(row) * width) + column] = static_cast<float>(output[row]);
+        }
+    }
+
+    for (row = 0U; row < height; ++row)
+    {
+        float* line = &grid[static_cast<size_t>(row) * width];
+
+        for (column = 0U; column < width; ++column)
+        {
+            input[column] = line[column];
+        }
+
+        distanceTransform1D(input, output, parabolas, bounds, width);
+
+        for (column = 0U; column < width; ++column)
+        {
+            line[column] = static_cast<float>(output[column]);
+        }
+    }
+
+    delete[] input;
+    delete[] output;
+    delete[] parabolas;
+    delete[] bounds;
+}
+
+/**
+ * Calculate the squared euclidean distance transform in one dimension by the
+ * lower envelope of parabolas.
+ *
+ * @param[in]   input       Sampled function
+ * @param[out]  output      Distance transform of the function
+ * @param[in]   parabolas   Working buffer for the parabola locations with length elements
+ * @param[in]   bounds      Working buffer for the parabola boundaries with length + 1 elements
+ * @param[in]   length      Number of samples
+ */
+static void distanceTransform1D(const double* input, double* output, int32_t* parabolas, double* bounds,
+                                uint32_t length)
+{
+    int32_t  envelopeIdx = 0;
+    uint32_t index       = 0U;
+
+    parabolas[0] = 0;
+    bounds[0]    = -INFINITE_DISTANCE;
+    bounds[1]    = INFINITE_DISTANCE;
+
+    for (index = 1U; index < length; ++index)
+    {
+        int32_t vertex       = parabolas[envelopeIdx];
+        double  intersection = getIntersection(input, vertex, index);
+
+        while ((0 < envelopeIdx) && (intersection <= bounds[envelopeIdx]))
+        {
+            --envelopeIdx;
+
+            vertex       = parabolas[envelopeIdx];
+            intersection = getIntersection(input, vertex, index);
+        }
+
+        ++envelopeIdx;
+
+        parabolas[envelopeIdx]  = static_cast<int32_t>(index);
+        bounds[envelopeIdx]     = intersection;
+        bounds[envelopeIdx + 1] = INFINITE_DISTANCE;
+    }
+
+    envelopeIdx = 0;
+
+    for (index = 0U; index < length; ++index)
+    {
+        double pos   = static_cast<double>(index);
+        double delta = 0.0;
+
+        while (bounds[envelopeIdx + 1] < pos)
+        {
+            ++envelopeIdx;
+        }
+
+        delta         = pos - parabolas[envelopeIdx];
+        output[index] = (delta * delta) + input[parabolas[envelopeIdx]];
+    }
+}
+
+/**
+ * Get the position, where the parabolas rooted at the first and the second sample intersect.
+ *
+ * @param[in] input     Sampled function
+ * @param[in] first     Index of the first sample
+ * @param[in] second    Index of the second sample, which must be greater than the first one
+ *
+ * @return Position of the intersection
+ */
+static double getIntersection(const double* input, int32_t first, uint32_t second)
+{
+    double firstPos  = static_cast<double>(first);
+    double secondPos = static_cast<double>(second);
+
+    return ((input[second] + (secondPos * secondPos)) - (input[first] + (firstPos * firstPos))) /
+           (2.0 * (secondPos - firstPos));
+}
+
+/**
+ * Thin the line pixels to a skeleton with a width of a single pixel, which
+ * keeps its connectivity. See Zhang and Suen, "A Fast Parallel Algorithm for
+ * Thinning Digital Patterns".
+ *
+ * @param[in,out] image     Input: 1 for line pixels, otherwise 0. Output: 1 for skeleton pixels, otherwise 0.
+ *                          The border pixels must be 0.
+ * @param[in]     width     Image width
+ * @param[in]     height    Image height
+ */
+static void thinSkeleton(uint8_t* image, uint32_t width, uint32_t height)
+{
+    bool isChanged = true;
+
+    while (true == isChanged)
+    {
+        isChanged = thinSkeletonStep(image, width, height, true);
+
+        if (true == thinSkeletonStep(image, width, height, false))
+        {
+            isChanged = true;
+        }
+    }
+}
+
+/**
+ * Remove the deletable boundary pixels of the skeleton in a single sub-iteration.
+ *
+ * @param[in,out] image         Image with 1 for skeleton pixels, otherwise 0
+ * @param[in]     width         Image width
+ * @param[in]     height        Image height
+ * @param[in]     isFirstStep   Is it the first sub-iteration, which removes the south-east boundary?
+ *
+ * @return If a pixel was removed, it will return true otherwise false.
+ */
+static bool thinSkeletonStep(uint8_t* image, uint32_t width, uint32_t height, bool isFirstStep)
+{
+    /* Pixels, which are deleted at the end of the sub-iteration. */
+    const uint8_t MARKED    = 2U;
+    bool          isChanged = false;
+    uint32_t      column    = 0U;
+    uint32_t      row       = 0U;
+    size_t        index     = 0U;
+
+    for (row = 1U; row < (height - 1U); ++row)
+    {
+        for (column = 1U; column < (width - 1U); ++column)
+        {
+            index = (static_cast<size_t>(row) * width) + column;
+
+            if (0U != image[index])
+            {
+                uint8_t neighbours[8U];
+                uint8_t count       = 0U;
+                uint8_t transitions = 0U;
+                uint8_t idx         = 0U;
+
+                getNeighbours(image, width, index, neighbours);
+
+                for (idx = 0U; idx < 8U; ++idx)
+                {
+                    count += neighbours[idx];
+
+                    if ((0U == neighbours[idx]) && (0U != neighbours[(idx + 1U) % 8U]))
+                    {
+                        ++transitions;
+                    }
+                }
+
+                /* The neighbours are: 0 north, 2 east, 4 south and 6 west. */
+                if ((2U <= count) && (6U >= count) && (1U == transitions))
+                {
+                    bool isDeletable = false;
+
+                    if (true == isFirstStep)
+                    {
+                        isDeletable = (0U == (neighbours[0U] * neighbours[2U] * neighbours[4U])) &&
+                                      (0U == (neighbours[2U] * neighbours[4U] * neighbours[6U]));
+                    }
+                    else
+                    {
+                        isDeletable = (0U == (neighbours[0U] * neighbours[2U] * neighbours[6U])) &&
+                                      (0U == (neighbours[0U] * neighbours[4U] * neighbours[6U]));
+                    }
+
+                    if (true == isDeletable)
+                    {
+                        image[index] = MARKED;
+                        isChanged    = true;
+                    }
+                }
+            }
+        }
+    }
+
+    for (index = 0U; index < (static_cast<size_t>(width) * height); ++index)
+    {
+        if (MARKED == image[index])
+        {
+            image[index] = 0U;
+        }
+    }
+
+    return isChanged;
+}
+
+/**
+ * Remove the spurs of the skeleton, which thinning creates at the corners of
+ * the line. The ends of the skeleton are shortened by the same length.
+ *
+ * @param[in,out] image     Image with 1 for skeleton pixels, otherwise 0
+ * @param[in]     width     Image width
+ * @param[in]     height    Image height
+ * @param[in]     length    Spur length in pixel
+ */
+static void pruneSkeleton(uint8_t* image, uint32_t width, uint32_t height, uint32_t length)
+{
+    /* Pixels, which are deleted at the end of the iteration. */
+    const uint8_t MARKED      = 2U;
+    const size_t  PIXEL_COUNT = static_cast<size_t>(width) * height;
+    uint32_t      iteration   = 0U;
+    size_t        index       = 0U;
+
+    for (iteration = 0U; iteration < length; ++iteration)
+    {
+        for (index = 0U; index < PIXEL_COUNT; ++index)
+        {
+            if ((0U != image[index]) && (1U >= countNeighbours(image, width, index)))
+            {
+                image[index] = MARKED;
+            }
+        }
+
+        for (index = 0U; index < PIXEL_COUNT; ++index)
+        {
+            if (MARKED == image[index])
+            {
+                image[index] = 0U;
+            }
+        }
+    }
+}
+
+/**
+ * Bridge the gaps in the line by connecting skeleton ends, which face each
+ * other, with a straight line. The closest pairs are connected first and every
+ * end is connected once at most.
+ *
+ * @param[in,out] image             Image with 1 for skeleton pixels, otherwise 0
+ * @param[in]     width             Image width
+ * @param[in]     height            Image height
+ * @param[in]     maxGap            Max. gap in pixel
+ * @param[in]     directionLength   Length of the skeleton end in pixel, which determines its direction.
+ */
+static void bridgeGaps(uint8_t* image, uint32_t width, uint32_t height, uint32_t maxGap, uint32_t directionLength)
+{
+    const size_t PIXEL_COUNT = static_cast<size_t>(width) * height;
+    uint32_t     endCount    = 0U;
+    uint32_t*    endColumns  = nullptr;
+    uint32_t*    endRows     = nullptr;
+    double*      xDirections = nullptr;
+    double*      yDirections = nullptr;
+    bool*        isUsed      = nullptr;
+    size_t       index       = 0U;
+    bool         isBridged   = true;
+
+    for (index = 0U; index < PIXEL_COUNT; ++index)
+    {
+        if ((0U != image[index]) && (1U == countNeighbours(image, width, index)))
+        {
+            ++endCount;
+        }
+    }
+
+    endColumns  = new uint32_t[endCount + 1U];
+    endRows     = new uint32_t[endCount + 1U];
+    xDirections = new double[endCount + 1U];
+    yDirections = new double[endCount + 1U];
+    isUsed      = new bool[endCount + 1U];
+    endCount    = 0U;
+
+    for (index = 0U; index < PIXEL_COUNT; ++index)
+    {
+        if ((0U != image[index]) && (1U == countNeighbours(image, width, index)) &&
+            (true == getEndDirection(image, width, static_cast<uint32_t>(index % width),
+                                     static_cast<uint32_t>(index / width), directionLength, xDirections[endCount],
+                                     yDirections[endCount])))
+        {
+            endColumns[endCount] = static_cast<uint32_t>(index % width);
+            endRows[endCount]    = static_cast<uint32_t>(index / width);
+            isUsed[endCount]     = false;
+            ++endCount;
+        }
+    }
+
+    while (true == isBridged)
+    {
+        uint32_t first      = 0U;
+        uint32_t second     = 0U;
+        uint32_t bestFirst  = 0U;
+        uint32_t bestSecond = 0U;
+        double   bestGap    = static_cast<double>(maxGap);
+
+        isBridged = false;
+
+        for (first = 0U; first < endCount; ++first)
+        {
+            for (second = first + 1U; second < endCount; ++second)
+            {
+                if ((false == isUsed[first]) && (false == isUsed[second]))
+                {
+                    double xDiff           = static_cast<double>(endColumns[second]) - endColumns[first];
+                    double yDiff           = static_cast<double>(endRows[second]) - endRows[first];
+                    double gap             = sqrt((xDiff * xDiff) + (yDiff * yDiff));
+                    double firstAlignment  = (xDirections[first] * xDiff) + (yDirections[first] * yDiff);
+                    double secondAlignment = -((xDirections[second] * xDiff) + (yDirections[second] * yDiff));
+
+                    /* Both ends shall point to the other one. */
+                    if ((0.0 < gap) && (bestGap >= gap) && ((MIN_BRIDGE_ALIGNMENT * gap) <= firstAlignment) &&
+                        ((MIN_BRIDGE_ALIGNMENT * gap) <= secondAlignment))
+                    {
+                        bestFirst  = first;
+                        bestSecond = second;
+                        bestGap    = gap;
+                        isBridged  = true;
+                    }
+                }
+            }
+        }
+
+        if (true == isBridged)
+        {
+            drawLine(image, width, static_cast<int32_t>(endColumns[bestFirst]),
+                     static_cast<int32_t>(endRows[bestFirst]), static_cast<int32_t>(endColumns[bestSecond]),
+                     static_cast<int32_t>(endRows[bestSecond]));
+
+            isUsed[bestFirst]  = true;
+            isUsed[bestSecond] = true;
+        }
+    }
+
+    delete[] endColumns;
+    delete[] endRows;
+    delete[] xDirections;
+    delete[] yDirections;
+    delete[] isUsed;
+}
+
+/**
+ * Get the direction of a skeleton end, by following the skeleton from the end
+ * pixel into the line.
+ *
+ * @param[in]   image           Image with 1 for skeleton pixels, otherwise 0
+ * @param[in]   width           Image width
+ * @param[in]   column          Column of the end pixel
+ * @param[in]   row             Row of the end pixel
+ * @param[in]   directionLength Number of pixels to follow
+ * @param[out]  xDirection      Normalized x-direction, pointing out of the line in pixel columns
+ * @param[out]  yDirection      Normalized y-direction, pointing out of the line in pixel rows
+ *
+ * @return If the direction is available, it will return true otherwise false.
+ */
+static bool getEndDirection(const uint8_t* image, uint32_t width, uint32_t column, uint32_t row,
+                            uint32_t directionLength, double& xDirection, double& yDirection)
+{
+    bool     isAvailable = false;
+    size_t   index       = (static_cast<size_t>(row) * width) + column;
+    size_t   prevIndex   = index;
+    size_t   prevPrevIdx = index;
+    uint32_t step        = 0U;
+    bool     isEnd       = false;
+    double   length      = 0.0;
+
+    /* The previous two pixels are skipped, because a diagonal step has both as neighbours. */
+    for (step = 0U; (step < directionLength) && (false == isEnd); ++step)
+    {
+        uint8_t idx  = 0U;
+        size_t  next = index;
+
+        for (idx = 0U; (idx < 8U) && (next == index); ++idx)
+        {
+            size_t neighbour = static_cast<size_t>(static_cast<int64_t>(index) + NEIGHBOUR_OFFSETS[idx][0U] +
+                                                   (static_cast<int64_t>(NEIGHBOUR_OFFSETS[idx][1U]) * width));
+
+            if ((0U != image[neighbour]) && (neighbour != prevIndex) && (neighbour != prevPrevIdx))
+            {
+                next = neighbour;
+            }
+        }
+
+        if (next == index)
+        {
+            isEnd = true;
+        }
+        else
+        {
+            prevPrevIdx = prevIndex;
+            prevIndex   = index;
+            index       = next;
+        }
+    }
+
+    xDirection = static_cast<double>(column) - static_cast<double>(index % width);
+    yDirection = static_cast<double>(row) - static_cast<double>(index / width);
+    length     = sqrt((xDirection * xDirection) + (yDirection * yDirection));
+
+    if (0.0 < length)
+    {
+        xDirection /= length;
+        yDirection /= length;
+        isAvailable = true;
+    }
+
+    return isAvailable;
+}
+
+/**
+ * Get the 8 neighbours of a pixel, clockwise and beginning with the upper one.
+ * The pixel must not be at the border.
+ *
+ * @param[in]   image       Image with 0 for background pixels
+ * @param[in]   width       Image width
+ * @param[in]   index       Pixel index
+ * @param[out]  neighbours  1 for every neighbour, which is not background, otherwise 0.
+ */
+static void getNeighbours(const uint8_t* image, uint32_t width, size_t index, uint8_t neighbours[8U])
+{
+    uint8_t idx = 0U;
+
+    for (idx = 0U; idx < 8U; ++idx)
+    {
+        size_t neighbour = static_cast<size_t>(static_cast<int64_t>(index) + NEIGHBOUR_OFFSETS[idx][0U] +
+                                               (static_cast<int64_t>(NEIGHBOUR_OFFSETS[idx][1U]) * width));
+
+        neighbours[idx] = (0U != image[neighbour]) ? 1U : 0U;
+    }
+}
+
+/**
+ * Count the neighbours of a pixel, which are not background.
+ * The pixel must not be at the border.
+ *
+ * @param[in] image     Image with 0 for background pixels
+ * @param[in] width     Image width
+ * @param[in] index     Pixel index
+ *
+ * @return Number of neighbours
+ */
+static uint8_t countNeighbours(const uint8_t* image, uint32_t width, size_t index)
+{
+    uint8_t neighbours[8U];
+    uint8_t count = 0U;
+    uint8_t idx   = 0U;
+
+    getNeighbours(image, width, index, neighbours);
+
+    for (idx = 0U; idx < 8U; ++idx)
+    {
+        count += neighbours[idx];
+    }
+
+    return count;
+}
+
+/**
+ * Draw a straight line with the value 1 by the Bresenham algorithm.
+ *
+ * @param[in,out] image     Image
+ * @param[in]     width     Image width
+ * @param[in]     column0   Column of the start pixel
+ * @param[in]     row0      Row of the start pixel
+ * @param[in]     column1   Column of the end pixel
+ * @param[in]     row1      Row of the end pixel
+ */
+static void drawLine(uint8_t* image, uint32_t width, int32_t column0, int32_t row0, int32_t column1, int32_t row1)
+{
+    int32_t columnDiff = (column1 > column0) ? (column1 - column0) : (column0 - column1);
+    int32_t rowDiff    = (row1 > row0) ? (row0 - row1) : (row1 - row0);
+    int32_t columnStep = (column1 > column0) ? 1 : -1;
+    int32_t rowStep    = (row1 > row0) ? 1 : -1;
+    int32_t error      = columnDiff + rowDiff;
+    int32_t column     = column0;
+    int32_t row        = row0;
+    bool    isEnd      = false;
+
+    while (false == isEnd)
+    {
+        image[(static_cast<size_t>(row) * width) + static_cast<size_t>(column)] = 1U;
+
+        if ((column1 == column) && (row1 == row))
+        {
+            isEnd = true;
+        }
+        else
+        {
+            int32_t doubleError = 2 * error;
+
+            if (doubleError >= rowDiff)
+            {
+                error += rowDiff;
+                column += columnStep;
+            }
+
+            if (doubleError <= columnDiff)
+            {
+                error += columnDiff;
+                row += rowStep;
+            }
+        }
+    }
+}
+
+/**
+ * Put a 16-bit value little endian into the buffer.
+ *
+ * @param[out]  buffer  Buffer with at least 2 byte
+ * @param[in]   value   Value
+ */
+static void putUInt16(uint8_t* buffer, uint16_t value)
+{
+    buffer[0U] = static_cast<uint8_t>(value & 0xFFU);
+    buffer[1U] = static_cast<uint8_t>((value >> 8U) & 0xFFU);
+}
+
+/**
+ * Put a 32-bit value little endian into the buffer.
+ *
+ * @param[out]  buffer  Buffer with at least 4 byte
+ * @param[in]   value   Value
+ */
+static void putUInt32(uint8_t* buffer, uint32_t value)
+{
+    putUInt16(&buffer[0U], static_cast<uint16_t>(value & 0xFFFFU));
+    putUInt16(&buffer[2U], static_cast<uint16_t>((value >> 16U) & 0xFFFFU));
+}
+
+/**
+ * Get a little endian 16-bit value from the buffer.
+ *
+ * @param[in] buffer    Buffer with at least 2 byte
+ *
+ * @return Value
+ */
+static uint16_t getUInt16(const uint8_t* buffer)
+{
+    return static_cast<uint16_t>(buffer[0U] | (static_cast<uint16_t>(buffer[1U]) << 8U));
+}
+
+/**
+ * Get a little endian 32-bit value from the buffer.
+ *
+ * @param[in] buffer    Buffer with at least 4 byte
+ *
+ * @return Value
+ */
+static uint32_t getUInt32(const uint8_t* buffer)
+{
+    return static_cast<uint32_t>(getUInt16(&buffer[0U])) | (static_cast<uint32_t>(getUInt16(&buffer[2U])) << 16U);
+}
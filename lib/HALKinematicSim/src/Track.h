@@ -0,0 +1,260 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Track of the headless simulation
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup HALKinematicSim
+ *
+ * @{
+ */
+
+#ifndef TRACK_H
+#define TRACK_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The track is a grayscale bitmap, which lies centered on the floor.
+ *
+ * The first image row is the one with the greatest y-coordinate and the first
+ * image column the one with the smallest x-coordinate, like a floor texture seen
+ * from above. The floor outside the bitmap is white.
+ *
+ * The bitmap is loaded from a binary PGM file (P5), which can be created from
+ * the Webots track textures with scripts/track_to_pgm.py.
+ *
+ * The bitmap is not sampled by the sensor queries. Instead the signed distance
+ * to the line edge is calculated once per pixel, which can be bilinear
+ * interpolated without blurring the line edge.
+ *
+ * To rate a run, the distance to the line centerline is calculated too. The
+ * centerline is the skeleton of the line, whose ends are bridged straight over
+ * gaps in the line. Therefore a robot, which drives straight over a gap, has
+ * no distance to the centerline.
+ *
+ * Because the calculation takes some time for big tracks, the distance fields
+ * are cached beside the PGM file.
+ */
+class Track
+{
+public:
+    /** Default edge length of the track in mm, like the Webots arena. */
+    static const uint32_t DEFAULT_SIZE = 2000U;
+
+    /** Darkness of a black pixel. */
+    static const uint8_t DARKNESS_MAX = 255U;
+
+    /** Pixel with a darkness equal or greater than the threshold belong to the line. */
+    static const uint8_t DARKNESS_THRESHOLD = 128U;
+
+    /** The distances are stored with a resolution of 1/16 mm. */
+    static const int16_t DISTANCE_UNITS_PER_MM = 16;
+
+    /**
+     * Constructs an empty track, which is white everywhere.
+     */
+    Track();
+
+    /**
+     * Destroys the track.
+     */
+    ~Track();
+
+    /**
+     * Load the track bitmap from a binary PGM file (P5).
+     * A previous loaded track is replaced.
+     *
+     * The distance fields are loaded from the cache file (PGM file name with
+     * ".sdf" extension), if it matches to the bitmap and the size. Otherwise
+     * they are calculated and the cache file is written.
+     *
+     * @param[in] fileName  Name of the PGM file
+     * @param[in] size      Edge length of the bitmap width in mm
+     *
+     * @return If successful loaded, it will return true otherwise false.
+     */
+    bool load(const char* fileName, uint32_t size);
+
+    /**
+     * Is a track loaded?
+     *
+     * @return If loaded, it will return true otherwise false.
+     */
+    bool isLoaded() const
+    {
+        return (nullptr != m_distanceField);
+    }
+
+    /**
+     * Were the distance fields of the loaded track read from the cache file?
+     *
+     * @return If read from the cache file, it will return true otherwise false.
+     */
+    bool isFromCache() const
+    {
+        return m_isFromCache;
+    }
+
+    /**
+     * Get the signed distance to the line edge at the given position.
+     * The distance field is bilinear interpolated between the pixel centers.
+     *
+     * @param[in] xPos  x-coordinate in mm
+     * @param[in] yPos  y-coordinate in mm
+     *
+     * @return Distance in mm, which is negative on the line and positive beside.
+     */
+    double getDistance(double xPos, double yPos) const;
+
+    /**
+     * Get the distance to the line centerline at the given position.
+     * The distance field is bilinear interpolated between the pixel centers.
+     *
+     * @param[in] xPos  x-coordinate in mm
+     * @param[in] yPos  y-coordinate in mm
+     *
+     * @return Distance in mm
+     */
+    double getCenterlineDistance(double xPos, double yPos) const;
+
+    /**
+     * Get the darkness of the floor at the given position.
+     * It is derived from the distance to the line edge.
+     *
+     * @param[in] xPos  x-coordinate in mm
+     * @param[in] yPos  y-coordinate in mm
+     *
+     * @return Darkness from 0 (white) to DARKNESS_MAX (black)
+     */
+    uint8_t getDarkness(double xPos, double yPos) const;
+
+private:
+    int16_t* m_distanceField;   /**< Signed distance to the line edge per pixel in 1/16 mm, row by row */
+    int16_t* m_centerlineField; /**< Distance to the line centerline per pixel in 1/16 mm, row by row */
+    uint32_t m_width;           /**< Bitmap width in pixel */
+    uint32_t m_height;          /**< Bitmap height in pixel */
+    uint32_t m_size;            /**< Edge length of the bitmap width in mm */
+    double   m_pixelSize;       /**< Edge length of a pixel in mm */
+    bool     m_isFromCache;     /**< Were the distance fields read from the cache file? */
+
+    /**
+     * Get the distance of a single pixel.
+     *
+     * @param[in] field     Distance field
+     * @param[in] column    Column, may be outside of the bitmap.
+     * @param[in] row       Row, may be outside of the bitmap.
+     *
+     * @return Distance in 1/16 mm
+     */
+    int16_t getPixelDistance(const int16_t* field, int32_t column, int32_t row) const;
+
+    /**
+     * Get the bilinear interpolated distance at the given position.
+     *
+     * @param[in] field     Distance field
+     * @param[in] xPos      x-coordinate in mm
+     * @param[in] yPos      y-coordinate in mm
+     *
+     * @return Distance in mm
+     */
+    double interpolate(const int16_t* field, double xPos, double yPos) const;
+
+    /**
+     * Calculate the signed distance field to the line edge from the bitmap.
+     *
+     * @param[in] bitmap    Darkness per pixel, row by row
+     */
+    void calculateDistanceField(const uint8_t* bitmap);
+
+    /**
+     * Calculate the distance field to the line centerline from the bitmap.
+     *
+     * @param[in] bitmap    Darkness per pixel, row by row
+     */
+    void calculateCenterlineField(const uint8_t* bitmap);
+
+    /**
+     * Read the distance fields from the cache file.
+     *
+     * @param[in] cacheName Name of the cache file
+     * @param[in] hash      Hash of the bitmap, which the distance fields must belong to
+     *
+     * @return If successful read, it will return true otherwise false.
+     */
+    bool readCache(const char* cacheName, uint32_t hash);
+
+    /**
+     * Write the distance fields to the cache file.
+     *
+     * @param[in] cacheName Name of the cache file
+     * @param[in] hash      Hash of the bitmap, which the distance fields belong to
+     *
+     * @return If successful written, it will return true otherwise false.
+     */
+    bool writeCache(const char* cacheName, uint32_t hash) const;
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] track Source instance.
+     */
+    Track(const Track& track);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] track Source instance.
+     *
+     * @returns Reference to Track instance.
+     */
+    Track& operator=(const Track& track);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* TRACK_H */
+/** @} */
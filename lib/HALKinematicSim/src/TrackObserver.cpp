@@ -0,0 +1,123 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Observer of the robot relative to the line of the track
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TrackObserver.h"
+#include <math.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Distance of the line sensor center in front of the robot center in mm, like in the Webots robot model. */
+static const double SENSOR_X_POS = 45.0;
+
+/**
+ * Cross-track error in mm, above the outer line sensors are off the line.
+ * The outer sensors are 46 mm and 44 mm beside the center, plus half the width of a usual line.
+ */
+static const double TRACK_LOST_DISTANCE = 55.0;
+
+/** Cross-track error in mm, below the track is found again. The hysteresis avoids counting a flickering edge. */
+static const double TRACK_FOUND_DISTANCE = 50.0;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+TrackObserver::TrackObserver(const KinematicPlant& plant, const Track& track) :
+    m_plant(plant),
+    m_track(track),
+    m_maxCrossTrackError(0.0),
+    m_trackLostCount(0U),
+    m_isTrackLost(false)
+{
+}
+
+void TrackObserver::process()
+{
+    double xPos            = m_plant.getXPos() + (SENSOR_X_POS * cos(m_plant.getOrientation()));
+    double yPos            = m_plant.getYPos() + (SENSOR_X_POS * sin(m_plant.getOrientation()));
+    double crossTrackError = m_track.getCenterlineDistance(xPos, yPos);
+
+    if (m_maxCrossTrackError < crossTrackError)
+    {
+        m_maxCrossTrackError = crossTrackError;
+    }
+
+    if ((false == m_isTrackLost) && (TRACK_LOST_DISTANCE < crossTrackError))
+    {
+        ++m_trackLostCount;
+        m_isTrackLost = true;
+    }
+    else if ((true == m_isTrackLost) && (TRACK_FOUND_DISTANCE > crossTrackError))
+    {
+        m_isTrackLost = false;
+    }
+    else
+    {
+        ;
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
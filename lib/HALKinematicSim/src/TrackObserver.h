@@ -0,0 +1,147 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Observer of the robot relative to the line of the track
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup HALKinematicSim
+ *
+ * @{
+ */
+
+#ifndef TRACK_OBSERVER_H
+#define TRACK_OBSERVER_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include "KinematicPlant.h"
+#include "Track.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Observes the ground truth of the simulation to rate a run, independent of
+ * what the application believes to see.
+ *
+ * The cross-track error is the distance of the line sensor center to the line
+ * centerline, where gaps in the line are bridged. Therefore it measures the
+ * lateral offset even over the line and doesn't rise in a gap. The track is
+ * lost, if even the outer line sensors are off the line.
+ */
+class TrackObserver
+{
+public:
+    /**
+     * Constructs the observer.
+     *
+     * @param[in] plant Kinematic plant, which provides the robot pose.
+     * @param[in] track Track, which is below the robot.
+     */
+    TrackObserver(const KinematicPlant& plant, const Track& track);
+
+    /**
+     * Destroys the observer.
+     */
+    ~TrackObserver()
+    {
+    }
+
+    /**
+     * Observe the current robot pose. Call it after every simulation step.
+     */
+    void process();
+
+    /**
+     * Get the max. cross-track error since construction.
+     *
+     * @return Max. cross-track error in mm
+     */
+    double getMaxCrossTrackError() const
+    {
+        return m_maxCrossTrackError;
+    }
+
+    /**
+     * Get how often the track was lost since construction.
+     *
+     * @return Number of times the track was lost
+     */
+    uint32_t getTrackLostCount() const
+    {
+        return m_trackLostCount;
+    }
+
+private:
+    const KinematicPlant& m_plant;              /**< Kinematic plant, which provides the robot pose */
+    const Track&          m_track;              /**< Track, which is below the robot */
+    double                m_maxCrossTrackError; /**< Max. cross-track error in mm */
+    uint32_t              m_trackLostCount;     /**< Number of times the track was lost */
+    bool                  m_isTrackLost;        /**< Is the track currently lost? */
+
+    /**
+     * Default constructor.
+     * Not allowed.
+     */
+    TrackObserver();
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] observer Source instance.
+     */
+    TrackObserver(const TrackObserver& observer);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] observer Source instance.
+     *
+     * @returns Reference to TrackObserver instance.
+     */
+    TrackObserver& operator=(const TrackObserver& observer);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* TRACK_OBSERVER_H */
+/** @} */
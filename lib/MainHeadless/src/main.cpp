@@ -0,0 +1,523 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Main entry point of the headless kinematic simulation
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <getopt.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <Arduino.h>
+#include <Board.h>
+#include <TrackObserver.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/** This type defines the possible program arguments. */
+typedef struct
+{
+    bool        verbose;     /**< Show verbose information */
+    const char* trackPath;   /**< Path to the track bitmap (binary PGM) */
+    int         trackSize;   /**< Edge length of the track bitmap width in mm */
+    int         xPos;        /**< Start x-coordinate in mm */
+    int         yPos;        /**< Start y-coordinate in mm */
+    int         orientation; /**< Start orientation in mrad */
+    int         duration;    /**< Simulated duration in ms */
+    int         timeStep;    /**< Simulation time step in ms */
+    int         benchmark;   /**< Number of sensor queries to benchmark instead of simulating */
+    int         seed;        /**< Seed of the line sensor noise, 0 means no noise */
+    int         rateFrom;    /**< Simulated time in ms, from which on the run is rated */
+
+} PrgArguments;
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static int           handleCommandLineArguments(PrgArguments& prgArguments, Button& buttonA, Button& buttonB,
+                                                Button& buttonC, int argc, char** argv);
+static void          showPrgArguments(const PrgArguments& prgArgs);
+static void          runBenchmark(const Track& track, uint32_t trackSize, uint32_t count);
+static unsigned long getSystemTick();
+static void          systemDelay(unsigned long ms);
+
+/******************************************************************************
+ * Variables
+ *****************************************************************************/
+
+/** Supported long program arguments. */
+static const struct option LONG_OPTIONS[] = {{"help", no_argument, nullptr, 0},
+                                             {"track", required_argument, nullptr, 0},
+                                             {"trackSize", required_argument, nullptr, 0},
+                                             {"xPos", required_argument, nullptr, 0},
+                                             {"yPos", required_argument, nullptr, 0},
+                                             {"orientation", required_argument, nullptr, 0},
+                                             {"duration", required_argument, nullptr, 0},
+                                             {"timeStep", required_argument, nullptr, 0},
+                                             {"buttonA", required_argument, nullptr, 0},
+                                             {"buttonB", required_argument, nullptr, 0},
+                                             {"buttonC", required_argument, nullptr, 0},
+                                             {"benchmark", required_argument, nullptr, 0},
+                                             {"seed", required_argument, nullptr, 0},
+                                             {"rateFrom", required_argument, nullptr, 0},
+                                             {nullptr, no_argument, nullptr, 0}}; /* Marks the end. */
+
+/** Program argument default value of the verbose flag. */
+static bool PRG_ARG_VERBOSE_DEFAULT = false;
+
+/** Program argument default value of the track path. No track means a white floor. */
+static const char* PRG_ARG_TRACK_PATH_DEFAULT = nullptr;
+
+/** Program argument default value of the track size in mm. */
+static const int PRG_ARG_TRACK_SIZE_DEFAULT = Track::DEFAULT_SIZE;
+
+/** Program argument default value of the start x-coordinate in mm, like in the Webots line follower world. */
+static const int PRG_ARG_X_POS_DEFAULT = -247;
+
+/** Program argument default value of the start y-coordinate in mm, like in the Webots line follower world. */
+static const int PRG_ARG_Y_POS_DEFAULT = -49;
+
+/** Program argument default value of the start orientation in mrad, like in the Webots line follower world. */
+static const int PRG_ARG_ORIENTATION_DEFAULT = 1588;
+
+/** Program argument default value of the simulated duration in ms. */
+static const int PRG_ARG_DURATION_DEFAULT = 60000;
+
+/** Program argument default value of the simulation time step in ms. */
+static const int PRG_ARG_TIME_STEP_DEFAULT = 1;
+
+/** Program argument default value of the number of benchmarked sensor queries. 0 means simulating. */
+static const int PRG_ARG_BENCHMARK_DEFAULT = 0;
+
+/** Program argument default value of the line sensor noise seed. 0 means no noise. */
+static const int PRG_ARG_SEED_DEFAULT = 0;
+
+/** Program argument default value of the simulated time in ms, from which on the run is rated. */
+static const int PRG_ARG_RATE_FROM_DEFAULT = 0;
+
+/**
+ * The maximum duration a simulated time step can have.
+ * Everything above would cause missbehaviour in the application.
+ */
+static const int MAX_TIME_STEP = 10;
+
+/**
+ * Simulation time step in ms, used by the Arduino delay function.
+ */
+static uint16_t gTimeStep = PRG_ARG_TIME_STEP_DEFAULT;
+
+/**
+ * Kinematic plant, which provides the virtual time to the Arduino functions.
+ */
+static KinematicPlant* gPlant = nullptr;
+
+/******************************************************************************
+ * External functions
+ *****************************************************************************/
+
+/**
+ * Main program entry point.
+ *
+ * @param[in] argc  Number of arguments
+ * @param[in] argv  Array of arguments
+ *
+ * @return Status
+ */
+extern int main(int argc, char** argv)
+{
+    int          status = 0;
+    PrgArguments prgArguments;
+    Board&       board = Board::getInstance();
+
+    printf("\n*** Radon Ulzer (headless) ***\n");
+
+    /* The stdout buffering is kept, because the simulation shall run as fast as possible. */
+
+    /* Parse command line arguments. */
+    status = handleCommandLineArguments(prgArguments, board.getScriptedButtonA(), board.getScriptedButtonB(),
+                                        board.getScriptedButtonC(), argc, argv);
+
+    if (0 == status)
+    {
+        /* Show used arguments only in verbose mode. */
+        if (true == prgArguments.verbose)
+        {
+            showPrgArguments(prgArguments);
+        }
+
+        if ((0 >= prgArguments.timeStep) || (MAX_TIME_STEP < prgArguments.timeStep))
+        {
+            printf("Simulation time step is too high!\n");
+            printf("This would cause missbehaviour in the application.\n");
+
+            status = -1;
+        }
+        else if (0 >= prgArguments.trackSize)
+        {
+            printf("Invalid track size: %d\n", prgArguments.trackSize);
+
+            status = -1;
+        }
+        else if (nullptr == prgArguments.trackPath)
+        {
+            printf("Warning: No track given, the floor is white.\n");
+        }
+        else if (false == board.getTrack().load(prgArguments.trackPath, prgArguments.trackSize))
+        {
+            printf("Failed to load track: %s\n", prgArguments.trackPath);
+
+            status = -1;
+        }
+        else
+        {
+            if (true == prgArguments.verbose)
+            {
+                printf("Distance field %s.\n",
+                       (true == board.getTrack().isFromCache()) ? "loaded from cache" : "calculated");
+            }
+        }
+    }
+
+    if ((0 == status) && (0 < prgArguments.benchmark))
+    {
+        runBenchmark(board.getTrack(), prgArguments.trackSize, prgArguments.benchmark);
+    }
+    else if (0 == status)
+    {
+        KinematicPlant& plant    = board.getPlant();
+        uint32_t        duration = (0 < prgArguments.duration) ? prgArguments.duration : 0U;
+        uint32_t        rateFrom = (0 < prgArguments.rateFrom) ? prgArguments.rateFrom : 0U;
+        TrackObserver   observer(plant, board.getTrack());
+
+        gTimeStep = static_cast<uint16_t>(prgArguments.timeStep);
+        gPlant    = &plant;
+
+        plant.setPose(static_cast<double>(prgArguments.xPos), static_cast<double>(prgArguments.yPos),
+                      static_cast<double>(prgArguments.orientation) / 1000.0);
+        board.getSimulatedLineSensors().setNoiseSeed(static_cast<uint32_t>(prgArguments.seed));
+
+        /* Unlike Webots, the virtual time advances only by stepping the plant.
+         * There is no synchronization with the wall clock, therefore the simulation
+         * runs as fast as possible and every run with the same arguments behaves the same.
+         */
+        Arduino::setup(getSystemTick, systemDelay);
+
+        while (duration > plant.getTime())
+        {
+            plant.step(gTimeStep);
+            Arduino::loop();
+
+            if (rateFrom <= plant.getTime())
+            {
+                observer.process();
+            }
+        }
+
+        printf("\nSimulated time: %u ms\n", plant.getTime());
+        printf("Pose: x %ld mm, y %ld mm, orientation %ld mrad\n", lround(plant.getXPos()), lround(plant.getYPos()),
+               lround(plant.getOrientation() * 1000.0));
+        printf("Max. cross-track error: %.1f mm\n", observer.getMaxCrossTrackError());
+        printf("Track lost: %u\n", observer.getTrackLostCount());
+    }
+
+    return status;
+}
+
+/******************************************************************************
+ * Local functions
+ *****************************************************************************/
+
+/**
+ * Handle the arguments passed to the programm.
+ * If a argument is not given via command line interface, its default value will be used.
+ * The scripted button presses are directly added to the buttons.
+ *
+ * @param[out]  prgArguments    Parsed program arguments
+ * @param[in]   buttonA         Scripted button A
+ * @param[in]   buttonB         Scripted button B
+ * @param[in]   buttonC         Scripted button C
+ * @param[in]   argc            Program argument count
+ * @param[in]   argv            Program argument vector
+ *
+ * @returns 0 if handling was succesful. Otherwise, -1
+ */
+static int handleCommandLineArguments(PrgArguments& prgArguments, Button& buttonA, Button& buttonB, Button& buttonC,
+                                      int argc, char** argv)
+{
+    int         status           = 0;
+    const char* availableOptions = "vh";
+    const char* programName      = argv[0];
+    int         optionIndex      = 0;
+    int         option           = getopt_long(argc, argv, availableOptions, LONG_OPTIONS, &optionIndex);
+
+    /* Set default values */
+    prgArguments.verbose     = PRG_ARG_VERBOSE_DEFAULT;
+    prgArguments.trackPath   = PRG_ARG_TRACK_PATH_DEFAULT;
+    prgArguments.trackSize   = PRG_ARG_TRACK_SIZE_DEFAULT;
+    prgArguments.xPos        = PRG_ARG_X_POS_DEFAULT;
+    prgArguments.yPos        = PRG_ARG_Y_POS_DEFAULT;
+    prgArguments.orientation = PRG_ARG_ORIENTATION_DEFAULT;
+    prgArguments.duration    = PRG_ARG_DURATION_DEFAULT;
+    prgArguments.timeStep    = PRG_ARG_TIME_STEP_DEFAULT;
+    prgArguments.benchmark   = PRG_ARG_BENCHMARK_DEFAULT;
+    prgArguments.seed        = PRG_ARG_SEED_DEFAULT;
+    prgArguments.rateFrom    = PRG_ARG_RATE_FROM_DEFAULT;
+
+    while ((-1 != option) && (0 == status))
+    {
+        switch (option)
+        {
+        case 0: /* Long option */
+
+            if (0 == strcmp(LONG_OPTIONS[optionIndex].name, "help"))
+            {
+                status = -1;
+            }
+            else if (0 == strcmp(LONG_OPTIONS[optionIndex].name, "track"))
+            {
+                prgArguments.trackPath = optarg;
+            }
+            else if (0 == strcmp(LONG_OPTIONS[optionIndex].name, "trackSize"))
+            {
+                prgArguments.trackSize = atoi(optarg);
+            }
+            else if (0 == strcmp(LONG_OPTIONS[optionIndex].name, "xPos"))
+            {
+                prgArguments.xPos = atoi(optarg);
+            }
+            else if (0 == strcmp(LONG_OPTIONS[optionIndex].name, "yPos"))
+            {
+                prgArguments.yPos = atoi(optarg);
+            }
+            else if (0 == strcmp(LONG_OPTIONS[optionIndex].name, "orientation"))
+            {
+                prgArguments.orientation = atoi(optarg);
+            }
+            else if (0 == strcmp(LONG_OPTIONS[optionIndex].name, "duration"))
+            {
+                prgArguments.duration = atoi(optarg);
+            }
+            else if (0 == strcmp(LONG_OPTIONS[optionIndex].name, "timeStep"))
+            {
+                prgArguments.timeStep = atoi(optarg);
+            }
+            else if (0 == strcmp(LONG_OPTIONS[optionIndex].name, "buttonA"))
+            {
+                if (false == buttonA.addPress(strtoul(optarg, nullptr, 0)))
+                {
+                    printf("Too many button A presses.\n");
+                    status = -1;
+                }
+            }
+            else if (0 == strcmp(LONG_OPTIONS[optionIndex].name, "buttonB"))
+            {
+                if (false == buttonB.addPress(strtoul(optarg, nullptr, 0)))
+                {
+                    printf("Too many button B presses.\n");
+                    status = -1;
+                }
+            }
+            else if (0 == strcmp(LONG_OPTIONS[optionIndex].name, "buttonC"))
+            {
+                if (false == buttonC.addPress(strtoul(optarg, nullptr, 0)))
+                {
+                    printf("Too many button C presses.\n");
+                    status = -1;
+                }
+            }
+            else if (0 == strcmp(LONG_OPTIONS[optionIndex].name, "benchmark"))
+            {
+                prgArguments.benchmark = atoi(optarg);
+            }
+            else if (0 == strcmp(LONG_OPTIONS[optionIndex].name, "seed"))
+            {
+                prgArguments.seed = atoi(optarg);
+            }
+            else if (0 == strcmp(LONG_OPTIONS[optionIndex].name, "rateFrom"))
+            {
+                prgArguments.rateFrom = atoi(optarg);
+            }
+            else
+            {
+                status = -1;
+            }
+            break;
+
+        case 'v': /* Verbose */
+            prgArguments.verbose = true;
+            break;
+
+        case '?': /* Unknown */
+            /* fallthrough */
+
+        case 'h': /* Help */
+            /* fallthrough */
+
+        default: /* Default */
+            status = -1;
+            break;
+        }
+
+        option = getopt_long(argc, argv, availableOptions, LONG_OPTIONS, &optionIndex);
+    }
+
+    /* Does the user need help? */
+    if (0 > status)
+    {
+        printf("Usage: %s <option(s)>\nOptions:\n", programName);
+        printf("\t-h\t\t\tShow this help message.\n");                       /* Help */
+        printf("\t-v\t\t\tVerbose mode. Default: Disabled\n");               /* Flag */
+        printf("\t--track <path>\t\tTrack bitmap (binary PGM).");            /* Track */
+        printf(" Default: White floor\n");                                   /* Track default value */
+        printf("\t--trackSize <mm>\tEdge length of the track width.");       /* Track size */
+        printf(" Default: %d\n", PRG_ARG_TRACK_SIZE_DEFAULT);                /* Track size default value */
+        printf("\t--xPos <mm>\t\tStart x-coordinate.");                      /* Start x-coordinate */
+        printf(" Default: %d\n", PRG_ARG_X_POS_DEFAULT);                     /* Start x-coordinate default value */
+        printf("\t--yPos <mm>\t\tStart y-coordinate.");                      /* Start y-coordinate */
+        printf(" Default: %d\n", PRG_ARG_Y_POS_DEFAULT);                     /* Start y-coordinate default value */
+        printf("\t--orientation <mrad>\tStart orientation.");                /* Start orientation */
+        printf(" Default: %d\n", PRG_ARG_ORIENTATION_DEFAULT);               /* Start orientation default value */
+        printf("\t--duration <ms>\t\tSimulated duration.");                  /* Duration */
+        printf(" Default: %d\n", PRG_ARG_DURATION_DEFAULT);                  /* Duration default value */
+        printf("\t--timeStep <ms>\t\tSimulation time step.");                /* Time step */
+        printf(" Default: %d\n", PRG_ARG_TIME_STEP_DEFAULT);                 /* Time step default value */
+        printf("\t--buttonA <ms>\t\tPress button A at the given time.\n");   /* Button A */
+        printf("\t--buttonB <ms>\t\tPress button B at the given time.\n");   /* Button B */
+        printf("\t--buttonC <ms>\t\tPress button C at the given time.\n");   /* Button C */
+        printf("\t\t\t\tThe button options can be given several times.\n"); /* Button note */
+        printf("\t--seed <n>\t\tSeed of the line sensor noise.");           /* Seed */
+        printf(" Default: %d (no noise)\n", PRG_ARG_SEED_DEFAULT);          /* Seed default value */
+        printf("\t--rateFrom <ms>\t\tRate the run from this time on.");     /* Rate from */
+        printf(" Default: %d\n", PRG_ARG_RATE_FROM_DEFAULT);                /* Rate from default value */
+        printf("\t--benchmark <count>\tMeasure the sensor queries/s.\n");   /* Benchmark */
+    }
+
+    return status;
+}
+
+/**
+ * Show program arguments on the console.
+ *
+ * @param[in] prgArgs   Program arguments
+ */
+static void showPrgArguments(const PrgArguments& prgArgs)
+{
+    printf("Track                    : %s\n", (nullptr == prgArgs.trackPath) ? "-" : prgArgs.trackPath);
+    printf("Track size               : %d mm\n", prgArgs.trackSize);
+    printf("Start position           : %d mm, %d mm\n", prgArgs.xPos, prgArgs.yPos);
+    printf("Start orientation        : %d mrad\n", prgArgs.orientation);
+    printf("Duration                 : %d ms\n", prgArgs.duration);
+    printf("Time step                : %d ms\n", prgArgs.timeStep);
+    printf("Benchmark                : %d queries\n", prgArgs.benchmark);
+    printf("Seed                     : %d\n", prgArgs.seed);
+    printf("Rate from                : %d ms\n", prgArgs.rateFrom);
+    /* Skip verbose flag. */
+}
+
+/**
+ * Measure the throughput of the track queries, which the line sensors use.
+ * The positions are pseudo random, but the same in every run.
+ *
+ * @param[in] track     Track
+ * @param[in] trackSize Edge length of the track width in mm
+ * @param[in] count     Number of queries
+ */
+static void runBenchmark(const Track& track, uint32_t trackSize, uint32_t count)
+{
+    const double SIZE      = static_cast<double>(trackSize);
+    uint32_t     random    = 1U;
+    uint32_t     darkSum   = 0U;
+    uint32_t     index     = 0U;
+    clock_t      start     = clock();
+    double       duration  = 0.0; /* ms */
+
+    for (index = 0U; index < count; ++index)
+    {
+        double xPos = 0.0;
+        double yPos = 0.0;
+
+        /* Linear congruential generator, see Numerical Recipes. */
+        random = (random * 1664525U) + 1013904223U;
+        xPos   = ((static_cast<double>(random) / UINT32_MAX) - 0.5) * SIZE;
+        random = (random * 1664525U) + 1013904223U;
+        yPos   = ((static_cast<double>(random) / UINT32_MAX) - 0.5) * SIZE;
+
+        /* The sum keeps the compiler from dropping the queries. */
+        darkSum += track.getDarkness(xPos, yPos);
+    }
+
+    duration = (static_cast<double>(clock() - start) * 1000.0) / CLOCKS_PER_SEC;
+
+    printf("Sensor queries: %u in %.1f ms, %.0f queries/s (checksum %u)\n", count, duration,
+           (0.0 < duration) ? ((count * 1000.0) / duration) : 0.0, darkSum);
+}
+
+/**
+ * Get the system tick in ms.
+ *
+ * @return Timestamp (system tick) in ms
+ */
+static unsigned long getSystemTick()
+{
+    unsigned long timestamp = 0U;
+
+    if (nullptr != gPlant)
+    {
+        timestamp = gPlant->getTime();
+    }
+
+    return timestamp;
+}
+
+/**
+ * Delay for a specific time in ms.
+ * The virtual time advances by stepping the plant.
+ *
+ * @param[in] ms    Time in ms.
+ */
+static void systemDelay(unsigned long ms)
+{
+    unsigned long timestamp = millis();
+
+    while ((nullptr != gPlant) && ((millis() - timestamp) < ms))
+    {
+        gPlant->step(gTimeStep);
+    }
+}
@@ -0,0 +1,440 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Deferred binary logging backend
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "BinaryLog.h"
+#include "Logging.h"
+#include <Arduino.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void addByte(uint8_t value);
+static void addLittleEndian(uint32_t value, uint8_t size);
+static bool push(const uint8_t* data, size_t size);
+static bool pushDroppedRecord();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* The length field of a frame is a single byte. */
+static_assert(CONFIG_LOG_BINARY_RECORD_SIZE <= UINT8_MAX, "CONFIG_LOG_BINARY_RECORD_SIZE is too large.");
+
+/* A record must fit into the ring buffer. */
+static_assert((CONFIG_LOG_BINARY_RECORD_SIZE + BinaryLog::FRAME_OVERHEAD) <= CONFIG_LOG_BINARY_BUFFER_SIZE,
+              "CONFIG_LOG_BINARY_BUFFER_SIZE is too small.");
+
+/** Size of the message id and the timestamp in the record payload in bytes. */
+static const uint8_t RECORD_HEADER_SIZE = 8U;
+
+/** Record payload, which is under construction. */
+static uint8_t gRecord[CONFIG_LOG_BINARY_RECORD_SIZE];
+
+/** Number of used bytes in the record payload. */
+static uint8_t gRecordSize = 0U;
+
+/** Is the record under construction valid? It becomes invalid if an argument doesn't fit. */
+static bool gIsRecordValid = false;
+
+/** Ring buffer with the frames, which are not sent yet. */
+static uint8_t gRingBuffer[CONFIG_LOG_BINARY_BUFFER_SIZE];
+
+/** Ring buffer index of the next byte to read. */
+static size_t gReadIdx = 0U;
+
+/** Number of bytes in the ring buffer. */
+static size_t gPendingBytes = 0U;
+
+/** Number of dropped records, which are not reported yet. */
+static uint16_t gUnreportedDrops = 0U;
+
+/** Number of dropped records since start. */
+static uint16_t gDroppedRecords = 0U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+void BinaryLog::begin(uint32_t id)
+{
+    gRecordSize    = 0U;
+    gIsRecordValid = true;
+
+    addLittleEndian(id, sizeof(id));
+    addLittleEndian(static_cast<uint32_t>(millis()), sizeof(uint32_t));
+}
+
+void BinaryLog::addSigned(int32_t value, uint8_t size)
+{
+    if (sizeof(int32_t) < size)
+    {
+        size = sizeof(int32_t);
+    }
+
+    addByte(ARG_TYPE_SIGNED | size);
+    addLittleEndian(static_cast<uint32_t>(value), size);
+}
+
+void BinaryLog::addUnsigned(uint32_t value, uint8_t size)
+{
+    if (sizeof(uint32_t) < size)
+    {
+        size = sizeof(uint32_t);
+    }
+
+    addByte(ARG_TYPE_UNSIGNED | size);
+    addLittleEndian(value, size);
+}
+
+void BinaryLog::addFloat(float value)
+{
+    uint32_t raw = 0U;
+
+    static_assert(sizeof(raw) == sizeof(value), "Unsupported float size.");
+
+    memcpy(&raw, &value, sizeof(raw));
+
+    addByte(ARG_TYPE_FLOAT);
+    addLittleEndian(raw, sizeof(raw));
+}
+
+void BinaryLog::addChar(char value)
+{
+    addByte(ARG_TYPE_CHAR);
+    addByte(static_cast<uint8_t>(value));
+}
+
+void BinaryLog::addString(const char* value)
+{
+    size_t length = 0U;
+
+    if (nullptr != value)
+    {
+        length = strlen(value);
+    }
+
+    /* Type and length byte are mandatory, the characters are truncated if necessary. */
+    if ((gRecordSize + 2U) > CONFIG_LOG_BINARY_RECORD_SIZE)
+    {
+        gIsRecordValid = false;
+    }
+    else
+    {
+        size_t available = CONFIG_LOG_BINARY_RECORD_SIZE - gRecordSize - 2U;
+
+        if (available < length)
+        {
+            length = available;
+        }
+
+        addByte(ARG_TYPE_STRING);
+        addByte(static_cast<uint8_t>(length));
+        memcpy(&gRecord[gRecordSize], value, length);
+        gRecordSize += static_cast<uint8_t>(length);
+    }
+}
+
+void BinaryLog::commit()
+{
+    if ((true == gIsRecordValid) && (true == Logging::isEnabled()))
+    {
+        uint8_t frameHead[2U] = {SYNC, gRecordSize};
+        uint8_t checksum      = gRecordSize;
+        uint8_t idx;
+        bool    isDropped     = false;
+
+        for (idx = 0U; idx < gRecordSize; ++idx)
+        {
+            checksum += gRecord[idx];
+        }
+
+        /* Report previously dropped records first, to keep the chronological order. */
+        if ((0U < gUnreportedDrops) && (false == pushDroppedRecord()))
+        {
+            isDropped = true;
+        }
+        else if ((static_cast<size_t>(gRecordSize) + FRAME_OVERHEAD) > (CONFIG_LOG_BINARY_BUFFER_SIZE - gPendingBytes))
+        {
+            isDropped = true;
+        }
+        else
+        {
+            (void)push(frameHead, sizeof(frameHead));
+            (void)push(gRecord, gRecordSize);
+            (void)push(&checksum, sizeof(checksum));
+            gUnreportedDrops = 0U;
+        }
+
+        if (true == isDropped)
+        {
+            if (UINT16_MAX > gUnreportedDrops)
+            {
+                ++gUnreportedDrops;
+            }
+
+            if (UINT16_MAX > gDroppedRecords)
+            {
+                ++gDroppedRecords;
+            }
+        }
+    }
+
+    gIsRecordValid = false;
+}
+
+size_t BinaryLog::read(uint8_t* buffer, size_t size)
+{
+    size_t count = 0U;
+
+    if (nullptr != buffer)
+    {
+        while ((count < size) && (0U < gPendingBytes))
+        {
+            buffer[count] = gRingBuffer[gReadIdx];
+
+            ++count;
+            --gPendingBytes;
+            ++gReadIdx;
+
+            if (CONFIG_LOG_BINARY_BUFFER_SIZE <= gReadIdx)
+            {
+                gReadIdx = 0U;
+            }
+        }
+    }
+
+    return count;
+}
+
+void BinaryLog::process()
+{
+    if (0U < gPendingBytes)
+    {
+        uint8_t buffer[CONFIG_LOG_BINARY_DRAIN_SIZE];
+        int     available = Serial.availableForWrite();
+        size_t  size      = sizeof(buffer);
+
+        /* Never block the main loop by the serial interface. */
+        if (0 >= available)
+        {
+            size = 0U;
+        }
+        else if (static_cast<size_t>(available) < size)
+        {
+            size = static_cast<size_t>(available);
+        }
+        else
+        {
+            ;
+        }
+
+        size = read(buffer, size);
+
+        if (0U < size)
+        {
+            (void)Serial.write(buffer, size);
+        }
+    }
+}
+
+uint16_t BinaryLog::getDroppedRecords()
+{
+    return gDroppedRecords;
+}
+
+size_t BinaryLog::getPendingBytes()
+{
+    return gPendingBytes;
+}
+
+void BinaryLog::clear()
+{
+    gRecordSize      = 0U;
+    gIsRecordValid   = false;
+    gReadIdx         = 0U;
+    gPendingBytes    = 0U;
+    gUnreportedDrops = 0U;
+    gDroppedRecords  = 0U;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Add a single byte to the record under construction.
+ * If the record is full, the record becomes invalid.
+ *
+ * @param[in] value Byte value
+ */
+static void addByte(uint8_t value)
+{
+    if (CONFIG_LOG_BINARY_RECORD_SIZE <= gRecordSize)
+    {
+        gIsRecordValid = false;
+    }
+    else
+    {
+        gRecord[gRecordSize] = value;
+        ++gRecordSize;
+    }
+}
+
+/**
+ * Add a value in little endian byte order to the record under construction.
+ *
+ * @param[in] value Value
+ * @param[in] size  Number of bytes, starting with the least significant byte.
+ */
+static void addLittleEndian(uint32_t value, uint8_t size)
+{
+    uint8_t idx;
+
+    for (idx = 0U; idx < size; ++idx)
+    {
+        addByte(static_cast<uint8_t>(value & 0xFFU));
+        value >>= 8U;
+    }
+}
+
+/**
+ * Push data into the ring buffer.
+ *
+ * @param[in] data  Data
+ * @param[in] size  Data size in bytes
+ *
+ * @return If the data fits, it will return true otherwise false.
+ */
+static bool push(const uint8_t* data, size_t size)
+{
+    bool isSuccessful = false;
+
+    if (size <= (CONFIG_LOG_BINARY_BUFFER_SIZE - gPendingBytes))
+    {
+        size_t writeIdx = (gReadIdx + gPendingBytes) % CONFIG_LOG_BINARY_BUFFER_SIZE;
+        size_t idx;
+
+        for (idx = 0U; idx < size; ++idx)
+        {
+            gRingBuffer[writeIdx] = data[idx];
+
+            ++writeIdx;
+
+            if (CONFIG_LOG_BINARY_BUFFER_SIZE <= writeIdx)
+            {
+                writeIdx = 0U;
+            }
+        }
+
+        gPendingBytes += size;
+        isSuccessful   = true;
+    }
+
+    return isSuccessful;
+}
+
+/**
+ * Push the record, which reports the number of dropped records, into the ring buffer.
+ * It is only pushed together with enough space for the record under construction,
+ * otherwise the record under construction would be dropped right after it.
+ *
+ * @return If successful pushed, it will return true otherwise false.
+ */
+static bool pushDroppedRecord()
+{
+    bool    isSuccessful = false;
+    uint8_t frame[BinaryLog::FRAME_OVERHEAD + RECORD_HEADER_SIZE + 3U];
+    size_t  required     = sizeof(frame) + gRecordSize + BinaryLog::FRAME_OVERHEAD;
+
+    if (required <= (CONFIG_LOG_BINARY_BUFFER_SIZE - gPendingBytes))
+    {
+        uint32_t timestamp = static_cast<uint32_t>(millis());
+        uint8_t  checksum  = 0U;
+        uint8_t  idx       = 0U;
+        uint8_t  byteIdx;
+
+        frame[idx++] = BinaryLog::SYNC;
+        frame[idx++] = static_cast<uint8_t>(sizeof(frame) - BinaryLog::FRAME_OVERHEAD);
+
+        for (byteIdx = 0U; byteIdx < sizeof(uint32_t); ++byteIdx)
+        {
+            frame[idx++] = static_cast<uint8_t>((BinaryLog::DROPPED_ID >> (8U * byteIdx)) & 0xFFU);
+        }
+
+        for (byteIdx = 0U; byteIdx < sizeof(uint32_t); ++byteIdx)
+        {
+            frame[idx++] = static_cast<uint8_t>((timestamp >> (8U * byteIdx)) & 0xFFU);
+        }
+
+        frame[idx++] = BinaryLog::ARG_TYPE_UNSIGNED | sizeof(uint16_t);
+        frame[idx++] = static_cast<uint8_t>(gUnreportedDrops & 0xFFU);
+        frame[idx++] = static_cast<uint8_t>((gUnreportedDrops >> 8U) & 0xFFU);
+
+        for (byteIdx = 1U; byteIdx < idx; ++byteIdx)
+        {
+            checksum += frame[byteIdx];
+        }
+
+        frame[idx++] = checksum;
+
+        isSuccessful = push(frame, idx);
+    }
+
+    return isSuccessful;
+}
@@ -0,0 +1,404 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Deferred binary logging backend
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup Service
+ *
+ * @{
+ */
+
+#ifndef BINARY_LOG_H
+#define BINARY_LOG_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+#ifndef CONFIG_LOG_BINARY_BUFFER_SIZE
+/** Size of the ring buffer in bytes, which holds the records till they are sent. */
+#define CONFIG_LOG_BINARY_BUFFER_SIZE (128)
+#endif /* CONFIG_LOG_BINARY_BUFFER_SIZE */
+
+#ifndef CONFIG_LOG_BINARY_RECORD_SIZE
+/** Max. size of a single record payload in bytes. */
+#define CONFIG_LOG_BINARY_RECORD_SIZE (40)
+#endif /* CONFIG_LOG_BINARY_RECORD_SIZE */
+
+#ifndef CONFIG_LOG_BINARY_DRAIN_SIZE
+/** Max. number of bytes, which are sent per process() call. */
+#define CONFIG_LOG_BINARY_DRAIN_SIZE (16)
+#endif /* CONFIG_LOG_BINARY_DRAIN_SIZE */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Deferred binary logging backend.
+ *
+ * Instead of formatting a log message as text, a record with the message id,
+ * the timestamp and the raw argument values is copied into a RAM ring buffer.
+ * The ring buffer is sent in bounded slices by process(), so the main loop is
+ * never blocked by the serial interface.
+ *
+ * The message id is determined at compile time by the log tag and the line
+ * number of the log message. The host decoder (scripts/decode_binary_log.py)
+ * scans the sources for the log messages and rebuilds the text log.
+ *
+ * Frame format:
+ * | SYNC | LEN | ID (4, little endian) | TIMESTAMP in ms (4, little endian) | ARGS | CHECKSUM |
+ *
+ * LEN is the number of bytes of the message id, the timestamp and the
+ * arguments. The checksum is the 8-bit sum of LEN and all bytes after it.
+ *
+ * Every argument starts with its type byte. The high nibble is the kind of
+ * the argument, the low nibble is its size in bytes for numbers. A string is
+ * followed by its length and the characters without termination.
+ *
+ * If a record doesn't fit into the ring buffer, it is dropped and counted.
+ * As soon as there is enough space again, a record with the DROPPED_ID and
+ * the number of dropped records is inserted.
+ */
+namespace BinaryLog
+{
+    /** Start of frame */
+    static const uint8_t SYNC = 0xA5U;
+
+    /** Message id of the record, which reports dropped records. Its only argument is the number of dropped records. */
+    static const uint32_t DROPPED_ID = 0U;
+
+    /** Argument type: signed integer, low nibble is the size. */
+    static const uint8_t ARG_TYPE_SIGNED = 0x10U;
+
+    /** Argument type: unsigned integer, low nibble is the size. */
+    static const uint8_t ARG_TYPE_UNSIGNED = 0x20U;
+
+    /** Argument type: float, 4 bytes */
+    static const uint8_t ARG_TYPE_FLOAT = 0x34U;
+
+    /** Argument type: single character, 1 byte */
+    static const uint8_t ARG_TYPE_CHAR = 0x41U;
+
+    /** Argument type: string, followed by the length and the characters. */
+    static const uint8_t ARG_TYPE_STRING = 0x50U;
+
+    /** Size of the frame overhead in bytes: sync, length and checksum */
+    static const uint8_t FRAME_OVERHEAD = 3U;
+
+    /** Start value of the log tag hash. */
+    static const uint16_t TAG_HASH_START = 5381U;
+
+    /**
+     * Calculate the log tag id at compile time.
+     * It is a 16-bit variant of the djb2 hash.
+     *
+     * @param[in] tag   Log tag
+     * @param[in] hash  Hash of the already processed characters.
+     *
+     * @return Log tag id
+     */
+    constexpr uint16_t getTagId(const char* tag, uint16_t hash = TAG_HASH_START)
+    {
+        return ('\0' == *tag) ? hash
+                              : getTagId(tag + 1, static_cast<uint16_t>((static_cast<uint32_t>(hash) * 33U) ^
+                                                                        static_cast<uint8_t>(*tag)));
+    }
+
+    /**
+     * Get the message id at compile time.
+     *
+     * @param[in] tagId         Log tag id
+     * @param[in] lineNumber    Line number of the log message.
+     *
+     * @return Message id
+     */
+    constexpr uint32_t getMessageId(uint16_t tagId, int lineNumber)
+    {
+        return (static_cast<uint32_t>(tagId) << 16U) | static_cast<uint16_t>(lineNumber);
+    }
+
+    /**
+     * Begin a new record. A not committed record is discarded.
+     *
+     * @param[in] id    Message id
+     */
+    void begin(uint32_t id);
+
+    /**
+     * Add a signed integer argument to the current record.
+     *
+     * @param[in] value Value
+     * @param[in] size  Size of the original datatype in bytes. Max. 4 bytes are stored.
+     */
+    void addSigned(int32_t value, uint8_t size);
+
+    /**
+     * Add an unsigned integer argument to the current record.
+     *
+     * @param[in] value Value
+     * @param[in] size  Size of the original datatype in bytes. Max. 4 bytes are stored.
+     */
+    void addUnsigned(uint32_t value, uint8_t size);
+
+    /**
+     * Add a float argument to the current record.
+     *
+     * @param[in] value Value
+     */
+    void addFloat(float value);
+
+    /**
+     * Add a single character argument to the current record.
+     *
+     * @param[in] value Character
+     */
+    void addChar(char value);
+
+    /**
+     * Add a string argument to the current record.
+     * It is truncated, if the record has not enough space left.
+     *
+     * @param[in] value String
+     */
+    void addString(const char* value);
+
+    /**
+     * Add an argument to the current record.
+     *
+     * @param[in] value Value
+     */
+    inline void addArg(bool value)
+    {
+        addUnsigned(value ? 1U : 0U, 1U);
+    }
+
+    /**
+     * Add an argument to the current record.
+     *
+     * @param[in] value Value
+     */
+    inline void addArg(char value)
+    {
+        addChar(value);
+    }
+
+    /**
+     * Add an argument to the current record.
+     *
+     * @param[in] value Value
+     */
+    inline void addArg(signed char value)
+    {
+        addSigned(value, sizeof(value));
+    }
+
+    /**
+     * Add an argument to the current record.
+     *
+     * @param[in] value Value
+     */
+    inline void addArg(unsigned char value)
+    {
+        addUnsigned(value, sizeof(value));
+    }
+
+    /**
+     * Add an argument to the current record.
+     *
+     * @param[in] value Value
+     */
+    inline void addArg(short value)
+    {
+        addSigned(value, sizeof(value));
+    }
+
+    /**
+     * Add an argument to the current record.
+     *
+     * @param[in] value Value
+     */
+    inline void addArg(unsigned short value)
+    {
+        addUnsigned(value, sizeof(value));
+    }
+
+    /**
+     * Add an argument to the current record.
+     *
+     * @param[in] value Value
+     */
+    inline void addArg(int value)
+    {
+        addSigned(value, sizeof(value));
+    }
+
+    /**
+     * Add an argument to the current record.
+     *
+     * @param[in] value Value
+     */
+    inline void addArg(unsigned int value)
+    {
+        addUnsigned(value, sizeof(value));
+    }
+
+    /**
+     * Add an argument to the current record.
+     *
+     * @param[in] value Value
+     */
+    inline void addArg(long value)
+    {
+        addSigned(static_cast<int32_t>(value), sizeof(value));
+    }
+
+    /**
+     * Add an argument to the current record.
+     *
+     * @param[in] value Value
+     */
+    inline void addArg(unsigned long value)
+    {
+        addUnsigned(static_cast<uint32_t>(value), sizeof(value));
+    }
+
+    /**
+     * Add an argument to the current record.
+     *
+     * @param[in] value Value
+     */
+    inline void addArg(float value)
+    {
+        addFloat(value);
+    }
+
+    /**
+     * Add an argument to the current record.
+     *
+     * @param[in] value Value
+     */
+    inline void addArg(double value)
+    {
+        addFloat(static_cast<float>(value));
+    }
+
+    /**
+     * Add an argument to the current record.
+     *
+     * @param[in] value Value
+     */
+    inline void addArg(const char* value)
+    {
+        addString(value);
+    }
+
+    /**
+     * Commit the current record to the ring buffer.
+     * If there is not enough space, the record is dropped.
+     */
+    void commit();
+
+    /**
+     * Write a record without arguments.
+     *
+     * @param[in] id    Message id
+     */
+    inline void write(uint32_t id)
+    {
+        begin(id);
+        commit();
+    }
+
+    /**
+     * Write a record with a single argument.
+     *
+     * @param[in] id    Message id
+     * @param[in] value Argument value
+     */
+    template<typename T>
+    void write(uint32_t id, T value)
+    {
+        begin(id);
+        addArg(value);
+        commit();
+    }
+
+    /**
+     * Read bytes of the committed records from the ring buffer.
+     *
+     * @param[out] buffer   Destination buffer
+     * @param[in]  size     Size of the destination buffer in bytes.
+     *
+     * @return Number of read bytes.
+     */
+    size_t read(uint8_t* buffer, size_t size);
+
+    /**
+     * Send the next slice of max. CONFIG_LOG_BINARY_DRAIN_SIZE bytes over the serial interface.
+     * Call it periodically in the main loop.
+     */
+    void process();
+
+    /**
+     * Get the number of dropped records since start.
+     *
+     * @return Number of dropped records. It saturates at UINT16_MAX.
+     */
+    uint16_t getDroppedRecords();
+
+    /**
+     * Get the number of bytes, which are waiting in the ring buffer.
+     *
+     * @return Number of bytes
+     */
+    size_t getPendingBytes();
+
+    /**
+     * Discard all records and reset the dropped records counter.
+     */
+    void clear();
+
+} /* namespace BinaryLog */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* BINARY_LOG_H */
+/** @} */
@@ -0,0 +1,157 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Send on change filter
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "ChangeFilter.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+ChangeFilter::ChangeFilter(uint8_t valueCount, uint16_t deadband, uint32_t minInterval, uint32_t maxInterval) :
+    m_valueCount((MAX_VALUES < valueCount) ? MAX_VALUES : valueCount),
+    m_deadband(deadband),
+    m_minInterval(minInterval),
+    m_maxInterval(maxInterval),
+    m_isSent(false),
+    m_lastTimestamp(0U),
+    m_lastValues()
+{
+}
+
+void ChangeFilter::reset()
+{
+    m_isSent = false;
+}
+
+bool ChangeFilter::isSendRequired(uint32_t timestamp, const uint16_t* values)
+{
+    bool isRequired = false;
+
+    if (nullptr != values)
+    {
+        uint32_t elapsed = timestamp - m_lastTimestamp;
+
+        if (false == m_isSent)
+        {
+            isRequired = true;
+        }
+        else if (m_minInterval > elapsed)
+        {
+            /* Rate cap, changes are sent later. */
+            ;
+        }
+        else if (m_maxInterval <= elapsed)
+        {
+            isRequired = true;
+        }
+        else
+        {
+            isRequired = isChanged(values);
+        }
+
+        if (true == isRequired)
+        {
+            uint8_t idx;
+
+            for (idx = 0U; idx < m_valueCount; ++idx)
+            {
+                m_lastValues[idx] = values[idx];
+            }
+
+            m_lastTimestamp = timestamp;
+            m_isSent        = true;
+        }
+    }
+
+    return isRequired;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+bool ChangeFilter::isChanged(const uint16_t* values) const
+{
+    bool    isChanged = false;
+    uint8_t idx       = 0U;
+
+    while ((m_valueCount > idx) && (false == isChanged))
+    {
+        uint16_t diff = (values[idx] > m_lastValues[idx]) ? (values[idx] - m_lastValues[idx])
+                                                          : (m_lastValues[idx] - values[idx]);
+
+        if (m_deadband < diff)
+        {
+            isChanged = true;
+        }
+        else
+        {
+            ++idx;
+        }
+    }
+
+    return isChanged;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
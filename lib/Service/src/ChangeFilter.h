@@ -0,0 +1,166 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Send on change filter
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup Service
+ *
+ * @{
+ */
+
+#ifndef CHANGE_FILTER_H
+#define CHANGE_FILTER_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Decides whether a set of values shall be sent, depended on how much they
+ * changed since they were sent the last time.
+ *
+ * - A value is changed, if it differs more than the deadband from its last sent value.
+ * - Changes are sent at most once per min. interval, which caps the rate.
+ * - Without any change the values are sent again after the max. interval,
+ *   which tells the receiver that they are still valid.
+ */
+class ChangeFilter
+{
+public:
+    /** Max. number of values. */
+    static const uint8_t MAX_VALUES = 8U;
+
+    /**
+     * Constructs the change filter.
+     *
+     * @param[in] valueCount    Number of values. It is limited to MAX_VALUES.
+     * @param[in] deadband      Max. difference of a value, which is not considered as change.
+     * @param[in] minInterval   Min. interval between two sends in ms.
+     * @param[in] maxInterval   Max. interval between two sends in ms.
+     */
+    ChangeFilter(uint8_t valueCount, uint16_t deadband, uint32_t minInterval, uint32_t maxInterval);
+
+    /**
+     * Destroys the change filter.
+     */
+    ~ChangeFilter()
+    {
+    }
+
+    /**
+     * Forget the last sent values. The next values are sent independent of
+     * any change, e.g. after the receiver is connected again.
+     */
+    void reset();
+
+    /**
+     * Shall the values be sent?
+     * If yes, the values are considered as sent.
+     *
+     * @param[in] timestamp Current timestamp in ms.
+     * @param[in] values    Values, with the number given at construction.
+     *
+     * @return If the values shall be sent, it will return true otherwise false.
+     */
+    bool isSendRequired(uint32_t timestamp, const uint16_t* values);
+
+private:
+    /** Number of values. */
+    uint8_t m_valueCount;
+
+    /** Max. difference of a value, which is not considered as change. */
+    uint16_t m_deadband;
+
+    /** Min. interval between two sends in ms. */
+    uint32_t m_minInterval;
+
+    /** Max. interval between two sends in ms. */
+    uint32_t m_maxInterval;
+
+    /** Are the last sent values valid? */
+    bool m_isSent;
+
+    /** Timestamp of the last send in ms. */
+    uint32_t m_lastTimestamp;
+
+    /** Last sent values. */
+    uint16_t m_lastValues[MAX_VALUES];
+
+    /**
+     * Is any value changed more than the deadband?
+     *
+     * @param[in] values    Values
+     *
+     * @return If changed, it will return true otherwise false.
+     */
+    bool isChanged(const uint16_t* values) const;
+
+    /**
+     * Default constructor.
+     * Not allowed.
+     */
+    ChangeFilter();
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] filter    Source instance.
+     */
+    ChangeFilter(const ChangeFilter& filter);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] filter    Source instance.
+     *
+     * @returns Reference to ChangeFilter instance.
+     */
+    ChangeFilter& operator=(const ChangeFilter& filter);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* CHANGE_FILTER_H */
+/** @} */
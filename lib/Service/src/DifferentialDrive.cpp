@@ -104,6 +104,27 @@ void DifferentialDrive::setMaxMotorSpeed(int16_t maxMotorSpeed)
     m_motorSpeedRightPID.setLimits(-m_maxMotorSpeed, m_maxMotorSpeed);
 }
 
+void DifferentialDrive::getPIDFactors(PIDFactors& factors) const
+{
+    factors = m_pidFactors;
+}
+
+void DifferentialDrive::setPIDFactors(const PIDFactors& factors)
+{
+    if ((0 < factors.pDenominator) && (0 < factors.iDenominator) && (0 < factors.dDenominator))
+    {
+        m_pidFactors = factors;
+
+        m_motorSpeedLeftPID.setPFactor(m_pidFactors.pNumerator, m_pidFactors.pDenominator);
+        m_motorSpeedLeftPID.setIFactor(m_pidFactors.iNumerator, m_pidFactors.iDenominator);
+        m_motorSpeedLeftPID.setDFactor(m_pidFactors.dNumerator, m_pidFactors.dDenominator);
+
+        m_motorSpeedRightPID.setPFactor(m_pidFactors.pNumerator, m_pidFactors.pDenominator);
+        m_motorSpeedRightPID.setIFactor(m_pidFactors.iNumerator, m_pidFactors.iDenominator);
+        m_motorSpeedRightPID.setDFactor(m_pidFactors.dNumerator, m_pidFactors.dDenominator);
+    }
+}
+
 int16_t DifferentialDrive::getLinearSpeed() const
 {
     return m_linearSpeedCenterSetPoint;
@@ -144,6 +165,8 @@ void DifferentialDrive::setAngularSpeed(int16_t angularSpeed)
 
 void DifferentialDrive::process(uint32_t period)
 {
+    uint32_t sampleTime = getSampleTime(period); /* [us] */
+
     /* The differential drive must be enabled.
      * The calibration is essential! The max. motor speed in [steps/s] is needed for closed-loop-control.
      */
@@ -158,8 +181,8 @@ void DifferentialDrive::process(uint32_t period)
         int16_t      linearSpeedLeft    = speedometer.getLinearSpeedLeft();           /* [steps/s] */
         int16_t      linearSpeedRight   = speedometer.getLinearSpeedRight();          /* [steps/s] */
 
-        m_motorSpeedLeftPID.setSampleTime(period);
-        m_motorSpeedRightPID.setSampleTime(period);
+        m_motorSpeedLeftPID.setSampleTimeUs(sampleTime);
+        m_motorSpeedRightPID.setSampleTimeUs(sampleTime);
 
         /* If left motor is stopped, the PID controller shall be cleared. */
         if (0 == m_linearSpeedLeftSetPoint)
@@ -230,16 +253,34 @@ DifferentialDrive::DifferentialDrive() :
     m_linearSpeedRightSetPoint(0),
     m_motorSpeedLeftPID(),
     m_motorSpeedRightPID(),
+    m_pidFactors(),
     m_lastLinearSpeedLeft(0),
-    m_lastLinearSpeedRight(0)
+    m_lastLinearSpeedRight(0),
+    m_lastProcessTimestamp(0U),
+    m_isLastProcessValid(false)
+{
+    const PIDFactors factors = {PID_P_NUMERATOR, PID_P_DENOMINATOR, PID_I_NUMERATOR,
+                                PID_I_DENOMINATOR, PID_D_NUMERATOR, PID_D_DENOMINATOR};
+
+    setPIDFactors(factors);
+}
+
+uint32_t DifferentialDrive::getSampleTime(uint32_t period)
 {
-    m_motorSpeedLeftPID.setPFactor(PID_P_NUMERATOR, PID_P_DENOMINATOR);
-    m_motorSpeedLeftPID.setIFactor(PID_I_NUMERATOR, PID_I_DENOMINATOR);
-    m_motorSpeedLeftPID.setDFactor(PID_D_NUMERATOR, PID_D_DENOMINATOR);
+    Timebase::Timestamp timestamp  = Timebase::now();
+    Timebase::Duration  sampleTime = Timebase::fromMs(period); /* [us] */
+
+    if (true == m_isLastProcessValid)
+    {
+        sampleTime = Timebase::getDuration(m_lastProcessTimestamp, timestamp);
+        sampleTime = ((sampleTime + (SAMPLE_TIME_RESOLUTION / 2U)) / SAMPLE_TIME_RESOLUTION) * SAMPLE_TIME_RESOLUTION;
+        sampleTime = constrain(sampleTime, SAMPLE_TIME_RESOLUTION, MAX_SAMPLE_TIME_FACTOR * Timebase::fromMs(period));
+    }
+
+    m_lastProcessTimestamp = timestamp;
+    m_isLastProcessValid   = true;
 
-    m_motorSpeedRightPID.setPFactor(PID_P_NUMERATOR, PID_P_DENOMINATOR);
-    m_motorSpeedRightPID.setIFactor(PID_I_NUMERATOR, PID_I_DENOMINATOR);
-    m_motorSpeedRightPID.setDFactor(PID_D_NUMERATOR, PID_D_DENOMINATOR);
+    return sampleTime;
 }
 
 void DifferentialDrive::calculateLinearSpeedLeftRight(int16_t linearSpeedCenter, int16_t angularSpeed,
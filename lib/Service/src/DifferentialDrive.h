@@ -46,6 +46,7 @@
 #include <stdint.h>
 #include <SimpleTimer.h>
 #include <PIDController.h>
+#include <Timebase.h>
 
 /******************************************************************************
  * Macros
@@ -70,6 +71,19 @@
 class DifferentialDrive
 {
 public:
+    /**
+     * The PID factors of the speed control, as numerator and denominator pairs.
+     */
+    struct PIDFactors
+    {
+        int16_t pNumerator;   /**< Proportional factor numerator */
+        int16_t pDenominator; /**< Proportional factor denominator */
+        int16_t iNumerator;   /**< Integral factor numerator */
+        int16_t iDenominator; /**< Integral factor denominator */
+        int16_t dNumerator;   /**< Derivative factor numerator */
+        int16_t dDenominator; /**< Derivative factor denominator */
+    };
+
     /**
      * Get the instance of the differential drive control.
      *
@@ -117,6 +131,21 @@ public:
      */
     void setMaxMotorSpeed(int16_t maxMotorSpeed);
 
+    /**
+     * Get the PID factors of the speed control.
+     *
+     * @param[out] factors  PID factors
+     */
+    void getPIDFactors(PIDFactors& factors) const;
+
+    /**
+     * Set the PID factors of the speed control. They are used by the left and
+     * right speed controller. If a denominator is not positive, the factors are rejected.
+     *
+     * @param[in] factors   PID factors
+     */
+    void setPIDFactors(const PIDFactors& factors);
+
     /**
      * Get the linear speed center set point.
      * Note, this is the speed which is commanded and not the measured one.
@@ -171,8 +200,9 @@ public:
 
     /**
      * Process the differential drive periodically.
+     * The speed controllers use the real elapsed time since the last call.
      *
-     * @param[in] period    Calling period in [ms]
+     * @param[in] period    Nominal calling period in [ms], used for the first call.
      */
     void process(uint32_t period);
 
@@ -207,6 +237,19 @@ private:
      */
     static const int16_t PID_D_DENOMINATOR = 1;
 
+    /**
+     * The max. sample time of the speed controllers as multiple of the
+     * nominal period. It limits the effect of a stalled main loop.
+     */
+    static const uint32_t MAX_SAMPLE_TIME_FACTOR = 4U;
+
+    /**
+     * The resolution of the sample time of the speed controllers in [us].
+     * It keeps the PID factors in range and avoids their recalculation by
+     * every small jitter.
+     */
+    static const uint32_t SAMPLE_TIME_RESOLUTION = 100U;
+
     int16_t m_isInit;    /**< Used to determine the initialization in the first time process() is called. */
     bool    m_isEnabled; /**< Enable/Disable the differential drive control. */
 
@@ -220,10 +263,25 @@ private:
 
     PIDController<int16_t> m_motorSpeedLeftPID;  /**< PID controller for the left motor speed. */
     PIDController<int16_t> m_motorSpeedRightPID; /**< PID controller for the right motor speed. */
+    PIDFactors             m_pidFactors;         /**< PID factors of the speed controllers. */
 
     int32_t m_lastLinearSpeedLeft;  /**< Last linear speed left PID output in [steps/s]. */
     int32_t m_lastLinearSpeedRight; /**< Last linear speed right PID output in [steps/s]. */
 
+    Timebase::Timestamp m_lastProcessTimestamp; /**< Timestamp in [us] of the last process() call. */
+    bool                m_isLastProcessValid;   /**< Is the timestamp of the last process() call valid? */
+
+    /**
+     * Get the sample time of the speed controllers. It is the elapsed time
+     * since the last call, rounded to the SAMPLE_TIME_RESOLUTION and limited
+     * to a reasonable range.
+     *
+     * @param[in] period    Nominal calling period in [ms]
+     *
+     * @return Sample time in [us]
+     */
+    uint32_t getSampleTime(uint32_t period);
+
     /**
      * Construct differential drive control.
      * It is disabled by default.
@@ -0,0 +1,156 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Gap keeping controller of a convoy follower
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "GapController.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+GapController::GapController(uint32_t sampleTime, uint16_t maxGap) :
+    m_pidCtrl(),
+    m_maxGap((MAX_GAP < maxGap) ? MAX_GAP : maxGap),
+    m_leaderSpeed(0),
+    m_standstillGap(0U),
+    m_timeGap(0U),
+    m_maxSpeed(0)
+{
+    m_pidCtrl.setPFactor(PID_P_NUMERATOR, PID_P_DENOMINATOR);
+    m_pidCtrl.setIFactor(PID_I_NUMERATOR, PID_I_DENOMINATOR);
+    m_pidCtrl.setDFactor(PID_D_NUMERATOR, PID_D_DENOMINATOR);
+    m_pidCtrl.setSampleTime(sampleTime);
+    m_pidCtrl.setLimits(-MAX_CORRECTION, MAX_CORRECTION);
+}
+
+void GapController::setTarget(int16_t leaderSpeed, uint16_t standstillGap, uint16_t timeGap)
+{
+    m_leaderSpeed   = leaderSpeed;
+    m_standstillGap = (m_maxGap < standstillGap) ? m_maxGap : standstillGap;
+    m_timeGap       = timeGap;
+}
+
+void GapController::reset()
+{
+    m_pidCtrl.clear();
+    m_pidCtrl.resync();
+}
+
+int16_t GapController::getDesiredGap(int16_t ownSpeed) const
+{
+    int32_t desiredGap = m_standstillGap;
+
+    /* Driving backwards doesn't reduce the gap below the standstill gap. */
+    if (0 < ownSpeed)
+    {
+        desiredGap += (static_cast<int32_t>(ownSpeed) * static_cast<int32_t>(m_timeGap)) / 1000;
+    }
+
+    if (m_maxGap < desiredGap)
+    {
+        desiredGap = m_maxGap;
+    }
+
+    return static_cast<int16_t>(desiredGap);
+}
+
+int16_t GapController::process(uint16_t gap, int16_t ownSpeed)
+{
+    int32_t speed = m_leaderSpeed;
+
+    if (GAP_UNKNOWN == gap)
+    {
+        /* Without measurement there is no gap error to correct. The controller
+         * starts again, when the vehicle ahead is measured again.
+         */
+        reset();
+    }
+    else
+    {
+        int16_t limitedGap = static_cast<int16_t>((m_maxGap < gap) ? m_maxGap : gap);
+
+        /* A gap larger than desired results in a positive correction. */
+        speed += m_pidCtrl.calculate(limitedGap, getDesiredGap(ownSpeed));
+    }
+
+    if (0 > speed)
+    {
+        speed = 0;
+    }
+    else if (m_maxSpeed < speed)
+    {
+        speed = m_maxSpeed;
+    }
+    else
+    {
+        ;
+    }
+
+    return static_cast<int16_t>(speed);
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
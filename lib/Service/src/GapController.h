@@ -0,0 +1,213 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Gap keeping controller of a convoy follower
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup Service
+ *
+ * @{
+ */
+
+#ifndef GAP_CONTROLLER_H
+#define GAP_CONTROLLER_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <PIDController.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Keeps the gap to the vehicle ahead, by controlling the own speed.
+ *
+ * The desired gap follows the constant time gap policy: it is the gap at
+ * standstill plus the distance, which is driven with the own speed within
+ * the time gap. The speed of the vehicle ahead is used as feed forward and
+ * the gap error is corrected by a PID controller:
+ *
+ * speed = leaderSpeed + PID(gap - desiredGap)
+ *
+ * The speed is limited to 0 and the max. speed, therefore the vehicle never
+ * drives backwards.
+ *
+ * If the gap is not measured, e.g. because the vehicle ahead is out of the
+ * sensor range, only the feed forward is used. The desired gap is limited
+ * to the measurable range.
+ */
+class GapController
+{
+public:
+    /** Default max. speed correction in [mm/s] by the PID controller. */
+    static const int16_t MAX_CORRECTION = 200;
+
+    /** Gap, which means that no vehicle ahead is measured. */
+    static const uint16_t GAP_UNKNOWN = UINT16_MAX;
+
+    /**
+     * Constructs the gap controller.
+     *
+     * @param[in] sampleTime    Processing period in [ms].
+     * @param[in] maxGap        Max. measurable gap in [mm].
+     */
+    GapController(uint32_t sampleTime, uint16_t maxGap);
+
+    /**
+     * Destroys the gap controller.
+     */
+    ~GapController()
+    {
+    }
+
+    /**
+     * Set the target of the gap control.
+     * A standstill gap beyond the max. measurable gap is limited to it.
+     *
+     * @param[in] leaderSpeed   Speed of the vehicle ahead in [mm/s].
+     * @param[in] standstillGap Desired gap at standstill in [mm].
+     * @param[in] timeGap       Desired time gap in [ms].
+     */
+    void setTarget(int16_t leaderSpeed, uint16_t standstillGap, uint16_t timeGap);
+
+    /**
+     * Set the max. speed, which limits the output.
+     *
+     * @param[in] maxSpeed  Max. speed in [mm/s]
+     */
+    void setMaxSpeed(int16_t maxSpeed)
+    {
+        m_maxSpeed = maxSpeed;
+    }
+
+    /**
+     * Get the PID controller of the gap error, e.g. to tune it.
+     *
+     * @return PID controller
+     */
+    PIDController<int16_t>& getPIDController()
+    {
+        return m_pidCtrl;
+    }
+
+    /**
+     * Reset the controller, e.g. before the gap control starts again.
+     */
+    void reset();
+
+    /**
+     * Get the desired gap for the given speed.
+     * It is limited to the max. measurable gap.
+     *
+     * @param[in] ownSpeed  Own speed in [mm/s].
+     *
+     * @return Desired gap in [mm]
+     */
+    int16_t getDesiredGap(int16_t ownSpeed) const;
+
+    /**
+     * Calculate the speed, which keeps the desired gap.
+     * It shall be called once per sample time.
+     *
+     * @param[in] gap       Measured gap in [mm] or GAP_UNKNOWN.
+     * @param[in] ownSpeed  Measured own speed in [mm/s].
+     *
+     * @return Speed in [mm/s]
+     */
+    int16_t process(uint16_t gap, int16_t ownSpeed);
+
+private:
+    /** PID proportional factor numerator for the gap error. */
+    static const int16_t PID_P_NUMERATOR = 2;
+
+    /** PID proportional factor denominator for the gap error. */
+    static const int16_t PID_P_DENOMINATOR = 1;
+
+    /** PID integral factor numerator for the gap error. */
+    static const int16_t PID_I_NUMERATOR = 0;
+
+    /** PID integral factor denominator for the gap error. */
+    static const int16_t PID_I_DENOMINATOR = 1;
+
+    /** PID derivative factor numerator for the gap error. */
+    static const int16_t PID_D_NUMERATOR = 0;
+
+    /** PID derivative factor denominator for the gap error. */
+    static const int16_t PID_D_DENOMINATOR = 1;
+
+    /** Max. gap in [mm], which is considered. It avoids an overflow. */
+    static const uint16_t MAX_GAP = 10000U;
+
+    PIDController<int16_t> m_pidCtrl;       /**< PID controller of the gap error. */
+    uint16_t               m_maxGap;        /**< Max. measurable gap in [mm]. */
+    int16_t                m_leaderSpeed;   /**< Speed of the vehicle ahead in [mm/s]. */
+    uint16_t               m_standstillGap; /**< Desired gap at standstill in [mm]. */
+    uint16_t               m_timeGap;       /**< Desired time gap in [ms]. */
+    int16_t                m_maxSpeed;      /**< Max. speed in [mm/s]. */
+
+    /**
+     * Default constructor.
+     * Not allowed.
+     */
+    GapController();
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] ctrl  Source instance.
+     */
+    GapController(const GapController& ctrl);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] ctrl  Source instance.
+     *
+     * @returns Reference to GapController instance.
+     */
+    GapController& operator=(const GapController& ctrl);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* GAP_CONTROLLER_H */
+/** @} */
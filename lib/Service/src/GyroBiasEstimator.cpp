@@ -0,0 +1,156 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Gyro bias estimator, which uses the standstill phases of the robot
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "GyroBiasEstimator.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+void GyroBiasEstimator::reset()
+{
+    m_bias             = 0;
+    m_isCalibrated     = false;
+    m_calibrationSum   = 0;
+    m_calibrationCount = 0U;
+}
+
+void GyroBiasEstimator::process(int16_t turnRate, bool isStandStill)
+{
+    if (false == isStandStill)
+    {
+        /* A moving robot spoils the calibration. */
+        m_calibrationSum   = 0;
+        m_calibrationCount = 0U;
+    }
+    else if (false == m_isCalibrated)
+    {
+        m_calibrationSum += turnRate;
+        ++m_calibrationCount;
+
+        if (CALIBRATION_SAMPLES <= m_calibrationCount)
+        {
+            int32_t count = static_cast<int32_t>(m_calibrationCount);
+
+            /* The mean is calculated in two parts to avoid an overflow of the sum. */
+            m_bias = ((m_calibrationSum / count) * (1 << BIAS_FRACTION_BITS)) +
+                     (((m_calibrationSum % count) * (1 << BIAS_FRACTION_BITS)) / count);
+            m_isCalibrated = true;
+        }
+    }
+    else
+    {
+        int32_t deviation = static_cast<int32_t>(turnRate) - static_cast<int32_t>(getBias());
+
+        /* Zero-velocity update, but only if the robot seems not to be turned by hand. */
+        if ((-MAX_DEVIATION <= deviation) && (MAX_DEVIATION >= deviation))
+        {
+            m_bias += ((static_cast<int32_t>(turnRate) * (1 << BIAS_FRACTION_BITS)) - m_bias) / ZUPT_SAMPLES;
+        }
+    }
+}
+
+int16_t GyroBiasEstimator::getBias() const
+{
+    const int32_t HALF = 1 << (BIAS_FRACTION_BITS - 1U);
+    int32_t       bias = 0;
+
+    /* Round to the nearest digit. */
+    if (0 <= m_bias)
+    {
+        bias = (m_bias + HALF) / (1 << BIAS_FRACTION_BITS);
+    }
+    else
+    {
+        bias = (m_bias - HALF) / (1 << BIAS_FRACTION_BITS);
+    }
+
+    return static_cast<int16_t>(bias);
+}
+
+int16_t GyroBiasEstimator::correct(int16_t turnRate) const
+{
+    int32_t corrected = static_cast<int32_t>(turnRate) - static_cast<int32_t>(getBias());
+
+    if (INT16_MAX < corrected)
+    {
+        corrected = INT16_MAX;
+    }
+    else if (INT16_MIN > corrected)
+    {
+        corrected = INT16_MIN;
+    }
+    else
+    {
+        ;
+    }
+
+    return static_cast<int16_t>(corrected);
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,171 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Gyro bias estimator, which uses the standstill phases of the robot
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup Service
+ *
+ * @{
+ */
+
+#ifndef GYRO_BIAS_ESTIMATOR_H
+#define GYRO_BIAS_ESTIMATOR_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The gyro bias estimator determines the zero-rate offset of the gyro. It shall
+ * be processed with every raw gyro sample together with the standstill state of
+ * the robot, e.g. from the odometry.
+ *
+ * At first the bias is calibrated by averaging a number of consecutive standstill
+ * samples. If the robot moves during the calibration, it starts again.
+ *
+ * After the calibration every standstill sample is used as zero-velocity update.
+ * The bias follows slowly with an exponential moving average, which compensates
+ * the temperature drift. A sample, which deviates too much from the bias, is not
+ * used, because the robot may be turned by hand while the wheels stand still.
+ */
+class GyroBiasEstimator
+{
+public:
+    /** Number of consecutive standstill samples for the calibration. */
+    static const uint16_t CALIBRATION_SAMPLES = 200U;
+
+    /** Max. deviation of a standstill sample from the bias in [digits] to be used for the zero-velocity update. */
+    static const int16_t MAX_DEVIATION = 100;
+
+    /**
+     * Constructs the gyro bias estimator.
+     */
+    GyroBiasEstimator() :
+        m_bias(0),
+        m_isCalibrated(false),
+        m_calibrationSum(0),
+        m_calibrationCount(0U)
+    {
+    }
+
+    /**
+     * Destroys the gyro bias estimator.
+     */
+    ~GyroBiasEstimator()
+    {
+    }
+
+    /**
+     * Reset the bias and start the calibration again.
+     */
+    void reset();
+
+    /**
+     * Process a raw gyro sample.
+     *
+     * @param[in] turnRate      Raw gyro turn rate in [digits].
+     * @param[in] isStandStill  Is the robot standing still?
+     */
+    void process(int16_t turnRate, bool isStandStill);
+
+    /**
+     * Is the bias calibrated?
+     *
+     * @return If calibrated, it will return true otherwise false.
+     */
+    bool isCalibrated() const
+    {
+        return m_isCalibrated;
+    }
+
+    /**
+     * Get the gyro bias.
+     *
+     * @return Gyro bias in [digits]
+     */
+    int16_t getBias() const;
+
+    /**
+     * Subtract the bias from a raw gyro turn rate.
+     *
+     * @param[in] turnRate  Raw gyro turn rate in [digits].
+     *
+     * @return Corrected gyro turn rate in [digits], saturated to the type range.
+     */
+    int16_t correct(int16_t turnRate) const;
+
+private:
+    /** Number of fractional bits of the bias. */
+    static const uint8_t BIAS_FRACTION_BITS = 12U;
+
+    /** Number of samples, which determines the time constant of the zero-velocity update. */
+    static const int32_t ZUPT_SAMPLES = 256;
+
+    int32_t  m_bias;             /**< Gyro bias in [digits] with BIAS_FRACTION_BITS fractional bits. */
+    bool     m_isCalibrated;     /**< Is the bias calibrated? */
+    int32_t  m_calibrationSum;   /**< Sum of the calibration samples in [digits]. */
+    uint16_t m_calibrationCount; /**< Number of calibration samples. */
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] estimator Source instance.
+     */
+    GyroBiasEstimator(const GyroBiasEstimator& estimator);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] estimator Source instance.
+     *
+     * @returns Reference to GyroBiasEstimator instance.
+     */
+    GyroBiasEstimator& operator=(const GyroBiasEstimator& estimator);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* GYRO_BIAS_ESTIMATOR_H */
+/** @} */
@@ -0,0 +1,255 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  State of a hierarchical state machine
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup Service
+ *
+ * @{
+ */
+
+#ifndef HIERARCHICAL_STATE_H
+#define HIERARCHICAL_STATE_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+#ifndef CONFIG_HSM_TIME_ACCOUNTING
+/** Enable/disable the per state time accounting. */
+#define CONFIG_HSM_TIME_ACCOUNTING (1)
+#endif /* CONFIG_HSM_TIME_ACCOUNTING */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/* Forward declaration */
+class HierarchicalStateMachine;
+
+/** Event, which is dispatched by the hierarchical state machine to its states. */
+typedef struct
+{
+    uint8_t id;    /**< Event id, defined by the application. */
+    int32_t param; /**< Optional event parameter, meaning depends on the event id. */
+
+} HsmEvent;
+
+/**
+ * A state of the hierarchical state machine.
+ *
+ * A state may have a parent state. Events which are not handled by a state
+ * are passed to its parent state. If a state is active, all of its parent
+ * states are active too.
+ *
+ * A state is only called on entry, on exit and if an event is dispatched.
+ * There is no periodic processing.
+ */
+class HierarchicalState
+{
+public:
+    /**
+     * Constructs the state.
+     *
+     * @param[in] parent    Parent state or nullptr if its a top level state.
+     */
+    explicit HierarchicalState(HierarchicalState* parent = nullptr) :
+        m_parent(parent),
+        m_isActive(false),
+        m_entryCount(0U)
+#if (0 != CONFIG_HSM_TIME_ACCOUNTING)
+        ,
+        m_entryTimestamp(0U),
+        m_activeTime(0U)
+#endif /* (0 != CONFIG_HSM_TIME_ACCOUNTING) */
+    {
+    }
+
+    /**
+     * Destroys the state.
+     */
+    virtual ~HierarchicalState()
+    {
+    }
+
+    /**
+     * If the state is entered, this method will called once.
+     * Use HierarchicalStateMachine::transitionTo() to request an initial
+     * transition to a sub-state.
+     *
+     * @param[in] hsm   State machine, which is calling this state.
+     */
+    virtual void entry(HierarchicalStateMachine& hsm)
+    {
+        (void)hsm;
+    }
+
+    /**
+     * If the state is left, this method will be called once.
+     *
+     * @param[in] hsm   State machine, which is calling this state.
+     */
+    virtual void exit(HierarchicalStateMachine& hsm)
+    {
+        (void)hsm;
+    }
+
+    /**
+     * Handle a event.
+     * Use HierarchicalStateMachine::transitionTo() to request a state transition.
+     *
+     * @param[in] hsm   State machine, which is calling this state.
+     * @param[in] event The event to handle.
+     *
+     * @return If the event is handled, it will return true. Otherwise false and the
+     *  event is passed to the parent state.
+     */
+    virtual bool onEvent(HierarchicalStateMachine& hsm, const HsmEvent& event) = 0;
+
+    /**
+     * Get parent state.
+     *
+     * @return Parent state or nullptr if its a top level state.
+     */
+    HierarchicalState* getParent() const
+    {
+        return m_parent;
+    }
+
+    /**
+     * Is the state active?
+     *
+     * @return If active, it will return true otherwise false.
+     */
+    bool isActive() const
+    {
+        return m_isActive;
+    }
+
+    /**
+     * Get how often the state was entered.
+     *
+     * @return Number of entries.
+     */
+    uint16_t getEntryCount() const
+    {
+        return m_entryCount;
+    }
+
+    /**
+     * Get the accumulated time in ms, the state was active.
+     * Note, the time accounting is only available if enabled by
+     * CONFIG_HSM_TIME_ACCOUNTING, otherwise 0 is returned.
+     *
+     * @param[in] timestamp Current timestamp in ms.
+     *
+     * @return Accumulated active time in ms.
+     */
+    uint32_t getActiveTime(uint32_t timestamp) const
+    {
+        uint32_t activeTime = 0U;
+
+#if (0 != CONFIG_HSM_TIME_ACCOUNTING)
+        activeTime = m_activeTime;
+
+        if (true == m_isActive)
+        {
+            activeTime += timestamp - m_entryTimestamp;
+        }
+#else  /* (0 != CONFIG_HSM_TIME_ACCOUNTING) */
+        (void)timestamp;
+#endif /* (0 != CONFIG_HSM_TIME_ACCOUNTING) */
+
+        return activeTime;
+    }
+
+    /**
+     * Reset the time accounting and the entry counter.
+     *
+     * @param[in] timestamp Current timestamp in ms.
+     */
+    void resetStatistics(uint32_t timestamp)
+    {
+        m_entryCount = 0U;
+
+#if (0 != CONFIG_HSM_TIME_ACCOUNTING)
+        m_entryTimestamp = timestamp;
+        m_activeTime     = 0U;
+#else  /* (0 != CONFIG_HSM_TIME_ACCOUNTING) */
+        (void)timestamp;
+#endif /* (0 != CONFIG_HSM_TIME_ACCOUNTING) */
+    }
+
+protected:
+private:
+    /* The state machine maintains the active flag and the statistics. */
+    friend class HierarchicalStateMachine;
+
+    HierarchicalState* m_parent;     /**< Parent state */
+    bool               m_isActive;   /**< Is state active? */
+    uint16_t           m_entryCount; /**< Number of entries */
+
+#if (0 != CONFIG_HSM_TIME_ACCOUNTING)
+    uint32_t m_entryTimestamp; /**< Timestamp in ms of the last entry. */
+    uint32_t m_activeTime;     /**< Accumulated active time in ms, excluding the current activity. */
+#endif /* (0 != CONFIG_HSM_TIME_ACCOUNTING) */
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] state Source instance.
+     */
+    HierarchicalState(const HierarchicalState& state);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] state Source instance.
+     *
+     * @returns Reference to HierarchicalState instance.
+     */
+    HierarchicalState& operator=(const HierarchicalState& state);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* HIERARCHICAL_STATE_H */
+/** @} */
@@ -0,0 +1,376 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Event driven hierarchical state machine
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <HierarchicalStateMachine.h>
+#include <Arduino.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+HierarchicalStateMachine::HierarchicalStateMachine() :
+    m_currentState(nullptr),
+    m_pendingState(nullptr),
+    m_eventQueue(),
+    m_eventRdIdx(0U),
+    m_eventCount(0U),
+    m_droppedEvents(0U),
+#if (0 < CONFIG_HSM_TRACE_SIZE)
+    m_trace(),
+#endif /* (0 < CONFIG_HSM_TRACE_SIZE) */
+    m_traceWrIdx(0U),
+    m_traceLength(0U)
+{
+}
+
+bool HierarchicalStateMachine::start(HierarchicalState* initialState)
+{
+    bool isStarted = false;
+
+    /* Discard pending events. */
+    m_eventRdIdx = 0U;
+    m_eventCount = 0U;
+
+    if ((nullptr != initialState) && (MAX_DEPTH >= getDepth(initialState)))
+    {
+        m_pendingState = initialState;
+        performTransitions(EVENT_ID_NONE);
+
+        isStarted = true;
+    }
+
+    return isStarted;
+}
+
+bool HierarchicalStateMachine::transitionTo(HierarchicalState* target)
+{
+    bool isRequested = false;
+
+    /* The transition path of a deeper state doesn't fit, therefore it is rejected before. */
+    if (MAX_DEPTH >= getDepth(target))
+    {
+        m_pendingState = target;
+        isRequested    = true;
+    }
+
+    return isRequested;
+}
+
+bool HierarchicalStateMachine::postEvent(uint8_t id, int32_t param)
+{
+    bool isPosted = false;
+
+    if (EVENT_QUEUE_SIZE <= m_eventCount)
+    {
+        if (UINT16_MAX > m_droppedEvents)
+        {
+            ++m_droppedEvents;
+        }
+    }
+    else
+    {
+        uint8_t wrIdx = (m_eventRdIdx + m_eventCount) % EVENT_QUEUE_SIZE;
+
+        m_eventQueue[wrIdx].id    = id;
+        m_eventQueue[wrIdx].param = param;
+        ++m_eventCount;
+
+        isPosted = true;
+    }
+
+    return isPosted;
+}
+
+void HierarchicalStateMachine::process()
+{
+    /* Only the events which are pending now are dispatched. Events posted by
+     * the states during dispatching are handled in the next call.
+     */
+    uint8_t pendingEvents = m_eventCount;
+
+    while (0U < pendingEvents)
+    {
+        HsmEvent           event = m_eventQueue[m_eventRdIdx];
+        HierarchicalState* state = m_currentState;
+        bool               isHandled = false;
+
+        m_eventRdIdx = (m_eventRdIdx + 1U) % EVENT_QUEUE_SIZE;
+        --m_eventCount;
+        --pendingEvents;
+
+        /* Pass the event from the leaf state up to the top level state, until it is handled. */
+        while ((nullptr != state) && (false == isHandled))
+        {
+            isHandled = state->onEvent(*this, event);
+            state     = state->getParent();
+        }
+
+        performTransitions(event.id);
+    }
+}
+
+bool HierarchicalStateMachine::isInState(const HierarchicalState* state) const
+{
+    const HierarchicalState* activeState = m_currentState;
+    bool                     isActive    = false;
+
+    while ((nullptr != activeState) && (false == isActive))
+    {
+        if (state == activeState)
+        {
+            isActive = true;
+        }
+        else
+        {
+            activeState = activeState->getParent();
+        }
+    }
+
+    return isActive;
+}
+
+bool HierarchicalStateMachine::getTraceEntry(uint8_t idx, TraceEntry& entry) const
+{
+    bool isAvailable = false;
+
+#if (0 < CONFIG_HSM_TRACE_SIZE)
+    if (m_traceLength > idx)
+    {
+        /* The oldest entry is located at the write index, if the buffer is full. */
+        uint8_t rdIdx = (m_traceWrIdx + TRACE_SIZE - m_traceLength + idx) % TRACE_SIZE;
+
+        entry       = m_trace[rdIdx];
+        isAvailable = true;
+    }
+#else  /* (0 < CONFIG_HSM_TRACE_SIZE) */
+    (void)idx;
+    (void)entry;
+#endif /* (0 < CONFIG_HSM_TRACE_SIZE) */
+
+    return isAvailable;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void HierarchicalStateMachine::performTransitions(uint8_t eventId)
+{
+    uint8_t transitions = 0U;
+
+    /* Entry handlers may request further transitions, e.g. to the initial sub-state. */
+    while ((nullptr != m_pendingState) && (MAX_TRANSITIONS_IN_ROW > transitions))
+    {
+        HierarchicalState* source = m_currentState;
+        HierarchicalState* target = m_pendingState;
+        uint32_t           timestamp = millis();
+
+        m_pendingState = nullptr;
+
+        addTrace(source, target, eventId, timestamp);
+        performTransition(target);
+
+        ++transitions;
+    }
+
+    /* Drop a transition request, which exceeds the limit. */
+    m_pendingState = nullptr;
+}
+
+void HierarchicalStateMachine::performTransition(HierarchicalState* target)
+{
+    HierarchicalState* targetPath[MAX_DEPTH];
+    uint8_t            targetDepth = 0U;
+    HierarchicalState* state       = target;
+    uint32_t           timestamp   = millis();
+
+    /* Determine the path from the target state up to its top level state.
+     * It fits, because the depth of the target state is checked by start() and transitionTo().
+     */
+    while (nullptr != state)
+    {
+        targetPath[targetDepth] = state;
+        ++targetDepth;
+
+        state = state->getParent();
+    }
+
+    /* A self transition leaves and enters the state again. */
+    if (target == m_currentState)
+    {
+        exitState(target, timestamp);
+    }
+    else
+    {
+        /* Leave all states up to the least common ancestor. */
+        state = m_currentState;
+
+        while ((nullptr != state) && (false == isOnPath(state, targetPath, targetDepth)))
+        {
+            exitState(state, timestamp);
+            state = state->getParent();
+        }
+    }
+
+    m_currentState = target;
+
+    /* Enter all states from the least common ancestor down to the target state. */
+    while (0U < targetDepth)
+    {
+        --targetDepth;
+
+        if (false == targetPath[targetDepth]->isActive())
+        {
+            enterState(targetPath[targetDepth], timestamp);
+        }
+    }
+}
+
+uint8_t HierarchicalStateMachine::getDepth(const HierarchicalState* state)
+{
+    uint8_t depth = 0U;
+
+    while ((nullptr != state) && (MAX_DEPTH >= depth))
+    {
+        ++depth;
+        state = state->getParent();
+    }
+
+    return depth;
+}
+
+bool HierarchicalStateMachine::isOnPath(const HierarchicalState* state, HierarchicalState* const* path,
+                                        uint8_t depth)
+{
+    bool    isFound = false;
+    uint8_t idx     = 0U;
+
+    while ((depth > idx) && (false == isFound))
+    {
+        if (state == path[idx])
+        {
+            isFound = true;
+        }
+
+        ++idx;
+    }
+
+    return isFound;
+}
+
+void HierarchicalStateMachine::enterState(HierarchicalState* state, uint32_t timestamp)
+{
+    state->m_isActive = true;
+
+    if (UINT16_MAX > state->m_entryCount)
+    {
+        ++state->m_entryCount;
+    }
+
+#if (0 != CONFIG_HSM_TIME_ACCOUNTING)
+    state->m_entryTimestamp = timestamp;
+#else  /* (0 != CONFIG_HSM_TIME_ACCOUNTING) */
+    (void)timestamp;
+#endif /* (0 != CONFIG_HSM_TIME_ACCOUNTING) */
+
+    state->entry(*this);
+}
+
+void HierarchicalStateMachine::exitState(HierarchicalState* state, uint32_t timestamp)
+{
+    state->exit(*this);
+
+    state->m_isActive = false;
+
+#if (0 != CONFIG_HSM_TIME_ACCOUNTING)
+    state->m_activeTime += timestamp - state->m_entryTimestamp;
+#else  /* (0 != CONFIG_HSM_TIME_ACCOUNTING) */
+    (void)timestamp;
+#endif /* (0 != CONFIG_HSM_TIME_ACCOUNTING) */
+}
+
+void HierarchicalStateMachine::addTrace(const HierarchicalState* source, const HierarchicalState* target,
+                                        uint8_t eventId, uint32_t timestamp)
+{
+#if (0 < CONFIG_HSM_TRACE_SIZE)
+    m_trace[m_traceWrIdx].timestamp = timestamp;
+    m_trace[m_traceWrIdx].source    = source;
+    m_trace[m_traceWrIdx].target    = target;
+    m_trace[m_traceWrIdx].eventId   = eventId;
+
+    m_traceWrIdx = (m_traceWrIdx + 1U) % TRACE_SIZE;
+
+    if (TRACE_SIZE > m_traceLength)
+    {
+        ++m_traceLength;
+    }
+#else  /* (0 < CONFIG_HSM_TRACE_SIZE) */
+    (void)source;
+    (void)target;
+    (void)eventId;
+    (void)timestamp;
+#endif /* (0 < CONFIG_HSM_TRACE_SIZE) */
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,319 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Event driven hierarchical state machine
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup Service
+ *
+ * @{
+ */
+
+#ifndef HIERARCHICAL_STATE_MACHINE_H
+#define HIERARCHICAL_STATE_MACHINE_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+#ifndef CONFIG_HSM_TRACE_SIZE
+/** Number of transitions kept in the trace buffer. Set to 0 to disable the trace. */
+#define CONFIG_HSM_TRACE_SIZE (8)
+#endif /* CONFIG_HSM_TRACE_SIZE */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include "HierarchicalState.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Event driven hierarchical state machine.
+ *
+ * In contrast to the StateMachine, the states are not processed periodically.
+ * Events are posted into a small static queue and dispatched during process().
+ * If no event is pending, process() returns immediately.
+ *
+ * An event is dispatched to the active leaf state first. If it doesn't handle
+ * it, the event is passed to the parent state and so on.
+ *
+ * On a transition all states up to the least common ancestor of the source and
+ * target state are left (exit) and all states down to the target state are
+ * entered (entry).
+ */
+class HierarchicalStateMachine
+{
+public:
+    /** Max. number of pending events. */
+    static const uint8_t EVENT_QUEUE_SIZE = 8U;
+
+    /** Max. nesting depth of the states. */
+    static const uint8_t MAX_DEPTH = 4U;
+
+    /** Number of transitions kept in the trace buffer. */
+    static const uint8_t TRACE_SIZE = CONFIG_HSM_TRACE_SIZE;
+
+    /** Event id used in the trace for transitions, which are not triggered by a event. */
+    static const uint8_t EVENT_ID_NONE = UINT8_MAX;
+
+    /** A single transition, recorded in the trace buffer. */
+    typedef struct
+    {
+        uint32_t                 timestamp; /**< Timestamp in ms of the transition. */
+        const HierarchicalState* source;    /**< Source leaf state, may be nullptr. */
+        const HierarchicalState* target;    /**< Target leaf state. */
+        uint8_t                  eventId;   /**< Id of the event, which triggered the transition. */
+
+    } TraceEntry;
+
+    /**
+     * Constructs the state machine.
+     */
+    HierarchicalStateMachine();
+
+    /**
+     * Destroys the state machine.
+     */
+    ~HierarchicalStateMachine()
+    {
+    }
+
+    /**
+     * Start the state machine by entering the initial state and all of its parents.
+     * Pending events will be discarded. A initial state, which is nested deeper
+     * than MAX_DEPTH, is rejected.
+     *
+     * @param[in] initialState  The initial state.
+     *
+     * @return If the state machine is started, it will return true otherwise false.
+     */
+    bool start(HierarchicalState* initialState);
+
+    /**
+     * Post a event. It will be dispatched during the next process() call.
+     *
+     * @param[in] id    Event id
+     * @param[in] param Optional event parameter
+     *
+     * @return If successful posted, it will return true. If the queue is full, it will return false.
+     */
+    bool postEvent(uint8_t id, int32_t param = 0);
+
+    /**
+     * Request a transition to the target state.
+     * Call it during the event handling or during the entry of a state.
+     * The transition is performed after the handler returned.
+     * A target state, which is nested deeper than MAX_DEPTH, is rejected.
+     *
+     * @param[in] target    Target state
+     *
+     * @return If the transition is requested, it will return true otherwise false.
+     */
+    bool transitionTo(HierarchicalState* target);
+
+    /**
+     * Process the state machine by dispatching all pending events.
+     * Events posted during processing are dispatched in the next call.
+     */
+    void process();
+
+    /**
+     * Get active leaf state.
+     *
+     * @return Active leaf state or nullptr if not started yet.
+     */
+    HierarchicalState* getState() const
+    {
+        return m_currentState;
+    }
+
+    /**
+     * Is the given state active?
+     * A parent state is active, if one of its sub-states is active.
+     *
+     * @param[in] state The state to check.
+     *
+     * @return If the state is active, it will return true otherwise false.
+     */
+    bool isInState(const HierarchicalState* state) const;
+
+    /**
+     * Get number of events, which were dropped because of a full event queue.
+     *
+     * @return Number of dropped events.
+     */
+    uint16_t getDroppedEvents() const
+    {
+        return m_droppedEvents;
+    }
+
+    /**
+     * Get number of recorded transitions in the trace buffer.
+     *
+     * @return Number of trace entries.
+     */
+    uint8_t getTraceLength() const
+    {
+        return m_traceLength;
+    }
+
+    /**
+     * Get a transition from the trace buffer.
+     *
+     * @param[in]   idx     Index, where 0 is the oldest recorded transition.
+     * @param[out]  entry   The trace entry.
+     *
+     * @return If a entry is available, it will return true otherwise false.
+     */
+    bool getTraceEntry(uint8_t idx, TraceEntry& entry) const;
+
+    /**
+     * Clear the trace buffer.
+     */
+    void clearTrace()
+    {
+        m_traceLength = 0U;
+        m_traceWrIdx  = 0U;
+    }
+
+protected:
+private:
+    /**
+     * Max. number of transitions, which are performed in a row. It protects
+     * against endless transitions, requested by entry handlers.
+     */
+    static const uint8_t MAX_TRANSITIONS_IN_ROW = 2U * MAX_DEPTH;
+
+    HierarchicalState* m_currentState;                 /**< Current active leaf state */
+    HierarchicalState* m_pendingState;                 /**< Requested target state */
+    HsmEvent           m_eventQueue[EVENT_QUEUE_SIZE]; /**< Event queue */
+    uint8_t            m_eventRdIdx;                   /**< Read index of the event queue */
+    uint8_t            m_eventCount;                   /**< Number of pending events */
+    uint16_t           m_droppedEvents;                /**< Number of dropped events */
+
+#if (0 < CONFIG_HSM_TRACE_SIZE)
+    TraceEntry m_trace[TRACE_SIZE]; /**< Transition trace ring buffer */
+#endif /* (0 < CONFIG_HSM_TRACE_SIZE) */
+
+    uint8_t m_traceWrIdx;  /**< Write index of the trace buffer */
+    uint8_t m_traceLength; /**< Number of recorded transitions */
+
+    /**
+     * Perform all pending transitions.
+     *
+     * @param[in] eventId   Id of the event, which triggered the transitions.
+     */
+    void performTransitions(uint8_t eventId);
+
+    /**
+     * Perform a single transition from the current state to the target state.
+     *
+     * @param[in] target    Target state
+     */
+    void performTransition(HierarchicalState* target);
+
+    /**
+     * Get the nesting depth of a state, which is 1 for a top level state.
+     * The counting stops above MAX_DEPTH.
+     *
+     * @param[in] state The state.
+     *
+     * @return Nesting depth
+     */
+    static uint8_t getDepth(const HierarchicalState* state);
+
+    /**
+     * Is the state part of the path?
+     *
+     * @param[in] state The state to search for.
+     * @param[in] path  Path of states.
+     * @param[in] depth Number of states in the path.
+     *
+     * @return If the state is part of the path, it will return true otherwise false.
+     */
+    static bool isOnPath(const HierarchicalState* state, HierarchicalState* const* path, uint8_t depth);
+
+    /**
+     * Enter a single state.
+     *
+     * @param[in] state     State to enter.
+     * @param[in] timestamp Current timestamp in ms.
+     */
+    void enterState(HierarchicalState* state, uint32_t timestamp);
+
+    /**
+     * Leave a single state.
+     *
+     * @param[in] state     State to leave.
+     * @param[in] timestamp Current timestamp in ms.
+     */
+    void exitState(HierarchicalState* state, uint32_t timestamp);
+
+    /**
+     * Record a transition in the trace buffer.
+     *
+     * @param[in] source    Source leaf state
+     * @param[in] target    Target leaf state
+     * @param[in] eventId   Id of the triggering event.
+     * @param[in] timestamp Current timestamp in ms.
+     */
+    void addTrace(const HierarchicalState* source, const HierarchicalState* target, uint8_t eventId,
+                  uint32_t timestamp);
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] hsm Source instance.
+     */
+    HierarchicalStateMachine(const HierarchicalStateMachine& hsm);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] hsm Source instance.
+     *
+     * @returns Reference to HierarchicalStateMachine instance.
+     */
+    HierarchicalStateMachine& operator=(const HierarchicalStateMachine& hsm);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* HIERARCHICAL_STATE_MACHINE_H */
+/** @} */
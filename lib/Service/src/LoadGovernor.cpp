@@ -0,0 +1,152 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Load governor, which degrades optional work if the control deadline is at risk
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <LoadGovernor.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+LoadGovernor::LoadGovernor(int32_t minSlack) :
+    m_minSlack(minSlack),
+    m_level(LEVEL_NOMINAL),
+    m_cycles(0U),
+    m_criticalCycles(0U),
+    m_relaxedWindows(0U)
+{
+}
+
+bool LoadGovernor::update(int32_t slack)
+{
+    bool isChanged = false;
+
+    if (m_minSlack > slack)
+    {
+        ++m_criticalCycles;
+    }
+
+    ++m_cycles;
+
+    /* Degrade immediately, don't wait for the end of the window. */
+    if (DEGRADE_LIMIT <= m_criticalCycles)
+    {
+        if (LEVEL_MINIMAL > m_level)
+        {
+            m_level   = static_cast<Level>(m_level + 1U);
+            isChanged = true;
+        }
+
+        m_relaxedWindows = 0U;
+        restartWindow();
+    }
+    else if (WINDOW <= m_cycles)
+    {
+        if (0U == m_criticalCycles)
+        {
+            ++m_relaxedWindows;
+        }
+        else
+        {
+            m_relaxedWindows = 0U;
+        }
+
+        if (RESTORE_WINDOWS <= m_relaxedWindows)
+        {
+            if (LEVEL_NOMINAL < m_level)
+            {
+                m_level   = static_cast<Level>(m_level - 1U);
+                isChanged = true;
+            }
+
+            m_relaxedWindows = 0U;
+        }
+
+        restartWindow();
+    }
+    else
+    {
+        ;
+    }
+
+    return isChanged;
+}
+
+void LoadGovernor::reset()
+{
+    m_level          = LEVEL_NOMINAL;
+    m_relaxedWindows = 0U;
+    restartWindow();
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void LoadGovernor::restartWindow()
+{
+    m_cycles         = 0U;
+    m_criticalCycles = 0U;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
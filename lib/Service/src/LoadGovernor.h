@@ -0,0 +1,187 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Load governor, which degrades optional work if the control deadline is at risk
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup Service
+ *
+ * @{
+ */
+
+#ifndef LOAD_GOVERNOR_H
+#define LOAD_GOVERNOR_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+#ifndef CONFIG_LOAD_GOVERNOR_WINDOW
+/** Number of control cycles, which are evaluated together. */
+#define CONFIG_LOAD_GOVERNOR_WINDOW (40)
+#endif /* CONFIG_LOAD_GOVERNOR_WINDOW */
+
+#ifndef CONFIG_LOAD_GOVERNOR_DEGRADE_LIMIT
+/** Number of control cycles with too less slack in a window, which raise the degradation level. */
+#define CONFIG_LOAD_GOVERNOR_DEGRADE_LIMIT (4)
+#endif /* CONFIG_LOAD_GOVERNOR_DEGRADE_LIMIT */
+
+#ifndef CONFIG_LOAD_GOVERNOR_RESTORE_WINDOWS
+/** Number of windows in a row without any critical control cycle, which lower the degradation level. */
+#define CONFIG_LOAD_GOVERNOR_RESTORE_WINDOWS (5)
+#endif /* CONFIG_LOAD_GOVERNOR_RESTORE_WINDOWS */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The load governor observes the slack of a periodic control task, which is
+ * the remaining time between the end of its execution and the end of its
+ * period, i.e. its deadline.
+ *
+ * If the slack drops too often below a limit inside a window of control
+ * cycles, the control deadline is at risk and the degradation level is
+ * raised immediately. The application reacts on it by reducing or skipping
+ * optional work, e.g. sending telemetry.
+ *
+ * The level is lowered step by step, after several windows in a row had
+ * enough slack in every control cycle. This hysteresis avoids toggling
+ * between two levels.
+ */
+class LoadGovernor
+{
+public:
+    /** Degradation levels */
+    enum Level : uint8_t
+    {
+        LEVEL_NOMINAL = 0U, /**< Enough slack, everything runs nominal. */
+        LEVEL_REDUCED,      /**< Slack is getting low, optional work shall be reduced. */
+        LEVEL_MINIMAL       /**< Control deadline is at risk, only the necessary work shall run. */
+    };
+
+    /** Number of control cycles, which are evaluated together. */
+    static const uint8_t WINDOW = CONFIG_LOAD_GOVERNOR_WINDOW;
+
+    /** Number of critical control cycles in a window, which raise the degradation level. */
+    static const uint8_t DEGRADE_LIMIT = CONFIG_LOAD_GOVERNOR_DEGRADE_LIMIT;
+
+    /** Number of windows in a row without critical control cycle, which lower the degradation level. */
+    static const uint8_t RESTORE_WINDOWS = CONFIG_LOAD_GOVERNOR_RESTORE_WINDOWS;
+
+    /**
+     * Constructs the load governor.
+     *
+     * @param[in] minSlack  Min. slack in us. A control cycle with less slack is critical.
+     */
+    explicit LoadGovernor(int32_t minSlack);
+
+    /**
+     * Destroys the load governor.
+     */
+    ~LoadGovernor()
+    {
+    }
+
+    /**
+     * Update the governor with the slack of the current control cycle.
+     * Call it once per control cycle.
+     *
+     * @param[in] slack Time in us between the end of the control task and its deadline.
+     *                  It is negative, if the deadline was missed.
+     *
+     * @return If the degradation level changed, it will return true otherwise false.
+     */
+    bool update(int32_t slack);
+
+    /**
+     * Get the current degradation level.
+     *
+     * @return Degradation level
+     */
+    Level getLevel() const
+    {
+        return m_level;
+    }
+
+    /**
+     * Reset to nominal level and restart the evaluation.
+     */
+    void reset();
+
+private:
+    int32_t m_minSlack;       /**< Min. slack in us of a non-critical control cycle. */
+    Level   m_level;          /**< Current degradation level. */
+    uint8_t m_cycles;         /**< Number of evaluated control cycles in the current window. */
+    uint8_t m_criticalCycles; /**< Number of critical control cycles in the current window. */
+    uint8_t m_relaxedWindows; /**< Number of windows in a row without critical control cycle. */
+
+    /**
+     * Start a new window.
+     */
+    void restartWindow();
+
+    /**
+     * Default constructor.
+     * Not allowed.
+     */
+    LoadGovernor();
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] governor Source instance.
+     */
+    LoadGovernor(const LoadGovernor& governor);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] governor Source instance.
+     *
+     * @returns Reference to LoadGovernor instance.
+     */
+    LoadGovernor& operator=(const LoadGovernor& governor);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* LOAD_GOVERNOR_H */
+/** @} */
@@ -46,10 +46,26 @@
  * Types and classes
  *****************************************************************************/
 
+/** Runtime log level of a single log tag. */
+typedef struct
+{
+    uint16_t tagId; /**< Log tag id */
+    uint8_t  level; /**< Severity level, see Logging::LogLevel */
+
+} LevelEntry;
+
 /******************************************************************************
  * Prototypes
  *****************************************************************************/
 
+static bool isDefaultTag(const char* tag);
+static bool findLevelEntry(uint16_t tagId, uint8_t& index);
+
+#if (0 != CONFIG_LOG_LEVEL_CMD)
+static void processLevelCmd();
+static bool handleLevelCmd(char* cmd);
+#endif /* (0 != CONFIG_LOG_LEVEL_CMD) */
+
 /******************************************************************************
  * Local Variables
  *****************************************************************************/
@@ -59,6 +75,37 @@
  */
 static bool gIsLogEnabled = true;
 
+/**
+ * Is the current log message enabled? It is set by the runtime log level check
+ * and used for the log message parts and the tail.
+ */
+static bool gIsMsgEnabled = true;
+
+/** Default log level of all log tags without individual log level. */
+static Logging::LogLevel gDefaultLevel = Logging::LOG_LEVEL_DEBUG;
+
+/** Log tags with individual runtime log level. */
+static LevelEntry gLevelTable[CONFIG_LOG_LEVEL_TABLE_SIZE];
+
+/** Number of used entries in the level table. */
+static uint8_t gLevelTableCount = 0U;
+
+/** Severity level identifiers, used by the log output and the serial command. */
+static const char LEVEL_IDS[] = "FEWID";
+
+#if (0 != CONFIG_LOG_LEVEL_CMD)
+
+/** Max. length of a serial command line, incl. termination. */
+static const uint8_t CMD_LINE_SIZE = 24U;
+
+/** Serial command line buffer. */
+static char gCmdLine[CMD_LINE_SIZE];
+
+/** Number of characters in the serial command line buffer. */
+static uint8_t gCmdLineLength = 0U;
+
+#endif /* (0 != CONFIG_LOG_LEVEL_CMD) */
+
 /******************************************************************************
  * Public Methods
  *****************************************************************************/
@@ -90,52 +137,109 @@ void Logging::disable()
     gIsLogEnabled = false;
 }
 
-void Logging::printHead(const char* filename, int lineNumber, Logging::LogLevel level)
+bool Logging::isEnabled(uint16_t tagId, LogLevel level)
 {
-    if (true == isEnabled())
+    bool isMsgEnabled = false;
+
+    if (true == gIsLogEnabled)
     {
-        const char* levelStr = "U";
+        uint8_t  index     = 0U;
+        LogLevel threshold = gDefaultLevel;
 
-        switch (level)
+        if (true == findLevelEntry(tagId, index))
         {
-        case Logging::LOG_LEVEL_FATAL:
-            levelStr = "F";
-            break;
+            threshold = static_cast<LogLevel>(gLevelTable[index].level);
+        }
+
+        isMsgEnabled = (level <= threshold);
+    }
 
-        case Logging::LOG_LEVEL_ERROR:
-            levelStr = "E";
-            break;
+    gIsMsgEnabled = isMsgEnabled;
 
-        case Logging::LOG_LEVEL_WARNING:
-            levelStr = "W";
-            break;
+    return isMsgEnabled;
+}
 
-        case Logging::LOG_LEVEL_INFO:
-            levelStr = "I";
-            break;
+bool Logging::setLevel(const char* tag, LogLevel level)
+{
+    bool isSuccessful = true;
 
-        case Logging::LOG_LEVEL_DEBUG:
-            levelStr = "D";
-            break;
+    if (true == isDefaultTag(tag))
+    {
+        gDefaultLevel = level;
+    }
+    else
+    {
+        uint16_t tagId = BinaryLog::getTagId(tag);
+        uint8_t  index = 0U;
 
-        default:
-            break;
+        if (true == findLevelEntry(tagId, index))
+        {
+            gLevelTable[index].level = level;
+        }
+        else if (CONFIG_LOG_LEVEL_TABLE_SIZE > gLevelTableCount)
+        {
+            gLevelTable[gLevelTableCount].tagId = tagId;
+            gLevelTable[gLevelTableCount].level = level;
+            ++gLevelTableCount;
+        }
+        else
+        {
+            isSuccessful = false;
+        }
+    }
+
+    return isSuccessful;
+}
+
+Logging::LogLevel Logging::getLevel(const char* tag)
+{
+    LogLevel level = gDefaultLevel;
+    uint8_t  index = 0U;
+
+    if ((false == isDefaultTag(tag)) && (true == findLevelEntry(BinaryLog::getTagId(tag), index)))
+    {
+        level = static_cast<LogLevel>(gLevelTable[index].level);
+    }
+
+    return level;
+}
+
+void Logging::process()
+{
+#if (0 != CONFIG_LOG_BINARY)
+    BinaryLog::process();
+#endif /* (0 != CONFIG_LOG_BINARY) */
+
+#if (0 != CONFIG_LOG_LEVEL_CMD)
+    processLevelCmd();
+#endif /* (0 != CONFIG_LOG_LEVEL_CMD) */
+}
+
+void Logging::printHead(LogString filename, int lineNumber, Logging::LogLevel level)
+{
+    if (true == isEnabled())
+    {
+        char levelId = 'U';
+
+        if ((sizeof(LEVEL_IDS) - 1U) > static_cast<size_t>(level))
+        {
+            levelId = LEVEL_IDS[level];
         }
 
         Serial.print(static_cast<uint32_t>(millis()));
-        Serial.print(" ");
-        Serial.print(levelStr);
-        Serial.print(" ");
+        Serial.print(' ');
+        Serial.print(levelId);
+        Serial.print(' ');
         Serial.print(filename);
-        Serial.print(":");
+        Serial.print(':');
         Serial.print(lineNumber);
-        Serial.print(" ");
+        Serial.print(' ');
     }
 }
 
 void Logging::printMsg(const char* message)
 {
-    if (true == isEnabled())
+    if ((true == isEnabled()) && (true == gIsMsgEnabled))
     {
         Serial.print(message);
     }
@@ -143,13 +247,13 @@ void Logging::printMsg(const char* message)
 
 void Logging::printTail()
 {
-    if (true == isEnabled())
+    if ((true == isEnabled()) && (true == gIsMsgEnabled))
     {
         Serial.print("\n");
     }
 }
 
-void Logging::print(const char* filename, int lineNumber, Logging::LogLevel level, const char* message)
+void Logging::print(LogString filename, int lineNumber, Logging::LogLevel level, LogString message)
 {
     if (true == isEnabled())
     {
@@ -161,3 +265,116 @@ void Logging::print(const char* filename, int lineNumber, Logging::LogLevel leve
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
+
+/**
+ * Does the log tag address the default log level?
+ *
+ * @param[in] tag   The log tag.
+ *
+ * @return If it is the default log tag, it will return true otherwise false.
+ */
+static bool isDefaultTag(const char* tag)
+{
+    return (nullptr == tag) || (0 == strcmp(tag, "*"));
+}
+
+/**
+ * Find the level table entry of a log tag.
+ *
+ * @param[in]  tagId    The log tag id.
+ * @param[out] index    Index of the level table entry.
+ *
+ * @return If found, it will return true otherwise false.
+ */
+static bool findLevelEntry(uint16_t tagId, uint8_t& index)
+{
+    bool    isFound = false;
+    uint8_t idx     = 0U;
+
+    while ((gLevelTableCount > idx) && (false == isFound))
+    {
+        if (tagId == gLevelTable[idx].tagId)
+        {
+            index   = idx;
+            isFound = true;
+        }
+        else
+        {
+            ++idx;
+        }
+    }
+
+    return isFound;
+}
+
+#if (0 != CONFIG_LOG_LEVEL_CMD)
+
+/**
+ * Receive the serial command line without blocking and handle it, if complete.
+ */
+static void processLevelCmd()
+{
+    while (0 < Serial.available())
+    {
+        int character = Serial.read();
+
+        if (('\n' == character) || ('\r' == character))
+        {
+            /* A too long command line is discarded. */
+            if ((0U < gCmdLineLength) && (CMD_LINE_SIZE > gCmdLineLength))
+            {
+                gCmdLine[gCmdLineLength] = '\0';
+
+                (void)handleLevelCmd(gCmdLine);
+            }
+
+            gCmdLineLength = 0U;
+        }
+        else if ((CMD_LINE_SIZE - 1U) > gCmdLineLength)
+        {
+            gCmdLine[gCmdLineLength] = static_cast<char>(character);
+            ++gCmdLineLength;
+        }
+        else
+        {
+            /* Mark the command line as too long. */
+            gCmdLineLength = CMD_LINE_SIZE;
+        }
+    }
+}
+
+/**
+ * Handle the serial command to change the runtime log level.
+ * Format: "log <tag> <level>", with the tag or "*" for the default log level
+ * and the level as single character: F, E, W, I or D.
+ *
+ * @param[in] cmd   Command line, which is modified during parsing.
+ *
+ * @return If successful handled, it will return true otherwise false.
+ */
+static bool handleLevelCmd(char* cmd)
+{
+    bool         isSuccessful  = false;
+    const char   CMD_PREFIX[]  = "log ";
+    const size_t PREFIX_LENGTH = sizeof(CMD_PREFIX) - 1U;
+    size_t       length        = strlen(cmd);
+
+    /* Minimum: prefix, tag with one character, space and level identifier. */
+    if (((PREFIX_LENGTH + 3U) <= length) && (0 == strncmp(cmd, CMD_PREFIX, PREFIX_LENGTH)) &&
+        (' ' == cmd[length - 2U]))
+    {
+        const char* levelId = strchr(LEVEL_IDS, cmd[length - 1U]);
+
+        if ((nullptr != levelId) && ('\0' != *levelId))
+        {
+            cmd[length - 2U] = '\0';
+
+            isSuccessful =
+                Logging::setLevel(&cmd[PREFIX_LENGTH], static_cast<Logging::LogLevel>(levelId - LEVEL_IDS));
+        }
+    }
+
+    return isSuccessful;
+}
+
+#endif /* (0 != CONFIG_LOG_LEVEL_CMD) */
@@ -65,19 +65,166 @@
 #define LOG_DEBUG_ENABLE (0)
 #endif /* LOG_DEBUG_ENABLE */
 
+#ifndef CONFIG_LOG_BINARY
+/**
+ * Enable/disable the deferred binary logging backend. If enabled, the log
+ * messages are not formatted on the robot, instead compact binary records
+ * are buffered and sent by Logging::process(). Use scripts/decode_binary_log.py
+ * on the host to get the text log.
+ */
+#define CONFIG_LOG_BINARY (0)
+#endif /* CONFIG_LOG_BINARY */
+
+#ifndef CONFIG_LOG_FLASH_STRINGS
+#ifdef TARGET_NATIVE
+/** Keep the log tags and log messages in RAM, because there is no separate program memory. */
+#define CONFIG_LOG_FLASH_STRINGS (0)
+#else /* TARGET_NATIVE */
+/** Keep the log tags and log messages in the program memory (PROGMEM) to save RAM. */
+#define CONFIG_LOG_FLASH_STRINGS (1)
+#endif /* TARGET_NATIVE */
+#endif /* CONFIG_LOG_FLASH_STRINGS */
+
+#ifndef CONFIG_LOG_LEVEL_TABLE_SIZE
+/** Max. number of log tags with an individual runtime log level. */
+#define CONFIG_LOG_LEVEL_TABLE_SIZE (4)
+#endif /* CONFIG_LOG_LEVEL_TABLE_SIZE */
+
+#ifndef CONFIG_LOG_LEVEL_CMD
+/**
+ * Enable/disable the serial command to change the runtime log level,
+ * e.g. "log RState D" or "log * W" for all log tags without individual level.
+ */
+#define CONFIG_LOG_LEVEL_CMD (1)
+#endif /* CONFIG_LOG_LEVEL_CMD */
+
 /******************************************************************************
  * Includes
  *****************************************************************************/
 #include <Arduino.h>
+#include "BinaryLog.h"
 
 /******************************************************************************
  * Macros
  *****************************************************************************/
 
+#if (0 == CONFIG_LOG_FLASH_STRINGS)
+
+/** Log string literal. */
+#define LOG_STR(_str)   (_str)
+
+/** Convert a string in program memory to a log string. */
+#define LOG_FLASH(_str) (_str)
+
+#else /* (0 == CONFIG_LOG_FLASH_STRINGS) */
+
+/** Log string literal, which is located in the program memory. */
+#define LOG_STR(_str)   F(_str)
+
+/** Convert a string in program memory to a log string. */
+#define LOG_FLASH(_str) reinterpret_cast<Logging::LogString>(_str)
+
+#endif /* (0 == CONFIG_LOG_FLASH_STRINGS) */
+
 #if LOG_FATAL_ENABLE || LOG_ERROR_ENABLE || LOG_WARNING_ENABLE || LOG_INFO_ENABLE || LOG_DEBUG_ENABLE
 
-/** Define the logging tag to know in which file the log message is located. */
-#define LOG_TAG(_tag) static const char* LOG_TAG = _tag
+/** Is the log message with the given severity level enabled at runtime? */
+#define LOG_IS_ENABLED(_level) Logging::isEnabled(LOG_TAG_ID, (_level))
+
+#if (0 == CONFIG_LOG_BINARY)
+
+/**
+ * Define the logging tag to know in which file the log message is located.
+ * The tag id is used to find the runtime log level.
+ */
+#define LOG_TAG(_tag)                                                \
+    static const char LOG_TAG_STR[] PROGMEM = _tag;                  \
+    static constexpr uint16_t LOG_TAG_ID = BinaryLog::getTagId(_tag)
+
+/** Log message with the given severity level. */
+#define LOG_PRINT(_level, _msg)                                                        \
+    do                                                                                 \
+    {                                                                                  \
+        if (true == LOG_IS_ENABLED(_level))                                            \
+        {                                                                              \
+            Logging::print(LOG_FLASH(LOG_TAG_STR), __LINE__, (_level), LOG_STR(_msg)); \
+        }                                                                              \
+    } while (0)
+
+/** Log message with the given severity level and additional value. */
+#define LOG_PRINT_VAL(_level, _msg, _val)                                                      \
+    do                                                                                         \
+    {                                                                                          \
+        if (true == LOG_IS_ENABLED(_level))                                                    \
+        {                                                                                      \
+            Logging::print(LOG_FLASH(LOG_TAG_STR), __LINE__, (_level), LOG_STR(_msg), (_val)); \
+        }                                                                                      \
+    } while (0)
+
+/** Log header with the given severity level. The following message parts and tail depend on it. */
+#define LOG_PRINT_HEAD(_level)                                              \
+    do                                                                      \
+    {                                                                       \
+        if (true == LOG_IS_ENABLED(_level))                                 \
+        {                                                                   \
+            Logging::printHead(LOG_FLASH(LOG_TAG_STR), __LINE__, (_level)); \
+        }                                                                   \
+    } while (0)
+
+/** Log message, without line feed. */
+#define LOG_PRINT_MSG(_msg) Logging::printMsg(_msg)
+
+/** Log tail. */
+#define LOG_PRINT_TAIL()    Logging::printTail()
+
+#else /* (0 == CONFIG_LOG_BINARY) */
+
+/**
+ * Define the logging tag to know in which file the log message is located.
+ * In binary mode only its id is kept, the tag string itself is not part of the firmware.
+ */
+#define LOG_TAG(_tag) static constexpr uint16_t LOG_TAG_ID = BinaryLog::getTagId(_tag)
+
+/** Log message with the given severity level. The message is resolved by the host decoder. */
+#define LOG_PRINT(_level, _msg)                                              \
+    do                                                                       \
+    {                                                                        \
+        if (true == LOG_IS_ENABLED(_level))                                  \
+        {                                                                    \
+            BinaryLog::write(BinaryLog::getMessageId(LOG_TAG_ID, __LINE__)); \
+        }                                                                    \
+    } while (0)
+
+/** Log message with the given severity level and additional value. The message is resolved by the host decoder. */
+#define LOG_PRINT_VAL(_level, _msg, _val)                                            \
+    do                                                                               \
+    {                                                                                \
+        if (true == LOG_IS_ENABLED(_level))                                          \
+        {                                                                            \
+            BinaryLog::write(BinaryLog::getMessageId(LOG_TAG_ID, __LINE__), (_val)); \
+        }                                                                            \
+    } while (0)
+
+/**
+ * Log header with the given severity level. If the level is disabled, no record
+ * is started and the following message parts and tail are discarded.
+ */
+#define LOG_PRINT_HEAD(_level)                                               \
+    do                                                                       \
+    {                                                                        \
+        if (true == LOG_IS_ENABLED(_level))                                  \
+        {                                                                    \
+            BinaryLog::begin(BinaryLog::getMessageId(LOG_TAG_ID, __LINE__)); \
+        }                                                                    \
+    } while (0)
+
+/** Log message, without line feed. It is added as string argument to the record. */
+#define LOG_PRINT_MSG(_msg) BinaryLog::addArg(_msg)
+
+/** Log tail. */
+#define LOG_PRINT_TAIL()    BinaryLog::commit()
+
+#endif /* (0 == CONFIG_LOG_BINARY) */
 
 #else /* LOG_FATAL_ENABLE || LOG_ERROR_ENABLE || LOG_WARNING_ENABLE || LOG_INFO_ENABLE || LOG_DEBUG_ENABLE */
 
@@ -102,19 +249,19 @@
 #else /* (0 == LOG_FATAL_ENABLE) */
 
 /** Log fatal error message. */
-#define LOG_FATAL(_msg)           Logging::print(LOG_TAG, __LINE__, Logging::LOG_LEVEL_FATAL, (_msg))
+#define LOG_FATAL(_msg)           LOG_PRINT(Logging::LOG_LEVEL_FATAL, _msg)
 
 /** Log fatal error message with additional value. */
-#define LOG_FATAL_VAL(_msg, _val) Logging::print<_val>(LOG_TAG, __LINE__, Logging::LOG_LEVEL_FATAL, (_msg), (_val))
+#define LOG_FATAL_VAL(_msg, _val) LOG_PRINT_VAL(Logging::LOG_LEVEL_FATAL, _msg, _val)
 
 /** Log fatal error header. */
-#define LOG_FATAL_HEAD()          Logging::printHead(LOG_TAG, __LINE__, Logging::LOG_LEVEL_FATAL)
+#define LOG_FATAL_HEAD()          LOG_PRINT_HEAD(Logging::LOG_LEVEL_FATAL)
 
 /** Log fatal error message, without line feed. */
-#define LOG_FATAL_MSG(_msg)       Logging::printMsg(_msg)
+#define LOG_FATAL_MSG(_msg)       LOG_PRINT_MSG(_msg)
 
 /** Log fatal error tail. */
-#define LOG_FATAL_TAIL()          Logging::printTail()
+#define LOG_FATAL_TAIL()          LOG_PRINT_TAIL()
 
 #endif /* (0 == LOG_FATAL_ENABLE) */
 
@@ -134,19 +281,19 @@
 #else /* (0 == LOG_ERROR_ENABLE) */
 
 /** Log error message. */
-#define LOG_ERROR(_msg)           Logging::print(LOG_TAG, __LINE__, Logging::LOG_LEVEL_ERROR, (_msg))
+#define LOG_ERROR(_msg)           LOG_PRINT(Logging::LOG_LEVEL_ERROR, _msg)
 
 /** Log error message with additional value. */
-#define LOG_ERROR_VAL(_msg, _val) Logging::print(LOG_TAG, __LINE__, Logging::LOG_LEVEL_ERROR, (_msg), (_val))
+#define LOG_ERROR_VAL(_msg, _val) LOG_PRINT_VAL(Logging::LOG_LEVEL_ERROR, _msg, _val)
 
 /** Log error header. */
-#define LOG_ERROR_HEAD()          Logging::printHead(LOG_TAG, __LINE__, Logging::LOG_LEVEL_ERROR)
+#define LOG_ERROR_HEAD()          LOG_PRINT_HEAD(Logging::LOG_LEVEL_ERROR)
 
 /** Log error error message, without line feed. */
-#define LOG_ERROR_MSG(_msg)       Logging::printMsg(_msg)
+#define LOG_ERROR_MSG(_msg)       LOG_PRINT_MSG(_msg)
 
 /** Log error tail. */
-#define LOG_ERROR_TAIL()          Logging::printTail()
+#define LOG_ERROR_TAIL()          LOG_PRINT_TAIL()
 
 #endif /* (0 == LOG_ERROR_ENABLE) */
 
@@ -166,19 +313,19 @@
 #else /* (0 == LOG_WARNING_ENABLE) */
 
 /** Log warning message. */
-#define LOG_WARNING(_msg)           Logging::print(LOG_TAG, __LINE__, Logging::LOG_LEVEL_WARNING, (_msg))
+#define LOG_WARNING(_msg)           LOG_PRINT(Logging::LOG_LEVEL_WARNING, _msg)
 
 /** Log warning message with additional value. */
-#define LOG_WARNING_VAL(_msg, _val) Logging::print(LOG_TAG, __LINE__, Logging::LOG_LEVEL_WARNING, (_msg), (_val))
+#define LOG_WARNING_VAL(_msg, _val) LOG_PRINT_VAL(Logging::LOG_LEVEL_WARNING, _msg, _val)
 
 /** Log warning header. */
-#define LOG_WARNING_HEAD()          Logging::printHead(LOG_TAG, __LINE__, Logging::LOG_LEVEL_WARNING)
+#define LOG_WARNING_HEAD()          LOG_PRINT_HEAD(Logging::LOG_LEVEL_WARNING)
 
 /** Log warning message, without line feed. */
-#define LOG_WARNING_MSG(_msg)       Logging::printMsg(_msg)
+#define LOG_WARNING_MSG(_msg)       LOG_PRINT_MSG(_msg)
 
 /** Log warning tail. */
-#define LOG_WARNING_TAIL()          Logging::printTail()
+#define LOG_WARNING_TAIL()          LOG_PRINT_TAIL()
 
 #endif /* (0 == LOG_WARNING_ENABLE) */
 
@@ -198,19 +345,19 @@
 #else /* (0 == LOG_INFO_ENABLE) */
 
 /** Log info message. */
-#define LOG_INFO(_msg)           Logging::print(LOG_TAG, __LINE__, Logging::LOG_LEVEL_INFO, (_msg))
+#define LOG_INFO(_msg)           LOG_PRINT(Logging::LOG_LEVEL_INFO, _msg)
 
 /** Log info message with additional value. */
-#define LOG_INFO_VAL(_msg, _val) Logging::print(LOG_TAG, __LINE__, Logging::LOG_LEVEL_INFO, (_msg), (_val))
+#define LOG_INFO_VAL(_msg, _val) LOG_PRINT_VAL(Logging::LOG_LEVEL_INFO, _msg, _val)
 
 /** Log info header. */
-#define LOG_INFO_HEAD()          Logging::printHead(LOG_TAG, __LINE__, Logging::LOG_LEVEL_INFO)
+#define LOG_INFO_HEAD()          LOG_PRINT_HEAD(Logging::LOG_LEVEL_INFO)
 
 /** Log info message, without line feed. */
-#define LOG_INFO_MSG(_msg)       Logging::printMsg(_msg)
+#define LOG_INFO_MSG(_msg)       LOG_PRINT_MSG(_msg)
 
 /** Log info tail. */
-#define LOG_INFO_TAIL()          Logging::printTail()
+#define LOG_INFO_TAIL()          LOG_PRINT_TAIL()
 
 #endif /* (0 == LOG_INFO_ENABLE) */
 
@@ -230,19 +377,19 @@
 #else /* (0 == LOG_DEBUG_ENABLE) */
 
 /** Log debug message. */
-#define LOG_DEBUG(_msg)           Logging::print(LOG_TAG, __LINE__, Logging::LOG_LEVEL_DEBUG, (_msg))
+#define LOG_DEBUG(_msg)           LOG_PRINT(Logging::LOG_LEVEL_DEBUG, _msg)
 
 /** Log debug message with additional value. */
-#define LOG_DEBUG_VAL(_msg, _val) Logging::print(LOG_TAG, __LINE__, Logging::LOG_LEVEL_DEBUG, (_msg), (_val))
+#define LOG_DEBUG_VAL(_msg, _val) LOG_PRINT_VAL(Logging::LOG_LEVEL_DEBUG, _msg, _val)
 
 /** Log debug header. */
-#define LOG_DEBUG_HEAD()          Logging::printHead(LOG_TAG, __LINE__, Logging::LOG_LEVEL_DEBUG)
+#define LOG_DEBUG_HEAD()          LOG_PRINT_HEAD(Logging::LOG_LEVEL_DEBUG)
 
 /** Log debug message, without line feed. */
-#define LOG_DEBUG_MSG(_msg)       Logging::printMsg(_msg)
+#define LOG_DEBUG_MSG(_msg)       LOG_PRINT_MSG(_msg)
 
 /** Log debug tail. */
-#define LOG_DEBUG_TAIL()          Logging::printTail()
+#define LOG_DEBUG_TAIL()          LOG_PRINT_TAIL()
 
 #endif /* (0 == LOG_DEBUG_ENABLE) */
 
@@ -268,6 +415,14 @@ namespace Logging
         LOG_LEVEL_DEBUG,   /**< A diagnostic message helpful for the developer. */
     };
 
+#if (0 == CONFIG_LOG_FLASH_STRINGS)
+    /** Log string, which is located in RAM. */
+    typedef const char* LogString;
+#else  /* (0 == CONFIG_LOG_FLASH_STRINGS) */
+    /** Log string, which is located in the program memory. */
+    typedef const __FlashStringHelper* LogString;
+#endif /* (0 == CONFIG_LOG_FLASH_STRINGS) */
+
     /**
      * Is logging enabled?
      *
@@ -285,6 +440,46 @@ namespace Logging
      */
     void disable();
 
+    /**
+     * Is the log message of the log tag with the given severity level enabled?
+     * The decision is kept for the following printMsg() and printTail() calls,
+     * which belong to the same log message.
+     *
+     * @param[in] tagId The log tag id, see BinaryLog::getTagId().
+     * @param[in] level The severity level of the log message.
+     *
+     * @return If enabled, it will return true otherwise false.
+     */
+    bool isEnabled(uint16_t tagId, LogLevel level);
+
+    /**
+     * Set the runtime log level of a log tag. All log messages up to this
+     * severity level are logged, if they are enabled at compile time.
+     *
+     * @param[in] tag   The log tag. Use nullptr or "*" to set the default log level
+     *                  of all log tags without individual log level.
+     * @param[in] level The severity level.
+     *
+     * @return If successful, it will return true otherwise false, because the level table is full.
+     */
+    bool setLevel(const char* tag, LogLevel level);
+
+    /**
+     * Get the runtime log level of a log tag.
+     *
+     * @param[in] tag   The log tag. Use nullptr or "*" to get the default log level.
+     *
+     * @return The severity level.
+     */
+    LogLevel getLevel(const char* tag);
+
+    /**
+     * Process the logging backend. In binary mode, the next part of the buffered
+     * log records is sent. If enabled, the serial command to change the runtime
+     * log level is handled too. Call it periodically in the main loop.
+     */
+    void process();
+
     /**
      * Print log message header.
      * Use printMsg() to log the message itself.
@@ -293,7 +488,7 @@ namespace Logging
      * @param[in] lineNumber    The line number in the file, where the log message is located.
      * @param[in] level         The severity level.
      */
-    void printHead(const char* filename, int lineNumber, LogLevel level);
+    void printHead(LogString filename, int lineNumber, LogLevel level);
 
     /**
      * Print message without line feed.
@@ -316,7 +511,7 @@ namespace Logging
      * @param[in] level         The severity level.
      * @param[in] message       The message itself.
      */
-    void print(const char* filename, int lineNumber, LogLevel level, const char* message);
+    void print(LogString filename, int lineNumber, LogLevel level, LogString message);
 
     /**
      * Print log message.
@@ -328,7 +523,7 @@ namespace Logging
      * @param[in] value         The value to print after the message.
      */
     template<typename T>
-    void print(const char* filename, int lineNumber, LogLevel level, const char* message, T value)
+    void print(LogString filename, int lineNumber, LogLevel level, LogString message, T value)
     {
         if (true == isEnabled())
         {
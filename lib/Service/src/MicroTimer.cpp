@@ -0,0 +1,135 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Simple timer with microsecond resolution
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <MicroTimer.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+void MicroTimer::start(Timebase::Duration duration)
+{
+    m_duration       = duration;
+    m_startTimestamp = Timebase::now();
+    m_isTimeout      = false;
+    m_isRunning      = true;
+}
+
+void MicroTimer::restart()
+{
+    m_startTimestamp = Timebase::now();
+    m_isTimeout      = false;
+    m_isRunning      = true;
+}
+
+void MicroTimer::restartPeriodic()
+{
+    m_startTimestamp += m_duration;
+    m_isTimeout      = false;
+    m_isRunning      = true;
+}
+
+void MicroTimer::stop()
+{
+    m_isTimeout = false;
+    m_isRunning = false;
+}
+
+bool MicroTimer::isRunning() const
+{
+    return m_isRunning;
+}
+
+bool MicroTimer::isTimeout()
+{
+    bool isTimeout = false;
+
+    if (true == m_isRunning)
+    {
+        if (false == m_isTimeout)
+        {
+            Timebase::Duration delta = getCurrentDuration();
+
+            if (m_duration <= delta)
+            {
+                m_isTimeout = true;
+            }
+        }
+
+        isTimeout = m_isTimeout;
+    }
+
+    return isTimeout;
+}
+
+Timebase::Duration MicroTimer::getCurrentDuration() const
+{
+    return Timebase::getElapsed(m_startTimestamp);
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,240 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Motion script, which is executed locally
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "MotionScript.h"
+#include <Arduino.h>
+#include <FPMath.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+MotionScript::MotionScript() :
+    m_steps(),
+    m_length(0U),
+    m_isRunning(false),
+    m_isFinished(false),
+    m_currentStep(0U),
+    m_stepStartTimestamp(0U),
+    m_stepStartMileage(0U),
+    m_lastOrientation(0),
+    m_turnedAngle(0)
+{
+}
+
+void MotionScript::clear()
+{
+    m_length      = 0U;
+    m_isRunning   = false;
+    m_isFinished  = false;
+    m_currentStep = 0U;
+}
+
+bool MotionScript::addStep(const Step& step)
+{
+    bool isSuccessful = false;
+
+    if ((false == m_isRunning) && (MAX_STEPS > m_length) && (STEP_TYPE_COUNT > step.type))
+    {
+        m_steps[m_length] = step;
+        ++m_length;
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+bool MotionScript::start(uint32_t timestamp, uint32_t mileage, int32_t orientation)
+{
+    bool isSuccessful = false;
+
+    if ((false == m_isRunning) && (0U < m_length))
+    {
+        m_isRunning          = true;
+        m_isFinished         = false;
+        m_currentStep        = 0U;
+        m_stepStartTimestamp = timestamp;
+        m_stepStartMileage   = mileage;
+        m_lastOrientation    = orientation;
+        m_turnedAngle        = 0;
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+void MotionScript::stop()
+{
+    m_isRunning = false;
+}
+
+void MotionScript::process(uint32_t timestamp, uint32_t mileage, int32_t orientation, int16_t& linearSpeed,
+                           int16_t& angularSpeed)
+{
+    linearSpeed  = 0;
+    angularSpeed = 0;
+
+    if (true == m_isRunning)
+    {
+        int32_t delta = orientation - m_lastOrientation;
+
+        /* The orientation wraps around, therefore the turned angle is accumulated
+         * by the shortest angle between two processing cycles.
+         */
+        while (FP_PI() < delta)
+        {
+            delta -= FP_2PI();
+        }
+
+        while (-FP_PI() >= delta)
+        {
+            delta += FP_2PI();
+        }
+
+        m_turnedAngle += delta;
+        m_lastOrientation = orientation;
+
+        /* Several steps may end in the same cycle, e.g. steps without duration. */
+        while ((true == m_isRunning) && (true == isStepFinished(timestamp, mileage)))
+        {
+            nextStep(timestamp, mileage);
+        }
+
+        if (true == m_isRunning)
+        {
+            linearSpeed  = m_steps[m_currentStep].linearSpeed;
+            angularSpeed = m_steps[m_currentStep].angularSpeed;
+        }
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+bool MotionScript::isStepFinished(uint32_t timestamp, uint32_t mileage) const
+{
+    bool        isFinished = false;
+    const Step& step       = m_steps[m_currentStep];
+
+    switch (step.type)
+    {
+    case STEP_TYPE_TIMED:
+        isFinished = (0 >= step.target) || (static_cast<uint32_t>(step.target) <= (timestamp - m_stepStartTimestamp));
+        break;
+
+    case STEP_TYPE_DISTANCE:
+        isFinished = (static_cast<uint32_t>(abs(step.target)) <= (mileage - m_stepStartMileage));
+        break;
+
+    case STEP_TYPE_ANGLE:
+        isFinished = (abs(step.target) <= abs(m_turnedAngle));
+        break;
+
+    default:
+        /* Unknown step types are skipped. */
+        isFinished = true;
+        break;
+    }
+
+    return isFinished;
+}
+
+void MotionScript::nextStep(uint32_t timestamp, uint32_t mileage)
+{
+    const Step& step = m_steps[m_currentStep];
+
+    /* A timed step ends at its planned time, independent of the processing
+     * cycle. This avoids that the cycle jitter accumulates over the steps.
+     */
+    if ((STEP_TYPE_TIMED == step.type) && (0 < step.target))
+    {
+        m_stepStartTimestamp += static_cast<uint32_t>(step.target);
+    }
+    else if (STEP_TYPE_TIMED != step.type)
+    {
+        m_stepStartTimestamp = timestamp;
+    }
+    else
+    {
+        ;
+    }
+
+    m_stepStartMileage = mileage;
+    m_turnedAngle      = 0;
+
+    if (m_length > (m_currentStep + 1U))
+    {
+        ++m_currentStep;
+    }
+    else
+    {
+        m_isRunning  = false;
+        m_isFinished = true;
+    }
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,249 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Motion script, which is executed locally
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup Service
+ *
+ * @{
+ */
+
+#ifndef MOTION_SCRIPT_H
+#define MOTION_SCRIPT_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+#ifndef CONFIG_MOTION_SCRIPT_SIZE
+/**
+ * Max. number of steps in a motion script.
+ */
+#define CONFIG_MOTION_SCRIPT_SIZE (16U)
+#endif /* CONFIG_MOTION_SCRIPT_SIZE */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * A motion script is a sequence of steps with a linear and angular speed each.
+ * A step ends after its duration, after the driven distance or after the
+ * turned angle. The script is uploaded completely before it is started and
+ * then executed locally, independent of the link timing.
+ *
+ * The timed steps are chained without gaps: the next step starts at the
+ * planned end of the previous one, not at the processing cycle in which the
+ * end was detected.
+ *
+ * The turned angle is accumulated over the processing cycles, therefore the
+ * orientation shall change less than PI between two cycles.
+ */
+class MotionScript
+{
+public:
+    /** Step types, which define the end of a step. */
+    enum StepType : uint8_t
+    {
+        STEP_TYPE_TIMED = 0, /**< The step ends after the duration in [ms]. */
+        STEP_TYPE_DISTANCE,  /**< The step ends after the driven distance in [mm]. */
+        STEP_TYPE_ANGLE,     /**< The step ends after the turned angle in [mrad]. */
+        STEP_TYPE_COUNT      /**< Number of step types. */
+    };
+
+    /** A single step of a motion script. */
+    struct Step
+    {
+        StepType type;         /**< Step type */
+        int32_t  target;       /**< Duration in [ms], distance in [mm] or angle in [mrad], depending on the type. */
+        int16_t  linearSpeed;  /**< Linear speed in [mm/s] */
+        int16_t  angularSpeed; /**< Angular speed in [mrad/s] */
+    };
+
+    /** Max. number of steps in a motion script. */
+    static const uint8_t MAX_STEPS = CONFIG_MOTION_SCRIPT_SIZE;
+
+    /**
+     * Constructs an empty motion script.
+     */
+    MotionScript();
+
+    /**
+     * Destroys the motion script.
+     */
+    ~MotionScript()
+    {
+    }
+
+    /**
+     * Remove all steps. A running script is stopped.
+     */
+    void clear();
+
+    /**
+     * Append a step to the script. It is not possible while the script is running.
+     *
+     * @param[in] step  Step
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addStep(const Step& step);
+
+    /**
+     * Get the number of steps.
+     *
+     * @return Number of steps
+     */
+    uint8_t getLength() const
+    {
+        return m_length;
+    }
+
+    /**
+     * Start the script with the first step.
+     *
+     * @param[in] timestamp     Current timestamp in [ms].
+     * @param[in] mileage       Current mileage in [mm].
+     * @param[in] orientation   Current orientation in [mrad].
+     *
+     * @return If successful started, it will return true otherwise false.
+     */
+    bool start(uint32_t timestamp, uint32_t mileage, int32_t orientation);
+
+    /**
+     * Stop the script immediately.
+     */
+    void stop();
+
+    /**
+     * Is the script running?
+     *
+     * @return If running, it will return true otherwise false.
+     */
+    bool isRunning() const
+    {
+        return m_isRunning;
+    }
+
+    /**
+     * Is the script finished, because all steps are executed?
+     * It is reset by the next start.
+     *
+     * @return If finished, it will return true otherwise false.
+     */
+    bool isFinished() const
+    {
+        return m_isFinished;
+    }
+
+    /**
+     * Get the index of the current step.
+     *
+     * @return Step index
+     */
+    uint8_t getCurrentStep() const
+    {
+        return m_currentStep;
+    }
+
+    /**
+     * Process the script and get the speeds of the current step. It shall be
+     * called periodically.
+     *
+     * @param[in]  timestamp    Current timestamp in [ms].
+     * @param[in]  mileage      Current mileage in [mm].
+     * @param[in]  orientation  Current orientation in [mrad].
+     * @param[out] linearSpeed  Linear speed in [mm/s]. 0 if the script is not running.
+     * @param[out] angularSpeed Angular speed in [mrad/s]. 0 if the script is not running.
+     */
+    void process(uint32_t timestamp, uint32_t mileage, int32_t orientation, int16_t& linearSpeed,
+                 int16_t& angularSpeed);
+
+private:
+    Step     m_steps[MAX_STEPS];   /**< Steps of the script. */
+    uint8_t  m_length;             /**< Number of steps. */
+    bool     m_isRunning;          /**< Is the script running? */
+    bool     m_isFinished;         /**< Are all steps executed? */
+    uint8_t  m_currentStep;        /**< Index of the current step. */
+    uint32_t m_stepStartTimestamp; /**< Start timestamp of the current step in [ms]. */
+    uint32_t m_stepStartMileage;   /**< Mileage at the start of the current step in [mm]. */
+    int32_t  m_lastOrientation;    /**< Orientation of the last processing in [mrad]. */
+    int32_t  m_turnedAngle;        /**< Turned angle since the start of the current step in [mrad]. */
+
+    /**
+     * Is the current step finished?
+     *
+     * @param[in] timestamp Current timestamp in [ms].
+     * @param[in] mileage   Current mileage in [mm].
+     *
+     * @return If finished, it will return true otherwise false.
+     */
+    bool isStepFinished(uint32_t timestamp, uint32_t mileage) const;
+
+    /**
+     * Start the next step or finish the script after the last one.
+     *
+     * @param[in] timestamp Current timestamp in [ms].
+     * @param[in] mileage   Current mileage in [mm].
+     */
+    void nextStep(uint32_t timestamp, uint32_t mileage);
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] script    Source instance.
+     */
+    MotionScript(const MotionScript& script);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] script    Source instance.
+     *
+     * @returns Reference to MotionScript instance.
+     */
+    MotionScript& operator=(const MotionScript& script);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* MOTION_SCRIPT_H */
+/** @} */
@@ -72,6 +72,12 @@ void Odometry::process()
     uint16_t absStepsRight = abs(relStepsRight);             /* Positive amount of delta steps right*/
     bool     isNoMovement  = detectStandStill(absStepsLeft, absStepsRight);
 
+    /* Keep the orientation change of this processing, in case it shall be substituted. */
+    int32_t pendingOrientation = calculateOrientation(0, relStepsLeft, relStepsRight); /* [mrad] */
+
+    m_lastOrientationChange = pendingOrientation - m_pendingOrientation;
+    m_pendingOrientation    = pendingOrientation;
+
     /* Orientation shall not be calculated from stand still to driving,
      * because there can not be any orientation change before.
      */
@@ -115,6 +121,9 @@ void Odometry::process()
             absStepsLeft  = 0U; /* [steps] */
             absStepsRight = 0U; /* [steps] */
             m_relEncoders.clear();
+
+            /* The pending orientation change is part of the orientation now. */
+            m_pendingOrientation = 0; /* [mrad] */
         }
     }
     m_lastAbsRelEncStepsLeft  = absStepsLeft;  /* [steps] */
@@ -144,9 +153,27 @@ int32_t Odometry::getOrientation() const
     return calculateOrientation(m_orientation, relStepsLeft, relStepsRight);
 }
 
+void Odometry::substituteOrientationChange(int32_t turnAngle)
+{
+    int32_t turnAngleMRad = 0; /* [mrad] */
+
+    /* The remainder is kept, otherwise small turn angles would get lost. */
+    m_turnAngleRemainder += turnAngle;
+    turnAngleMRad = m_turnAngleRemainder / 1000;
+    m_turnAngleRemainder -= turnAngleMRad * 1000;
+
+    m_orientation += turnAngleMRad - m_lastOrientationChange;
+    m_orientation %= FP_2PI(); /* -2*PI < orientation < +2*PI */
+
+    /* Avoid substituting the same orientation change twice. */
+    m_lastOrientationChange = turnAngleMRad;
+}
+
 void Odometry::clearPosition()
 {
     m_relEncoders.clear();
+    m_lastOrientationChange   = 0;
+    m_pendingOrientation      = 0;
     m_lastAbsRelEncStepsLeft  = 0;
     m_lastAbsRelEncStepsRight = 0;
     m_posX                    = 0;
@@ -148,6 +148,16 @@ public:
         m_orientation %= FP_2PI();
     }
 
+    /**
+     * Substitute the orientation change of the last processing, which is derived
+     * from the encoders, with a turn angle measured by another sensor, e.g. the gyro.
+     * Use it in case of wheel slip, because then the encoders can not be trusted.
+     * It shall be called once after each processing.
+     *
+     * @param[in] turnAngle Turn angle since the last processing in urad.
+     */
+    void substituteOrientationChange(int32_t turnAngle);
+
     /**
      * Clear the position by setting (x, y) to (0, 0) mm.
      */
@@ -207,6 +217,15 @@ private:
     /** Absolute orientation in mrad. 0 mrad means the robot drives parallel to the y-axis.  */
     int32_t m_orientation;
 
+    /** Orientation change in mrad during the last processing, derived from the encoders. */
+    int32_t m_lastOrientationChange;
+
+    /** Orientation in mrad of the relative encoder steps, which are not considered in m_orientation yet. */
+    int32_t m_pendingOrientation;
+
+    /** Remainder in urad of the substituted turn angles, which is below 1 mrad. */
+    int32_t m_turnAngleRemainder;
+
     /** Absolute position on x-axis. Unit is mm. */
     int32_t m_posX;
 
@@ -234,6 +253,9 @@ private:
         m_mileage(0),
         m_relEncoders(Board::getInstance().getEncoders()),
         m_orientation(FP_PI() / 2), /* 90° - heading to north */
+        m_lastOrientationChange(0),
+        m_pendingOrientation(0),
+        m_turnAngleRemainder(0),
         m_posX(0),
         m_posY(0),
         m_countingXSteps(0),
@@ -44,6 +44,7 @@
  * Includes
  *****************************************************************************/
 #include <Arduino.h>
+#include <Timebase.h>
 
 /******************************************************************************
  * Macros
@@ -72,6 +73,9 @@ struct Type
 template<>
 struct Type<int8_t>
 {
+    /** Datatype with double width, used for intermediate results. */
+    typedef int16_t Wide;
+
     /** Enumeration used to determine the min. value. */
     enum Min
     {
@@ -93,6 +97,9 @@ struct Type<int8_t>
 template<>
 struct Type<int16_t>
 {
+    /** Datatype with double width, used for intermediate results. */
+    typedef int32_t Wide;
+
     /** Enumeration used to determine the min. value. */
     enum Min
     {
@@ -114,6 +121,9 @@ struct Type<int16_t>
 template<>
 struct Type<int32_t>
 {
+    /** Datatype with double width, used for intermediate results. */
+    typedef int64_t Wide;
+
     /** Enumeration used to determine the min. value. */
     enum Min
     {
@@ -168,7 +178,7 @@ public:
         m_lastError(0),
         m_integral(0),
         m_lastOutput(0),
-        m_sampleTime(SAMPLE_TIME_DEFAULT),
+        m_sampleTime(Timebase::fromMs(SAMPLE_TIME_DEFAULT)),
         m_resync(false),
         m_isDerivativeOnMeasurement(false),
         m_lastProcessValue(0)
@@ -207,7 +217,7 @@ public:
         m_lastError(0),
         m_integral(0),
         m_lastOutput(0),
-        m_sampleTime(SAMPLE_TIME_DEFAULT),
+        m_sampleTime(Timebase::fromMs(SAMPLE_TIME_DEFAULT)),
         m_resync(false),
         m_isDerivativeOnMeasurement(false),
         m_lastProcessValue(0)
@@ -315,29 +325,36 @@ public:
         }
 
         {
-            T error        = setpoint - processValue;
-            T proportional = (m_kPNumerator * error) / m_kPDenominator;
-            T integral     = (m_kINumeratorDT * (m_integral + error)) / m_kIDenominatorDT;
-            T derivative   = 0;
+            /* The factors with considered sample time may be greater than the
+             * factors itself. Therefore the integral and derivative part is
+             * calculated with double width to avoid an overflow.
+             */
+            typedef typename Type<T>::Wide Wide;
+
+            T    error        = setpoint - processValue;
+            T    proportional = (m_kPNumerator * error) / m_kPDenominator;
+            Wide integral =
+                (static_cast<Wide>(m_kINumeratorDT) * (static_cast<Wide>(m_integral) + error)) / m_kIDenominatorDT;
+            Wide derivative = 0;
 
             /* Avoid integral windup. */
-            integral = constrain(integral, m_min, m_max);
+            integral = constrain(integral, static_cast<Wide>(m_min), static_cast<Wide>(m_max));
 
             if (false == m_isDerivativeOnMeasurement)
             {
-                derivative = ((error - m_lastError) * m_kDNumeratorDT) / m_kDDenominatorDT;
+                derivative = ((static_cast<Wide>(error) - m_lastError) * m_kDNumeratorDT) / m_kDDenominatorDT;
             }
             else
             {
-                derivative = ((m_lastProcessValue - processValue) * m_kDNumeratorDT) / m_kDDenominatorDT;
+                derivative =
+                    ((static_cast<Wide>(m_lastProcessValue) - processValue) * m_kDNumeratorDT) / m_kDDenominatorDT;
             }
 
-            output = proportional + integral + derivative;
-
             /* Limit the controller output */
-            output = constrain(output, m_min, m_max);
+            output = static_cast<T>(constrain(proportional + integral + derivative, static_cast<Wide>(m_min),
+                                              static_cast<Wide>(m_max)));
 
-            m_integral         = integral;
+            m_integral         = static_cast<T>(integral);
             m_lastError        = error;
             m_lastOutput       = output;
             m_lastProcessValue = processValue;
@@ -402,19 +419,7 @@ public:
             m_kIDenominator = denominator;
 
             reduceFraction(m_kINumerator, m_kIDenominator);
-
-            if (0 == m_sampleTime)
-            {
-                m_kINumeratorDT   = m_kINumerator;
-                m_kIDenominatorDT = m_kIDenominator;
-            }
-            else
-            {
-                m_kINumeratorDT   = m_kINumerator;
-                m_kIDenominatorDT = m_kIDenominator * m_sampleTime;
-
-                reduceFraction(m_kINumeratorDT, m_kIDenominatorDT);
-            }
+            considerSampleTime(m_kINumerator, m_kIDenominator, m_kINumeratorDT, m_kIDenominatorDT);
         }
     }
 
@@ -445,19 +450,7 @@ public:
             m_kDDenominator = denominator;
 
             reduceFraction(m_kDNumerator, m_kDDenominator);
-
-            if (0 == m_sampleTime)
-            {
-                m_kDNumeratorDT   = m_kDNumerator;
-                m_kDDenominatorDT = m_kDDenominator;
-            }
-            else
-            {
-                m_kDNumeratorDT   = m_kDNumerator;
-                m_kDDenominatorDT = m_kDDenominator * m_sampleTime;
-
-                reduceFraction(m_kDNumeratorDT, m_kDDenominatorDT);
-            }
+            considerSampleTime(m_kDNumerator, m_kDDenominator, m_kDNumeratorDT, m_kDDenominatorDT);
         }
     }
 
@@ -486,9 +479,19 @@ public:
     /**
      * Get sample time (dT).
      *
-     * @return Sample time in ms
+     * @return Sample time in ms, rounded to the nearest ms.
      */
     uint32_t getSampleTime() const
+    {
+        return Timebase::toMs(m_sampleTime);
+    }
+
+    /**
+     * Get sample time (dT).
+     *
+     * @return Sample time in us
+     */
+    uint32_t getSampleTimeUs() const
     {
         return m_sampleTime;
     }
@@ -503,28 +506,29 @@ public:
      * @param[in]   sampleTime  Sample time in ms
      */
     void setSampleTime(uint32_t sampleTime)
+    {
+        setSampleTimeUs(Timebase::fromMs(sampleTime));
+    }
+
+    /**
+     * Set sample time (dT) in us.
+     * Note, internally the integral and derivative factors will be automatically
+     * adjusted. If they would overflow the datatype, the precision of the
+     * sample time is reduced. Therefore a coarse resolution, e.g. 100 us,
+     * keeps the sample time exact and avoids a recalculation by jitter.
+     *
+     * Ensure that the calculate() method is called once in this period.
+     *
+     * @param[in]   sampleTime  Sample time in us
+     */
+    void setSampleTimeUs(uint32_t sampleTime)
     {
         if (m_sampleTime != sampleTime)
         {
-            if (0 == sampleTime)
-            {
-                m_kINumeratorDT   = m_kINumerator;
-                m_kIDenominatorDT = m_kIDenominator;
-                m_kDNumeratorDT   = m_kDNumerator;
-                m_kDDenominatorDT = m_kDDenominator;
-            }
-            else
-            {
-                m_kINumeratorDT   = m_kINumerator;
-                m_kIDenominatorDT = m_kIDenominator * sampleTime;
-                m_kDNumeratorDT   = m_kDNumerator;
-                m_kDDenominatorDT = m_kDDenominator * sampleTime;
-
-                reduceFraction(m_kINumeratorDT, m_kIDenominatorDT);
-                reduceFraction(m_kDNumeratorDT, m_kDDenominatorDT);
-            }
-
             m_sampleTime = sampleTime;
+
+            considerSampleTime(m_kINumerator, m_kIDenominator, m_kINumeratorDT, m_kIDenominatorDT);
+            considerSampleTime(m_kDNumerator, m_kDDenominator, m_kDNumeratorDT, m_kDDenominatorDT);
         }
     }
 
@@ -576,7 +580,7 @@ private:
     T        m_lastError;                 /**< Last calculated error */
     T        m_integral;                  /**< Integral value */
     T        m_lastOutput;                /**< Last output value, which is used till next sample time. */
-    uint32_t m_sampleTime;                /**< Sample time period in ms */
+    uint32_t m_sampleTime;                /**< Sample time period in us */
     bool     m_resync;                    /**< A resync avoids a output bump */
     bool     m_isDerivativeOnMeasurement; /**< Enables/Disables derivative on measurement. */
     T        m_lastProcessValue;          /**< Last process value is used for derivative on measurement only. */
@@ -604,13 +608,74 @@ private:
 
         if (0 == m_kIDenominatorDT)
         {
-            m_kIDenominatorDT = m_sampleTime;
+            m_kIDenominatorDT = SAMPLE_TIME_DEFAULT;
         }
 
         if (0 == m_kDDenominatorDT)
         {
-            m_kDDenominatorDT = m_sampleTime;
+            m_kDDenominatorDT = SAMPLE_TIME_DEFAULT;
+        }
+    }
+
+    /**
+     * Calculate the factor with considered sample time: factor / dT[ms].
+     * If the factor would overflow the datatype, the precision of the sample
+     * time is reduced until it fits.
+     *
+     * @param[in]  numerator        Numerator of the factor
+     * @param[in]  denominator      Denominator of the factor (> 0)
+     * @param[out] numeratorDT      Numerator of the factor with considered sample time
+     * @param[out] denominatorDT    Denominator of the factor with considered sample time
+     */
+    void considerSampleTime(T numerator, T denominator, T& numeratorDT, T& denominatorDT)
+    {
+        if (0 == m_sampleTime)
+        {
+            numeratorDT   = numerator;
+            denominatorDT = denominator;
         }
+        else
+        {
+            /* factor / dT[ms] = (numerator * 1000) / (denominator * dT[us]) */
+            const uint32_t MAX_RESULT          = static_cast<uint32_t>(Type<T>::MAX_RESULT);
+            uint32_t       divisor             = calcUnsignedGreatestCommonDivisor(Timebase::US_PER_MS, m_sampleTime);
+            uint32_t       numeratorScale      = Timebase::US_PER_MS / divisor;
+            uint32_t       denominatorScale    = m_sampleTime / divisor;
+            uint32_t       absNumerator        = static_cast<uint32_t>((0 > numerator) ? -numerator : numerator);
+            uint32_t       maxNumeratorScale   = (0U == absNumerator) ? UINT32_MAX : (MAX_RESULT / absNumerator);
+            uint32_t       maxDenominatorScale = MAX_RESULT / static_cast<uint32_t>(denominator);
+
+            while ((maxNumeratorScale < numeratorScale) || (maxDenominatorScale < denominatorScale))
+            {
+                numeratorScale   = (numeratorScale + 1U) / 2U;
+                denominatorScale = (denominatorScale + 1U) / 2U;
+            }
+
+            numeratorDT   = numerator * static_cast<T>(numeratorScale);
+            denominatorDT = denominator * static_cast<T>(denominatorScale);
+
+            reduceFraction(numeratorDT, denominatorDT);
+        }
+    }
+
+    /**
+     * Calculate greatest common divisor of two positive numbers.
+     *
+     * @param[in] number1   Number 1
+     * @param[in] number2   Number 2
+     *
+     * @return Greatest common divisor
+     */
+    static uint32_t calcUnsignedGreatestCommonDivisor(uint32_t number1, uint32_t number2)
+    {
+        while (0U != number2)
+        {
+            uint32_t rest = number1 % number2;
+            number1       = number2;
+            number2       = rest;
+        }
+
+        return number1;
     }
 
     /**
@@ -0,0 +1,280 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Registry of runtime tunable parameters
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "ParameterRegistry.h"
+#include <string.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+ParameterRegistry::ParameterRegistry() :
+    m_parameters(),
+    m_count(0U),
+    m_changeCallback(nullptr),
+    m_userData(nullptr)
+{
+}
+
+void ParameterRegistry::setChangeCallback(ChangeCallback callback, void* userData)
+{
+    m_changeCallback = callback;
+    m_userData       = userData;
+}
+
+bool ParameterRegistry::find(const char* name, uint8_t& index) const
+{
+    bool    isFound = false;
+    uint8_t idx     = 0U;
+
+    if (nullptr != name)
+    {
+        while ((m_count > idx) && (false == isFound))
+        {
+            if (0 == strncmp(name, m_parameters[idx].name, MAX_NAME_LENGTH + 1U))
+            {
+                index   = idx;
+                isFound = true;
+            }
+            else
+            {
+                ++idx;
+            }
+        }
+    }
+
+    return isFound;
+}
+
+const char* ParameterRegistry::getName(uint8_t index) const
+{
+    const char* name = nullptr;
+
+    if (m_count > index)
+    {
+        name = m_parameters[index].name;
+    }
+
+    return name;
+}
+
+bool ParameterRegistry::getType(uint8_t index, Type& type) const
+{
+    bool isValid = false;
+
+    if (m_count > index)
+    {
+        type    = m_parameters[index].type;
+        isValid = true;
+    }
+
+    return isValid;
+}
+
+bool ParameterRegistry::getLimits(uint8_t index, int32_t& min, int32_t& max) const
+{
+    bool isValid = false;
+
+    if (m_count > index)
+    {
+        min     = m_parameters[index].min;
+        max     = m_parameters[index].max;
+        isValid = true;
+    }
+
+    return isValid;
+}
+
+bool ParameterRegistry::getValue(uint8_t index, int32_t& value) const
+{
+    bool isValid = false;
+
+    if (m_count > index)
+    {
+        const Parameter& parameter = m_parameters[index];
+
+        switch (parameter.type)
+        {
+        case TYPE_INT16:
+            value = *static_cast<const int16_t*>(parameter.value);
+            break;
+
+        case TYPE_UINT16:
+            value = *static_cast<const uint16_t*>(parameter.value);
+            break;
+
+        case TYPE_INT32:
+        default:
+            value = *static_cast<const int32_t*>(parameter.value);
+            break;
+        }
+
+        isValid = true;
+    }
+
+    return isValid;
+}
+
+bool ParameterRegistry::isPersistent(uint8_t index) const
+{
+    bool isPersistent = false;
+
+    if (m_count > index)
+    {
+        isPersistent = m_parameters[index].isPersistent;
+    }
+
+    return isPersistent;
+}
+
+bool ParameterRegistry::areAllPersistent() const
+{
+    bool    areAllPersistent = true;
+    uint8_t index            = 0U;
+
+    while ((m_count > index) && (true == areAllPersistent))
+    {
+        areAllPersistent = m_parameters[index].isPersistent;
+        ++index;
+    }
+
+    return areAllPersistent;
+}
+
+ParameterRegistry::Result ParameterRegistry::setValue(uint8_t index, int32_t value)
+{
+    Result result = RESULT_UNKNOWN;
+
+    if (m_count > index)
+    {
+        const Parameter& parameter = m_parameters[index];
+        int32_t          oldValue  = 0;
+
+        (void)getValue(index, oldValue);
+
+        /* The bounds are within the range of the parameter type, see addParameter(). */
+        if ((parameter.min > value) || (parameter.max < value))
+        {
+            result = RESULT_OUT_OF_RANGE;
+        }
+        else
+        {
+            switch (parameter.type)
+            {
+            case TYPE_INT16:
+                *static_cast<int16_t*>(parameter.value) = static_cast<int16_t>(value);
+                break;
+
+            case TYPE_UINT16:
+                *static_cast<uint16_t*>(parameter.value) = static_cast<uint16_t>(value);
+                break;
+
+            case TYPE_INT32:
+            default:
+                *static_cast<int32_t*>(parameter.value) = value;
+                break;
+            }
+
+            if ((oldValue != value) && (nullptr != m_changeCallback))
+            {
+                m_changeCallback(index, m_userData);
+            }
+
+            result = RESULT_OK;
+        }
+    }
+
+    return result;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+bool ParameterRegistry::addParameter(const char* name, void* value, Type type, int32_t min, int32_t max,
+                                     bool isPersistent)
+{
+    bool    isSuccessful = false;
+    uint8_t index        = 0U;
+
+    if ((MAX_PARAMETERS > m_count) && (nullptr != name) && ('\0' != name[0U]) &&
+        (MAX_NAME_LENGTH >= strlen(name)) && (min <= max) && (false == find(name, index)))
+    {
+        Parameter& parameter = m_parameters[m_count];
+
+        parameter.name         = name;
+        parameter.value        = value;
+        parameter.min          = min;
+        parameter.max          = max;
+        parameter.type         = type;
+        parameter.isPersistent = isPersistent;
+        ++m_count;
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,324 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Registry of runtime tunable parameters
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup Service
+ *
+ * @{
+ */
+
+#ifndef PARAMETER_REGISTRY_H
+#define PARAMETER_REGISTRY_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+#ifndef CONFIG_PARAMETER_REGISTRY_SIZE
+/** Max. number of parameters in a registry. */
+#define CONFIG_PARAMETER_REGISTRY_SIZE (16U)
+#endif /* CONFIG_PARAMETER_REGISTRY_SIZE */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Registry of named parameters, which can be read and written at runtime,
+ * e.g. to tune the controller gains on the track without rebuilding.
+ *
+ * A parameter refers to a variable of its owner and has bounds. A value
+ * outside the bounds is rejected. After a parameter is changed, the owner
+ * is notified by the change callback to apply it.
+ *
+ * The names are not copied, therefore they shall be string literals.
+ */
+class ParameterRegistry
+{
+public:
+    /** Parameter types. */
+    typedef enum : uint8_t
+    {
+        TYPE_INT16 = 0, /**< Signed 16 bit integer */
+        TYPE_UINT16,    /**< Unsigned 16 bit integer */
+        TYPE_INT32      /**< Signed 32 bit integer */
+
+    } Type;
+
+    /** Result of a parameter write. */
+    typedef enum : uint8_t
+    {
+        RESULT_OK = 0,      /**< Parameter written. */
+        RESULT_UNKNOWN,     /**< Unknown parameter. */
+        RESULT_OUT_OF_RANGE /**< Value is outside the parameter bounds. */
+
+    } Result;
+
+    /**
+     * Callback, which is called after a parameter is changed.
+     *
+     * @param[in] index     Index of the changed parameter.
+     * @param[in] userData  User data, given at registration of the callback.
+     */
+    typedef void (*ChangeCallback)(uint8_t index, void* userData);
+
+    /** Max. number of parameters. */
+    static const uint8_t MAX_PARAMETERS = CONFIG_PARAMETER_REGISTRY_SIZE;
+
+    /** Max. length of a parameter name without termination. */
+    static const uint8_t MAX_NAME_LENGTH = 11U;
+
+    /**
+     * Constructs an empty parameter registry.
+     */
+    ParameterRegistry();
+
+    /**
+     * Destroys the parameter registry.
+     */
+    ~ParameterRegistry()
+    {
+    }
+
+    /**
+     * Set the callback, which is called after a parameter is changed.
+     *
+     * @param[in] callback  Change callback. Use nullptr to remove it.
+     * @param[in] userData  User data, which is passed to the callback.
+     */
+    void setChangeCallback(ChangeCallback callback, void* userData);
+
+    /**
+     * Add a signed 16 bit parameter.
+     *
+     * @param[in] name  Unique parameter name, see MAX_NAME_LENGTH.
+     * @param[in] value Variable, which holds the parameter value.
+     * @param[in] min   Lower bound.
+     * @param[in] max   Upper bound.
+     * @param[in] isPersistent  If the parameter is stored in the settings, set it to true.
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool add(const char* name, int16_t& value, int16_t min, int16_t max, bool isPersistent = false)
+    {
+        return addParameter(name, &value, TYPE_INT16, min, max, isPersistent);
+    }
+
+    /**
+     * Add an unsigned 16 bit parameter.
+     *
+     * @param[in] name  Unique parameter name, see MAX_NAME_LENGTH.
+     * @param[in] value Variable, which holds the parameter value.
+     * @param[in] min   Lower bound.
+     * @param[in] max   Upper bound.
+     * @param[in] isPersistent  If the parameter is stored in the settings, set it to true.
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool add(const char* name, uint16_t& value, uint16_t min, uint16_t max, bool isPersistent = false)
+    {
+        return addParameter(name, &value, TYPE_UINT16, min, max, isPersistent);
+    }
+
+    /**
+     * Add a signed 32 bit parameter.
+     *
+     * @param[in] name  Unique parameter name, see MAX_NAME_LENGTH.
+     * @param[in] value Variable, which holds the parameter value.
+     * @param[in] min   Lower bound.
+     * @param[in] max   Upper bound.
+     * @param[in] isPersistent  If the parameter is stored in the settings, set it to true.
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool add(const char* name, int32_t& value, int32_t min, int32_t max, bool isPersistent = false)
+    {
+        return addParameter(name, &value, TYPE_INT32, min, max, isPersistent);
+    }
+
+    /**
+     * Get the number of parameters.
+     *
+     * @return Number of parameters
+     */
+    uint8_t getCount() const
+    {
+        return m_count;
+    }
+
+    /**
+     * Find a parameter by its name.
+     *
+     * @param[in]  name     Parameter name
+     * @param[out] index    Parameter index
+     *
+     * @return If found, it will return true otherwise false.
+     */
+    bool find(const char* name, uint8_t& index) const;
+
+    /**
+     * Get the parameter name.
+     *
+     * @param[in] index Parameter index
+     *
+     * @return Parameter name or nullptr, if the index is invalid.
+     */
+    const char* getName(uint8_t index) const;
+
+    /**
+     * Get the parameter type.
+     *
+     * @param[in]  index    Parameter index
+     * @param[out] type     Parameter type
+     *
+     * @return If the index is valid, it will return true otherwise false.
+     */
+    bool getType(uint8_t index, Type& type) const;
+
+    /**
+     * Get the parameter bounds.
+     *
+     * @param[in]  index    Parameter index
+     * @param[out] min      Lower bound
+     * @param[out] max      Upper bound
+     *
+     * @return If the index is valid, it will return true otherwise false.
+     */
+    bool getLimits(uint8_t index, int32_t& min, int32_t& max) const;
+
+    /**
+     * Get the parameter value.
+     *
+     * @param[in]  index    Parameter index
+     * @param[out] value    Parameter value
+     *
+     * @return If the index is valid, it will return true otherwise false.
+     */
+    bool getValue(uint8_t index, int32_t& value) const;
+
+    /**
+     * Is the parameter stored in the settings? A volatile parameter gets
+     * lost at power off.
+     *
+     * @param[in] index Parameter index
+     *
+     * @return If the parameter is persistent, it will return true otherwise false.
+     */
+    bool isPersistent(uint8_t index) const;
+
+    /**
+     * Are all parameters stored in the settings?
+     *
+     * @return If all parameters are persistent, it will return true otherwise false.
+     */
+    bool areAllPersistent() const;
+
+    /**
+     * Set the parameter value. If the value is changed, the change callback
+     * will be called.
+     *
+     * @param[in] index Parameter index
+     * @param[in] value Parameter value
+     *
+     * @return Result of the write
+     */
+    Result setValue(uint8_t index, int32_t value);
+
+private:
+    /** A single parameter. */
+    struct Parameter
+    {
+        const char* name;         /**< Parameter name */
+        void*       value;        /**< Variable, which holds the parameter value. */
+        int32_t     min;          /**< Lower bound */
+        int32_t     max;          /**< Upper bound */
+        Type        type;         /**< Parameter type */
+        bool        isPersistent; /**< Is the parameter stored in the settings? */
+    };
+
+    /** Registered parameters. */
+    Parameter m_parameters[MAX_PARAMETERS];
+
+    /** Number of registered parameters. */
+    uint8_t m_count;
+
+    /** Change callback. */
+    ChangeCallback m_changeCallback;
+
+    /** User data of the change callback. */
+    void* m_userData;
+
+    /**
+     * Add a parameter.
+     *
+     * @param[in] name  Unique parameter name
+     * @param[in] value Variable, which holds the parameter value.
+     * @param[in] type  Type of the variable
+     * @param[in] min   Lower bound
+     * @param[in] max   Upper bound
+     * @param[in] isPersistent  Is the parameter stored in the settings?
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addParameter(const char* name, void* value, Type type, int32_t min, int32_t max, bool isPersistent);
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] registry  Source instance.
+     */
+    ParameterRegistry(const ParameterRegistry& registry);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] registry  Source instance.
+     *
+     * @returns Reference to ParameterRegistry instance.
+     */
+    ParameterRegistry& operator=(const ParameterRegistry& registry);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* PARAMETER_REGISTRY_H */
+/** @} */
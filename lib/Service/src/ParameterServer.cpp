@@ -0,0 +1,178 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Parameter protocol server
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "ParameterServer.h"
+#include <string.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+ParameterServer::ParameterServer(ParameterRegistry& registry) :
+    m_registry(registry),
+    m_storeCallback(nullptr),
+    m_userData(nullptr)
+{
+}
+
+void ParameterServer::setStoreCallback(StoreCallback callback, void* userData)
+{
+    m_storeCallback = callback;
+    m_userData      = userData;
+}
+
+void ParameterServer::handleRequest(const Request& request, Response& response)
+{
+    char    name[NAME_SIZE];
+    uint8_t index = request.index;
+
+    memset(&response, 0, sizeof(response));
+    response.requestId  = request.requestId;
+    response.responseId = RESPONSE_OK;
+    response.index      = index;
+    response.count      = m_registry.getCount();
+
+    /* The received name may be not terminated. */
+    strncpy(name, request.name, sizeof(name) - 1U);
+    name[sizeof(name) - 1U] = '\0';
+
+    switch (request.requestId)
+    {
+    case REQUEST_LIST:
+        if (false == fillResponse(index, response))
+        {
+            response.responseId = RESPONSE_UNKNOWN;
+        }
+        break;
+
+    case REQUEST_GET:
+    case REQUEST_SET:
+        if (false == m_registry.find(name, index))
+        {
+            response.responseId = RESPONSE_UNKNOWN;
+        }
+        else
+        {
+            if (REQUEST_SET == request.requestId)
+            {
+                response.responseId = static_cast<ResponseId>(m_registry.setValue(index, request.value));
+            }
+
+            /* The response contains the current value, even if the requested one was rejected. */
+            (void)fillResponse(index, response);
+        }
+        break;
+
+    case REQUEST_STORE:
+        if (nullptr != m_storeCallback)
+        {
+            m_storeCallback(m_userData);
+        }
+
+        /* The volatile parameters keep their values only until power off. */
+        if (false == m_registry.areAllPersistent())
+        {
+            response.responseId = RESPONSE_NOT_PERSISTED;
+        }
+        break;
+
+    default:
+        response.responseId = RESPONSE_ERROR;
+        break;
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+bool ParameterServer::fillResponse(uint8_t index, Response& response) const
+{
+    bool                    isFound = false;
+    const char*             name    = m_registry.getName(index);
+    ParameterRegistry::Type type    = ParameterRegistry::TYPE_INT32;
+    int32_t                 value   = 0;
+    int32_t                 min     = 0;
+    int32_t                 max     = 0;
+
+    if ((nullptr != name) && (true == m_registry.getType(index, type)) &&
+        (true == m_registry.getValue(index, value)) && (true == m_registry.getLimits(index, min, max)))
+    {
+        response.index = index;
+        response.type  = type;
+        response.value = value;
+        response.min   = min;
+        response.max   = max;
+        response.flags = (true == m_registry.isPersistent(index)) ? FLAG_PERSISTENT : 0U;
+
+        /* The name is always terminated, because it is not longer than the max. name length. */
+        strncpy(response.name, name, sizeof(response.name));
+
+        isFound = true;
+    }
+
+    return isFound;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
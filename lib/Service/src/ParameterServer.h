@@ -0,0 +1,206 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Parameter protocol server
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup Service
+ *
+ * @{
+ */
+
+#ifndef PARAMETER_SERVER_H
+#define PARAMETER_SERVER_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <ParameterRegistry.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Handles the requests of the parameter protocol, which the DCS uses to list,
+ * read, write and store the parameters of a registry. The application only
+ * transports the request and response payloads, e.g. on the "PARAM" and
+ * "PARAM_RSP" SerialMuxProt channels.
+ */
+class ParameterServer
+{
+public:
+    /** Parameter requests. */
+    typedef enum : uint8_t
+    {
+        REQUEST_LIST = 0, /**< Get the parameter with the given index, to list all parameters. */
+        REQUEST_GET,      /**< Get the parameter with the given name. */
+        REQUEST_SET,      /**< Set the parameter with the given name. */
+        REQUEST_STORE     /**< Store the persistent parameters in the settings. */
+
+    } RequestId;
+
+    /** Parameter responses, the first ones are equal to ParameterRegistry::Result. */
+    typedef enum : uint8_t
+    {
+        RESPONSE_OK = 0,       /**< Request successful executed. */
+        RESPONSE_UNKNOWN,      /**< Unknown parameter. */
+        RESPONSE_OUT_OF_RANGE, /**< Value is outside the parameter bounds. */
+        RESPONSE_ERROR,        /**< Invalid request. */
+        RESPONSE_NOT_PERSISTED /**< Store request executed, but not all parameters are persistent. */
+
+    } ResponseId;
+
+    /** Parameter flag: The parameter is stored in the settings by the store request. */
+    static const uint8_t FLAG_PERSISTENT = 0x01U;
+
+    /** Size of a parameter name in the payloads, including the termination. */
+    static const uint8_t NAME_SIZE = ParameterRegistry::MAX_NAME_LENGTH + 1U;
+
+    /** Request payload. */
+    typedef struct
+    {
+        RequestId requestId;       /**< Request ID */
+        uint8_t   index;           /**< Parameter index, used by the list request. */
+        char      name[NAME_SIZE]; /**< Parameter name, used by the get and set request. */
+        int32_t   value;           /**< Parameter value, used by the set request. */
+    } __attribute__((packed)) Request;
+
+    /** Response payload. */
+    typedef struct
+    {
+        RequestId  requestId;       /**< Request ID */
+        ResponseId responseId;      /**< Response to the request */
+        uint8_t    index;           /**< Parameter index */
+        uint8_t    count;           /**< Number of parameters */
+        uint8_t    type;            /**< Parameter type, see ParameterRegistry::Type. */
+        uint8_t    flags;           /**< Parameter flags, see FLAG_PERSISTENT. */
+        char       name[NAME_SIZE]; /**< Parameter name */
+        int32_t    value;           /**< Parameter value */
+        int32_t    min;             /**< Lower bound of the parameter value */
+        int32_t    max;             /**< Upper bound of the parameter value */
+    } __attribute__((packed)) Response;
+
+    /**
+     * Callback, which is called to store the persistent parameters.
+     *
+     * @param[in] userData  User data, given at registration of the callback.
+     */
+    typedef void (*StoreCallback)(void* userData);
+
+    /**
+     * Constructs the parameter server.
+     *
+     * @param[in] registry  Parameter registry, which is served.
+     */
+    explicit ParameterServer(ParameterRegistry& registry);
+
+    /**
+     * Destroys the parameter server.
+     */
+    ~ParameterServer()
+    {
+    }
+
+    /**
+     * Set the callback, which is called by the store request. It shall store
+     * all persistent parameters. The volatile parameters can not be stored,
+     * which is reported in the response to the store request.
+     *
+     * @param[in] callback  Store callback. Use nullptr to remove it.
+     * @param[in] userData  User data, which is passed to the callback.
+     */
+    void setStoreCallback(StoreCallback callback, void* userData);
+
+    /**
+     * Handle a request and create the response, which shall be sent back.
+     *
+     * @param[in]  request   Received request.
+     * @param[out] response  Response to the request.
+     */
+    void handleRequest(const Request& request, Response& response);
+
+private:
+    /** Parameter registry, which is served. */
+    ParameterRegistry& m_registry;
+
+    /** Store callback. */
+    StoreCallback m_storeCallback;
+
+    /** User data of the store callback. */
+    void* m_userData;
+
+    /**
+     * Fill the parameter details into the response.
+     *
+     * @param[in]  index    Parameter index
+     * @param[out] response Response
+     *
+     * @return If the parameter exists, it will return true otherwise false.
+     */
+    bool fillResponse(uint8_t index, Response& response) const;
+
+    /**
+     * Default constructor.
+     * Not allowed.
+     */
+    ParameterServer();
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] server    Source instance.
+     */
+    ParameterServer(const ParameterServer& server);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] server    Source instance.
+     *
+     * @returns Reference to ParameterServer instance.
+     */
+    ParameterServer& operator=(const ParameterServer& server);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* PARAMETER_SERVER_H */
+/** @} */
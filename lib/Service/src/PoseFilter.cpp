@@ -0,0 +1,258 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Pose filter, which fuses the gyro turn rate with the odometry
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "PoseFilter.h"
+#include <Arduino.h>
+#include <Util.h>
+#include <math.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static int32_t  wrapAngle(int32_t angle, int32_t pi);
+static uint32_t addSaturated(uint32_t value, uint32_t summand);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+PoseFilter::PoseFilter() :
+    m_orientationNoise(DEFAULT_ORIENTATION_NOISE),
+    m_odometryNoise(DEFAULT_ODOMETRY_NOISE),
+    m_positionNoise(DEFAULT_POSITION_NOISE),
+    m_posX(0),
+    m_posY(0),
+    m_orientation(0),
+    m_positionVariance(0U),
+    m_orientationVariance(0U),
+    m_slipOffset(0),
+    m_lastOdoPosX(0),
+    m_lastOdoPosY(0),
+    m_lastOdoOrientation(0)
+{
+}
+
+void PoseFilter::reset(int32_t posX, int32_t posY, int32_t orientation)
+{
+    m_posX                = posX * 1000;
+    m_posY                = posY * 1000;
+    m_orientation         = wrapAngle(orientation * 1000, PI_URAD);
+    m_positionVariance    = 0U;
+    m_orientationVariance = 0U;
+    m_slipOffset          = 0;
+    m_lastOdoPosX         = posX;
+    m_lastOdoPosY         = posY;
+    m_lastOdoOrientation  = orientation * 1000;
+}
+
+void PoseFilter::process(uint16_t period, int32_t turnRate, int32_t odoPosX, int32_t odoPosY, int32_t odoOrientation,
+                         bool isSlipDetected)
+{
+    int32_t  odoOrientationURad = odoOrientation * 1000;                                         /* [urad] */
+    int32_t  gyroDelta          = turnRate * static_cast<int32_t>(period);                       /* [urad] */
+    int32_t  odoDelta           = wrapAngle(odoOrientationURad - m_lastOdoOrientation, PI_URAD); /* [urad] */
+    int32_t  deviation          = odoDelta - gyroDelta;                                          /* [urad] */
+    uint32_t processNoise       = UINT32_MAX;                                                    /* [urad^2] */
+
+    if ((0U == period) || ((UINT32_MAX / period) >= m_orientationNoise))
+    {
+        processNoise = m_orientationNoise * period;
+    }
+
+    /* Prediction with the gyro turn rate. */
+    m_orientation         = wrapAngle(m_orientation + gyroDelta, PI_URAD);
+    m_orientationVariance = addSaturated(m_orientationVariance, processNoise);
+
+    /* The odometry orientation error, caused by wheel slip, is compensated
+     * by the gyro. It is kept to avoid that the odometry pulls the orientation
+     * back to the wrong one.
+     */
+    if (true == isSlipDetected)
+    {
+        m_slipOffset = wrapAngle(m_slipOffset - deviation, PI_URAD);
+    }
+    else
+    {
+        updateOrientation(wrapAngle(odoOrientationURad + m_slipOffset, PI_URAD));
+    }
+
+    updatePosition(odoPosX - m_lastOdoPosX, odoPosY - m_lastOdoPosY, odoOrientationURad);
+
+    m_lastOdoPosX        = odoPosX;
+    m_lastOdoPosY        = odoPosY;
+    m_lastOdoOrientation = odoOrientationURad;
+}
+
+void PoseFilter::getPosition(int32_t& posX, int32_t& posY) const
+{
+    posX = Util::divRoundUp(m_posX, static_cast<int32_t>(1000));
+    posY = Util::divRoundUp(m_posY, static_cast<int32_t>(1000));
+}
+
+int32_t PoseFilter::getOrientation() const
+{
+    return Util::divRoundUp(m_orientation, static_cast<int32_t>(1000));
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void PoseFilter::updateOrientation(int32_t odoOrientation)
+{
+    const uint32_t GAIN_ONE   = static_cast<uint32_t>(1U) << GAIN_SHIFT;
+    int32_t        innovation = wrapAngle(odoOrientation - m_orientation, PI_URAD); /* [urad] */
+    uint32_t       variance   = m_orientationVariance;
+    uint32_t       sum        = addSaturated(variance, m_odometryNoise);
+    uint32_t       gain       = 0U;
+    uint32_t       correction = 0U;
+
+    /* Scale both down, so the gain can be calculated in 32 bit with GAIN_SHIFT bits precision. */
+    while (GAIN_ONE <= sum)
+    {
+        variance >>= 1U;
+        sum >>= 1U;
+    }
+
+    if (0U < sum)
+    {
+        gain = (variance << GAIN_SHIFT) / sum;
+    }
+
+    correction = static_cast<uint32_t>((static_cast<uint64_t>(abs(innovation)) * gain) >> GAIN_SHIFT);
+
+    if (0 > innovation)
+    {
+        m_orientation = wrapAngle(m_orientation - static_cast<int32_t>(correction), PI_URAD);
+    }
+    else
+    {
+        m_orientation = wrapAngle(m_orientation + static_cast<int32_t>(correction), PI_URAD);
+    }
+
+    m_orientationVariance -= static_cast<uint32_t>((static_cast<uint64_t>(m_orientationVariance) * gain) >> GAIN_SHIFT);
+}
+
+void PoseFilter::updatePosition(int32_t deltaX, int32_t deltaY, int32_t odoOrientation)
+{
+    if ((0 != deltaX) || (0 != deltaY))
+    {
+        /* The odometry moved along its own orientation, the fused one is rotated by the difference. */
+        int32_t rotation  = wrapAngle(m_orientation - odoOrientation, PI_URAD); /* [urad] */
+        float   fRotation = static_cast<float>(rotation) / 1000000.0F;         /* [rad] */
+        float   fCos      = cosf(fRotation);
+        float   fSin      = sinf(fRotation);
+        float   fDeltaX   = static_cast<float>(deltaX);                         /* [mm] */
+        float   fDeltaY   = static_cast<float>(deltaY);                         /* [mm] */
+        float   fDistance = sqrtf((fDeltaX * fDeltaX) + (fDeltaY * fDeltaY));   /* [mm] */
+
+        m_posX += static_cast<int32_t>(lroundf(((fCos * fDeltaX) - (fSin * fDeltaY)) * 1000.0F));
+        m_posY += static_cast<int32_t>(lroundf(((fSin * fDeltaX) + (fCos * fDeltaY)) * 1000.0F));
+
+        m_positionVariance =
+            addSaturated(m_positionVariance, static_cast<uint32_t>(lroundf(fDistance)) * m_positionNoise);
+    }
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Wrap an angle into the range (-PI; PI].
+ *
+ * @param[in] angle Angle
+ * @param[in] pi    PI in the unit of the angle.
+ *
+ * @return Wrapped angle
+ */
+static int32_t wrapAngle(int32_t angle, int32_t pi)
+{
+    while (pi < angle)
+    {
+        angle -= 2 * pi;
+    }
+
+    while (-pi >= angle)
+    {
+        angle += 2 * pi;
+    }
+
+    return angle;
+}
+
+/**
+ * Add a summand to a value and saturate at the max. value.
+ *
+ * @param[in] value     Value
+ * @param[in] summand   Summand
+ *
+ * @return Saturated sum
+ */
+static uint32_t addSaturated(uint32_t value, uint32_t summand)
+{
+    uint32_t sum = UINT32_MAX;
+
+    if ((UINT32_MAX - value) > summand)
+    {
+        sum = value + summand;
+    }
+
+    return sum;
+}
@@ -0,0 +1,250 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Pose filter, which fuses the gyro turn rate with the odometry
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup Service
+ *
+ * @{
+ */
+
+#ifndef POSE_FILTER_H
+#define POSE_FILTER_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The pose filter fuses the gyro turn rate with the odometry orientation and
+ * position. It shall be processed every control period.
+ *
+ * The orientation is estimated with a scalar Kalman filter in fixed-point.
+ * The gyro turn rate is integrated in the prediction step, the odometry
+ * orientation corrects it in the update step. Short-term the gyro dominates,
+ * long-term the odometry, like in a complementary filter, but with a gain
+ * that follows the orientation variance.
+ *
+ * During wheel slip, which the caller detects e.g. with the SlipDetector, the
+ * odometry orientation is not used for the update and its error is
+ * compensated afterwards.
+ *
+ * The position integrates the odometry movement, rotated by the difference
+ * between the fused and the odometry orientation. Its variance grows with
+ * the driven distance.
+ */
+class PoseFilter
+{
+public:
+    /** Default orientation process noise in [urad^2/ms], which covers the gyro noise. */
+    static const uint32_t DEFAULT_ORIENTATION_NOISE = 20U;
+
+    /** Default odometry orientation measurement noise in [urad^2]. */
+    static const uint32_t DEFAULT_ODOMETRY_NOISE = 1000000000U;
+
+    /** Default position process noise in [mm^2/mm], which covers the odometry distance error. */
+    static const uint16_t DEFAULT_POSITION_NOISE = 1U;
+
+    /**
+     * Constructs the pose filter at the origin.
+     */
+    PoseFilter();
+
+    /**
+     * Destroys the pose filter.
+     */
+    ~PoseFilter()
+    {
+    }
+
+    /**
+     * Reset the filter to the odometry pose. The variances are cleared.
+     *
+     * @param[in] posX          Odometry x position in [mm].
+     * @param[in] posY          Odometry y position in [mm].
+     * @param[in] orientation   Odometry orientation in [mrad].
+     */
+    void reset(int32_t posX, int32_t posY, int32_t orientation);
+
+    /**
+     * Set the orientation process noise, which covers the gyro noise.
+     * A lower noise trusts the gyro more.
+     *
+     * @param[in] noise Orientation process noise in [urad^2/ms].
+     */
+    void setOrientationNoise(uint32_t noise)
+    {
+        m_orientationNoise = noise;
+    }
+
+    /**
+     * Set the odometry orientation measurement noise.
+     * A lower noise trusts the odometry more.
+     *
+     * @param[in] noise Odometry orientation measurement noise in [urad^2]. Shall be greater than 0.
+     */
+    void setOdometryNoise(uint32_t noise)
+    {
+        if (0U < noise)
+        {
+            m_odometryNoise = noise;
+        }
+    }
+
+    /**
+     * Set the position process noise, which covers the odometry distance error.
+     *
+     * @param[in] noise Position process noise in [mm^2/mm].
+     */
+    void setPositionNoise(uint16_t noise)
+    {
+        m_positionNoise = noise;
+    }
+
+    /**
+     * Process the filter with the current measurements.
+     *
+     * @param[in] period            Time since the last processing in [ms].
+     * @param[in] turnRate          Gyro turn rate in [mrad/s].
+     * @param[in] odoPosX           Odometry x position in [mm].
+     * @param[in] odoPosY           Odometry y position in [mm].
+     * @param[in] odoOrientation    Odometry orientation in [mrad].
+     * @param[in] isSlipDetected    Is wheel slip detected?
+     */
+    void process(uint16_t period, int32_t turnRate, int32_t odoPosX, int32_t odoPosY, int32_t odoOrientation,
+                 bool isSlipDetected);
+
+    /**
+     * Get the fused position.
+     *
+     * @param[out] posX X position in [mm].
+     * @param[out] posY Y position in [mm].
+     */
+    void getPosition(int32_t& posX, int32_t& posY) const;
+
+    /**
+     * Get the fused orientation.
+     *
+     * @return Orientation in [mrad], in the range (-PI; PI].
+     */
+    int32_t getOrientation() const;
+
+    /**
+     * Get the variance of the position in both directions.
+     *
+     * @return Position variance in [mm^2].
+     */
+    uint32_t getPositionVariance() const
+    {
+        return m_positionVariance;
+    }
+
+    /**
+     * Get the variance of the orientation.
+     *
+     * @return Orientation variance in [urad^2].
+     */
+    uint32_t getOrientationVariance() const
+    {
+        return m_orientationVariance;
+    }
+
+private:
+    /** PI in [urad]. */
+    static const int32_t PI_URAD = 3141593;
+
+    /** Fixed-point shift of the Kalman gain. */
+    static const uint8_t GAIN_SHIFT = 16U;
+
+    uint32_t m_orientationNoise;    /**< Orientation process noise in [urad^2/ms]. */
+    uint32_t m_odometryNoise;       /**< Odometry orientation measurement noise in [urad^2]. */
+    uint16_t m_positionNoise;       /**< Position process noise in [mm^2/mm]. */
+    int32_t  m_posX;                /**< Fused x position in [um]. */
+    int32_t  m_posY;                /**< Fused y position in [um]. */
+    int32_t  m_orientation;         /**< Fused orientation in [urad], in the range (-PI; PI]. */
+    uint32_t m_positionVariance;    /**< Position variance in [mm^2]. */
+    uint32_t m_orientationVariance; /**< Orientation variance in [urad^2]. */
+    int32_t  m_slipOffset;          /**< Odometry orientation error in [urad], caused by wheel slip. */
+    int32_t  m_lastOdoPosX;         /**< Odometry x position of the last processing in [mm]. */
+    int32_t  m_lastOdoPosY;         /**< Odometry y position of the last processing in [mm]. */
+    int32_t  m_lastOdoOrientation;  /**< Odometry orientation of the last processing in [urad]. */
+
+    /**
+     * Update the orientation with the odometry orientation.
+     *
+     * @param[in] odoOrientation    Odometry orientation in [urad], corrected by the slip offset.
+     */
+    void updateOrientation(int32_t odoOrientation);
+
+    /**
+     * Move the position by the odometry movement.
+     *
+     * @param[in] deltaX            Odometry movement in x direction in [mm].
+     * @param[in] deltaY            Odometry movement in y direction in [mm].
+     * @param[in] odoOrientation    Odometry orientation in [urad].
+     */
+    void updatePosition(int32_t deltaX, int32_t deltaY, int32_t odoOrientation);
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] filter    Source instance.
+     */
+    PoseFilter(const PoseFilter& filter);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] filter    Source instance.
+     *
+     * @returns Reference to PoseFilter instance.
+     */
+    PoseFilter& operator=(const PoseFilter& filter);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* POSE_FILTER_H */
+/** @} */
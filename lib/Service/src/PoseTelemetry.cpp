@@ -0,0 +1,192 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Pose telemetry to the supervisor
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "PoseTelemetry.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* The number of poses in a batch frame is a single byte. */
+static_assert((0 < CONFIG_POSE_TELEMETRY_BATCH_SIZE) && (UINT8_MAX >= CONFIG_POSE_TELEMETRY_BATCH_SIZE),
+              "CONFIG_POSE_TELEMETRY_BATCH_SIZE is out of range.");
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+PoseTelemetry::PoseTelemetry(Stream& stream) :
+    m_stream(stream),
+    m_sequenceNumber(0U),
+    m_batchFrame(),
+    m_batchCount(0U),
+    m_lastTimestamp(0U)
+{
+}
+
+void PoseTelemetry::sendReset()
+{
+    m_sequenceNumber = 0U;
+    m_batchCount     = 0U;
+
+    (void)m_stream.print("RST");
+}
+
+void PoseTelemetry::sendPose(uint32_t timestamp, int32_t posX, int32_t posY, int32_t orientation)
+{
+#if (0 != CONFIG_POSE_TELEMETRY_TEXT)
+
+    const size_t BUFFER_SIZE = 40U;
+    char         buffer[BUFFER_SIZE];
+
+    (void)timestamp;
+
+    (void)snprintf(buffer, BUFFER_SIZE, "ODO,%ld,%ld,%ld", static_cast<long>(posX), static_cast<long>(posY),
+                   static_cast<long>(orientation));
+
+    (void)m_stream.print(buffer);
+
+#elif (1 == CONFIG_POSE_TELEMETRY_BATCH_SIZE)
+
+    uint8_t frame[POSE_FRAME_SIZE];
+    uint8_t idx = 0U;
+
+    frame[idx++] = FRAME_TYPE_POSE;
+    idx += writeLittleEndian(&frame[idx], m_sequenceNumber, sizeof(uint16_t));
+    idx += writeLittleEndian(&frame[idx], timestamp, sizeof(uint32_t));
+    idx += writeLittleEndian(&frame[idx], static_cast<uint32_t>(posX), sizeof(int32_t));
+    idx += writeLittleEndian(&frame[idx], static_cast<uint32_t>(posY), sizeof(int32_t));
+    idx += writeLittleEndian(&frame[idx], static_cast<uint32_t>(orientation), sizeof(int16_t));
+
+    (void)m_stream.write(frame, idx);
+
+#else
+
+    uint32_t timeDiff = timestamp - m_lastTimestamp;
+    uint8_t  idx      = 0U;
+
+    /* The time difference to the previous pose must fit into a single byte. */
+    if ((0U < m_batchCount) && (UINT8_MAX < timeDiff))
+    {
+        flush();
+    }
+
+    if (0U == m_batchCount)
+    {
+        timeDiff = 0U;
+
+        m_batchFrame[idx++] = FRAME_TYPE_POSE_BATCH;
+        m_batchFrame[idx++] = 0U; /* Number of poses, set during flush. */
+        idx += writeLittleEndian(&m_batchFrame[idx], m_sequenceNumber, sizeof(uint16_t));
+        idx += writeLittleEndian(&m_batchFrame[idx], timestamp, sizeof(uint32_t));
+    }
+    else
+    {
+        idx = BATCH_HEADER_SIZE + (m_batchCount * BATCH_POSE_SIZE);
+    }
+
+    m_batchFrame[idx++] = static_cast<uint8_t>(timeDiff);
+    idx += writeLittleEndian(&m_batchFrame[idx], static_cast<uint32_t>(posX), sizeof(int32_t));
+    idx += writeLittleEndian(&m_batchFrame[idx], static_cast<uint32_t>(posY), sizeof(int32_t));
+    (void)writeLittleEndian(&m_batchFrame[idx], static_cast<uint32_t>(orientation), sizeof(int16_t));
+
+    m_lastTimestamp = timestamp;
+    ++m_batchCount;
+
+    if (CONFIG_POSE_TELEMETRY_BATCH_SIZE <= m_batchCount)
+    {
+        flush();
+    }
+
+#endif
+
+    ++m_sequenceNumber;
+}
+
+void PoseTelemetry::flush()
+{
+    if (0U < m_batchCount)
+    {
+        m_batchFrame[1U] = m_batchCount;
+
+        (void)m_stream.write(m_batchFrame, BATCH_HEADER_SIZE + (m_batchCount * BATCH_POSE_SIZE));
+
+        m_batchCount = 0U;
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+uint8_t PoseTelemetry::writeLittleEndian(uint8_t* buffer, uint32_t value, uint8_t size)
+{
+    uint8_t idx;
+
+    for (idx = 0U; idx < size; ++idx)
+    {
+        buffer[idx] = static_cast<uint8_t>(value & 0xFFU);
+        value >>= 8U;
+    }
+
+    return size;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,212 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Pose telemetry to the supervisor
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup Service
+ *
+ * @{
+ */
+
+#ifndef POSE_TELEMETRY_H
+#define POSE_TELEMETRY_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+#ifndef CONFIG_POSE_TELEMETRY_TEXT
+/** Use the legacy text protocol "ODO,x,y,orientation" instead of the binary pose frames. */
+#define CONFIG_POSE_TELEMETRY_TEXT (0)
+#endif /* CONFIG_POSE_TELEMETRY_TEXT */
+
+#ifndef CONFIG_POSE_TELEMETRY_BATCH_SIZE
+/**
+ * Number of poses, which are sent together in one batch frame.
+ * With 1 every pose is sent immediately in a single pose frame.
+ */
+#define CONFIG_POSE_TELEMETRY_BATCH_SIZE (4)
+#endif /* CONFIG_POSE_TELEMETRY_BATCH_SIZE */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <Arduino.h>
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Sends the robot pose, determined by the odometry, to the supervisor.
+ *
+ * All values are little endian. The first byte is the frame type. It is
+ * always below 0x20, which distinguishes the binary frames from the text
+ * commands like "RST".
+ *
+ * Single pose frame (17 bytes):
+ * | TYPE (0x01) | SEQ (2) | TIMESTAMP in ms (4) | X in mm (4) | Y in mm (4) | ORIENTATION in mrad (2) |
+ *
+ * Batch frame (8 bytes + 11 bytes per pose):
+ * | TYPE (0x02) | COUNT | SEQ of first pose (2) | TIMESTAMP of first pose in ms (4) | POSE 1 | ... | POSE n |
+ * with POSE:
+ * | DT in ms since the previous pose | X in mm (4) | Y in mm (4) | ORIENTATION in mrad (2) |
+ *
+ * The sequence number is incremented per pose, which allows the supervisor
+ * to detect lost poses.
+ */
+class PoseTelemetry
+{
+public:
+    /** Frame type of a single pose. */
+    static const uint8_t FRAME_TYPE_POSE = 0x01U;
+
+    /** Frame type of a batch of poses. */
+    static const uint8_t FRAME_TYPE_POSE_BATCH = 0x02U;
+
+    /** Size of a single pose frame in bytes. */
+    static const uint8_t POSE_FRAME_SIZE = 17U;
+
+    /** Size of the batch frame header in bytes. */
+    static const uint8_t BATCH_HEADER_SIZE = 8U;
+
+    /** Size of a single pose in a batch frame in bytes. */
+    static const uint8_t BATCH_POSE_SIZE = 11U;
+
+    /**
+     * Constructs the pose telemetry.
+     *
+     * @param[in] stream    Stream to the supervisor.
+     */
+    explicit PoseTelemetry(Stream& stream);
+
+    /**
+     * Destroys the pose telemetry.
+     */
+    ~PoseTelemetry()
+    {
+    }
+
+    /**
+     * Request the supervisor to reset its observed position and orientation.
+     * Pending poses are discarded and the sequence number starts again with 0.
+     */
+    void sendReset();
+
+    /**
+     * Send a pose. Depended on the batch size, it is sent immediately or
+     * collected until the batch is full.
+     *
+     * @param[in] timestamp     Timestamp of the pose in ms.
+     * @param[in] posX          Position x in mm.
+     * @param[in] posY          Position y in mm.
+     * @param[in] orientation   Orientation in mrad.
+     */
+    void sendPose(uint32_t timestamp, int32_t posX, int32_t posY, int32_t orientation);
+
+    /**
+     * Send the collected poses immediately, even if the batch is not full.
+     */
+    void flush();
+
+    /**
+     * Get the sequence number of the next pose.
+     *
+     * @return Sequence number
+     */
+    uint16_t getSequenceNumber() const
+    {
+        return m_sequenceNumber;
+    }
+
+private:
+    /** Size of the batch frame buffer in bytes. */
+    static const uint16_t BATCH_FRAME_SIZE = BATCH_HEADER_SIZE + (CONFIG_POSE_TELEMETRY_BATCH_SIZE * BATCH_POSE_SIZE);
+
+    /** Stream to the supervisor. */
+    Stream& m_stream;
+
+    /** Sequence number of the next pose. */
+    uint16_t m_sequenceNumber;
+
+    /** Batch frame, which is under construction. */
+    uint8_t m_batchFrame[BATCH_FRAME_SIZE];
+
+    /** Number of poses in the batch frame. */
+    uint8_t m_batchCount;
+
+    /** Timestamp of the last pose in the batch frame in ms. */
+    uint32_t m_lastTimestamp;
+
+    /**
+     * Write a value in little endian byte order into the buffer.
+     *
+     * @param[out] buffer   Destination buffer
+     * @param[in]  value    Value
+     * @param[in]  size     Number of bytes, starting with the least significant byte.
+     *
+     * @return Number of written bytes.
+     */
+    static uint8_t writeLittleEndian(uint8_t* buffer, uint32_t value, uint8_t size);
+
+    /**
+     * Default constructor.
+     * Not allowed.
+     */
+    PoseTelemetry();
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] telemetry Source instance.
+     */
+    PoseTelemetry(const PoseTelemetry& telemetry);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] telemetry Source instance.
+     *
+     * @returns Reference to PoseTelemetry instance.
+     */
+    PoseTelemetry& operator=(const PoseTelemetry& telemetry);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* POSE_TELEMETRY_H */
+/** @} */
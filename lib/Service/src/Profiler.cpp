@@ -0,0 +1,247 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Loop profiler
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <Profiler.h>
+#include <Arduino.h>
+#include <Logging.h>
+#include <Util.h>
+
+#ifdef TARGET_NATIVE
+#include <chrono>
+#endif /* TARGET_NATIVE */
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/* The profiler compiles away completely, if disabled. */
+#if (0 != CONFIG_PROFILER_ENABLE)
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void logUInt(const char* name, uint32_t value);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* Set the logging tag. */
+LOG_TAG("Profiler");
+
+/** Statistics of all sections. */
+static Profiler::Statistics gStatistics[Profiler::SECTION_COUNT];
+
+/** Names of all sections, used for logging. */
+static const char* gSectionNames[Profiler::SECTION_COUNT] = {"BOARD", "SMP", "SPEED", "DD", "ODO", "SM", "POSE"};
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+Timebase::Timestamp Profiler::now()
+{
+#ifdef TARGET_NATIVE
+    std::chrono::microseconds timestamp =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch());
+
+    /* The truncation wraps around consistent with the unsigned arithmetic. */
+    return static_cast<Timebase::Timestamp>(timestamp.count());
+#else  /* TARGET_NATIVE */
+    return Timebase::now();
+#endif /* TARGET_NATIVE */
+}
+
+void Profiler::record(Section section, uint32_t duration)
+{
+    if (SECTION_COUNT > section)
+    {
+        Statistics& statistics = gStatistics[section];
+        uint16_t    value      = (UINT16_MAX < duration) ? UINT16_MAX : static_cast<uint16_t>(duration);
+        uint8_t     bin        = 0U;
+        uint32_t    binLimit   = HISTOGRAM_BIN_0_LIMIT;
+
+        /* Stop recording, if the counter would overflow. It is expected that
+         * the statistics are read and reset periodically.
+         */
+        if (UINT16_MAX > statistics.count)
+        {
+            if ((0U == statistics.count) || (statistics.min > value))
+            {
+                statistics.min = value;
+            }
+
+            if (statistics.max < value)
+            {
+                statistics.max = value;
+            }
+
+            while (((HISTOGRAM_BINS - 1U) > bin) && (binLimit <= value))
+            {
+                binLimit *= 2U;
+                ++bin;
+            }
+
+            ++statistics.histogram[bin];
+            ++statistics.count;
+            statistics.sum += value;
+        }
+    }
+}
+
+bool Profiler::getStatistics(Section section, Statistics& statistics)
+{
+    bool isValid = false;
+
+    if (SECTION_COUNT > section)
+    {
+        statistics = gStatistics[section];
+        isValid    = true;
+    }
+
+    return isValid;
+}
+
+uint16_t Profiler::getMean(const Statistics& statistics)
+{
+    uint16_t mean = 0U;
+
+    if (0U < statistics.count)
+    {
+        mean = static_cast<uint16_t>(statistics.sum / statistics.count);
+    }
+
+    return mean;
+}
+
+void Profiler::reset(Section section)
+{
+    if (SECTION_COUNT > section)
+    {
+        Statistics& statistics = gStatistics[section];
+        uint8_t     bin        = 0U;
+
+        statistics.count = 0U;
+        statistics.min   = 0U;
+        statistics.max   = 0U;
+        statistics.sum   = 0U;
+
+        for (bin = 0U; bin < HISTOGRAM_BINS; ++bin)
+        {
+            statistics.histogram[bin] = 0U;
+        }
+    }
+}
+
+void Profiler::resetAll()
+{
+    uint8_t section = 0U;
+
+    for (section = 0U; section < SECTION_COUNT; ++section)
+    {
+        reset(static_cast<Section>(section));
+    }
+}
+
+void Profiler::logAll()
+{
+    uint8_t section = 0U;
+
+    for (section = 0U; section < SECTION_COUNT; ++section)
+    {
+        const Statistics& statistics = gStatistics[section];
+        uint8_t           bin        = 0U;
+
+        LOG_INFO_HEAD();
+        LOG_INFO_MSG(gSectionNames[section]);
+        logUInt(" n=", statistics.count);
+        logUInt(" min=", statistics.min);
+        logUInt(" max=", statistics.max);
+        logUInt(" mean=", getMean(statistics));
+        LOG_INFO_MSG(" hist=");
+
+        for (bin = 0U; bin < HISTOGRAM_BINS; ++bin)
+        {
+            logUInt((0U == bin) ? "" : ",", statistics.histogram[bin]);
+        }
+
+        LOG_INFO_TAIL();
+
+        reset(static_cast<Section>(section));
+    }
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Log a named unsigned value, without line feed.
+ *
+ * @param[in] name  Name, printed in front of the value.
+ * @param[in] value Value
+ */
+static void logUInt(const char* name, uint32_t value)
+{
+    const size_t BUFFER_SIZE = 11U; /* Max. 10 digits and termination */
+    char         buffer[BUFFER_SIZE];
+
+    Util::uintToStr(buffer, BUFFER_SIZE, value);
+
+    LOG_INFO_MSG(name);
+    LOG_INFO_MSG(buffer);
+}
+
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
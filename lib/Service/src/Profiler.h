@@ -0,0 +1,241 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Loop profiler
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup Service
+ *
+ * @{
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+#ifndef CONFIG_PROFILER_ENABLE
+/** Enable/disable the loop profiler. If disabled, the profiler scopes compile away. */
+#define CONFIG_PROFILER_ENABLE (0)
+#endif /* CONFIG_PROFILER_ENABLE */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <Timebase.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/** Concatenate two tokens, after they are expanded. */
+#define PROFILER_CONCAT(_a, _b)       PROFILER_CONCAT_IMPL(_a, _b)
+
+/** Concatenate two tokens. */
+#define PROFILER_CONCAT_IMPL(_a, _b)  _a##_b
+
+#if (0 != CONFIG_PROFILER_ENABLE)
+
+/**
+ * Measure the execution time from this line until the end of the enclosing scope.
+ *
+ * @param[in] _section  Profiler section, see Profiler::Section.
+ */
+#define PROFILER_SCOPE(_section)      Profiler::Scope PROFILER_CONCAT(profilerScope, __LINE__)(_section)
+
+#else /* (0 != CONFIG_PROFILER_ENABLE) */
+
+/**
+ * Measure the execution time from this line until the end of the enclosing scope.
+ *
+ * @param[in] _section  Profiler section, see Profiler::Section.
+ */
+#define PROFILER_SCOPE(_section)
+
+#endif /* (0 != CONFIG_PROFILER_ENABLE) */
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Loop profiler, which measures the execution time of the main loop sections.
+ *
+ * Every section keeps the min., max. and mean execution time as well as a
+ * histogram. The execution time is measured in us. Use PROFILER_SCOPE() to
+ * measure a section, it compiles away if the profiler is disabled by
+ * CONFIG_PROFILER_ENABLE.
+ */
+namespace Profiler
+{
+    /** Profiled main loop sections. */
+    typedef enum : uint8_t
+    {
+        SECTION_BOARD = 0,          /**< Board::process() */
+        SECTION_SMP,                /**< SerialMuxProt server processing */
+        SECTION_SPEEDOMETER,        /**< Speedometer::process() */
+        SECTION_DIFFERENTIAL_DRIVE, /**< DifferentialDrive::process() */
+        SECTION_ODOMETRY,           /**< Odometry::process() */
+        SECTION_STATE_MACHINE,      /**< System state machine processing */
+        SECTION_POSE_FILTER,        /**< PoseFilter::process() */
+        SECTION_COUNT               /**< Number of sections */
+
+    } Section;
+
+    /** Number of histogram bins. */
+    static const uint8_t HISTOGRAM_BINS = 8U;
+
+    /**
+     * Upper limit in us of the first histogram bin. The limit of every further
+     * bin is doubled. The last bin contains all greater execution times.
+     */
+    static const uint16_t HISTOGRAM_BIN_0_LIMIT = 64U;
+
+    /** Statistics of a single section. */
+    typedef struct
+    {
+        uint16_t count;                     /**< Number of measurements. */
+        uint16_t min;                       /**< Min. execution time in us. */
+        uint16_t max;                       /**< Max. execution time in us. */
+        uint32_t sum;                       /**< Sum of all execution times in us. */
+        uint16_t histogram[HISTOGRAM_BINS]; /**< Number of measurements per bin. */
+
+    } Statistics;
+
+    /**
+     * Get the timestamp for the execution time measurement.
+     *
+     * On the target it is the Timebase. In the simulation the Timebase follows
+     * the simulation time, which doesn't advance while a section is executed.
+     * Therefore the monotonic clock of the host is used there.
+     *
+     * @return Timestamp in us
+     */
+    Timebase::Timestamp now();
+
+    /**
+     * Record a single execution time measurement.
+     *
+     * @param[in] section   Profiler section
+     * @param[in] duration  Execution time in us.
+     */
+    void record(Section section, uint32_t duration);
+
+    /**
+     * Get the statistics of a section.
+     *
+     * @param[in]   section     Profiler section
+     * @param[out]  statistics  Section statistics
+     *
+     * @return If the section is valid, it will return true otherwise false.
+     */
+    bool getStatistics(Section section, Statistics& statistics);
+
+    /**
+     * Get the mean execution time of a section.
+     *
+     * @param[in] statistics    Section statistics
+     *
+     * @return Mean execution time in us.
+     */
+    uint16_t getMean(const Statistics& statistics);
+
+    /**
+     * Reset the statistics of a section.
+     *
+     * @param[in] section   Profiler section
+     */
+    void reset(Section section);
+
+    /**
+     * Reset the statistics of all sections.
+     */
+    void resetAll();
+
+    /**
+     * Log the statistics of all sections with info level and reset them afterwards.
+     */
+    void logAll();
+
+    /**
+     * Profiler scope, which measures the time between its construction and destruction.
+     * Use the PROFILER_SCOPE() macro instead of using it directly.
+     */
+    class Scope
+    {
+    public:
+        /**
+         * Start the measurement.
+         *
+         * @param[in] section   Profiler section
+         */
+        explicit Scope(Section section) : m_section(section), m_startTimestamp(now())
+        {
+        }
+
+        /**
+         * Stop the measurement and record it.
+         */
+        ~Scope()
+        {
+            record(m_section, Timebase::getDuration(m_startTimestamp, now()));
+        }
+
+    private:
+        Section             m_section;        /**< Profiler section */
+        Timebase::Timestamp m_startTimestamp; /**< Timestamp in us at start of the measurement. */
+
+        /**
+         * Copy construction of an instance.
+         * Not allowed.
+         *
+         * @param[in] scope Source instance.
+         */
+        Scope(const Scope& scope);
+
+        /**
+         * Assignment of an instance.
+         * Not allowed.
+         *
+         * @param[in] scope Source instance.
+         *
+         * @returns Reference to Scope instance.
+         */
+        Scope& operator=(const Scope& scope);
+    };
+
+} /* namespace Profiler */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* PROFILER_H */
+/** @} */
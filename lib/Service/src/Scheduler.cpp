@@ -0,0 +1,244 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Cooperative scheduler for periodic tasks
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <Scheduler.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+Scheduler::Scheduler() :
+    m_tasks(),
+    m_order(),
+    m_taskCount(0U),
+    m_isStarted(false),
+    m_lateness(0U),
+    m_deadline(0U)
+{
+}
+
+uint8_t Scheduler::addTask(TaskFunc func, void* userData, uint32_t period, uint8_t priority)
+{
+    uint8_t taskId = INVALID_TASK_ID;
+
+    if ((nullptr != func) && (0U < period) && (MAX_TASKS > m_taskCount))
+    {
+        Task&   task = m_tasks[m_taskCount];
+        uint8_t pos  = m_taskCount;
+
+        task.func     = func;
+        task.userData = userData;
+        task.period   = period;
+        task.deadline = Timebase::now() + Timebase::fromMs(period);
+        task.priority = priority;
+
+        /* Keep the order sorted by priority. Tasks with the same priority are
+         * kept in order of registration.
+         */
+        while ((0U < pos) && (m_tasks[m_order[pos - 1U]].priority > priority))
+        {
+            m_order[pos] = m_order[pos - 1U];
+            --pos;
+        }
+
+        taskId       = m_taskCount;
+        m_order[pos] = taskId;
+        ++m_taskCount;
+    }
+
+    return taskId;
+}
+
+void Scheduler::start()
+{
+    Timebase::Timestamp timestamp = Timebase::now();
+    uint8_t             idx       = 0U;
+
+    for (idx = 0U; idx < m_taskCount; ++idx)
+    {
+        m_tasks[idx].deadline = timestamp + Timebase::fromMs(m_tasks[idx].period);
+    }
+
+    resetStatistics();
+    m_isStarted = true;
+}
+
+void Scheduler::process()
+{
+    uint8_t runs = 0U;
+    uint8_t pos  = 0U;
+
+    /* The number of task runs per call is limited to the number of tasks,
+     * so the remaining main loop is not starved.
+     */
+    while ((true == m_isStarted) && (m_taskCount > pos) && (m_taskCount > runs))
+    {
+        Task&               task      = m_tasks[m_order[pos]];
+        Timebase::Timestamp timestamp = Timebase::now();
+
+        /* The signed difference handles the timestamp overflow. */
+        if (0 <= static_cast<int32_t>(timestamp - task.deadline))
+        {
+            m_lateness = Timebase::getDuration(task.deadline, timestamp) / Timebase::US_PER_MS;
+
+            release(task, timestamp);
+            m_deadline = task.deadline;
+            task.func(task.userData);
+            ++runs;
+
+            /* Search again from the task with the highest priority. */
+            pos = 0U;
+        }
+        else
+        {
+            ++pos;
+        }
+    }
+}
+
+bool Scheduler::setPeriod(uint8_t taskId, uint32_t period)
+{
+    bool isValid = false;
+
+    if ((m_taskCount > taskId) && (0U < period))
+    {
+        m_tasks[taskId].period = period;
+        isValid                = true;
+    }
+
+    return isValid;
+}
+
+bool Scheduler::getStatistics(uint8_t taskId, TaskStatistics& statistics) const
+{
+    bool isValid = false;
+
+    if (m_taskCount > taskId)
+    {
+        statistics = m_tasks[taskId].statistics;
+        isValid    = true;
+    }
+
+    return isValid;
+}
+
+void Scheduler::resetStatistics()
+{
+    uint8_t idx = 0U;
+
+    for (idx = 0U; idx < m_taskCount; ++idx)
+    {
+        TaskStatistics& statistics = m_tasks[idx].statistics;
+
+        statistics.releases  = 0U;
+        statistics.overruns  = 0U;
+        statistics.maxJitter = 0U;
+        statistics.sumJitter = 0U;
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void Scheduler::release(Task& task, Timebase::Timestamp timestamp)
+{
+    TaskStatistics&    statistics = task.statistics;
+    Timebase::Duration period     = Timebase::fromMs(task.period);
+    Timebase::Duration jitter     = Timebase::getDuration(task.deadline, timestamp);
+    uint32_t           jitterMs   = 0U;
+
+    /* Missed complete periods are skipped, but the task stays on its time grid. */
+    if (period <= jitter)
+    {
+        uint32_t missed = jitter / period;
+
+        if (static_cast<uint32_t>(UINT16_MAX - statistics.overruns) < missed)
+        {
+            statistics.overruns = UINT16_MAX;
+        }
+        else
+        {
+            statistics.overruns += static_cast<uint16_t>(missed);
+        }
+
+        task.deadline += missed * period;
+        jitter -= missed * period;
+    }
+
+    task.deadline += period;
+
+    /* The statistics are kept in ms. */
+    jitterMs = jitter / Timebase::US_PER_MS;
+
+    if (statistics.maxJitter < jitterMs)
+    {
+        statistics.maxJitter = static_cast<uint16_t>(jitterMs);
+    }
+
+    ++statistics.releases;
+    statistics.sumJitter += jitterMs;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
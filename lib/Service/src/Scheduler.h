@@ -0,0 +1,248 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Cooperative scheduler for periodic tasks
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup Service
+ *
+ * @{
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+#ifndef CONFIG_SCHEDULER_MAX_TASKS
+/** Max. number of periodic tasks, which can be registered. */
+#define CONFIG_SCHEDULER_MAX_TASKS (7)
+#endif /* CONFIG_SCHEDULER_MAX_TASKS */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <Timebase.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Cooperative scheduler for periodic tasks.
+ *
+ * Every task has a period and a priority. The release time of a task is
+ * derived from its previous deadline and not from the time it was executed.
+ * Therefore the period doesn't drift due to the main loop latency.
+ *
+ * If several tasks are due, the task with the highest priority (lowest value)
+ * runs first. After each task the due tasks are searched again, so a higher
+ * prioritized task doesn't wait for all lower prioritized ones.
+ *
+ * If a task misses one or more complete periods, the missed releases are
+ * skipped and counted as overruns. The task stays on its time grid.
+ *
+ * The periods are given in ms, but the time grid is kept in us by the
+ * Timebase. This way a task can determine its slack precisely.
+ */
+class Scheduler
+{
+public:
+    /**
+     * Task function, which is called by the scheduler.
+     *
+     * @param[in] userData  User data, provided at task registration.
+     */
+    typedef void (*TaskFunc)(void* userData);
+
+    /** Task statistics. */
+    typedef struct
+    {
+        uint32_t releases;  /**< Number of task executions. */
+        uint16_t overruns;  /**< Number of skipped releases, because a complete period was missed. */
+        uint16_t maxJitter; /**< Max. delay in ms between deadline and task execution. */
+        uint32_t sumJitter; /**< Sum of all delays in ms, used to calculate the mean jitter. */
+
+    } TaskStatistics;
+
+    /** Max. number of tasks. */
+    static const uint8_t MAX_TASKS = CONFIG_SCHEDULER_MAX_TASKS;
+
+    /** Invalid task id, returned if a task can not be registered. */
+    static const uint8_t INVALID_TASK_ID = UINT8_MAX;
+
+    /** Highest task priority. The greater the value, the lower the priority. */
+    static const uint8_t PRIORITY_HIGHEST = 0U;
+
+    /**
+     * Constructs the scheduler.
+     */
+    Scheduler();
+
+    /**
+     * Destroys the scheduler.
+     */
+    ~Scheduler()
+    {
+    }
+
+    /**
+     * Register a periodic task.
+     * Tasks with the same priority are executed in the order of registration.
+     *
+     * @param[in] func      Task function
+     * @param[in] userData  User data, which is passed to the task function.
+     * @param[in] period    Period in ms.
+     * @param[in] priority  Priority, where 0 is the highest.
+     *
+     * @return Task id. If no task slot is available, it will return INVALID_TASK_ID.
+     */
+    uint8_t addTask(TaskFunc func, void* userData, uint32_t period, uint8_t priority);
+
+    /**
+     * Start all registered tasks. The first release of every task is one
+     * period after the start. The task statistics are reset.
+     */
+    void start();
+
+    /**
+     * Execute all due tasks in order of their priority.
+     * Call it periodically in the main loop.
+     */
+    void process();
+
+    /**
+     * Change the period of a task. The already scheduled release is kept,
+     * the following releases use the new period.
+     *
+     * @param[in] taskId    Task id
+     * @param[in] period    Period in ms.
+     *
+     * @return If the task id and the period are valid, it will return true otherwise false.
+     */
+    bool setPeriod(uint8_t taskId, uint32_t period);
+
+    /**
+     * Get the lateness of the task, which is currently executed. It is the
+     * time between its deadline and its execution, inclusive missed periods.
+     * Call it only inside a task function.
+     *
+     * @return Lateness in ms
+     */
+    uint32_t getLateness() const
+    {
+        return m_lateness;
+    }
+
+    /**
+     * Get the deadline of the task, which is currently executed. It is the
+     * end of its current period, i.e. its release plus its period.
+     * Call it only inside a task function.
+     *
+     * @return Deadline timestamp in us
+     */
+    Timebase::Timestamp getDeadline() const
+    {
+        return m_deadline;
+    }
+
+    /**
+     * Get the statistics of a task.
+     *
+     * @param[in]   taskId      Task id
+     * @param[out]  statistics  Task statistics
+     *
+     * @return If the task id is valid, it will return true otherwise false.
+     */
+    bool getStatistics(uint8_t taskId, TaskStatistics& statistics) const;
+
+    /**
+     * Reset the statistics of all tasks.
+     */
+    void resetStatistics();
+
+protected:
+private:
+    /** A single periodic task. */
+    typedef struct
+    {
+        TaskFunc            func;       /**< Task function */
+        void*               userData;   /**< User data, passed to the task function. */
+        uint32_t            period;     /**< Period in ms */
+        Timebase::Timestamp deadline;   /**< Absolute timestamp in us of the next release. */
+        uint8_t             priority;   /**< Task priority */
+        TaskStatistics      statistics; /**< Task statistics */
+
+    } Task;
+
+    Task                m_tasks[MAX_TASKS]; /**< Tasks in order of registration. The index is the task id. */
+    uint8_t             m_order[MAX_TASKS]; /**< Task ids in order of their priority. */
+    uint8_t             m_taskCount;        /**< Number of registered tasks. */
+    bool                m_isStarted;        /**< Is scheduler started? */
+    uint32_t            m_lateness;         /**< Lateness in ms of the currently executed task. */
+    Timebase::Timestamp m_deadline;         /**< Deadline in us of the currently executed task. */
+
+    /**
+     * Release a task, which is due. It updates the deadline and the statistics.
+     *
+     * @param[in] task      The task to release.
+     * @param[in] timestamp Current timestamp in us.
+     */
+    void release(Task& task, Timebase::Timestamp timestamp);
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] scheduler Source instance.
+     */
+    Scheduler(const Scheduler& scheduler);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] scheduler Source instance.
+     *
+     * @returns Reference to Scheduler instance.
+     */
+    Scheduler& operator=(const Scheduler& scheduler);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* SCHEDULER_H */
+/** @} */
@@ -0,0 +1,262 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Setpoint conditioning of remote setpoints
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "SetpointConditioner.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static int16_t limitToInt16(int32_t value);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+SetpointConditioner::SetpointConditioner() :
+    m_delay(DEFAULT_DELAY),
+    m_maxExtrapolation(DEFAULT_MAX_EXTRAPOLATION),
+    m_timeout(DEFAULT_TIMEOUT),
+    m_rampDuration(DEFAULT_RAMP_DURATION),
+    m_setpoints(),
+    m_setpointCount(0U),
+    m_output(),
+    m_isTimeout(false),
+    m_rampStart(),
+    m_rampStartTimestamp(0U)
+{
+}
+
+void SetpointConditioner::reset()
+{
+    uint8_t idx = 0U;
+
+    m_setpointCount = 0U;
+    m_isTimeout     = false;
+
+    for (idx = 0U; idx < NUM_VALUES; ++idx)
+    {
+        m_output[idx] = 0;
+    }
+}
+
+void SetpointConditioner::write(int16_t value0, int16_t value1, Timebase::Timestamp timestamp)
+{
+    /* After a timeout the old setpoint is outdated and not used anymore. */
+    if ((0U == m_setpointCount) || (true == m_isTimeout))
+    {
+        m_setpointCount = 1U;
+        m_isTimeout     = false;
+    }
+    else
+    {
+        m_setpoints[0U] = m_setpoints[1U];
+        m_setpointCount = 2U;
+    }
+
+    m_setpoints[1U].values[0U] = value0;
+    m_setpoints[1U].values[1U] = value1;
+    m_setpoints[1U].timestamp  = timestamp;
+}
+
+void SetpointConditioner::process(Timebase::Timestamp timestamp, int16_t& value0, int16_t& value1)
+{
+    if (0U < m_setpointCount)
+    {
+        if ((false == m_isTimeout) && (0U < m_timeout) &&
+            (Timebase::fromMs(m_timeout) < Timebase::getDuration(m_setpoints[1U].timestamp, timestamp)))
+        {
+            m_isTimeout          = true;
+            m_rampStart[0U]      = m_output[0U];
+            m_rampStart[1U]      = m_output[1U];
+            m_rampStartTimestamp = timestamp;
+        }
+
+        if (true == m_isTimeout)
+        {
+            calculateRamp(timestamp, m_output);
+        }
+        else
+        {
+            calculateOutput(timestamp, m_output);
+        }
+    }
+
+    value0 = m_output[0U];
+    value1 = m_output[1U];
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void SetpointConditioner::calculateOutput(Timebase::Timestamp timestamp, int16_t* output) const
+{
+    const Setpoint&     newest      = m_setpoints[1U];
+    const Setpoint&     oldest      = m_setpoints[0U];
+    Timebase::Timestamp query       = timestamp - Timebase::fromMs(m_delay);
+    uint32_t            interval    = Timebase::getDuration(oldest.timestamp, newest.timestamp) / Timebase::US_PER_MS;
+    int32_t             sinceOldest = static_cast<int32_t>(query - oldest.timestamp);
+    int32_t             sinceNewest = static_cast<int32_t>(query - newest.timestamp);
+    uint8_t             idx         = 0U;
+
+    /* A single setpoint or a step is not interpolated. */
+    if ((1U == m_setpointCount) || (0U == interval) || (MAX_INTERVAL < interval))
+    {
+        const Setpoint& setpoint = ((1U < m_setpointCount) && (0 > sinceNewest)) ? oldest : newest;
+
+        for (idx = 0U; idx < NUM_VALUES; ++idx)
+        {
+            output[idx] = setpoint.values[idx];
+        }
+    }
+    /* Before the oldest setpoint, which is only possible with a long delay. */
+    else if (0 >= sinceOldest)
+    {
+        for (idx = 0U; idx < NUM_VALUES; ++idx)
+        {
+            output[idx] = oldest.values[idx];
+        }
+    }
+    else
+    {
+        uint32_t time = 0U;
+
+        /* Interpolation between the setpoints? */
+        if (0 >= sinceNewest)
+        {
+            time = static_cast<uint32_t>(sinceOldest) / Timebase::US_PER_MS;
+        }
+        /* Extrapolation after the newest setpoint, which is limited. */
+        else
+        {
+            uint32_t extrapolation = static_cast<uint32_t>(sinceNewest) / Timebase::US_PER_MS;
+
+            if (m_maxExtrapolation < extrapolation)
+            {
+                extrapolation = m_maxExtrapolation;
+            }
+
+            if (MAX_INTERVAL < extrapolation)
+            {
+                extrapolation = MAX_INTERVAL;
+            }
+
+            time = interval + extrapolation;
+        }
+
+        for (idx = 0U; idx < NUM_VALUES; ++idx)
+        {
+            int32_t delta = static_cast<int32_t>(newest.values[idx]) - oldest.values[idx];
+
+            output[idx] = limitToInt16(oldest.values[idx] + ((delta * static_cast<int32_t>(time)) /
+                                                             static_cast<int32_t>(interval)));
+        }
+    }
+}
+
+void SetpointConditioner::calculateRamp(Timebase::Timestamp timestamp, int16_t* output) const
+{
+    uint32_t elapsed = Timebase::getDuration(m_rampStartTimestamp, timestamp) / Timebase::US_PER_MS;
+    uint8_t  idx     = 0U;
+
+    for (idx = 0U; idx < NUM_VALUES; ++idx)
+    {
+        if (m_rampDuration <= elapsed)
+        {
+            output[idx] = 0;
+        }
+        else
+        {
+            int32_t remaining = static_cast<int32_t>(m_rampDuration - elapsed);
+
+            output[idx] = static_cast<int16_t>((m_rampStart[idx] * remaining) / static_cast<int32_t>(m_rampDuration));
+        }
+    }
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Limit a value to the int16_t range.
+ *
+ * @param[in] value Value
+ *
+ * @return Limited value
+ */
+static int16_t limitToInt16(int32_t value)
+{
+    int16_t result = 0;
+
+    if (INT16_MIN > value)
+    {
+        result = INT16_MIN;
+    }
+    else if (INT16_MAX < value)
+    {
+        result = INT16_MAX;
+    }
+    else
+    {
+        result = static_cast<int16_t>(value);
+    }
+
+    return result;
+}
@@ -0,0 +1,284 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Setpoint conditioning of remote setpoints
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup Service
+ *
+ * @{
+ */
+
+#ifndef SETPOINT_CONDITIONER_H
+#define SETPOINT_CONDITIONER_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include "Timebase.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Conditions a pair of setpoints, which are received at irregular points in
+ * time, e.g. via a jittery link, for a periodic control.
+ *
+ * Every setpoint is timestamped on reception. The output follows the
+ * setpoints with a configurable delay. If the output time lies between two
+ * setpoints, it is interpolated. If it lies after the last setpoint, it is
+ * extrapolated up to the max. extrapolation time and held afterwards.
+ *
+ * If no setpoint is received within the timeout, the output is ramped down to
+ * zero (watchdog).
+ */
+class SetpointConditioner
+{
+public:
+    /** Default interpolation delay in ms. */
+    static const uint32_t DEFAULT_DELAY = 0U;
+
+    /** Default max. extrapolation time in ms. */
+    static const uint32_t DEFAULT_MAX_EXTRAPOLATION = 0U;
+
+    /** Default watchdog timeout in ms. */
+    static const uint32_t DEFAULT_TIMEOUT = 500U;
+
+    /** Default ramp duration in ms to ramp down to zero after a timeout. */
+    static const uint32_t DEFAULT_RAMP_DURATION = 250U;
+
+    /** Max. ramp duration in ms. It avoids an overflow. */
+    static const uint32_t MAX_RAMP_DURATION = UINT16_MAX;
+
+    /**
+     * Constructs the setpoint conditioner.
+     */
+    SetpointConditioner();
+
+    /**
+     * Destroys the setpoint conditioner.
+     */
+    ~SetpointConditioner()
+    {
+    }
+
+    /**
+     * Get the interpolation delay.
+     *
+     * @return Delay in ms
+     */
+    uint32_t getDelay() const
+    {
+        return m_delay;
+    }
+
+    /**
+     * Set the interpolation delay. It shall be about the setpoint period to
+     * interpolate between the received setpoints. 0 disables the interpolation.
+     *
+     * @param[in] delay Delay in ms
+     */
+    void setDelay(uint32_t delay)
+    {
+        m_delay = delay;
+    }
+
+    /**
+     * Get the max. extrapolation time.
+     *
+     * @return Max. extrapolation time in ms
+     */
+    uint32_t getMaxExtrapolation() const
+    {
+        return m_maxExtrapolation;
+    }
+
+    /**
+     * Set the max. extrapolation time. After this time the last setpoint is held.
+     * 0 disables the extrapolation.
+     *
+     * @param[in] maxExtrapolation  Max. extrapolation time in ms
+     */
+    void setMaxExtrapolation(uint32_t maxExtrapolation)
+    {
+        m_maxExtrapolation = maxExtrapolation;
+    }
+
+    /**
+     * Get the watchdog timeout.
+     *
+     * @return Timeout in ms
+     */
+    uint32_t getTimeout() const
+    {
+        return m_timeout;
+    }
+
+    /**
+     * Set the watchdog timeout. 0 disables the watchdog.
+     *
+     * @param[in] timeout   Timeout in ms
+     */
+    void setTimeout(uint32_t timeout)
+    {
+        m_timeout = timeout;
+    }
+
+    /**
+     * Get the ramp duration after a timeout.
+     *
+     * @return Ramp duration in ms
+     */
+    uint32_t getRampDuration() const
+    {
+        return m_rampDuration;
+    }
+
+    /**
+     * Set the ramp duration after a timeout. 0 results in an immediate stop.
+     *
+     * @param[in] rampDuration  Ramp duration in ms, max. MAX_RAMP_DURATION
+     */
+    void setRampDuration(uint32_t rampDuration)
+    {
+        m_rampDuration = (MAX_RAMP_DURATION < rampDuration) ? MAX_RAMP_DURATION : rampDuration;
+    }
+
+    /**
+     * Reset the conditioner. All received setpoints are discarded and the
+     * output is zero.
+     */
+    void reset();
+
+    /**
+     * Write a received setpoint.
+     *
+     * @param[in] value0    First value of the setpoint.
+     * @param[in] value1    Second value of the setpoint.
+     * @param[in] timestamp Reception timestamp in us.
+     */
+    void write(int16_t value0, int16_t value1, Timebase::Timestamp timestamp);
+
+    /**
+     * Calculate the output. It shall be called periodically.
+     *
+     * @param[in]  timestamp    Current timestamp in us.
+     * @param[out] value0       First value of the output.
+     * @param[out] value1       Second value of the output.
+     */
+    void process(Timebase::Timestamp timestamp, int16_t& value0, int16_t& value1);
+
+    /**
+     * Is the watchdog timeout elapsed?
+     *
+     * @return If elapsed, it will return true otherwise false.
+     */
+    bool isTimeout() const
+    {
+        return m_isTimeout;
+    }
+
+private:
+    /** Number of values per setpoint. */
+    static const uint8_t NUM_VALUES = 2U;
+
+    /**
+     * Max. time in ms between two setpoints, which are interpolated or used
+     * for extrapolation. Setpoints with a larger time in between are handled
+     * as a step. It avoids an overflow.
+     */
+    static const uint32_t MAX_INTERVAL = 1000U;
+
+    /** A setpoint with its reception timestamp. */
+    struct Setpoint
+    {
+        int16_t             values[NUM_VALUES]; /**< Setpoint values */
+        Timebase::Timestamp timestamp;          /**< Reception timestamp in us */
+    };
+
+    uint32_t            m_delay;                 /**< Interpolation delay in ms. */
+    uint32_t            m_maxExtrapolation;      /**< Max. extrapolation time in ms. */
+    uint32_t            m_timeout;               /**< Watchdog timeout in ms. */
+    uint32_t            m_rampDuration;          /**< Ramp duration in ms after a timeout. */
+    Setpoint            m_setpoints[2U];         /**< The last two setpoints, the newest one at index 1. */
+    uint8_t             m_setpointCount;         /**< Number of valid setpoints. */
+    int16_t             m_output[NUM_VALUES];    /**< Last output. */
+    bool                m_isTimeout;             /**< Is the watchdog timeout elapsed? */
+    int16_t             m_rampStart[NUM_VALUES]; /**< Output at the begin of the ramp. */
+    Timebase::Timestamp m_rampStartTimestamp;    /**< Timestamp in us at the begin of the ramp. */
+
+    /**
+     * Calculate the output from the received setpoints.
+     *
+     * @param[in]  timestamp    Current timestamp in us.
+     * @param[out] output       Output values.
+     */
+    void calculateOutput(Timebase::Timestamp timestamp, int16_t* output) const;
+
+    /**
+     * Calculate the ramp down output after a timeout.
+     *
+     * @param[in]  timestamp    Current timestamp in us.
+     * @param[out] output       Output values.
+     */
+    void calculateRamp(Timebase::Timestamp timestamp, int16_t* output) const;
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] conditioner   Source instance.
+     */
+    SetpointConditioner(const SetpointConditioner& conditioner);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] conditioner   Source instance.
+     *
+     * @returns Reference to SetpointConditioner instance.
+     */
+    SetpointConditioner& operator=(const SetpointConditioner& conditioner);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* SETPOINT_CONDITIONER_H */
+/** @} */
@@ -0,0 +1,145 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Wheel slip detector, which cross-checks the encoders with the IMU
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "SlipDetector.h"
+#include <Arduino.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+void SlipDetector::reset()
+{
+    m_imuSpeed       = 0;
+    m_isSpeedValid   = false;
+    m_isSlipDetected = false;
+    m_holdTime       = 0U;
+}
+
+void SlipDetector::process(uint16_t period, int32_t encoderTurnRate, int32_t gyroTurnRate, int32_t encoderSpeed,
+                           int32_t acceleration)
+{
+    int32_t turnRateDeviation = encoderTurnRate - gyroTurnRate; /* [mrad/s] */
+    int32_t speedDeviation    = 0;                              /* [um/s] */
+    bool    isDeviation       = false;
+
+    /* The integrated speed starts with the encoder speed. */
+    if (false == m_isSpeedValid)
+    {
+        m_imuSpeed     = encoderSpeed * 1000;
+        m_isSpeedValid = true;
+    }
+    else
+    {
+        m_imuSpeed += acceleration * static_cast<int32_t>(period);
+    }
+
+    speedDeviation = (encoderSpeed * 1000) - m_imuSpeed;
+
+    /* Pull the integrated speed towards the encoder speed to compensate the accelerometer bias. */
+    m_imuSpeed += speedDeviation / SPEED_CORRECTION_STEPS;
+
+    if ((static_cast<int32_t>(m_turnRateThreshold) < abs(turnRateDeviation)) ||
+        ((static_cast<int32_t>(m_speedThreshold) * 1000) < abs(speedDeviation)))
+    {
+        isDeviation = true;
+    }
+
+    if (true == isDeviation)
+    {
+        if (false == m_isSlipDetected)
+        {
+            m_isSlipDetected = true;
+
+            if (UINT16_MAX > m_slipEventCount)
+            {
+                ++m_slipEventCount;
+            }
+        }
+
+        m_holdTime = 0U;
+    }
+    else if (true == m_isSlipDetected)
+    {
+        if ((SLIP_HOLD_TIME - m_holdTime) <= period)
+        {
+            m_isSlipDetected = false;
+            m_holdTime       = 0U;
+        }
+        else
+        {
+            m_holdTime += period;
+        }
+    }
+    else
+    {
+        ;
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,207 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Wheel slip detector, which cross-checks the encoders with the IMU
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup Service
+ *
+ * @{
+ */
+
+#ifndef SLIP_DETECTOR_H
+#define SLIP_DETECTOR_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The slip detector compares the movement derived from the wheel encoders with
+ * the movement measured by the IMU. It shall be processed every control period.
+ *
+ * Wheel slip is detected, if
+ * - the encoder turn rate deviates from the gyro turn rate or
+ * - the encoder speed deviates from the speed, which is integrated from the
+ *   accelerometer. The integrated speed is pulled slowly towards the encoder
+ *   speed, which compensates the accelerometer bias. A slipping wheel spins up
+ *   or down faster than the robot can accelerate, so the deviation rises.
+ *
+ * The slip is released after the deviations are below their thresholds for
+ * a hold time. Every detected slip counts as slip event.
+ */
+class SlipDetector
+{
+public:
+    /** Default turn rate deviation in [mrad/s] for the slip detection. */
+    static const uint16_t DEFAULT_TURN_RATE_THRESHOLD = 1000U;
+
+    /** Default speed deviation in [mm/s] for the slip detection. */
+    static const uint16_t DEFAULT_SPEED_THRESHOLD = 100U;
+
+    /** Time in [ms] the deviations shall be below their thresholds, until the slip is released. */
+    static const uint16_t SLIP_HOLD_TIME = 50U;
+
+    /**
+     * Constructs the slip detector.
+     */
+    SlipDetector() :
+        m_turnRateThreshold(DEFAULT_TURN_RATE_THRESHOLD),
+        m_speedThreshold(DEFAULT_SPEED_THRESHOLD),
+        m_imuSpeed(0),
+        m_isSpeedValid(false),
+        m_isSlipDetected(false),
+        m_holdTime(0U),
+        m_slipEventCount(0U)
+    {
+    }
+
+    /**
+     * Destroys the slip detector.
+     */
+    ~SlipDetector()
+    {
+    }
+
+    /**
+     * Reset the slip detection. The slip event counter is kept.
+     */
+    void reset();
+
+    /**
+     * Set the turn rate deviation, which is considered as wheel slip.
+     *
+     * @param[in] threshold Turn rate deviation in [mrad/s].
+     */
+    void setTurnRateThreshold(uint16_t threshold)
+    {
+        m_turnRateThreshold = threshold;
+    }
+
+    /**
+     * Set the speed deviation, which is considered as wheel slip.
+     *
+     * @param[in] threshold Speed deviation in [mm/s].
+     */
+    void setSpeedThreshold(uint16_t threshold)
+    {
+        m_speedThreshold = threshold;
+    }
+
+    /**
+     * Process the slip detection.
+     *
+     * @param[in] period            Time since the last processing in [ms].
+     * @param[in] encoderTurnRate   Turn rate derived from the encoders in [mrad/s].
+     * @param[in] gyroTurnRate      Turn rate measured by the gyro in [mrad/s].
+     * @param[in] encoderSpeed      Linear center speed derived from the encoders in [mm/s].
+     * @param[in] acceleration      Acceleration in driving direction, measured by the accelerometer in [mm/s^2].
+     */
+    void process(uint16_t period, int32_t encoderTurnRate, int32_t gyroTurnRate, int32_t encoderSpeed,
+                 int32_t acceleration);
+
+    /**
+     * Is wheel slip detected?
+     *
+     * @return If wheel slip is detected, it will return true otherwise false.
+     */
+    bool isSlipDetected() const
+    {
+        return m_isSlipDetected;
+    }
+
+    /**
+     * Get the number of slip events. It saturates at its max. value.
+     *
+     * @return Number of slip events
+     */
+    uint16_t getSlipEventCount() const
+    {
+        return m_slipEventCount;
+    }
+
+    /**
+     * Clear the number of slip events.
+     */
+    void clearSlipEventCount()
+    {
+        m_slipEventCount = 0U;
+    }
+
+private:
+    /**
+     * Number of processings, which determines the time constant of pulling the
+     * integrated speed towards the encoder speed.
+     */
+    static const int32_t SPEED_CORRECTION_STEPS = 16;
+
+    uint16_t m_turnRateThreshold; /**< Turn rate deviation in [mrad/s] for the slip detection. */
+    uint16_t m_speedThreshold;    /**< Speed deviation in [mm/s] for the slip detection. */
+    int32_t  m_imuSpeed;          /**< Speed integrated from the accelerometer in [um/s]. */
+    bool     m_isSpeedValid;      /**< Is the integrated speed initialized? */
+    bool     m_isSlipDetected;    /**< Is wheel slip detected? */
+    uint16_t m_holdTime;          /**< Time in [ms] since the deviations are below their thresholds during slip. */
+    uint16_t m_slipEventCount;    /**< Number of slip events. */
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] detector Source instance.
+     */
+    SlipDetector(const SlipDetector& detector);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] detector Source instance.
+     *
+     * @returns Reference to SlipDetector instance.
+     */
+    SlipDetector& operator=(const SlipDetector& detector);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* SLIP_DETECTOR_H */
+/** @} */
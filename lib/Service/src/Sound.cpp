@@ -36,6 +36,7 @@
 #include <stdint.h>
 #include <Board.h>
 #include <Arduino.h>
+#include <SimpleTimer.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -49,6 +50,15 @@
  * Types and classes
  *****************************************************************************/
 
+/** A single tone, followed by silence. */
+typedef struct
+{
+    uint16_t frequency; /**< Frequency in Hz */
+    uint16_t duration;  /**< Tone duration in ms */
+    uint16_t silence;   /**< Silence duration in ms after the tone */
+
+} Tone;
+
 /******************************************************************************
  * Prototypes
  *****************************************************************************/
@@ -57,6 +67,18 @@
  * Local Variables
  *****************************************************************************/
 
+/** Queued tones, which are not played yet. */
+static Tone gToneQueue[CONFIG_SOUND_QUEUE_SIZE];
+
+/** Index of the next tone in the queue. */
+static uint8_t gToneQueueIdx = 0U;
+
+/** Number of tones in the queue. */
+static uint8_t gToneQueueCount = 0U;
+
+/** Timer for the current tone and its following silence. */
+static SimpleTimer gToneTimer;
+
 /** Alarm frequency in Hz. */
 static const uint16_t ALARM_FREQ = 500;
 
@@ -140,40 +162,48 @@ static const char gStarWarsMelody[] PROGMEM = "! O2 T100 MS"
  * External Functions
  *****************************************************************************/
 
-void Sound::playAlarm()
+bool Sound::playTone(uint16_t frequency, uint16_t duration, uint16_t silence)
 {
-    IBuzzer& buzzer = Board::getInstance().getBuzzer();
+    bool isQueued = false;
+
+    if (CONFIG_SOUND_QUEUE_SIZE > gToneQueueCount)
+    {
+        Tone& tone = gToneQueue[(gToneQueueIdx + gToneQueueCount) % CONFIG_SOUND_QUEUE_SIZE];
 
+        tone.frequency = frequency;
+        tone.duration  = duration;
+        tone.silence   = silence;
+
+        ++gToneQueueCount;
+        isQueued = true;
+
+        /* Start it immediately, if nothing else is playing. */
+        process();
+    }
+
+    return isQueued;
+}
+
+void Sound::playAlarm()
+{
     /* Req. 3.4.5-2:
      * The Sound shall play two consecutive sounds of 500Hz frequency and 1/3s duration,
      * interrupted by 1/3s of silence.
+     * Both tones are queued together, so the alarm is either played completely or not at all.
      */
-    buzzer.playFrequency(ALARM_FREQ, ALARM_DURATION, VOLUME);
-    while (true == buzzer.isPlaying())
+    if ((gToneQueueCount + 2U) <= CONFIG_SOUND_QUEUE_SIZE)
     {
-        /* Only required for simulation:
-         * 1) The sound is stopped by the buzzer process(). Without stopping it,
-         * the isPlaying() will always return true.
-         * 2) The simulation time must be stepped forward, otherwise during process()
-         * the sound won't stop. The workaround is here to use a delay() which
-         * internally ticks the simulation time.
-         */
-        buzzer.process();
-        delay(1U);
+        (void)playTone(ALARM_FREQ, ALARM_DURATION, SILENCE_DURATION);
+        (void)playTone(ALARM_FREQ, ALARM_DURATION, 0U);
     }
-
-    delay(SILENCE_DURATION);
-    buzzer.playFrequency(ALARM_FREQ, ALARM_DURATION, VOLUME);
 }
 
 void Sound::playBeep()
 {
-    IBuzzer& buzzer = Board::getInstance().getBuzzer();
-
     /* Req. 3.4.5-1:
      * The Sound shall play a sound of 1000Hz frequency and 1s duration.
      */
-    buzzer.playFrequency(BEEP_FREQ, BEEP_DURATION, VOLUME);
+    (void)playTone(BEEP_FREQ, BEEP_DURATION, 0U);
 }
 
 void Sound::playMelody(Melody melody)
@@ -197,10 +227,45 @@ void Sound::playMelody(Melody melody)
 
     if (nullptr != song)
     {
+        clear();
+        gToneTimer.stop();
+
         buzzer.playMelodyPGM(song);
     }
 }
 
+void Sound::clear()
+{
+    gToneQueueIdx   = 0U;
+    gToneQueueCount = 0U;
+}
+
+bool Sound::isPlaying()
+{
+    return (0U < gToneQueueCount) || (true == gToneTimer.isRunning());
+}
+
+void Sound::process()
+{
+    /* The current tone and its silence are over? */
+    if ((true == gToneTimer.isRunning()) && (true == gToneTimer.isTimeout()))
+    {
+        gToneTimer.stop();
+    }
+
+    if ((false == gToneTimer.isRunning()) && (0U < gToneQueueCount))
+    {
+        IBuzzer&    buzzer = Board::getInstance().getBuzzer();
+        const Tone& tone   = gToneQueue[gToneQueueIdx];
+
+        buzzer.playFrequency(tone.frequency, tone.duration, VOLUME);
+        gToneTimer.start(static_cast<uint32_t>(tone.duration) + tone.silence);
+
+        gToneQueueIdx = (gToneQueueIdx + 1U) % CONFIG_SOUND_QUEUE_SIZE;
+        --gToneQueueCount;
+    }
+}
+
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
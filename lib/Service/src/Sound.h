@@ -40,9 +40,15 @@
  * Compile Switches
  *****************************************************************************/
 
+#ifndef CONFIG_SOUND_QUEUE_SIZE
+/** Max. number of queued tones. */
+#define CONFIG_SOUND_QUEUE_SIZE (4)
+#endif /* CONFIG_SOUND_QUEUE_SIZE */
+
 /******************************************************************************
  * Includes
  *****************************************************************************/
+#include <stdint.h>
 
 /** The buzzer can play different kind of notification sounds. */
 namespace Sound
@@ -70,23 +76,55 @@ typedef enum
  * Functions
  *****************************************************************************/
 
+/**
+ * Queue a tone, followed by silence. The tones are played one after another
+ * by process(), the caller is never blocked.
+ *
+ * @param[in] frequency Tone frequency in Hz.
+ * @param[in] duration  Tone duration in ms.
+ * @param[in] silence   Silence duration in ms after the tone.
+ *
+ * @return If the tone is queued, it will return true otherwise false, because the queue is full.
+ */
+bool playTone(uint16_t frequency, uint16_t duration, uint16_t silence);
+
 /**
  * Play alarm tone.
+ * It is queued and doesn't block.
  */
 void playAlarm();
 
 /**
  * Play beep tone.
+ * It is queued and doesn't block.
  */
 void playBeep();
 
 /**
  * Play melody.
+ * All queued tones are discarded.
  * 
  * @param[in] melody Choose the melody which to play.
  */
 void playMelody(Melody melody);
 
+/**
+ * Discard all queued tones. A tone in progress ends after its duration.
+ */
+void clear();
+
+/**
+ * Is a tone or its following silence in progress or are tones queued?
+ *
+ * @return If busy, it will return true otherwise false.
+ */
+bool isPlaying();
+
+/**
+ * Play the queued tones one after another. Call it periodically in the main loop.
+ */
+void process();
+
 }
 
 #endif /* SOUND_H */
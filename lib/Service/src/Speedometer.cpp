@@ -64,13 +64,14 @@ Speedometer Speedometer::m_instance;
 
 void Speedometer::process()
 {
-    IMotors&      motors         = Board::getInstance().getMotors();
-    uint32_t      timestamp      = millis();                       /* [ms] */
-    int32_t       diffStepsLeft  = m_relEncoders.getCountsLeft();  /* [steps] */
-    int32_t       diffStepsRight = m_relEncoders.getCountsRight(); /* [steps] */
-    const int32_t ONE_SECOND     = 1000;                           /* 1s in ms */
-    bool          resetLeft      = false;
-    bool          resetRight     = false;
+    IMotors&            motors         = Board::getInstance().getMotors();
+    Timebase::Timestamp timestamp      = Timebase::now();                                    /* [us] */
+    int32_t             diffStepsLeft  = m_relEncoders.getCountsLeft();                      /* [steps] */
+    int32_t             diffStepsRight = m_relEncoders.getCountsRight();                     /* [steps] */
+    Timebase::Duration  dTimeLeft      = Timebase::getDuration(m_timestampLeft, timestamp);  /* [us] */
+    Timebase::Duration  dTimeRight     = Timebase::getDuration(m_timestampRight, timestamp); /* [us] */
+    bool                resetLeft      = false;
+    bool                resetRight     = false;
 
     if (0 == motors.getLeftSpeed())
     {
@@ -121,11 +122,9 @@ void Speedometer::process()
         m_relEncoders.clearLeft();
     }
     /* Moved long enough to be able to calculate the linear speed? */
-    else if (MIN_ENCODER_COUNT <= abs(diffStepsLeft))
+    else if ((MIN_ENCODER_COUNT <= abs(diffStepsLeft)) && (SPEED_TIME_UNIT <= dTimeLeft))
     {
-        uint32_t dTimeLeft = timestamp - m_timestampLeft; /* [ms] */
-
-        m_linearSpeedLeft = diffStepsLeft * ONE_SECOND / static_cast<int32_t>(dTimeLeft);
+        m_linearSpeedLeft = calculateLinearSpeed(diffStepsLeft, dTimeLeft);
         m_timestampLeft   = timestamp;
 
         m_relEncoders.clearLeft();
@@ -143,11 +142,9 @@ void Speedometer::process()
         m_relEncoders.clearRight();
     }
     /* Moved long enough to be able to calculate the linear speed? */
-    else if (MIN_ENCODER_COUNT <= abs(diffStepsRight))
+    else if ((MIN_ENCODER_COUNT <= abs(diffStepsRight)) && (SPEED_TIME_UNIT <= dTimeRight))
     {
-        uint32_t dTimeRight = timestamp - m_timestampRight; /* [ms] */
-
-        m_linearSpeedRight = diffStepsRight * ONE_SECOND / static_cast<int32_t>(dTimeRight);
+        m_linearSpeedRight = calculateLinearSpeed(diffStepsRight, dTimeRight);
         m_timestampRight   = timestamp;
 
         m_relEncoders.clearRight();
@@ -185,6 +182,14 @@ int16_t Speedometer::getLinearSpeedRight() const
  * Private Methods
  *****************************************************************************/
 
+int16_t Speedometer::calculateLinearSpeed(int32_t steps, Timebase::Duration duration)
+{
+    const int32_t ONE_SECOND = static_cast<int32_t>(1000000U / SPEED_TIME_UNIT); /* 1s in SPEED_TIME_UNIT */
+    int32_t       units      = static_cast<int32_t>(duration / SPEED_TIME_UNIT);
+
+    return static_cast<int16_t>(steps * ONE_SECOND / units);
+}
+
 Speedometer::Direction Speedometer::getDirectionLeft()
 {
     IMotors& motors = Board::getInstance().getMotors();
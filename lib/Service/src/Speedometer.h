@@ -47,6 +47,7 @@
 #include <Board.h>
 #include <RelativeEncoders.h>
 #include <RobotConstants.h>
+#include <Timebase.h>
 
 /******************************************************************************
  * Macros
@@ -114,17 +115,23 @@ private:
      */
     static const int32_t MIN_ENCODER_COUNT = static_cast<int32_t>(RobotConstants::ENCODER_RESOLUTION / 2U);
 
+    /**
+     * Time unit in us, used for the speed calculation. The elapsed time is
+     * reduced to it, so the intermediate result still fits into 32 bit.
+     */
+    static const uint32_t SPEED_TIME_UNIT = 10U;
+
     /** Speedometer instance */
     static Speedometer m_instance;
 
     /** Relative encoder left/right */
     RelativeEncoders m_relEncoders;
 
-    /** Timestamp of last left speed calculation. */
-    uint32_t m_timestampLeft;
+    /** Timestamp in us of last left speed calculation. */
+    Timebase::Timestamp m_timestampLeft;
 
-    /** Timestamp of last right speed calculation. */
-    uint32_t m_timestampRight;
+    /** Timestamp in us of last right speed calculation. */
+    Timebase::Timestamp m_timestampRight;
 
     /** Linear speed left in steps/s */
     int16_t m_linearSpeedLeft;
@@ -199,6 +206,16 @@ private:
      * @return Direction of movement.
      */
     Direction getDirectionByMotorSpeed(int16_t motorSpeed);
+
+    /**
+     * Calculate the linear speed by the driven steps and the elapsed time.
+     *
+     * @param[in] steps     Driven encoder steps
+     * @param[in] duration  Elapsed time in us, at least SPEED_TIME_UNIT.
+     *
+     * @return Linear speed in steps/s
+     */
+    static int16_t calculateLinearSpeed(int32_t steps, Timebase::Duration duration);
 };
 
 /******************************************************************************
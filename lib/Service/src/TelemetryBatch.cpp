@@ -0,0 +1,229 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Batched and delta encoded telemetry frames
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TelemetryBatch.h"
+#include <string.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* The frame size is a single byte and the frame needs space for at least one sample. */
+static_assert((TelemetryBatch::HEADER_SIZE < CONFIG_TELEMETRY_BATCH_FRAME_SIZE) &&
+                  (UINT8_MAX >= CONFIG_TELEMETRY_BATCH_FRAME_SIZE),
+              "CONFIG_TELEMETRY_BATCH_FRAME_SIZE is out of range.");
+
+/* The keyframe countdown is a single byte. */
+static_assert((0 < CONFIG_TELEMETRY_BATCH_KEYFRAME_INTERVAL) && (UINT8_MAX >= CONFIG_TELEMETRY_BATCH_KEYFRAME_INTERVAL),
+              "CONFIG_TELEMETRY_BATCH_KEYFRAME_INTERVAL is out of range.");
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+TelemetryBatch::TelemetryBatch(uint8_t valueCount) :
+    m_valueCount((MAX_VALUES < valueCount) ? MAX_VALUES : valueCount),
+    m_sequenceNumber(0U),
+    m_framesToKeyframe(0U),
+    m_frame(),
+    m_frameLength(0U),
+    m_reference(),
+    m_lastTimestamp(0U)
+{
+    reset();
+}
+
+void TelemetryBatch::reset()
+{
+    m_sequenceNumber   = 0U;
+    m_framesToKeyframe = CONFIG_TELEMETRY_BATCH_KEYFRAME_INTERVAL - 1U;
+
+    startFrame(true);
+}
+
+bool TelemetryBatch::addSample(uint32_t timestamp, const int32_t* values)
+{
+    bool isAdded = false;
+
+    if (nullptr != values)
+    {
+        uint8_t sample[MAX_SAMPLE_SIZE];
+        uint8_t sampleLength = 0U;
+        uint8_t sampleCount  = getSampleCount();
+        bool    isAbsolute   = (0U == sampleCount) && (true == isKeyframe());
+        uint8_t idx;
+
+        if (0U < sampleCount)
+        {
+            sampleLength += writeVarint(&sample[sampleLength], timestamp - m_lastTimestamp);
+        }
+
+        for (idx = 0U; idx < m_valueCount; ++idx)
+        {
+            /* The difference is calculated unsigned, because an overflow is well defined and
+             * the receiver gets the same value back by the same overflow.
+             */
+            uint32_t reference = (true == isAbsolute) ? 0U : static_cast<uint32_t>(m_reference[idx]);
+            uint32_t delta     = static_cast<uint32_t>(values[idx]) - reference;
+
+            sampleLength += writeSignedVarint(&sample[sampleLength], static_cast<int32_t>(delta));
+        }
+
+        if ((FRAME_SIZE >= (m_frameLength + sampleLength)) && (INFO_COUNT_MASK > sampleCount))
+        {
+            memcpy(&m_frame[m_frameLength], sample, sampleLength);
+            m_frameLength += sampleLength;
+
+            if (0U == sampleCount)
+            {
+                for (idx = 0U; idx < sizeof(uint32_t); ++idx)
+                {
+                    m_frame[TIMESTAMP_IDX + idx] = static_cast<uint8_t>((timestamp >> (8U * idx)) & 0xFFU);
+                }
+            }
+
+            /* Only a sample, which the receiver gets, is the reference of the next deltas. */
+            for (idx = 0U; idx < m_valueCount; ++idx)
+            {
+                m_reference[idx] = values[idx];
+            }
+
+            m_lastTimestamp = timestamp;
+            ++m_frame[INFO_IDX];
+
+            isAdded = true;
+        }
+    }
+
+    return isAdded;
+}
+
+void TelemetryBatch::nextFrame()
+{
+    bool isNextKeyframe = false;
+
+    /* A keyframe without any sample is repeated, because the receiver needs the absolute values. */
+    if ((true == isKeyframe()) && (0U == getSampleCount()))
+    {
+        isNextKeyframe = true;
+    }
+    else if (0U == m_framesToKeyframe)
+    {
+        m_framesToKeyframe = CONFIG_TELEMETRY_BATCH_KEYFRAME_INTERVAL - 1U;
+        isNextKeyframe     = true;
+    }
+    else
+    {
+        --m_framesToKeyframe;
+    }
+
+    ++m_sequenceNumber;
+    startFrame(isNextKeyframe);
+}
+
+void TelemetryBatch::startKeyframe()
+{
+    /* The sequence number is kept, because the current frame was not sent. */
+    m_framesToKeyframe = CONFIG_TELEMETRY_BATCH_KEYFRAME_INTERVAL - 1U;
+    startFrame(true);
+}
+
+uint8_t TelemetryBatch::writeSignedVarint(uint8_t* buffer, int32_t value)
+{
+    uint32_t zigzag = static_cast<uint32_t>(value) << 1U;
+
+    if (0 > value)
+    {
+        zigzag = ~zigzag;
+    }
+
+    return writeVarint(buffer, zigzag);
+}
+
+uint8_t TelemetryBatch::writeVarint(uint8_t* buffer, uint32_t value)
+{
+    uint8_t idx = 0U;
+
+    while (0x7FU < value)
+    {
+        buffer[idx++] = static_cast<uint8_t>(value & 0x7FU) | 0x80U;
+        value >>= 7U;
+    }
+
+    buffer[idx++] = static_cast<uint8_t>(value);
+
+    return idx;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void TelemetryBatch::startFrame(bool isKeyframe)
+{
+    memset(m_frame, 0, sizeof(m_frame));
+
+    m_frame[0U]       = static_cast<uint8_t>(m_sequenceNumber & 0xFFU);
+    m_frame[1U]       = static_cast<uint8_t>((m_sequenceNumber >> 8U) & 0xFFU);
+    m_frame[INFO_IDX] = (true == isKeyframe) ? INFO_KEYFRAME : 0U;
+    m_frameLength     = HEADER_SIZE;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,289 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Batched and delta encoded telemetry frames
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup Service
+ *
+ * @{
+ */
+
+#ifndef TELEMETRY_BATCH_H
+#define TELEMETRY_BATCH_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+#ifndef CONFIG_TELEMETRY_BATCH_FRAME_SIZE
+/**
+ * Size of a telemetry batch frame in bytes. It shall not exceed the max. payload
+ * size of a SerialMuxProt channel.
+ */
+#define CONFIG_TELEMETRY_BATCH_FRAME_SIZE (32)
+#endif /* CONFIG_TELEMETRY_BATCH_FRAME_SIZE */
+
+#ifndef CONFIG_TELEMETRY_BATCH_KEYFRAME_INTERVAL
+/** Every n-th frame is a keyframe, which starts with the absolute values. */
+#define CONFIG_TELEMETRY_BATCH_KEYFRAME_INTERVAL (10)
+#endif /* CONFIG_TELEMETRY_BATCH_KEYFRAME_INTERVAL */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Collects several telemetry samples in a fixed size frame. Every sample
+ * consists of the same number of signed values. The values are delta encoded
+ * against the previous sample and written as zigzag varint, which needs a
+ * single byte for small changes.
+ *
+ * All multi-byte header values are little endian. Unused bytes at the end of
+ * the frame are 0.
+ *
+ * Frame:
+ * | SEQ (2) | INFO | TIMESTAMP of the first sample in ms (4) | SAMPLE 1 | ... | SAMPLE n |
+ * with INFO:
+ * | Bit 7: keyframe flag | Bit 0 - 6: number of samples |
+ * with SAMPLE:
+ * | DT in ms since the previous sample (varint, not for the first sample) | VALUE 1 (varint) | ... | VALUE m (varint) |
+ *
+ * The first sample of a keyframe contains the absolute values, all other
+ * samples contain the difference to the previous sample, even across frames.
+ * The sequence number is incremented per frame. If the receiver detects a
+ * gap, it shall discard the frames until the next keyframe.
+ */
+class TelemetryBatch
+{
+public:
+    /** Max. number of values per sample. */
+    static const uint8_t MAX_VALUES = 8U;
+
+    /** Size of a frame in bytes. */
+    static const uint8_t FRAME_SIZE = CONFIG_TELEMETRY_BATCH_FRAME_SIZE;
+
+    /** Size of the frame header in bytes. */
+    static const uint8_t HEADER_SIZE = 7U;
+
+    /** Keyframe flag in the info byte. */
+    static const uint8_t INFO_KEYFRAME = 0x80U;
+
+    /** Mask of the number of samples in the info byte. */
+    static const uint8_t INFO_COUNT_MASK = 0x7FU;
+
+    /**
+     * Constructs the telemetry batch.
+     *
+     * @param[in] valueCount    Number of values per sample. It is limited to MAX_VALUES.
+     */
+    explicit TelemetryBatch(uint8_t valueCount);
+
+    /**
+     * Destroys the telemetry batch.
+     */
+    ~TelemetryBatch()
+    {
+    }
+
+    /**
+     * Discard all samples. The next frame is a keyframe and the sequence
+     * number starts again with 0.
+     */
+    void reset();
+
+    /**
+     * Add a sample to the current frame.
+     * If the sample doesn't fit, the frame shall be sent and the next frame
+     * started with nextFrame(). A sample which doesn't even fit into an empty
+     * frame is lost, but the following deltas stay valid.
+     *
+     * @param[in] timestamp Timestamp of the sample in ms.
+     * @param[in] values    Values of the sample, with the number given at construction.
+     *
+     * @return If the sample is added, it will return true otherwise false.
+     */
+    bool addSample(uint32_t timestamp, const int32_t* values);
+
+    /**
+     * Start the next frame, after the current frame is sent.
+     * A keyframe without any sample is repeated.
+     */
+    void nextFrame();
+
+    /**
+     * Start the current frame again as keyframe, e.g. because the time base
+     * of the timestamps changed. The time differences are unsigned, therefore
+     * a time base which jumps backwards requires a keyframe. The samples of
+     * the current frame are discarded, so send it before.
+     */
+    void startKeyframe();
+
+    /**
+     * Get the number of samples in the current frame.
+     *
+     * @return Number of samples
+     */
+    uint8_t getSampleCount() const
+    {
+        return m_frame[INFO_IDX] & INFO_COUNT_MASK;
+    }
+
+    /**
+     * Get the current frame with the size FRAME_SIZE.
+     *
+     * @return Frame
+     */
+    const uint8_t* getFrame() const
+    {
+        return m_frame;
+    }
+
+    /**
+     * Get the sequence number of the current frame.
+     *
+     * @return Sequence number
+     */
+    uint16_t getSequenceNumber() const
+    {
+        return m_sequenceNumber;
+    }
+
+    /**
+     * Is the current frame a keyframe?
+     *
+     * @return If keyframe, it will return true otherwise false.
+     */
+    bool isKeyframe() const
+    {
+        return (0U != (m_frame[INFO_IDX] & INFO_KEYFRAME));
+    }
+
+    /**
+     * Encode a value as zigzag varint. The zigzag mapping keeps small negative
+     * values small: 0, -1, 1, -2, 2 ... are mapped to 0, 1, 2, 3, 4 ...
+     *
+     * @param[out] buffer   Destination buffer with at least 5 bytes.
+     * @param[in]  value    Value
+     *
+     * @return Number of written bytes.
+     */
+    static uint8_t writeSignedVarint(uint8_t* buffer, int32_t value);
+
+    /**
+     * Encode a value as varint. Every byte carries 7 bits, starting with the
+     * least significant bits. The most significant bit is set, if another
+     * byte follows.
+     *
+     * @param[out] buffer   Destination buffer with at least 5 bytes.
+     * @param[in]  value    Value
+     *
+     * @return Number of written bytes.
+     */
+    static uint8_t writeVarint(uint8_t* buffer, uint32_t value);
+
+private:
+    /** Index of the info byte in the frame. */
+    static const uint8_t INFO_IDX = 2U;
+
+    /** Index of the timestamp in the frame. */
+    static const uint8_t TIMESTAMP_IDX = 3U;
+
+    /** Max. size of a varint in bytes. */
+    static const uint8_t MAX_VARINT_SIZE = 5U;
+
+    /** Max. size of a single encoded sample in bytes. */
+    static const uint8_t MAX_SAMPLE_SIZE = (MAX_VALUES + 1U) * MAX_VARINT_SIZE;
+
+    /** Number of values per sample. */
+    uint8_t m_valueCount;
+
+    /** Sequence number of the current frame. */
+    uint16_t m_sequenceNumber;
+
+    /** Number of frames until the next keyframe. */
+    uint8_t m_framesToKeyframe;
+
+    /** Current frame. */
+    uint8_t m_frame[FRAME_SIZE];
+
+    /** Number of used bytes in the current frame. */
+    uint8_t m_frameLength;
+
+    /** Values of the previous sample, which are the reference for the deltas. */
+    int32_t m_reference[MAX_VALUES];
+
+    /** Timestamp of the previous sample in ms. */
+    uint32_t m_lastTimestamp;
+
+    /**
+     * Clear the current frame and write its header.
+     *
+     * @param[in] isKeyframe    Is the frame a keyframe?
+     */
+    void startFrame(bool isKeyframe);
+
+    /**
+     * Default constructor.
+     * Not allowed.
+     */
+    TelemetryBatch();
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] batch Source instance.
+     */
+    TelemetryBatch(const TelemetryBatch& batch);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] batch Source instance.
+     *
+     * @returns Reference to TelemetryBatch instance.
+     */
+    TelemetryBatch& operator=(const TelemetryBatch& batch);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* TELEMETRY_BATCH_H */
+/** @} */
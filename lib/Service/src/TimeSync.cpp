@@ -0,0 +1,219 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Clock synchronization with a peer
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TimeSync.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* The number of exchanges is a single byte. */
+static_assert((0 < CONFIG_TIME_SYNC_SAMPLES) && (UINT8_MAX >= CONFIG_TIME_SYNC_SAMPLES),
+              "CONFIG_TIME_SYNC_SAMPLES is out of range.");
+
+/** Number of us per second, which is the ppm base. */
+static const int64_t US_PER_S = 1000000;
+
+/** The offset correction is divided by this factor to filter the link jitter. */
+static const int32_t OFFSET_FILTER_FACTOR = 4;
+
+/** The drift correction is divided by this factor to filter the link jitter. */
+static const int32_t DRIFT_FILTER_FACTOR = 32;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+TimeSync::TimeSync() :
+    m_sequence(0U),
+    m_isRequestPending(false),
+    m_requestTimestamp(0U),
+    m_sampleCount(0U),
+    m_sampleOffset(0U),
+    m_sampleDelay(0U),
+    m_sampleTimestamp(0U),
+    m_isSynced(false),
+    m_offset(0U),
+    m_drift(0),
+    m_isDriftValid(false),
+    m_roundTripDelay(0U),
+    m_syncTimestamp(0U)
+{
+}
+
+void TimeSync::reset()
+{
+    m_isRequestPending = false;
+    m_sampleCount      = 0U;
+    m_isSynced         = false;
+    m_offset           = 0U;
+    m_drift            = 0;
+    m_isDriftValid     = false;
+    m_roundTripDelay   = 0U;
+}
+
+uint8_t TimeSync::createRequest(Timebase::Timestamp now)
+{
+    ++m_sequence;
+    m_requestTimestamp = now;
+    m_isRequestPending = true;
+
+    return m_sequence;
+}
+
+bool TimeSync::processResponse(uint8_t sequence, uint32_t originTimestamp, uint32_t receiveTimestamp,
+                               uint32_t transmitTimestamp, Timebase::Timestamp now)
+{
+    bool isAccepted = false;
+
+    /* The origin timestamp protects against a response of a former run, with the same sequence number. */
+    if ((true == m_isRequestPending) && (m_sequence == sequence) && (m_requestTimestamp == originTimestamp))
+    {
+        uint32_t roundTrip      = Timebase::getDuration(originTimestamp, now);
+        uint32_t peerProcessing = transmitTimestamp - receiveTimestamp;
+        uint32_t delay          = (roundTrip > peerProcessing) ? (roundTrip - peerProcessing) : 0U;
+
+        /* ((T2 - T1) + (T3 - T4)) / 2 is equal to (T2 - T1) - delay / 2, which is
+         * calculated modulo 2^32 without overflow issues.
+         */
+        uint32_t offset = (receiveTimestamp - originTimestamp) - (delay / 2U);
+
+        if ((0U == m_sampleCount) || (m_sampleDelay > delay))
+        {
+            m_sampleOffset    = offset;
+            m_sampleDelay     = delay;
+            m_sampleTimestamp = originTimestamp + (roundTrip / 2U);
+        }
+
+        ++m_sampleCount;
+
+        if (CONFIG_TIME_SYNC_SAMPLES <= m_sampleCount)
+        {
+            updateEstimation();
+            m_sampleCount = 0U;
+        }
+
+        m_isRequestPending = false;
+        isAccepted         = true;
+    }
+
+    return isAccepted;
+}
+
+uint32_t TimeSync::toPeerTime(Timebase::Timestamp timestamp) const
+{
+    /* Signed, because the timestamp may be slightly before the estimation. */
+    int32_t elapsed    = static_cast<int32_t>(timestamp - m_syncTimestamp);
+    int64_t correction = (static_cast<int64_t>(elapsed) * m_drift) / US_PER_S;
+
+    return timestamp + m_offset + static_cast<uint32_t>(correction);
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void TimeSync::updateEstimation()
+{
+    uint32_t interval = Timebase::getDuration(m_syncTimestamp, m_sampleTimestamp);
+    uint32_t offset   = m_sampleOffset;
+
+    if ((true == m_isSynced) && (0U < interval) && (INT32_MAX >= interval))
+    {
+        /* Difference of the measured offset to the offset predicted by the current drift. */
+        uint32_t predictedOffset = toPeerTime(m_sampleTimestamp) - m_sampleTimestamp;
+        int32_t  residual        = static_cast<int32_t>(m_sampleOffset - predictedOffset);
+        int64_t  drift           = (static_cast<int64_t>(residual) * US_PER_S) / static_cast<int64_t>(interval);
+
+        if (true == m_isDriftValid)
+        {
+            /* The measured offset is disturbed by the link jitter. Therefore the
+             * prediction is only partly corrected, like by a phase locked loop.
+             */
+            offset = predictedOffset + static_cast<uint32_t>(residual / OFFSET_FILTER_FACTOR);
+            drift /= DRIFT_FILTER_FACTOR;
+        }
+
+        drift += m_drift;
+
+        if (MAX_DRIFT < drift)
+        {
+            drift = MAX_DRIFT;
+        }
+        else if (-MAX_DRIFT > drift)
+        {
+            drift = -MAX_DRIFT;
+        }
+        else
+        {
+            ;
+        }
+
+        m_drift        = static_cast<int32_t>(drift);
+        m_isDriftValid = true;
+    }
+
+    m_offset         = offset;
+    m_roundTripDelay = m_sampleDelay;
+    m_syncTimestamp  = m_sampleTimestamp;
+    m_isSynced       = true;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
@@ -0,0 +1,256 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Clock synchronization with a peer
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup Service
+ *
+ * @{
+ */
+
+#ifndef TIME_SYNC_H
+#define TIME_SYNC_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+#ifndef CONFIG_TIME_SYNC_SAMPLES
+/**
+ * Number of exchanges per estimation. The exchange with the shortest round
+ * trip delay is used, because it is the least disturbed one.
+ */
+#define CONFIG_TIME_SYNC_SAMPLES (4)
+#endif /* CONFIG_TIME_SYNC_SAMPLES */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include "Timebase.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Synchronizes the local clock with the clock of a peer, e.g. the DCS, by
+ * NTP-style request/response exchanges. All timestamps are in us and wrap
+ * around after 2^32 us.
+ *
+ * 1. The local side sends a request with its transmit timestamp T1.
+ * 2. The peer receives the request at T2 and sends the response at T3,
+ *    both in peer time. The response contains T1, T2 and T3.
+ * 3. The local side receives the response at T4.
+ *
+ * Round trip delay: (T4 - T1) - (T3 - T2)
+ * Offset (peer - local): ((T2 - T1) + (T3 - T4)) / 2
+ *
+ * The offset assumes a symmetric link delay. The drift of the clocks is
+ * estimated by the offset change between two estimations.
+ */
+class TimeSync
+{
+public:
+    /** Max. absolute drift in ppm, which is accepted. */
+    static const int32_t MAX_DRIFT = 10000;
+
+    /**
+     * Constructs the time synchronization.
+     */
+    TimeSync();
+
+    /**
+     * Destroys the time synchronization.
+     */
+    ~TimeSync()
+    {
+    }
+
+    /**
+     * Forget the estimation, e.g. after the peer restarted.
+     */
+    void reset();
+
+    /**
+     * Create the next request. A pending request without response is dropped.
+     *
+     * @param[in] now   Current local timestamp in us, which is sent as T1.
+     *
+     * @return Sequence number of the request.
+     */
+    uint8_t createRequest(Timebase::Timestamp now);
+
+    /**
+     * Process the response of the peer.
+     *
+     * @param[in] sequence          Sequence number of the request.
+     * @param[in] originTimestamp   T1: Transmit timestamp of the request in local time.
+     * @param[in] receiveTimestamp  T2: Receive timestamp of the request in peer time.
+     * @param[in] transmitTimestamp T3: Transmit timestamp of the response in peer time.
+     * @param[in] now               T4: Receive timestamp of the response in local time.
+     *
+     * @return If the response belongs to the pending request, it will return true otherwise false.
+     */
+    bool processResponse(uint8_t sequence, uint32_t originTimestamp, uint32_t receiveTimestamp,
+                         uint32_t transmitTimestamp, Timebase::Timestamp now);
+
+    /**
+     * Is the local clock synchronized with the peer clock?
+     *
+     * @return If synchronized, it will return true otherwise false.
+     */
+    bool isSynced() const
+    {
+        return m_isSynced;
+    }
+
+    /**
+     * Get the clock offset of the last estimation.
+     *
+     * @return Offset (peer - local) in us, modulo 2^32.
+     */
+    uint32_t getOffset() const
+    {
+        return m_offset;
+    }
+
+    /**
+     * Get the estimated drift of the peer clock relative to the local clock.
+     *
+     * @return Drift in ppm. Positive if the peer clock runs faster.
+     */
+    int32_t getDrift() const
+    {
+        return m_drift;
+    }
+
+    /**
+     * Get the round trip delay of the exchange, which was used for the last estimation.
+     *
+     * @return Round trip delay in us
+     */
+    uint32_t getRoundTripDelay() const
+    {
+        return m_roundTripDelay;
+    }
+
+    /**
+     * Get the local timestamp of the last estimation.
+     *
+     * @return Local timestamp in us
+     */
+    Timebase::Timestamp getSyncTimestamp() const
+    {
+        return m_syncTimestamp;
+    }
+
+    /**
+     * Convert a local timestamp to peer time. It is only valid, if the
+     * clock is synchronized.
+     *
+     * @param[in] timestamp Local timestamp in us
+     *
+     * @return Peer timestamp in us
+     */
+    uint32_t toPeerTime(Timebase::Timestamp timestamp) const;
+
+private:
+    /** Sequence number of the last request. */
+    uint8_t m_sequence;
+
+    /** Is a request pending? */
+    bool m_isRequestPending;
+
+    /** Transmit timestamp of the pending request in local time. */
+    Timebase::Timestamp m_requestTimestamp;
+
+    /** Number of exchanges for the next estimation. */
+    uint8_t m_sampleCount;
+
+    /** Offset of the best exchange for the next estimation. */
+    uint32_t m_sampleOffset;
+
+    /** Round trip delay of the best exchange for the next estimation. */
+    uint32_t m_sampleDelay;
+
+    /** Local timestamp of the best exchange for the next estimation. */
+    Timebase::Timestamp m_sampleTimestamp;
+
+    /** Is the clock synchronized? */
+    bool m_isSynced;
+
+    /** Estimated offset (peer - local) in us. */
+    uint32_t m_offset;
+
+    /** Estimated drift in ppm. */
+    int32_t m_drift;
+
+    /** Is the drift estimated at least once? */
+    bool m_isDriftValid;
+
+    /** Round trip delay of the exchange, used for the estimation. */
+    uint32_t m_roundTripDelay;
+
+    /** Local timestamp of the estimation. */
+    Timebase::Timestamp m_syncTimestamp;
+
+    /**
+     * Update the estimation with the best exchange.
+     */
+    void updateEstimation();
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] sync  Source instance.
+     */
+    TimeSync(const TimeSync& sync);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] sync  Source instance.
+     *
+     * @returns Reference to TimeSync instance.
+     */
+    TimeSync& operator=(const TimeSync& sync);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* TIME_SYNC_H */
+/** @} */
@@ -0,0 +1,155 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Monotonic timebase with microsecond resolution
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup Service
+ *
+ * @{
+ */
+
+#ifndef TIMEBASE_H
+#define TIMEBASE_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * Monotonic timebase with microsecond resolution.
+ *
+ * On the target it is derived from micros() with a resolution of 4 us.
+ * In the simulation it is derived from the simulation time, which advances
+ * in steps of whole milliseconds.
+ *
+ * The timestamps wrap around after ~71.6 min. Durations are always calculated
+ * by unsigned subtraction, which is correct across the wrap around as long
+ * as the measured duration itself is shorter than the wrap around period.
+ */
+namespace Timebase
+{
+    /** Timestamp in us. It wraps around after 2^32 us (~71.6 min). */
+    typedef uint32_t Timestamp;
+
+    /** Duration in us. */
+    typedef uint32_t Duration;
+
+    /** Number of microseconds per millisecond. */
+    static const uint32_t US_PER_MS = 1000U;
+
+    /**
+     * Get the current timestamp.
+     *
+     * @return Timestamp in us
+     */
+    Timestamp now();
+
+    /**
+     * Get the duration between two timestamps.
+     *
+     * @param[in] from  Start timestamp in us
+     * @param[in] to    End timestamp in us, which shall not be before the start.
+     *
+     * @return Duration in us
+     */
+    inline Duration getDuration(Timestamp from, Timestamp to)
+    {
+        return to - from;
+    }
+
+    /**
+     * Get the elapsed time since the given timestamp.
+     *
+     * @param[in] timestamp Timestamp in the past in us
+     *
+     * @return Elapsed time in us
+     */
+    inline Duration getElapsed(Timestamp timestamp)
+    {
+        return getDuration(timestamp, now());
+    }
+
+    /**
+     * Is the timestamp reached or already in the past?
+     * It is valid for timestamps less than half the wrap around period in
+     * the future or in the past.
+     *
+     * @param[in] timestamp Timestamp in us
+     *
+     * @return If the timestamp is reached, it will return true otherwise false.
+     */
+    inline bool isReached(Timestamp timestamp)
+    {
+        return (0 <= static_cast<int32_t>(now() - timestamp));
+    }
+
+    /**
+     * Convert a duration from ms to us.
+     *
+     * @param[in] duration  Duration in ms, max. 4294967 ms.
+     *
+     * @return Duration in us
+     */
+    inline Duration fromMs(uint32_t duration)
+    {
+        return duration * US_PER_MS;
+    }
+
+    /**
+     * Convert a duration from us to ms. It is rounded to the nearest ms.
+     *
+     * @param[in] duration  Duration in us
+     *
+     * @return Duration in ms
+     */
+    inline uint32_t toMs(Duration duration)
+    {
+        return (duration / US_PER_MS) + (((duration % US_PER_MS) < (US_PER_MS / 2U)) ? 0U : 1U);
+    }
+
+} /* namespace Timebase */
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* TIMEBASE_H */
+/** @} */
@@ -0,0 +1,308 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Waypoint follower with a pure pursuit controller
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "WaypointFollower.h"
+#include <Arduino.h>
+#include <math.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static int16_t limitToInt16(float value);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+WaypointFollower::WaypointFollower() :
+    m_waypoints(),
+    m_length(0U),
+    m_lookaheadDistance(DEFAULT_LOOKAHEAD_DISTANCE),
+    m_defaultSpeed(DEFAULT_SPEED),
+    m_isRunning(false),
+    m_isFinished(false),
+    m_currentWaypoint(0U),
+    m_startX(0),
+    m_startY(0)
+{
+}
+
+void WaypointFollower::clear()
+{
+    m_length          = 0U;
+    m_isRunning       = false;
+    m_isFinished      = false;
+    m_currentWaypoint = 0U;
+}
+
+bool WaypointFollower::addWaypoint(const Waypoint& waypoint)
+{
+    bool isSuccessful = false;
+
+    if ((false == m_isRunning) && (MAX_WAYPOINTS > m_length) && (0 <= waypoint.speed))
+    {
+        m_waypoints[m_length] = waypoint;
+        ++m_length;
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+bool WaypointFollower::start(int32_t posX, int32_t posY)
+{
+    bool isSuccessful = false;
+
+    if ((false == m_isRunning) && (0U < m_length))
+    {
+        m_isRunning       = true;
+        m_isFinished      = false;
+        m_currentWaypoint = 0U;
+        m_startX          = posX;
+        m_startY          = posY;
+
+        isSuccessful = true;
+    }
+
+    return isSuccessful;
+}
+
+void WaypointFollower::stop()
+{
+    m_isRunning = false;
+}
+
+void WaypointFollower::process(int32_t posX, int32_t posY, int32_t orientation, int16_t& linearSpeed,
+                               int16_t& angularSpeed)
+{
+    linearSpeed  = 0;
+    angularSpeed = 0;
+
+    if (true == m_isRunning)
+    {
+        const float lookahead  = static_cast<float>(m_lookaheadDistance); /* [mm] */
+        float       distance   = 0.0F;                                     /* [mm] */
+        bool        isSwitched = true;
+
+        /* Switch to the next segment, as soon as the waypoint is within the lookahead distance. */
+        while (true == isSwitched)
+        {
+            float deltaX = static_cast<float>(m_waypoints[m_currentWaypoint].x - posX);
+            float deltaY = static_cast<float>(m_waypoints[m_currentWaypoint].y - posY);
+
+            distance = sqrtf((deltaX * deltaX) + (deltaY * deltaY));
+
+            if ((m_length > (m_currentWaypoint + 1U)) && (lookahead >= distance))
+            {
+                ++m_currentWaypoint;
+            }
+            else
+            {
+                isSwitched = false;
+            }
+        }
+
+        if ((m_length == (m_currentWaypoint + 1U)) && (static_cast<float>(GOAL_TOLERANCE) >= distance))
+        {
+            m_isRunning  = false;
+            m_isFinished = true;
+        }
+        else
+        {
+            float speed = static_cast<float>(m_waypoints[m_currentWaypoint].speed); /* [mm/s] */
+            float goalX = 0.0F;                                                     /* [mm] */
+            float goalY = 0.0F;                                                     /* [mm] */
+
+            if (0.0F >= speed)
+            {
+                speed = static_cast<float>(m_defaultSpeed);
+            }
+
+            /* Slow down to reach the last waypoint without overshooting. */
+            if (m_length == (m_currentWaypoint + 1U))
+            {
+                float maxSpeed = (distance * 1000.0F) / static_cast<float>(APPROACH_TIME);
+
+                if (maxSpeed < speed)
+                {
+                    speed = maxSpeed;
+                }
+            }
+
+            getGoalPoint(posX, posY, goalX, goalY);
+
+            {
+                const float theta    = static_cast<float>(orientation) / 1000.0F; /* [rad] */
+                const float deltaX   = goalX - static_cast<float>(posX);
+                const float deltaY   = goalY - static_cast<float>(posY);
+                const float distSq   = (deltaX * deltaX) + (deltaY * deltaY);
+                const float cosTheta = cosf(theta);
+                const float sinTheta = sinf(theta);
+                const float localX   = (cosTheta * deltaX) + (sinTheta * deltaY);  /* Ahead of the robot. */
+                const float localY   = (-sinTheta * deltaX) + (cosTheta * deltaY); /* Left of the robot. */
+
+                if (1.0F > distSq)
+                {
+                    /* The goal point is reached, keep the direction. */
+                    linearSpeed = limitToInt16(speed);
+                }
+                else if (0.0F > localX)
+                {
+                    /* The goal point is behind, turn on the spot towards it. */
+                    float turnRate = (speed * 2000.0F) / lookahead; /* [mrad/s] */
+
+                    angularSpeed = limitToInt16((0.0F > localY) ? -turnRate : turnRate);
+                }
+                else
+                {
+                    /* Pure pursuit: the arc through the goal point has the curvature 2 * y / d^2. */
+                    float curvature = (2.0F * localY) / distSq; /* [1/mm] */
+
+                    linearSpeed  = limitToInt16(speed);
+                    angularSpeed = limitToInt16(speed * curvature * 1000.0F);
+                }
+            }
+        }
+    }
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+void WaypointFollower::getGoalPoint(int32_t posX, int32_t posY, float& goalX, float& goalY) const
+{
+    const Waypoint& target  = m_waypoints[m_currentWaypoint];
+    int32_t         originX = m_startX;
+    int32_t         originY = m_startY;
+    float           segX    = 0.0F;
+    float           segY    = 0.0F;
+    float           length  = 0.0F;
+
+    if (0U < m_currentWaypoint)
+    {
+        originX = m_waypoints[m_currentWaypoint - 1U].x;
+        originY = m_waypoints[m_currentWaypoint - 1U].y;
+    }
+
+    segX   = static_cast<float>(target.x - originX);
+    segY   = static_cast<float>(target.y - originY);
+    length = sqrtf((segX * segX) + (segY * segY));
+
+    if (1.0F > length)
+    {
+        goalX = static_cast<float>(target.x);
+        goalY = static_cast<float>(target.y);
+    }
+    else
+    {
+        /* Project the robot position onto the segment and move the lookahead distance ahead. */
+        float progress = (((static_cast<float>(posX - originX) * segX) + (static_cast<float>(posY - originY) * segY)) /
+                          length) +
+                         static_cast<float>(m_lookaheadDistance);
+
+        if (0.0F > progress)
+        {
+            progress = 0.0F;
+        }
+        else if (length < progress)
+        {
+            progress = length;
+        }
+        else
+        {
+            ;
+        }
+
+        goalX = static_cast<float>(originX) + ((segX * progress) / length);
+        goalY = static_cast<float>(originY) + ((segY * progress) / length);
+    }
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Limit a value to the 16 bit signed integer range and round it.
+ *
+ * @param[in] value Value
+ *
+ * @return Limited value
+ */
+static int16_t limitToInt16(float value)
+{
+    int16_t result = 0;
+
+    if (static_cast<float>(INT16_MAX) <= value)
+    {
+        result = INT16_MAX;
+    }
+    else if (static_cast<float>(INT16_MIN) >= value)
+    {
+        result = INT16_MIN;
+    }
+    else
+    {
+        result = static_cast<int16_t>(lroundf(value));
+    }
+
+    return result;
+}
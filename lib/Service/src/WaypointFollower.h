@@ -0,0 +1,295 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Waypoint follower with a pure pursuit controller
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup Service
+ *
+ * @{
+ */
+
+#ifndef WAYPOINT_FOLLOWER_H
+#define WAYPOINT_FOLLOWER_H
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+#ifndef CONFIG_WAYPOINT_FOLLOWER_SIZE
+/**
+ * Max. number of waypoints in a path.
+ */
+#define CONFIG_WAYPOINT_FOLLOWER_SIZE (16U)
+#endif /* CONFIG_WAYPOINT_FOLLOWER_SIZE */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+
+/**
+ * The waypoint follower drives along a path of waypoints, based on the pose
+ * of the odometry. The path is uploaded completely before it is started and
+ * then followed locally.
+ *
+ * The path consists of straight segments between the waypoints. The first
+ * segment starts at the position, where the path is started. A pure pursuit
+ * controller steers the robot on a circular arc to the goal point, which is
+ * on the current segment the lookahead distance ahead of the robot. If the
+ * robot is within the lookahead distance of a waypoint, the next segment is
+ * followed. If the goal point is behind the robot, it turns on the spot.
+ *
+ * The speed is reduced approaching the last waypoint. The path is finished,
+ * if the robot is within the goal tolerance of the last waypoint.
+ */
+class WaypointFollower
+{
+public:
+    /** A single waypoint of the path. */
+    struct Waypoint
+    {
+        int32_t x;     /**< X position in [mm] */
+        int32_t y;     /**< Y position in [mm] */
+        int16_t speed; /**< Linear speed in [mm/s] to this waypoint. 0 selects the default speed. */
+    };
+
+    /** Max. number of waypoints in a path. */
+    static const uint8_t MAX_WAYPOINTS = CONFIG_WAYPOINT_FOLLOWER_SIZE;
+
+    /** Default lookahead distance in [mm]. */
+    static const uint16_t DEFAULT_LOOKAHEAD_DISTANCE = 100U;
+
+    /** Default linear speed in [mm/s]. */
+    static const int16_t DEFAULT_SPEED = 200;
+
+    /** Goal tolerance in [mm], within the last waypoint is reached. */
+    static const uint16_t GOAL_TOLERANCE = 20U;
+
+    /**
+     * Time in [ms], in which the last waypoint shall be reached at the latest.
+     * It limits the speed approaching the last waypoint.
+     */
+    static const uint16_t APPROACH_TIME = 500U;
+
+    /**
+     * Constructs a waypoint follower with an empty path.
+     */
+    WaypointFollower();
+
+    /**
+     * Destroys the waypoint follower.
+     */
+    ~WaypointFollower()
+    {
+    }
+
+    /**
+     * Remove all waypoints. A running path is stopped.
+     */
+    void clear();
+
+    /**
+     * Append a waypoint to the path. It is not possible while the path is followed.
+     * The robot drives forward only, therefore the speed shall not be negative.
+     *
+     * @param[in] waypoint  Waypoint
+     *
+     * @return If successful added, it will return true otherwise false.
+     */
+    bool addWaypoint(const Waypoint& waypoint);
+
+    /**
+     * Get the number of waypoints.
+     *
+     * @return Number of waypoints
+     */
+    uint8_t getLength() const
+    {
+        return m_length;
+    }
+
+    /**
+     * Get the lookahead distance.
+     *
+     * @return Lookahead distance in [mm]
+     */
+    uint16_t getLookaheadDistance() const
+    {
+        return m_lookaheadDistance;
+    }
+
+    /**
+     * Set the lookahead distance. A shorter distance follows the path more
+     * precisely, a longer distance drives smoother.
+     *
+     * @param[in] distance  Lookahead distance in [mm]. Shall be greater than 0.
+     */
+    void setLookaheadDistance(uint16_t distance)
+    {
+        if (0U < distance)
+        {
+            m_lookaheadDistance = distance;
+        }
+    }
+
+    /**
+     * Get the default linear speed, which is used for waypoints without speed.
+     *
+     * @return Default linear speed in [mm/s]
+     */
+    int16_t getDefaultSpeed() const
+    {
+        return m_defaultSpeed;
+    }
+
+    /**
+     * Set the default linear speed, which is used for waypoints without speed.
+     *
+     * @param[in] speed Default linear speed in [mm/s]. Shall be greater than 0.
+     */
+    void setDefaultSpeed(int16_t speed)
+    {
+        if (0 < speed)
+        {
+            m_defaultSpeed = speed;
+        }
+    }
+
+    /**
+     * Start following the path with the first waypoint.
+     *
+     * @param[in] posX  Current x position in [mm].
+     * @param[in] posY  Current y position in [mm].
+     *
+     * @return If successful started, it will return true otherwise false.
+     */
+    bool start(int32_t posX, int32_t posY);
+
+    /**
+     * Stop following the path immediately.
+     */
+    void stop();
+
+    /**
+     * Is the path followed?
+     *
+     * @return If running, it will return true otherwise false.
+     */
+    bool isRunning() const
+    {
+        return m_isRunning;
+    }
+
+    /**
+     * Is the path finished, because the last waypoint is reached?
+     * It is reset by the next start.
+     *
+     * @return If finished, it will return true otherwise false.
+     */
+    bool isFinished() const
+    {
+        return m_isFinished;
+    }
+
+    /**
+     * Get the index of the waypoint, which is currently driven to.
+     *
+     * @return Waypoint index
+     */
+    uint8_t getCurrentWaypoint() const
+    {
+        return m_currentWaypoint;
+    }
+
+    /**
+     * Process the pure pursuit controller and get the speeds to follow the
+     * path. It shall be called periodically.
+     *
+     * @param[in]  posX         Current x position in [mm].
+     * @param[in]  posY         Current y position in [mm].
+     * @param[in]  orientation  Current orientation in [mrad].
+     * @param[out] linearSpeed  Linear speed in [mm/s]. 0 if the path is not followed.
+     * @param[out] angularSpeed Angular speed in [mrad/s]. 0 if the path is not followed.
+     */
+    void process(int32_t posX, int32_t posY, int32_t orientation, int16_t& linearSpeed, int16_t& angularSpeed);
+
+private:
+    Waypoint m_waypoints[MAX_WAYPOINTS]; /**< Waypoints of the path. */
+    uint8_t  m_length;                   /**< Number of waypoints. */
+    uint16_t m_lookaheadDistance;        /**< Lookahead distance in [mm]. */
+    int16_t  m_defaultSpeed;             /**< Default linear speed in [mm/s]. */
+    bool     m_isRunning;                /**< Is the path followed? */
+    bool     m_isFinished;               /**< Is the last waypoint reached? */
+    uint8_t  m_currentWaypoint;          /**< Index of the waypoint, which is currently driven to. */
+    int32_t  m_startX;                   /**< X position in [mm], where the path was started. */
+    int32_t  m_startY;                   /**< Y position in [mm], where the path was started. */
+
+    /**
+     * Determine the goal point on the current segment, which is the lookahead
+     * distance ahead of the robot, projected onto the segment.
+     *
+     * @param[in]  posX     Current x position in [mm].
+     * @param[in]  posY     Current y position in [mm].
+     * @param[out] goalX    X position of the goal point in [mm].
+     * @param[out] goalY    Y position of the goal point in [mm].
+     */
+    void getGoalPoint(int32_t posX, int32_t posY, float& goalX, float& goalY) const;
+
+    /**
+     * Copy construction of an instance.
+     * Not allowed.
+     *
+     * @param[in] follower  Source instance.
+     */
+    WaypointFollower(const WaypointFollower& follower);
+
+    /**
+     * Assignment of an instance.
+     * Not allowed.
+     *
+     * @param[in] follower  Source instance.
+     *
+     * @returns Reference to WaypointFollower instance.
+     */
+    WaypointFollower& operator=(const WaypointFollower& follower);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif /* WAYPOINT_FOLLOWER_H */
+/** @} */
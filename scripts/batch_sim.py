@@ -0,0 +1,297 @@
+"""Runs headless line follower simulations in parallel over a matrix of parameter sets, tracks and seeds"""
+
+# MIT License
+#
+# Copyright (c) 2023 - 2025 Andreas Merkle (web@blue-andi.de)
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+
+################################################################################
+# Imports
+################################################################################
+import argparse
+import concurrent.futures
+import csv
+import itertools
+import os
+import re
+import subprocess
+import sys
+import time
+
+################################################################################
+# Variables
+################################################################################
+
+# Simulated time in ms, when button B starts the motor speed and line sensor calibration.
+CALIBRATION_PRESS_TIME = 500
+
+# Simulated time in ms, when button A releases the track after the calibration.
+RELEASE_PRESS_TIME = 8000
+
+# Simulated time in ms between the button A presses, which choose the next parameter set.
+PARAMETER_SET_PRESS_PERIOD = 300
+
+# Duration in ms after the last button A press, till the robot starts driving.
+# See ReleaseTrackState::TRACK_RELEASE_DURATION.
+TRACK_RELEASE_DURATION = 5000
+
+# Number of parameter sets. See ParameterSets::MAX_SETS.
+MAX_PARAMETER_SETS = 4
+
+LAP_TIME_PATTERN = re.compile(r"Lap time: (\d+)")
+ABORT_PATTERN = re.compile(r"Abort: (.+?)\.?$", re.MULTILINE)
+ERROR_PATTERN = re.compile(r"Error: (.+?)$", re.MULTILINE)
+CROSS_TRACK_ERROR_PATTERN = re.compile(r"Max\. cross-track error: ([\d.]+) mm")
+TRACK_LOST_PATTERN = re.compile(r"Track lost: (\d+)")
+
+COLUMNS = ["track", "set", "seed", "lap time [ms]", "max. cross-track error [mm]", "track lost", "abort reason"]
+
+################################################################################
+# Classes
+################################################################################
+
+################################################################################
+# Functions
+################################################################################
+
+def get_program_arguments(program, track, parameter_set, seed, duration):
+    """Get the arguments of a single headless simulation run. The buttons are
+    scripted like a user would press them: calibrate, release the track and
+    choose the parameter set by pressing button A again.
+
+    Args:
+        program (str): Headless simulation program.
+        track (str): Track bitmap (binary PGM).
+        parameter_set (int): Parameter set id.
+        seed (int): Seed of the line sensor noise.
+        duration (int): Simulated duration in ms.
+
+    Returns:
+        list: Program arguments
+    """
+    last_press_time = RELEASE_PRESS_TIME + (parameter_set * PARAMETER_SET_PRESS_PERIOD)
+    arguments = [program,
+                 "--track", track,
+                 "--seed", str(seed),
+                 "--duration", str(duration),
+                 "--rateFrom", str(last_press_time + TRACK_RELEASE_DURATION),
+                 "--buttonB", str(CALIBRATION_PRESS_TIME)]
+
+    for press_time in range(RELEASE_PRESS_TIME, last_press_time + 1, PARAMETER_SET_PRESS_PERIOD):
+        arguments += ["--buttonA", str(press_time)]
+
+    return arguments
+
+def parse_output(output):
+    """Parse the console output of a simulation run.
+
+    Args:
+        output (str): Console output.
+
+    Returns:
+        tuple: Lap time in ms or None, max. cross-track error in mm or None,
+            track lost count or None and the abort reason or None.
+    """
+    lap_time = None
+    cross_track_error = None
+    track_lost = None
+    abort_reason = None
+
+    # After an abort the lap time 0 is reported.
+    match = LAP_TIME_PATTERN.search(output)
+    if (match is not None) and (int(match.group(1)) > 0):
+        lap_time = int(match.group(1))
+
+    match = CROSS_TRACK_ERROR_PATTERN.search(output)
+    if match is not None:
+        cross_track_error = float(match.group(1))
+
+    match = TRACK_LOST_PATTERN.search(output)
+    if match is not None:
+        track_lost = int(match.group(1))
+
+    abort_match = ABORT_PATTERN.search(output)
+    error_match = ERROR_PATTERN.search(output)
+
+    if error_match is not None:
+        abort_reason = f"Error {error_match.group(1).strip()}"
+    elif abort_match is not None:
+        abort_reason = abort_match.group(1).strip()
+    elif lap_time is None:
+        abort_reason = "Not finished"
+
+    return lap_time, cross_track_error, track_lost, abort_reason
+
+def run(program, track, parameter_set, seed, duration, timeout):
+    """Run a single headless simulation in its own process, which isolates the
+    application instances from each other.
+
+    Args:
+        program (str): Headless simulation program.
+        track (str): Track bitmap (binary PGM).
+        parameter_set (int): Parameter set id.
+        seed (int): Seed of the line sensor noise.
+        duration (int): Simulated duration in ms.
+        timeout (float): Max. wall-clock time of the run in s.
+
+    Returns:
+        list: Result row, see COLUMNS.
+    """
+    arguments = get_program_arguments(program, track, parameter_set, seed, duration)
+
+    try:
+        result = subprocess.run(arguments, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                                timeout=timeout, check=False)
+        lap_time, cross_track_error, track_lost, abort_reason = \
+            parse_output(result.stdout.decode("utf-8", errors="replace"))
+
+        if result.returncode != 0:
+            abort_reason = f"Exit code {result.returncode}"
+
+    except subprocess.TimeoutExpired:
+        lap_time, cross_track_error, track_lost, abort_reason = None, None, None, "Timeout"
+
+    return [track, parameter_set, seed, lap_time, cross_track_error, track_lost, abort_reason]
+
+def prepare_tracks(program, tracks):
+    """Load every track once, before the runs start in parallel. This creates
+    the distance field cache of every track, which all runs share then.
+
+    Args:
+        program (str): Headless simulation program.
+        tracks (list): Track bitmaps (binary PGM).
+
+    Returns:
+        bool: True if all tracks are loaded, otherwise False.
+    """
+    is_successful = True
+
+    for track in tracks:
+        result = subprocess.run([program, "--track", track, "--benchmark", "1"], stdout=subprocess.PIPE,
+                                stderr=subprocess.STDOUT, check=False)
+
+        if result.returncode != 0:
+            print(f"Failed to load track {track}:", file=sys.stderr)
+            print(result.stdout.decode("utf-8", errors="replace"), file=sys.stderr)
+            is_successful = False
+
+    return is_successful
+
+def to_text(value):
+    """Convert a result value to its text in the table.
+
+    Args:
+        value: Result value.
+
+    Returns:
+        str: Text
+    """
+    text = "-"
+
+    if isinstance(value, float):
+        text = f"{value:.1f}"
+    elif value is not None:
+        text = str(value)
+
+    return text
+
+def print_table(rows):
+    """Print the results as table on the console.
+
+    Args:
+        rows (list): Result rows, see COLUMNS.
+    """
+    texts = [[to_text(value) for value in row] for row in rows]
+    widths = [max([len(column)] + [len(row[idx]) for row in texts]) for idx, column in enumerate(COLUMNS)]
+
+    print(" | ".join(column.ljust(widths[idx]) for idx, column in enumerate(COLUMNS)).rstrip())
+    print("-+-".join("-" * width for width in widths))
+
+    for row in texts:
+        print(" | ".join(text.ljust(widths[idx]) for idx, text in enumerate(row)).rstrip())
+
+def write_csv(file_name, rows):
+    """Write the results to a CSV file.
+
+    Args:
+        file_name (str): CSV file name.
+        rows (list): Result rows, see COLUMNS.
+    """
+    with open(file_name, "w", newline="", encoding="utf-8") as fd:
+        writer = csv.writer(fd)
+        writer.writerow(COLUMNS)
+
+        for row in rows:
+            writer.writerow(["" if value is None else value for value in row])
+
+def main():
+    """Main entry point"""
+    parser = argparse.ArgumentParser(description="Runs headless line follower simulations in parallel over " \
+                                     "all combinations of parameter sets, tracks and seeds.")
+    parser.add_argument("tracks", nargs="+", help="Track bitmaps (binary PGM), see track_to_pgm.py")
+    parser.add_argument("-p", "--program", default=".pio/build/LineFollowerHeadless/program",
+                        help="Headless simulation program, default .pio/build/LineFollowerHeadless/program")
+    parser.add_argument("-s", "--sets", type=int, nargs="+", default=list(range(MAX_PARAMETER_SETS)),
+                        help="Parameter set ids, default all")
+    parser.add_argument("-r", "--seeds", type=int, nargs="+", default=[0],
+                        help="Seeds of the line sensor noise, 0 means no noise, default 0")
+    parser.add_argument("-d", "--duration", type=int, default=60000,
+                        help="Simulated duration of every run in ms, default 60000")
+    parser.add_argument("-j", "--jobs", type=int, default=os.cpu_count(),
+                        help="Number of parallel runs, default number of CPU cores")
+    parser.add_argument("-t", "--timeout", type=float, default=600.0,
+                        help="Max. wall-clock time of every run in s, default 600")
+    parser.add_argument("-o", "--output", default=None, help="Write the results to this CSV file")
+    args = parser.parse_args()
+
+    if any((set_id < 0) or (set_id >= MAX_PARAMETER_SETS) for set_id in args.sets):
+        print(f"The parameter set ids must be in the range 0 to {MAX_PARAMETER_SETS - 1}.", file=sys.stderr)
+        sys.exit(1)
+
+    if (args.jobs is None) or (args.jobs < 1):
+        args.jobs = 1
+
+    if not prepare_tracks(args.program, args.tracks):
+        sys.exit(1)
+
+    matrix = list(itertools.product(args.tracks, args.sets, args.seeds))
+    start_time = time.monotonic()
+
+    # Every run is a separate process, which only waits here. Therefore the
+    # threads don't contend for the GIL and the runs scale with the cores.
+    with concurrent.futures.ThreadPoolExecutor(max_workers=args.jobs) as executor:
+        rows = list(executor.map(lambda entry: run(args.program, entry[0], entry[1], entry[2], args.duration,
+                                                   args.timeout), matrix))
+
+    duration = time.monotonic() - start_time
+
+    print_table(rows)
+    print(f"\n{len(rows)} runs in {duration:.1f} s with {args.jobs} parallel jobs.")
+
+    if args.output is not None:
+        write_csv(args.output, rows)
+
+################################################################################
+# Main
+################################################################################
+
+if __name__ == "__main__":
+    main()
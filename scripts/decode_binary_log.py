@@ -0,0 +1,275 @@
+"""Decoder for the binary log records of the robot"""
+
+# MIT License
+#
+# Copyright (c) 2022 - 2025 Andreas Merkle (web@blue-andi.de)
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+################################################################################
+# Imports
+################################################################################
+import argparse
+import os
+import re
+import struct
+import sys
+
+################################################################################
+# Variables
+################################################################################
+SYNC = 0xA5
+FRAME_OVERHEAD = 3
+DROPPED_ID = 0
+TAG_HASH_START = 5381
+
+ARG_TYPE_SIGNED = 0x10
+ARG_TYPE_UNSIGNED = 0x20
+ARG_TYPE_FLOAT = 0x30
+ARG_TYPE_CHAR = 0x40
+ARG_TYPE_STRING = 0x50
+
+LEVELS = {
+    "FATAL": "F",
+    "ERROR": "E",
+    "WARNING": "W",
+    "INFO": "I",
+    "DEBUG": "D"
+}
+
+REGEX_LOG_TAG = re.compile(r'^\s*LOG_TAG\(\s*"([^"]*)"\s*\)')
+REGEX_LOG_MSG = re.compile(r'\bLOG_(FATAL|ERROR|WARNING|INFO|DEBUG)(_VAL|_HEAD)?\(\s*("(?:[^"\\]|\\.)*")?')
+
+################################################################################
+# Classes
+################################################################################
+
+class MessageCatalog:
+    """Catalog of all log messages, which maps the message id to the text."""
+
+    def __init__(self):
+        self.messages = {}
+
+    def add_file(self, file_name):
+        """Scan a source file for log messages."""
+        tag = None
+        tag_id = None
+        messages = []
+
+        with open(file_name, "r", encoding="utf-8", errors="replace") as file:
+            for line_number, line in enumerate(file, start=1):
+                match = REGEX_LOG_TAG.match(line)
+                if match is not None:
+                    tag = match.group(1)
+                    tag_id = get_tag_id(tag)
+                    continue
+
+                for match in REGEX_LOG_MSG.finditer(line):
+                    text = ""
+                    if match.group(3) is not None:
+                        text = bytes(match.group(3)[1:-1], "utf-8").decode("unicode_escape")
+                    messages.append((line_number, LEVELS[match.group(1)], text))
+
+        # The log tag may be defined after the first log message was found in the file.
+        if tag is not None:
+            for line_number, level, text in messages:
+                message_id = (tag_id << 16) | (line_number & 0xFFFF)
+                entry = (tag, level, text, file_name)
+
+                if message_id in self.messages:
+                    other = self.messages[message_id]
+                    print(f"Warning: Message id 0x{message_id:08X} of {file_name}:{line_number} "
+                          f"collides with {other[3]}.", file=sys.stderr)
+                self.messages[message_id] = entry
+
+    def add_directory(self, path):
+        """Scan all source files in the directory recursively."""
+        for root, _, files in os.walk(path):
+            for file_name in sorted(files):
+                if os.path.splitext(file_name)[1] in (".c", ".cpp", ".h", ".hpp"):
+                    self.add_file(os.path.join(root, file_name))
+
+    def get(self, message_id):
+        """Get tag, level and text of the message."""
+        return self.messages.get(message_id)
+
+class FrameDecoder:
+    """Decodes the byte stream into records."""
+
+    def __init__(self):
+        self.buffer = bytearray()
+        self.checksum_errors = 0
+
+    def feed(self, data):
+        """Feed received bytes and return all completely received records."""
+        records = []
+        self.buffer.extend(data)
+
+        while True:
+            # Synchronize to the start of a frame.
+            start = self.buffer.find(bytes([SYNC]))
+            if start < 0:
+                self.buffer.clear()
+                break
+            del self.buffer[:start]
+
+            if len(self.buffer) < 2:
+                break
+
+            length = self.buffer[1]
+            if len(self.buffer) < (length + FRAME_OVERHEAD):
+                break
+
+            payload = bytes(self.buffer[2:2 + length])
+            checksum = (length + sum(payload)) & 0xFF
+
+            if (checksum != self.buffer[2 + length]) or (length < 8):
+                # Skip only the sync byte, the real frame may start inside.
+                self.checksum_errors += 1
+                del self.buffer[:1]
+                continue
+
+            del self.buffer[:length + FRAME_OVERHEAD]
+            records.append(parse_record(payload))
+
+        return records
+
+################################################################################
+# Functions
+################################################################################
+
+def get_tag_id(tag):
+    """Calculate the log tag id, same as BinaryLog::getTagId()."""
+    tag_id = TAG_HASH_START
+    for char in tag.encode("utf-8"):
+        tag_id = ((tag_id * 33) ^ char) & 0xFFFF
+    return tag_id
+
+def parse_record(payload):
+    """Parse the record payload into message id, timestamp and arguments."""
+    message_id, timestamp = struct.unpack_from("<II", payload, 0)
+    args = []
+    idx = 8
+
+    while idx < len(payload):
+        arg_type = payload[idx] & 0xF0
+        arg_size = payload[idx] & 0x0F
+        idx += 1
+
+        if arg_type == ARG_TYPE_STRING:
+            length = payload[idx]
+            args.append(payload[idx + 1:idx + 1 + length].decode("utf-8", errors="replace"))
+            idx += 1 + length
+        elif arg_type == ARG_TYPE_CHAR:
+            args.append(chr(payload[idx]))
+            idx += arg_size
+        elif arg_type == ARG_TYPE_FLOAT:
+            args.append(f"{struct.unpack_from('<f', payload, idx)[0]:.2f}")
+            idx += arg_size
+        elif arg_type in (ARG_TYPE_SIGNED, ARG_TYPE_UNSIGNED):
+            args.append(str(int.from_bytes(payload[idx:idx + arg_size], "little",
+                                           signed=(arg_type == ARG_TYPE_SIGNED))))
+            idx += arg_size
+        else:
+            args.append("<?>")
+            break
+
+    return message_id, timestamp, args
+
+def format_record(catalog, record):
+    """Format the record like the text log of the robot."""
+    message_id, timestamp, args = record
+    text = None
+
+    if message_id == DROPPED_ID:
+        text = f"{timestamp} W BinaryLog:0 Dropped records: {''.join(args)}"
+    else:
+        entry = catalog.get(message_id)
+        tag_id = message_id >> 16
+        line_number = message_id & 0xFFFF
+
+        if entry is None:
+            text = f"{timestamp} U 0x{tag_id:04X}:{line_number} {' '.join(args)}"
+        else:
+            tag, level, msg, _ = entry
+            text = f"{timestamp} {level} {tag}:{line_number} {msg}{''.join(args)}"
+
+    return text
+
+def open_input(args):
+    """Open the input stream, either a serial port or a file."""
+    stream = None
+
+    if args.port is not None:
+        import serial # pylint: disable=import-outside-toplevel
+        stream = serial.Serial(args.port, args.baudrate, timeout=0.1)
+    elif args.file == "-":
+        stream = sys.stdin.buffer
+    else:
+        stream = open(args.file, "rb") # pylint: disable=consider-using-with
+
+    return stream
+
+def main():
+    """Main entry point."""
+    parser = argparse.ArgumentParser(description="Decodes the binary log records of the robot.")
+    parser.add_argument("file", nargs="?", default="-",
+                        help="Recorded binary log file or - for stdin. Default: -")
+    parser.add_argument("-p", "--port", help="Serial port to read from, e.g. COM3 or /dev/ttyACM0.")
+    parser.add_argument("-b", "--baudrate", type=int, default=115200, help="Serial baudrate. Default: 115200")
+    parser.add_argument("-s", "--src", action="append",
+                        help="Source directory with the log messages. Use it for the application and the "
+                             "Service library, e.g. -s lib/APPLineFollower/src -s lib/Service/src")
+    args = parser.parse_args()
+
+    catalog = MessageCatalog()
+    src_dirs = args.src
+    if src_dirs is None:
+        src_dirs = [os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "lib", "Service", "src")]
+    for src_dir in src_dirs:
+        catalog.add_directory(src_dir)
+
+    decoder = FrameDecoder()
+    stream = open_input(args)
+
+    try:
+        while True:
+            data = stream.read(64)
+            if (data is None) or (len(data) == 0):
+                if args.port is None:
+                    break
+                continue
+
+            for record in decoder.feed(data):
+                print(format_record(catalog, record), flush=True)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if stream is not sys.stdin.buffer:
+            stream.close()
+
+    if decoder.checksum_errors > 0:
+        print(f"Checksum errors: {decoder.checksum_errors}", file=sys.stderr)
+
+################################################################################
+# Main
+################################################################################
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,129 @@
+"""Decoder for the batched and delta encoded telemetry frames of the robot"""
+
+# MIT License
+#
+# Copyright (c) 2022 - 2025 Andreas Merkle (web@blue-andi.de)
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+################################################################################
+################################################################################
+# Imports
+################################################################################
+import struct
+
+################################################################################
+# Variables
+################################################################################
+HEADER_FORMAT = "<HBI"
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+INFO_KEYFRAME = 0x80
+INFO_COUNT_MASK = 0x7F
+
+# Values of a sample on the "VEH_BATCH" channel, see SMPChannelPayload::VehicleDataValue.
+VEHICLE_DATA_VALUES = ["x", "y", "orientation", "left", "right", "center", "proximity"]
+
+################################################################################
+# Classes
+################################################################################
+
+class TelemetryBatchDecoder:
+    """Decodes the telemetry batch frames of a single channel. The deltas
+    refer to the previous sample, therefore after a lost frame all frames are
+    discarded until the next keyframe."""
+
+    def __init__(self, value_count):
+        self.value_count = value_count
+        self.reference = None
+        self.next_seq = None
+        self.lost_frames = 0
+
+    def decode(self, frame):
+        """Decode a frame and return the list of samples as tuple of
+        timestamp in ms and the list of values."""
+        samples = []
+        seq, info, timestamp = struct.unpack_from(HEADER_FORMAT, frame)
+        is_keyframe = (info & INFO_KEYFRAME) != 0
+        count = info & INFO_COUNT_MASK
+
+        if (self.next_seq is not None) and (seq != self.next_seq):
+            self.lost_frames += (seq - self.next_seq) & 0xFFFF
+            self.reference = None
+
+        self.next_seq = (seq + 1) & 0xFFFF
+
+        if is_keyframe and (count > 0):
+            self.reference = None
+
+        if (self.reference is not None) or (is_keyframe and (count > 0)):
+            idx = HEADER_SIZE
+
+            for sample_idx in range(count):
+                if sample_idx > 0:
+                    time_diff, idx = read_varint(frame, idx)
+                    timestamp = (timestamp + time_diff) & 0xFFFFFFFF
+
+                # The first sample of a keyframe contains the absolute values.
+                if self.reference is None:
+                    self.reference = [0] * self.value_count
+
+                values = []
+                for value_idx in range(self.value_count):
+                    delta, idx = read_signed_varint(frame, idx)
+                    values.append(to_int32(self.reference[value_idx] + delta))
+
+                self.reference = values
+                samples.append((timestamp, values))
+
+        return samples
+
+################################################################################
+# Functions
+################################################################################
+
+def read_varint(data, idx):
+    """Read a varint and return it together with the index of the next byte."""
+    value = 0
+    shift = 0
+
+    while True:
+        byte = data[idx]
+        idx += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+
+        if (byte & 0x80) == 0:
+            break
+
+    return value, idx
+
+def read_signed_varint(data, idx):
+    """Read a zigzag varint and return it together with the index of the next byte."""
+    value, idx = read_varint(data, idx)
+
+    return (value >> 1) ^ -(value & 1), idx
+
+def to_int32(value):
+    """Wrap a value around to the int32 range, like the robot does."""
+    value &= 0xFFFFFFFF
+
+    if value >= 0x80000000:
+        value -= 0x100000000
+
+    return value
@@ -0,0 +1,307 @@
+"""Converts a Webots track texture (PNG) to a binary PGM, which the headless simulation loads"""
+
+# MIT License
+#
+# Copyright (c) 2023 - 2025 Andreas Merkle (web@blue-andi.de)
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+
+################################################################################
+# Imports
+################################################################################
+import argparse
+import struct
+import sys
+import zlib
+
+################################################################################
+# Variables
+################################################################################
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+
+COLOR_TYPE_GRAY = 0
+COLOR_TYPE_RGB = 2
+COLOR_TYPE_PALETTE = 3
+COLOR_TYPE_GRAY_ALPHA = 4
+COLOR_TYPE_RGBA = 6
+
+CHANNELS = {
+    COLOR_TYPE_GRAY: 1,
+    COLOR_TYPE_RGB: 3,
+    COLOR_TYPE_PALETTE: 1,
+    COLOR_TYPE_GRAY_ALPHA: 2,
+    COLOR_TYPE_RGBA: 4
+}
+
+################################################################################
+# Classes
+################################################################################
+
+################################################################################
+# Functions
+################################################################################
+
+def read_chunks(data):
+    """Split the PNG file into its chunks.
+
+    Args:
+        data (bytes): PNG file content.
+
+    Returns:
+        list: Chunks as tuple of type and data.
+    """
+    if data[:len(PNG_SIGNATURE)] != PNG_SIGNATURE:
+        raise ValueError("Not a PNG file.")
+
+    chunks = []
+    offset = len(PNG_SIGNATURE)
+
+    while offset < len(data):
+        length, chunk_type = struct.unpack(">I4s", data[offset:offset + 8])
+        chunks.append((chunk_type, data[offset + 8:offset + 8 + length]))
+        offset += 8 + length + 4 # Length, type, data and CRC
+
+    return chunks
+
+def paeth(left, up, up_left):
+    """Paeth predictor of the PNG filter type 4."""
+    estimate = left + up - up_left
+    dist_left = abs(estimate - left)
+    dist_up = abs(estimate - up)
+    dist_up_left = abs(estimate - up_left)
+
+    if (dist_left <= dist_up) and (dist_left <= dist_up_left):
+        return left
+    if dist_up <= dist_up_left:
+        return up
+    return up_left
+
+def unfilter(raw, width, height, bpp):
+    """Reverse the PNG scanline filters.
+
+    Args:
+        raw (bytes): Decompressed image data with the filter type per scanline.
+        width (int): Image width in pixel.
+        height (int): Image height in pixel.
+        bpp (int): Bytes per pixel.
+
+    Returns:
+        list: Scanlines as bytearray.
+    """
+    stride = width * bpp
+    rows = []
+    prev = bytearray(stride)
+
+    for row_idx in range(height):
+        offset = row_idx * (stride + 1)
+        filter_type = raw[offset]
+        row = bytearray(raw[offset + 1:offset + 1 + stride])
+
+        if filter_type == 1: # Sub
+            for idx in range(bpp, stride):
+                row[idx] = (row[idx] + row[idx - bpp]) & 0xFF
+        elif filter_type == 2: # Up
+            row = bytearray((value + up) & 0xFF for value, up in zip(row, prev))
+        elif filter_type == 3: # Average
+            for idx in range(stride):
+                left = row[idx - bpp] if idx >= bpp else 0
+                row[idx] = (row[idx] + ((left + prev[idx]) >> 1)) & 0xFF
+        elif filter_type == 4: # Paeth
+            for idx in range(stride):
+                left = row[idx - bpp] if idx >= bpp else 0
+                up_left = prev[idx - bpp] if idx >= bpp else 0
+                row[idx] = (row[idx] + paeth(left, prev[idx], up_left)) & 0xFF
+        elif filter_type != 0:
+            raise ValueError(f"Unknown filter type {filter_type}.")
+
+        rows.append(row)
+        prev = row
+
+    return rows
+
+def to_gray(rows, width, color_type, palette):
+    """Convert the scanlines to gray values. Transparent pixels are white.
+
+    Args:
+        rows (list): Scanlines as bytearray.
+        width (int): Image width in pixel.
+        color_type (int): PNG color type.
+        palette (bytes): Palette, only used by the palette color type.
+
+    Returns:
+        list: Scanlines with one gray value per pixel as bytearray.
+    """
+    gray_rows = []
+    bpp = CHANNELS[color_type]
+
+    for row in rows:
+        gray_row = bytearray(width)
+
+        for idx in range(width):
+            pixel = row[idx * bpp:(idx + 1) * bpp]
+            alpha = 255
+
+            if color_type == COLOR_TYPE_GRAY:
+                gray = pixel[0]
+            elif color_type == COLOR_TYPE_GRAY_ALPHA:
+                gray = pixel[0]
+                alpha = pixel[1]
+            elif color_type == COLOR_TYPE_PALETTE:
+                red, green, blue = palette[pixel[0] * 3:pixel[0] * 3 + 3]
+                gray = (299 * red + 587 * green + 114 * blue) // 1000
+            else:
+                gray = (299 * pixel[0] + 587 * pixel[1] + 114 * pixel[2]) // 1000
+                if color_type == COLOR_TYPE_RGBA:
+                    alpha = pixel[3]
+
+            # Blend with the white floor.
+            gray_row[idx] = (gray * alpha + 255 * (255 - alpha)) // 255
+
+        gray_rows.append(gray_row)
+
+    return gray_rows
+
+def map_to_floor(rows, width, height, floor_size, tile_size):
+    """Map the texture to the floor like the Webots RectangleArena does. A texture
+    tile starts at the floor corner with the smallest coordinates and is repeated,
+    if it is smaller than the floor. If it is greater, only a part is visible.
+
+    Args:
+        rows (list): Scanlines with one gray value per pixel.
+        width (int): Image width in pixel.
+        height (int): Image height in pixel.
+        floor_size (float): Edge length of the floor in m.
+        tile_size (float): Edge length of a texture tile in m.
+
+    Returns:
+        tuple: Scanlines of the floor, width and height.
+    """
+    new_width = int(round(width * floor_size / tile_size))
+    new_height = int(round(height * floor_size / tile_size))
+    new_rows = []
+
+    # The first scanline is the one with the greatest y-coordinate, therefore
+    # the rows are counted from the bottom.
+    for row_idx in range(new_height - 1, -1, -1):
+        row = rows[height - 1 - (row_idx % height)]
+        new_rows.append(bytearray(row[idx % width] for idx in range(new_width)))
+
+    return new_rows, new_width, new_height
+
+def downscale(rows, width, height, factor):
+    """Downscale the gray image by averaging blocks of factor x factor pixels.
+
+    Args:
+        rows (list): Scanlines with one gray value per pixel.
+        width (int): Image width in pixel.
+        height (int): Image height in pixel.
+        factor (int): Downscale factor.
+
+    Returns:
+        tuple: Downscaled scanlines, width and height.
+    """
+    new_width = width // factor
+    new_height = height // factor
+    new_rows = []
+
+    for row_idx in range(new_height):
+        sums = [0] * new_width
+
+        for row in rows[row_idx * factor:(row_idx + 1) * factor]:
+            for idx in range(new_width):
+                sums[idx] += sum(row[idx * factor:(idx + 1) * factor])
+
+        new_rows.append(bytearray(value // (factor * factor) for value in sums))
+
+    return new_rows, new_width, new_height
+
+def convert(png_file, pgm_file, floor_size, tile_size, factor):
+    """Convert a PNG file to a binary PGM file.
+
+    Args:
+        png_file (str): PNG file name.
+        pgm_file (str): PGM file name.
+        floor_size (float): Edge length of the floor in m.
+        tile_size (float): Edge length of a texture tile in m.
+        factor (int): Downscale factor.
+    """
+    with open(png_file, "rb") as fd:
+        chunks = read_chunks(fd.read())
+
+    header = chunks[0][1]
+    width, height, bit_depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", header)
+
+    if (bit_depth != 8) or (color_type not in CHANNELS):
+        raise ValueError("Only 8 bit per channel are supported.")
+
+    if interlace != 0:
+        raise ValueError("Interlaced images are not supported.")
+
+    palette = b"".join(data for chunk_type, data in chunks if chunk_type == b"PLTE")
+    raw = zlib.decompress(b"".join(data for chunk_type, data in chunks if chunk_type == b"IDAT"))
+    rows = unfilter(raw, width, height, CHANNELS[color_type])
+    rows = to_gray(rows, width, color_type, palette)
+
+    if floor_size != tile_size:
+        rows, width, height = map_to_floor(rows, width, height, floor_size, tile_size)
+
+    if factor > 1:
+        rows, width, height = downscale(rows, width, height, factor)
+
+    with open(pgm_file, "wb") as fd:
+        fd.write(f"P5\n{width} {height}\n255\n".encode("ascii"))
+        for row in rows:
+            fd.write(row)
+
+    print(f"{pgm_file}: {width} x {height} pixel")
+
+def main():
+    """Main entry point"""
+    parser = argparse.ArgumentParser(description="Converts a Webots track texture (PNG) to a binary PGM, " \
+                                     "which the headless simulation loads with --track.")
+    parser.add_argument("png", help="Track texture, e.g. webots/worlds/track.png")
+    parser.add_argument("pgm", help="Output file")
+    parser.add_argument("-f", "--floor-size", type=float, default=None,
+                        help="Edge length of the floor in m (RectangleArena floorSize)")
+    parser.add_argument("-t", "--tile-size", type=float, default=None,
+                        help="Edge length of a texture tile in m (RectangleArena floorTileSize), default floor size")
+    parser.add_argument("-d", "--downscale", type=int, default=1,
+                        help="Downscale factor to reduce the file size, default 1")
+    args = parser.parse_args()
+
+    if args.downscale < 1:
+        print("The downscale factor must be at least 1.", file=sys.stderr)
+        sys.exit(1)
+
+    floor_size = args.floor_size if args.floor_size is not None else args.tile_size
+    tile_size = args.tile_size if args.tile_size is not None else floor_size
+
+    if (floor_size is not None) and ((floor_size <= 0) or (tile_size <= 0)):
+        print("The floor and tile size must be greater than 0.", file=sys.stderr)
+        sys.exit(1)
+
+    convert(args.png, args.pgm, floor_size, tile_size, args.downscale)
+
+################################################################################
+# Main
+################################################################################
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,301 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @author  Andreas Merkle <web@blue-andi.de>
+ * @brief   This module contains the BinaryLog tests.
+ */
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <BinaryLog.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testIds();
+static void testRecord();
+static void testString();
+static void testDroppedRecords();
+
+static uint32_t getUInt32(const uint8_t* data);
+static uint8_t  getChecksum(const uint8_t* frame);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Program setup routine, which is called once at startup.
+ */
+void setup()
+{
+#ifndef TARGET_NATIVE
+    /* https://docs.platformio.org/en/latest/plus/unit-testing.html#demo */
+    delay(2000);
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Main entry point.
+ */
+void loop()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testIds);
+    RUN_TEST(testRecord);
+    RUN_TEST(testString);
+    RUN_TEST(testDroppedRecords);
+
+    UNITY_END();
+
+#ifndef TARGET_NATIVE
+    /* Don't exit on the robot to avoid a endless test loop.
+     * If the test runs on the pc, it must exit.
+     */
+    for (;;)
+    {
+    }
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Initialize the test setup.
+ */
+extern void setUp(void)
+{
+    BinaryLog::clear();
+}
+
+/**
+ * Clean up test setup.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Test the compile time calculation of the log tag and message ids.
+ */
+static void testIds()
+{
+    /* The ids must be available at compile time. */
+    static constexpr uint16_t TAG_ID = BinaryLog::getTagId("RState");
+
+    /* Reference values, which the host decoder calculates as well. */
+    TEST_ASSERT_EQUAL_UINT16(BinaryLog::TAG_HASH_START, BinaryLog::getTagId(""));
+    TEST_ASSERT_EQUAL_UINT16(((5381U * 33U) ^ 'A') & 0xFFFFU, BinaryLog::getTagId("A"));
+    TEST_ASSERT_TRUE(TAG_ID != BinaryLog::getTagId("EState"));
+
+    TEST_ASSERT_EQUAL_UINT32((static_cast<uint32_t>(TAG_ID) << 16U) | 85U, BinaryLog::getMessageId(TAG_ID, 85));
+    TEST_ASSERT_TRUE(BinaryLog::DROPPED_ID != BinaryLog::getMessageId(TAG_ID, 85));
+}
+
+/**
+ * Test the frame format of a record with arguments.
+ */
+static void testRecord()
+{
+    const uint32_t ID = BinaryLog::getMessageId(BinaryLog::getTagId("Test"), 42);
+    uint8_t        frame[32U];
+    size_t         size;
+
+    TEST_ASSERT_EQUAL(0U, BinaryLog::read(frame, sizeof(frame)));
+
+    BinaryLog::begin(ID);
+    BinaryLog::addArg(static_cast<int16_t>(-2));
+    BinaryLog::addArg(static_cast<uint8_t>(200U));
+    BinaryLog::addArg(1.5F);
+    BinaryLog::commit();
+
+    /* SYNC + LEN + ID + TIMESTAMP + 3 arguments + CHECKSUM */
+    size = BinaryLog::read(frame, sizeof(frame));
+    TEST_ASSERT_EQUAL(2U + 4U + 4U + 3U + 2U + 5U + 1U, size);
+    TEST_ASSERT_EQUAL(0U, BinaryLog::getPendingBytes());
+
+    TEST_ASSERT_EQUAL_UINT8(BinaryLog::SYNC, frame[0U]);
+    TEST_ASSERT_EQUAL_UINT8(size - BinaryLog::FRAME_OVERHEAD, frame[1U]);
+    TEST_ASSERT_EQUAL_UINT32(ID, getUInt32(&frame[2U]));
+    TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(millis()), getUInt32(&frame[6U]));
+
+    TEST_ASSERT_EQUAL_UINT8(BinaryLog::ARG_TYPE_SIGNED | 2U, frame[10U]);
+    TEST_ASSERT_EQUAL_UINT8(0xFEU, frame[11U]);
+    TEST_ASSERT_EQUAL_UINT8(0xFFU, frame[12U]);
+
+    TEST_ASSERT_EQUAL_UINT8(BinaryLog::ARG_TYPE_UNSIGNED | 1U, frame[13U]);
+    TEST_ASSERT_EQUAL_UINT8(200U, frame[14U]);
+
+    TEST_ASSERT_EQUAL_UINT8(BinaryLog::ARG_TYPE_FLOAT, frame[15U]);
+    TEST_ASSERT_EQUAL_UINT32(0x3FC00000U, getUInt32(&frame[16U]));
+
+    TEST_ASSERT_EQUAL_UINT8(getChecksum(frame), frame[size - 1U]);
+
+    /* A record, which is not committed, is discarded by the next one. */
+    BinaryLog::begin(ID);
+    BinaryLog::addArg(123);
+    BinaryLog::write(ID);
+    TEST_ASSERT_EQUAL(2U + 4U + 4U + 1U, BinaryLog::getPendingBytes());
+}
+
+/**
+ * Test string arguments and their truncation.
+ */
+static void testString()
+{
+    const uint32_t ID = BinaryLog::getMessageId(BinaryLog::getTagId("Test"), 1);
+    uint8_t        frame[CONFIG_LOG_BINARY_RECORD_SIZE + BinaryLog::FRAME_OVERHEAD];
+    size_t         size;
+    char           longString[CONFIG_LOG_BINARY_RECORD_SIZE + 1U];
+
+    BinaryLog::write(ID, "abc");
+    size = BinaryLog::read(frame, sizeof(frame));
+    TEST_ASSERT_EQUAL(2U + 4U + 4U + 2U + 3U + 1U, size);
+    TEST_ASSERT_EQUAL_UINT8(BinaryLog::ARG_TYPE_STRING, frame[10U]);
+    TEST_ASSERT_EQUAL_UINT8(3U, frame[11U]);
+    TEST_ASSERT_EQUAL_MEMORY("abc", &frame[12U], 3U);
+
+    /* A too long string is truncated to the record size. */
+    memset(longString, 'x', sizeof(longString) - 1U);
+    longString[sizeof(longString) - 1U] = '\0';
+
+    BinaryLog::write(ID, static_cast<const char*>(longString));
+    size = BinaryLog::read(frame, sizeof(frame));
+    TEST_ASSERT_EQUAL(sizeof(frame), size);
+    TEST_ASSERT_EQUAL_UINT8(CONFIG_LOG_BINARY_RECORD_SIZE - 4U - 4U - 2U, frame[11U]);
+    TEST_ASSERT_EQUAL_UINT8(getChecksum(frame), frame[size - 1U]);
+}
+
+/**
+ * Test that records are dropped as a whole if the ring buffer is full and
+ * that the number of dropped records is reported afterwards.
+ */
+static void testDroppedRecords()
+{
+    const uint32_t ID          = BinaryLog::getMessageId(BinaryLog::getTagId("Test"), 2);
+    const size_t   RECORD_SIZE = 2U + 4U + 4U + 5U + 1U;
+    const size_t   RECORDS     = CONFIG_LOG_BINARY_BUFFER_SIZE / RECORD_SIZE;
+    uint8_t        frame[RECORD_SIZE];
+    size_t         idx;
+
+    for (idx = 0U; idx < (RECORDS + 2U); ++idx)
+    {
+        BinaryLog::write(ID, static_cast<uint32_t>(idx));
+    }
+
+    /* Only complete records are in the buffer. */
+    TEST_ASSERT_EQUAL(RECORDS * RECORD_SIZE, BinaryLog::getPendingBytes());
+    TEST_ASSERT_EQUAL_UINT16(2U, BinaryLog::getDroppedRecords());
+
+    /* Drain the buffer and log the next record. */
+    while (0U < BinaryLog::read(frame, sizeof(frame)))
+    {
+        TEST_ASSERT_EQUAL_UINT32(ID, getUInt32(&frame[2U]));
+        TEST_ASSERT_EQUAL_UINT8(getChecksum(frame), frame[RECORD_SIZE - 1U]);
+    }
+
+    BinaryLog::write(ID, static_cast<uint32_t>(idx));
+
+    /* The dropped records are reported first. */
+    TEST_ASSERT_EQUAL(2U + 4U + 4U + 3U + 1U, BinaryLog::read(frame, 2U + 4U + 4U + 3U + 1U));
+    TEST_ASSERT_EQUAL_UINT32(BinaryLog::DROPPED_ID, getUInt32(&frame[2U]));
+    TEST_ASSERT_EQUAL_UINT8(BinaryLog::ARG_TYPE_UNSIGNED | 2U, frame[10U]);
+    TEST_ASSERT_EQUAL_UINT8(2U, frame[11U]);
+    TEST_ASSERT_EQUAL_UINT8(0U, frame[12U]);
+    TEST_ASSERT_EQUAL_UINT8(getChecksum(frame), frame[13U]);
+
+    TEST_ASSERT_EQUAL(RECORD_SIZE, BinaryLog::read(frame, sizeof(frame)));
+    TEST_ASSERT_EQUAL_UINT32(ID, getUInt32(&frame[2U]));
+    TEST_ASSERT_EQUAL_UINT16(2U, BinaryLog::getDroppedRecords());
+}
+
+/**
+ * Get a 32-bit value in little endian byte order.
+ *
+ * @param[in] data  Data
+ *
+ * @return Value
+ */
+static uint32_t getUInt32(const uint8_t* data)
+{
+    return static_cast<uint32_t>(data[0U]) | (static_cast<uint32_t>(data[1U]) << 8U) |
+           (static_cast<uint32_t>(data[2U]) << 16U) | (static_cast<uint32_t>(data[3U]) << 24U);
+}
+
+/**
+ * Calculate the checksum of a frame.
+ *
+ * @param[in] frame Frame, starting with the sync byte.
+ *
+ * @return Checksum
+ */
+static uint8_t getChecksum(const uint8_t* frame)
+{
+    uint8_t checksum = frame[1U];
+    uint8_t idx;
+
+    for (idx = 0U; idx < frame[1U]; ++idx)
+    {
+        checksum += frame[2U + idx];
+    }
+
+    return checksum;
+}
@@ -0,0 +1,215 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @author  Andreas Merkle <web@blue-andi.de>
+ * @brief   This module contains the ChangeFilter tests.
+ */
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <ChangeFilter.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testDeadband();
+static void testMinInterval();
+static void testMaxInterval();
+static void testReset();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Number of values, used by the tests. */
+static const uint8_t VALUE_COUNT = 3U;
+
+/** Deadband, used by the tests. */
+static const uint16_t DEADBAND = 10U;
+
+/** Min. interval in ms, used by the tests. */
+static const uint32_t MIN_INTERVAL = 20U;
+
+/** Max. interval in ms, used by the tests. */
+static const uint32_t MAX_INTERVAL = 500U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Program setup routine, which is called once at startup.
+ */
+void setup()
+{
+#ifndef TARGET_NATIVE
+    /* https://docs.platformio.org/en/latest/plus/unit-testing.html#demo */
+    delay(2000);
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Main entry point.
+ */
+void loop()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testDeadband);
+    RUN_TEST(testMinInterval);
+    RUN_TEST(testMaxInterval);
+    RUN_TEST(testReset);
+
+    UNITY_END();
+
+#ifndef TARGET_NATIVE
+    /* Don't exit on the robot to avoid a endless test loop.
+     * If the test runs on the pc, it must exit.
+     */
+    for (;;)
+    {
+    }
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Initialize the test setup.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test setup.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Test that only changes above the deadband are sent.
+ */
+static void testDeadband()
+{
+    ChangeFilter filter(VALUE_COUNT, DEADBAND, MIN_INTERVAL, MAX_INTERVAL);
+    uint16_t     values[VALUE_COUNT] = {100U, 200U, 300U};
+
+    /* The first values are always sent. */
+    TEST_ASSERT_TRUE(filter.isSendRequired(1000U, values));
+
+    /* Changes within the deadband in both directions. */
+    values[0U] += DEADBAND;
+    values[1U] -= DEADBAND;
+    TEST_ASSERT_FALSE(filter.isSendRequired(1100U, values));
+
+    /* A single value changed more than the deadband. */
+    values[2U] -= DEADBAND + 1U;
+    TEST_ASSERT_TRUE(filter.isSendRequired(1200U, values));
+
+    /* The sent values are the new reference. */
+    values[2U] += DEADBAND;
+    TEST_ASSERT_FALSE(filter.isSendRequired(1300U, values));
+}
+
+/**
+ * Test that the changes are sent at most once per min. interval.
+ */
+static void testMinInterval()
+{
+    ChangeFilter filter(VALUE_COUNT, DEADBAND, MIN_INTERVAL, MAX_INTERVAL);
+    uint16_t     values[VALUE_COUNT] = {100U, 200U, 300U};
+
+    TEST_ASSERT_TRUE(filter.isSendRequired(1000U, values));
+
+    values[0U] = 500U;
+    TEST_ASSERT_FALSE(filter.isSendRequired(1000U + MIN_INTERVAL - 1U, values));
+
+    /* The change is sent, after the min. interval elapsed. */
+    TEST_ASSERT_TRUE(filter.isSendRequired(1000U + MIN_INTERVAL, values));
+}
+
+/**
+ * Test that unchanged values are sent again after the max. interval.
+ */
+static void testMaxInterval()
+{
+    ChangeFilter filter(VALUE_COUNT, DEADBAND, MIN_INTERVAL, MAX_INTERVAL);
+    uint16_t     values[VALUE_COUNT] = {100U, 200U, 300U};
+
+    /* Timestamp overflow shall not matter. */
+    TEST_ASSERT_TRUE(filter.isSendRequired(UINT32_MAX - 10U, values));
+    TEST_ASSERT_FALSE(filter.isSendRequired(UINT32_MAX - 11U + MAX_INTERVAL, values));
+    TEST_ASSERT_TRUE(filter.isSendRequired(UINT32_MAX - 10U + MAX_INTERVAL, values));
+    TEST_ASSERT_FALSE(filter.isSendRequired(UINT32_MAX - 10U + MAX_INTERVAL + MIN_INTERVAL, values));
+}
+
+/**
+ * Test that the values are sent after a reset, independent of any change.
+ */
+static void testReset()
+{
+    ChangeFilter filter(VALUE_COUNT, DEADBAND, MIN_INTERVAL, MAX_INTERVAL);
+    uint16_t     values[VALUE_COUNT] = {100U, 200U, 300U};
+
+    TEST_ASSERT_TRUE(filter.isSendRequired(1000U, values));
+    TEST_ASSERT_FALSE(filter.isSendRequired(1001U, values));
+
+    filter.reset();
+    TEST_ASSERT_TRUE(filter.isSendRequired(1001U, values));
+}
@@ -0,0 +1,234 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @author  Andreas Merkle <web@blue-andi.de>
+ * @brief   This module contains the GapController tests.
+ */
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <GapController.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testDesiredGap();
+static void testSpeed();
+static void testLimits();
+static void testUnknownGap();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Sample time in ms. */
+static const uint32_t SAMPLE_TIME = 5U;
+
+/** Max. measurable gap in mm. */
+static const uint16_t MAX_GAP = 300U;
+
+/** Max. speed in mm/s. */
+static const int16_t MAX_SPEED = 400;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Program setup routine, which is called once at startup.
+ */
+void setup()
+{
+#ifndef TARGET_NATIVE
+    /* https://docs.platformio.org/en/latest/plus/unit-testing.html#demo */
+    delay(2000);
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Main entry point.
+ */
+void loop()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testDesiredGap);
+    RUN_TEST(testSpeed);
+    RUN_TEST(testLimits);
+    RUN_TEST(testUnknownGap);
+
+    UNITY_END();
+
+#ifndef TARGET_NATIVE
+    /* Don't exit on the robot to avoid a endless test loop.
+     * If the test runs on the pc, it must exit.
+     */
+    for (;;)
+    {
+    }
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Initialize the test setup.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test setup.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test the desired gap with the constant time gap policy.
+ */
+static void testDesiredGap()
+{
+    GapController ctrl(SAMPLE_TIME, MAX_GAP);
+
+    ctrl.setTarget(0, 100U, 500U);
+
+    TEST_ASSERT_EQUAL_INT16(100, ctrl.getDesiredGap(0));
+    TEST_ASSERT_EQUAL_INT16(150, ctrl.getDesiredGap(100));
+    TEST_ASSERT_EQUAL_INT16(250, ctrl.getDesiredGap(300));
+
+    /* Driving backwards doesn't reduce the gap. */
+    TEST_ASSERT_EQUAL_INT16(100, ctrl.getDesiredGap(-100));
+
+    /* The desired gap is limited to the measurable range. */
+    TEST_ASSERT_EQUAL_INT16(MAX_GAP, ctrl.getDesiredGap(1000));
+
+    ctrl.setTarget(0, 1000U, 0U);
+    TEST_ASSERT_EQUAL_INT16(MAX_GAP, ctrl.getDesiredGap(0));
+}
+
+/**
+ * Test that the gap error corrects the leader speed.
+ */
+static void testSpeed()
+{
+    GapController ctrl(SAMPLE_TIME, MAX_GAP);
+
+    ctrl.setMaxSpeed(MAX_SPEED);
+    ctrl.setTarget(200, 100U, 500U);
+
+    /* Desired gap reached: drive with leader speed. */
+    TEST_ASSERT_EQUAL_INT16(200, ctrl.process(200U, 200));
+
+    /* Gap too large: faster than the leader. */
+    ctrl.reset();
+    TEST_ASSERT_EQUAL_INT16(300, ctrl.process(250U, 200));
+
+    /* Gap too small: slower than the leader. */
+    ctrl.reset();
+    TEST_ASSERT_EQUAL_INT16(100, ctrl.process(150U, 200));
+}
+
+/**
+ * Test that the speed is limited.
+ */
+static void testLimits()
+{
+    GapController ctrl(SAMPLE_TIME, MAX_GAP);
+
+    ctrl.setMaxSpeed(MAX_SPEED);
+    ctrl.setTarget(MAX_SPEED, 100U, 0U);
+
+    /* Never faster than the max. speed. */
+    TEST_ASSERT_EQUAL_INT16(MAX_SPEED, ctrl.process(1000U, MAX_SPEED));
+
+    /* Never backwards, even if the vehicle ahead is too close. */
+    ctrl.reset();
+    ctrl.setTarget(0, 100U, 0U);
+    TEST_ASSERT_EQUAL_INT16(0, ctrl.process(0U, 0));
+
+    /* Gap beyond the range is limited and doesn't overflow. */
+    ctrl.reset();
+    TEST_ASSERT_EQUAL_INT16(GapController::MAX_CORRECTION, ctrl.process(UINT16_MAX - 1U, 0));
+}
+
+/**
+ * Test that without a measured gap only the leader speed is used.
+ */
+static void testUnknownGap()
+{
+    GapController ctrl(SAMPLE_TIME, MAX_GAP);
+
+    ctrl.setMaxSpeed(MAX_SPEED);
+    ctrl.setTarget(200, 100U, 500U);
+
+    /* No correction, even if the vehicle ahead was lost far away. */
+    TEST_ASSERT_EQUAL_INT16(200, ctrl.process(GapController::GAP_UNKNOWN, 200));
+
+    /* The correction starts again, after the vehicle ahead is measured again. */
+    TEST_ASSERT_EQUAL_INT16(100, ctrl.process(150U, 200));
+    TEST_ASSERT_EQUAL_INT16(200, ctrl.process(GapController::GAP_UNKNOWN, 200));
+
+    /* Still limited to the max. speed. */
+    ctrl.setTarget(MAX_SPEED + 100, 100U, 500U);
+    TEST_ASSERT_EQUAL_INT16(MAX_SPEED, ctrl.process(GapController::GAP_UNKNOWN, 200));
+}
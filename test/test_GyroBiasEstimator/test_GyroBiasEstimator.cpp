@@ -0,0 +1,271 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @author  Andreas Merkle <web@blue-andi.de>
+ * @brief   This module contains the GyroBiasEstimator tests.
+ */
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <GyroBiasEstimator.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testCalibration();
+static void testCalibrationRestart();
+static void testZeroVelocityUpdate();
+static void testCorrection();
+static void calibrate(GyroBiasEstimator& estimator, int16_t turnRate);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Program setup routine, which is called once at startup.
+ */
+void setup()
+{
+#ifndef TARGET_NATIVE
+    /* https://docs.platformio.org/en/latest/plus/unit-testing.html#demo */
+    delay(2000);
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Main entry point.
+ */
+void loop()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testCalibration);
+    RUN_TEST(testCalibrationRestart);
+    RUN_TEST(testZeroVelocityUpdate);
+    RUN_TEST(testCorrection);
+
+    UNITY_END();
+
+#ifndef TARGET_NATIVE
+    /* Don't exit on the robot to avoid a endless test loop.
+     * If the test runs on the pc, it must exit.
+     */
+    for (;;)
+    {
+    }
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Initialize the test setup.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test setup.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test the calibration with standstill samples.
+ */
+static void testCalibration()
+{
+    GyroBiasEstimator estimator;
+    uint16_t          idx = 0U;
+
+    TEST_ASSERT_FALSE(estimator.isCalibrated());
+    TEST_ASSERT_EQUAL_INT16(0, estimator.getBias());
+
+    /* Alternating samples with a mean of -12.5 digits. */
+    for (idx = 0U; idx < GyroBiasEstimator::CALIBRATION_SAMPLES; ++idx)
+    {
+        TEST_ASSERT_FALSE(estimator.isCalibrated());
+        estimator.process((0U == (idx % 2U)) ? -10 : -15, true);
+    }
+
+    TEST_ASSERT_TRUE(estimator.isCalibrated());
+    TEST_ASSERT_EQUAL_INT16(-13, estimator.getBias());
+
+    estimator.reset();
+    TEST_ASSERT_FALSE(estimator.isCalibrated());
+    TEST_ASSERT_EQUAL_INT16(0, estimator.getBias());
+}
+
+/**
+ * Test that a moving robot restarts the calibration.
+ */
+static void testCalibrationRestart()
+{
+    GyroBiasEstimator estimator;
+    uint16_t          idx = 0U;
+
+    for (idx = 1U; idx < GyroBiasEstimator::CALIBRATION_SAMPLES; ++idx)
+    {
+        estimator.process(1000, true);
+    }
+
+    estimator.process(1000, false);
+
+    for (idx = 1U; idx < GyroBiasEstimator::CALIBRATION_SAMPLES; ++idx)
+    {
+        estimator.process(20, true);
+    }
+
+    TEST_ASSERT_FALSE(estimator.isCalibrated());
+
+    estimator.process(20, true);
+    TEST_ASSERT_TRUE(estimator.isCalibrated());
+    TEST_ASSERT_EQUAL_INT16(20, estimator.getBias());
+}
+
+/**
+ * Test the zero-velocity update after the calibration.
+ */
+static void testZeroVelocityUpdate()
+{
+    GyroBiasEstimator estimator;
+    uint16_t          idx = 0U;
+
+    calibrate(estimator, 20);
+
+    /* The bias shall not follow samples during driving. */
+    for (idx = 0U; idx < 1000U; ++idx)
+    {
+        estimator.process(50, false);
+    }
+
+    TEST_ASSERT_EQUAL_INT16(20, estimator.getBias());
+
+    /* The bias shall not follow samples, which deviate too much. */
+    for (idx = 0U; idx < 1000U; ++idx)
+    {
+        estimator.process(20 + GyroBiasEstimator::MAX_DEVIATION + 1, true);
+    }
+
+    TEST_ASSERT_EQUAL_INT16(20, estimator.getBias());
+
+    /* The bias shall follow a drift during standstill. */
+    for (idx = 0U; idx < 2000U; ++idx)
+    {
+        estimator.process(30, true);
+    }
+
+    TEST_ASSERT_INT_WITHIN(1, 30, estimator.getBias());
+
+    for (idx = 0U; idx < 2000U; ++idx)
+    {
+        estimator.process(-5, true);
+    }
+
+    TEST_ASSERT_INT_WITHIN(1, -5, estimator.getBias());
+}
+
+/**
+ * Test the bias correction of the turn rate.
+ */
+static void testCorrection()
+{
+    GyroBiasEstimator estimator;
+
+    /* Without calibration, the turn rate is not changed. */
+    TEST_ASSERT_EQUAL_INT16(100, estimator.correct(100));
+
+    calibrate(estimator, -20);
+    TEST_ASSERT_EQUAL_INT16(120, estimator.correct(100));
+    TEST_ASSERT_EQUAL_INT16(0, estimator.correct(-20));
+    TEST_ASSERT_EQUAL_INT16(INT16_MAX, estimator.correct(INT16_MAX - 10));
+
+    calibrate(estimator, 20);
+    TEST_ASSERT_EQUAL_INT16(INT16_MIN, estimator.correct(INT16_MIN + 10));
+}
+
+/**
+ * Calibrate the estimator with a constant turn rate.
+ *
+ * @param[in] estimator Gyro bias estimator
+ * @param[in] turnRate  Turn rate in [digits]
+ */
+static void calibrate(GyroBiasEstimator& estimator, int16_t turnRate)
+{
+    uint16_t idx = 0U;
+
+    estimator.reset();
+
+    for (idx = 0U; idx < GyroBiasEstimator::CALIBRATION_SAMPLES; ++idx)
+    {
+        estimator.process(turnRate, true);
+    }
+
+    TEST_ASSERT_TRUE(estimator.isCalibrated());
+    TEST_ASSERT_EQUAL_INT16(turnRate, estimator.getBias());
+}
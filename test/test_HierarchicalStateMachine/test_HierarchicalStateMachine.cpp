@@ -0,0 +1,537 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @author  Andreas Merkle <web@blue-andi.de>
+ * @brief   This module contains the HierarchicalStateMachine tests.
+ */
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <HierarchicalStateMachine.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/** Test events. */
+typedef enum
+{
+    EVENT_START = 0, /**< Start driving. */
+    EVENT_CURVE,     /**< Curve detected. */
+    EVENT_STRAIGHT,  /**< Straight line detected. */
+    EVENT_STOP,      /**< Stop driving. */
+    EVENT_UNKNOWN    /**< Not handled by any state. */
+
+} TestEvent;
+
+/**
+ * Test state, which records its calls into a shared log and performs
+ * a transition on a configured event.
+ */
+class TestState : public HierarchicalState
+{
+public:
+    /**
+     * Constructs the test state.
+     *
+     * @param[in] name      Single character name, used in the call log.
+     * @param[in] parent    Parent state
+     */
+    TestState(char name, HierarchicalState* parent = nullptr) :
+        HierarchicalState(parent),
+        m_name(name),
+        m_eventId(EVENT_UNKNOWN),
+        m_target(nullptr),
+        m_initialState(nullptr),
+        m_handledEvents(0U)
+    {
+    }
+
+    /**
+     * Configure the event, which triggers a transition.
+     *
+     * @param[in] eventId   Event id
+     * @param[in] target    Target state
+     */
+    void setTransition(uint8_t eventId, HierarchicalState* target)
+    {
+        m_eventId = eventId;
+        m_target  = target;
+    }
+
+    /**
+     * Configure the initial sub-state, which is entered after this state.
+     *
+     * @param[in] initialState  Initial sub-state
+     */
+    void setInitialState(HierarchicalState* initialState)
+    {
+        m_initialState = initialState;
+    }
+
+    /**
+     * Get number of handled events.
+     *
+     * @return Number of handled events.
+     */
+    uint8_t getHandledEvents() const
+    {
+        return m_handledEvents;
+    }
+
+    void entry(HierarchicalStateMachine& hsm) final
+    {
+        addToLog('+');
+
+        if (nullptr != m_initialState)
+        {
+            (void)hsm.transitionTo(m_initialState);
+        }
+    }
+
+    void exit(HierarchicalStateMachine& hsm) final
+    {
+        (void)hsm;
+        addToLog('-');
+    }
+
+    bool onEvent(HierarchicalStateMachine& hsm, const HsmEvent& event) final
+    {
+        bool isHandled = false;
+
+        if ((m_eventId == event.id) && (nullptr != m_target))
+        {
+            (void)hsm.transitionTo(m_target);
+            ++m_handledEvents;
+            isHandled = true;
+        }
+
+        return isHandled;
+    }
+
+    /** Call log of all test states. */
+    static char gLog[64];
+
+    /** Current write index of the call log. */
+    static uint8_t gLogIdx;
+
+    /**
+     * Clear the call log.
+     */
+    static void clearLog()
+    {
+        gLogIdx = 0U;
+        gLog[0] = '\0';
+    }
+
+private:
+    char               m_name;          /**< State name */
+    uint8_t            m_eventId;       /**< Event, which triggers the transition. */
+    HierarchicalState* m_target;        /**< Target state of the transition. */
+    HierarchicalState* m_initialState;  /**< Initial sub-state */
+    uint8_t            m_handledEvents; /**< Number of handled events */
+
+    /**
+     * Add a call to the log.
+     *
+     * @param[in] action    Action character, '+' for entry and '-' for exit.
+     */
+    void addToLog(char action)
+    {
+        if ((sizeof(gLog) - 2U) > gLogIdx)
+        {
+            gLog[gLogIdx++] = action;
+            gLog[gLogIdx++] = m_name;
+            gLog[gLogIdx]   = '\0';
+        }
+    }
+};
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testEntryExitOrder();
+static void testEventBubbling();
+static void testEventQueueOverflow();
+static void testTrace();
+static void testTimeAccounting();
+static void testMaxDepth();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+char    TestState::gLog[64];
+uint8_t TestState::gLogIdx = 0U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Program setup routine, which is called once at startup.
+ */
+void setup()
+{
+#ifndef TARGET_NATIVE
+    /* https://docs.platformio.org/en/latest/plus/unit-testing.html#demo */
+    delay(2000);
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Main entry point.
+ */
+void loop()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testEntryExitOrder);
+    RUN_TEST(testEventBubbling);
+    RUN_TEST(testEventQueueOverflow);
+    RUN_TEST(testTrace);
+    RUN_TEST(testTimeAccounting);
+    RUN_TEST(testMaxDepth);
+
+    UNITY_END();
+
+#ifndef TARGET_NATIVE
+    /* Don't exit on the robot to avoid a endless test loop.
+     * If the test runs on the pc, it must exit.
+     */
+    for (;;)
+    {
+    }
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Initialize the test setup.
+ */
+extern void setUp(void)
+{
+    TestState::clearLog();
+}
+
+/**
+ * Clean up test setup.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test the order of the entry and exit calls across the state hierarchy.
+ *
+ * Hierarchy:
+ * - I (Idle)
+ * - D (Driving)
+ *   - S (Straight)
+ *   - C (Curve)
+ */
+static void testEntryExitOrder()
+{
+    HierarchicalStateMachine hsm;
+    TestState                idle('I');
+    TestState                driving('D');
+    TestState                straight('S', &driving);
+    TestState                curve('C', &driving);
+
+    idle.setTransition(EVENT_START, &driving);
+    driving.setInitialState(&straight);
+    driving.setTransition(EVENT_STOP, &idle);
+    straight.setTransition(EVENT_CURVE, &curve);
+    curve.setTransition(EVENT_STRAIGHT, &straight);
+
+    /* Not started yet. */
+    TEST_ASSERT_NULL(hsm.getState());
+
+    TEST_ASSERT_TRUE(hsm.start(&idle));
+    TEST_ASSERT_EQUAL_PTR(&idle, hsm.getState());
+    TEST_ASSERT_EQUAL_STRING("+I", TestState::gLog);
+
+    /* Without pending events, nothing happens. */
+    hsm.process();
+    TEST_ASSERT_EQUAL_STRING("+I", TestState::gLog);
+
+    /* Entering the parent state leads to its initial sub-state. */
+    TestState::clearLog();
+    TEST_ASSERT_TRUE(hsm.postEvent(EVENT_START));
+    hsm.process();
+    TEST_ASSERT_EQUAL_PTR(&straight, hsm.getState());
+    TEST_ASSERT_EQUAL_STRING("-I+D+S", TestState::gLog);
+    TEST_ASSERT_TRUE(hsm.isInState(&driving));
+    TEST_ASSERT_TRUE(hsm.isInState(&straight));
+    TEST_ASSERT_FALSE(hsm.isInState(&idle));
+
+    /* A transition between sibling states doesn't leave the parent state. */
+    TestState::clearLog();
+    TEST_ASSERT_TRUE(hsm.postEvent(EVENT_CURVE));
+    hsm.process();
+    TEST_ASSERT_EQUAL_PTR(&curve, hsm.getState());
+    TEST_ASSERT_EQUAL_STRING("-S+C", TestState::gLog);
+    TEST_ASSERT_TRUE(driving.isActive());
+    TEST_ASSERT_FALSE(straight.isActive());
+    TEST_ASSERT_EQUAL_UINT16(1U, driving.getEntryCount());
+    TEST_ASSERT_EQUAL_UINT16(1U, curve.getEntryCount());
+
+    /* Leaving the parent state leaves the sub-state first. */
+    TestState::clearLog();
+    TEST_ASSERT_TRUE(hsm.postEvent(EVENT_STOP));
+    hsm.process();
+    TEST_ASSERT_EQUAL_PTR(&idle, hsm.getState());
+    TEST_ASSERT_EQUAL_STRING("-C-D+I", TestState::gLog);
+    TEST_ASSERT_FALSE(driving.isActive());
+    TEST_ASSERT_FALSE(curve.isActive());
+    TEST_ASSERT_EQUAL_UINT16(2U, idle.getEntryCount());
+}
+
+/**
+ * Test that unhandled events are passed to the parent state.
+ */
+static void testEventBubbling()
+{
+    HierarchicalStateMachine hsm;
+    TestState                idle('I');
+    TestState                driving('D');
+    TestState                straight('S', &driving);
+
+    driving.setTransition(EVENT_STOP, &idle);
+
+    TEST_ASSERT_TRUE(hsm.start(&straight));
+    TEST_ASSERT_EQUAL_STRING("+D+S", TestState::gLog);
+
+    /* Neither the sub-state nor its parent handle it. */
+    TEST_ASSERT_TRUE(hsm.postEvent(EVENT_UNKNOWN));
+    hsm.process();
+    TEST_ASSERT_EQUAL_PTR(&straight, hsm.getState());
+    TEST_ASSERT_EQUAL_UINT8(0U, driving.getHandledEvents());
+
+    /* The sub-state doesn't handle it, but its parent. */
+    TEST_ASSERT_TRUE(hsm.postEvent(EVENT_STOP));
+    hsm.process();
+    TEST_ASSERT_EQUAL_PTR(&idle, hsm.getState());
+    TEST_ASSERT_EQUAL_UINT8(1U, driving.getHandledEvents());
+    TEST_ASSERT_EQUAL_UINT8(0U, straight.getHandledEvents());
+}
+
+/**
+ * Test the event queue limits.
+ */
+static void testEventQueueOverflow()
+{
+    HierarchicalStateMachine hsm;
+    TestState                idle('I');
+    TestState                driving('D');
+    uint8_t                  idx = 0U;
+
+    idle.setTransition(EVENT_START, &driving);
+    driving.setTransition(EVENT_STOP, &idle);
+    TEST_ASSERT_TRUE(hsm.start(&idle));
+
+    /* Fill the queue completely. */
+    for (idx = 0U; idx < HierarchicalStateMachine::EVENT_QUEUE_SIZE; ++idx)
+    {
+        uint8_t eventId = (0U == (idx % 2U)) ? EVENT_START : EVENT_STOP;
+
+        TEST_ASSERT_TRUE(hsm.postEvent(eventId));
+    }
+
+    /* A full queue drops further events. */
+    TEST_ASSERT_FALSE(hsm.postEvent(EVENT_START));
+    TEST_ASSERT_FALSE(hsm.postEvent(EVENT_START));
+    TEST_ASSERT_EQUAL_UINT16(2U, hsm.getDroppedEvents());
+
+    /* All queued events are dispatched in order. */
+    hsm.process();
+    TEST_ASSERT_EQUAL_PTR(&idle, hsm.getState());
+    TEST_ASSERT_EQUAL_UINT8(HierarchicalStateMachine::EVENT_QUEUE_SIZE / 2U, idle.getHandledEvents());
+    TEST_ASSERT_EQUAL_UINT8(HierarchicalStateMachine::EVENT_QUEUE_SIZE / 2U, driving.getHandledEvents());
+
+    /* The queue is usable again. */
+    TEST_ASSERT_TRUE(hsm.postEvent(EVENT_START));
+    hsm.process();
+    TEST_ASSERT_EQUAL_PTR(&driving, hsm.getState());
+}
+
+/**
+ * Test the transition trace.
+ */
+static void testTrace()
+{
+    HierarchicalStateMachine             hsm;
+    HierarchicalStateMachine::TraceEntry entry;
+    TestState                            idle('I');
+    TestState                            driving('D');
+    TestState                            straight('S', &driving);
+    uint8_t                              idx = 0U;
+
+    idle.setTransition(EVENT_START, &driving);
+    driving.setInitialState(&straight);
+    driving.setTransition(EVENT_STOP, &idle);
+
+    TEST_ASSERT_TRUE(hsm.start(&idle));
+    TEST_ASSERT_EQUAL_UINT8(1U, hsm.getTraceLength());
+    TEST_ASSERT_TRUE(hsm.getTraceEntry(0U, entry));
+    TEST_ASSERT_NULL(entry.source);
+    TEST_ASSERT_EQUAL_PTR(&idle, entry.target);
+    TEST_ASSERT_EQUAL_UINT8(HierarchicalStateMachine::EVENT_ID_NONE, entry.eventId);
+
+    /* The transition to the initial sub-state is traced as well. */
+    TEST_ASSERT_TRUE(hsm.postEvent(EVENT_START));
+    hsm.process();
+    TEST_ASSERT_EQUAL_UINT8(3U, hsm.getTraceLength());
+    TEST_ASSERT_TRUE(hsm.getTraceEntry(1U, entry));
+    TEST_ASSERT_EQUAL_PTR(&idle, entry.source);
+    TEST_ASSERT_EQUAL_PTR(&driving, entry.target);
+    TEST_ASSERT_EQUAL_UINT8(EVENT_START, entry.eventId);
+    TEST_ASSERT_TRUE(hsm.getTraceEntry(2U, entry));
+    TEST_ASSERT_EQUAL_PTR(&driving, entry.source);
+    TEST_ASSERT_EQUAL_PTR(&straight, entry.target);
+    TEST_ASSERT_FALSE(hsm.getTraceEntry(3U, entry));
+
+    /* On overflow the oldest entries are overwritten. */
+    for (idx = 0U; idx < HierarchicalStateMachine::TRACE_SIZE; ++idx)
+    {
+        TEST_ASSERT_TRUE(hsm.postEvent(hsm.isInState(&idle) ? EVENT_START : EVENT_STOP));
+        hsm.process();
+    }
+
+    TEST_ASSERT_EQUAL_UINT8(HierarchicalStateMachine::TRACE_SIZE, hsm.getTraceLength());
+    TEST_ASSERT_TRUE(hsm.getTraceEntry(HierarchicalStateMachine::TRACE_SIZE - 1U, entry));
+    TEST_ASSERT_EQUAL_PTR(hsm.getState(), entry.target);
+
+    hsm.clearTrace();
+    TEST_ASSERT_EQUAL_UINT8(0U, hsm.getTraceLength());
+    TEST_ASSERT_FALSE(hsm.getTraceEntry(0U, entry));
+}
+
+/**
+ * Test the per state time accounting.
+ */
+static void testTimeAccounting()
+{
+    const uint32_t           WAIT_TIME = 100;
+    HierarchicalStateMachine hsm;
+    TestState                idle('I');
+    TestState                driving('D');
+
+    idle.setTransition(EVENT_START, &driving);
+    driving.setTransition(EVENT_STOP, &idle);
+
+    TEST_ASSERT_TRUE(hsm.start(&idle));
+    delay(WAIT_TIME);
+
+    TEST_ASSERT_TRUE(hsm.postEvent(EVENT_START));
+    hsm.process();
+    TEST_ASSERT_GREATER_OR_EQUAL(WAIT_TIME, idle.getActiveTime(millis()));
+    TEST_ASSERT_LESS_THAN(2U * WAIT_TIME, idle.getActiveTime(millis()));
+
+    /* The idle time doesn't increase anymore, because its not active. */
+    delay(WAIT_TIME);
+    TEST_ASSERT_LESS_THAN(2U * WAIT_TIME, idle.getActiveTime(millis()));
+    TEST_ASSERT_GREATER_OR_EQUAL(WAIT_TIME, driving.getActiveTime(millis()));
+
+    idle.resetStatistics(millis());
+    TEST_ASSERT_EQUAL_UINT16(0U, idle.getEntryCount());
+    TEST_ASSERT_EQUAL_UINT32(0U, idle.getActiveTime(millis()));
+}
+
+/**
+ * Test that states, which are nested deeper than the max. depth, are rejected.
+ */
+static void testMaxDepth()
+{
+    HierarchicalStateMachine hsm;
+    TestState                idle('I');
+    TestState                level1('1');
+    TestState                level2('2', &level1);
+    TestState                level3('3', &level2);
+    TestState                level4('4', &level3);
+    TestState                level5('5', &level4);
+
+    TEST_ASSERT_EQUAL_UINT8(4U, HierarchicalStateMachine::MAX_DEPTH);
+
+    /* The initial state is too deep. */
+    TEST_ASSERT_FALSE(hsm.start(&level5));
+    TEST_ASSERT_NULL(hsm.getState());
+    TEST_ASSERT_EQUAL_STRING("", TestState::gLog);
+
+    TEST_ASSERT_FALSE(hsm.start(nullptr));
+    TEST_ASSERT_NULL(hsm.getState());
+
+    /* The deepest allowed state is entered completely. */
+    TEST_ASSERT_TRUE(hsm.start(&level4));
+    TEST_ASSERT_EQUAL_PTR(&level4, hsm.getState());
+    TEST_ASSERT_EQUAL_STRING("+1+2+3+4", TestState::gLog);
+
+    /* A transition to a too deep state is rejected, the current state is kept. */
+    TestState::clearLog();
+    level4.setTransition(EVENT_START, &level5);
+    TEST_ASSERT_TRUE(hsm.postEvent(EVENT_START));
+    hsm.process();
+    TEST_ASSERT_EQUAL_PTR(&level4, hsm.getState());
+    TEST_ASSERT_EQUAL_STRING("", TestState::gLog);
+    TEST_ASSERT_EQUAL_UINT8(1U, level4.getHandledEvents());
+
+    TEST_ASSERT_FALSE(hsm.transitionTo(&level5));
+    TEST_ASSERT_TRUE(hsm.transitionTo(&idle));
+}
@@ -0,0 +1,254 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @author  Andreas Merkle <web@blue-andi.de>
+ * @brief   This module contains the LoadGovernor tests.
+ */
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <unity.h>
+#include <LoadGovernor.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void feed(LoadGovernor& governor, int32_t slack, uint16_t cycles);
+static void testNominal();
+static void testDegrade();
+static void testRestore();
+static void testHysteresis();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Period of the observed control task in us. */
+static const int32_t CONTROL_PERIOD = 5000;
+
+/** Min. slack of the observed control task in us. */
+static const int32_t MIN_SLACK = 3000;
+
+/** Slack of a critical control cycle in us. */
+static const int32_t CRITICAL_SLACK = MIN_SLACK - 1;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Program setup routine, which is called once at startup.
+ */
+void setup()
+{
+#ifndef TARGET_NATIVE
+    /* https://docs.platformio.org/en/latest/plus/unit-testing.html#demo */
+    delay(2000);
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Main entry point.
+ */
+void loop()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testNominal);
+    RUN_TEST(testDegrade);
+    RUN_TEST(testRestore);
+    RUN_TEST(testHysteresis);
+
+    UNITY_END();
+
+#ifndef TARGET_NATIVE
+    /* Don't exit on the robot to avoid a endless test loop.
+     * If the test runs on the pc, it must exit.
+     */
+    for (;;)
+    {
+    }
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Initialize the test setup.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test setup.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Feed the governor several times with the same slack.
+ *
+ * @param[in] governor  Load governor
+ * @param[in] slack     Slack in us
+ * @param[in] cycles    Number of control cycles
+ */
+static void feed(LoadGovernor& governor, int32_t slack, uint16_t cycles)
+{
+    uint16_t cycle = 0U;
+
+    for (cycle = 0U; cycle < cycles; ++cycle)
+    {
+        (void)governor.update(slack);
+    }
+}
+
+/**
+ * Test that enough slack keeps the nominal level.
+ */
+static void testNominal()
+{
+    LoadGovernor governor(MIN_SLACK);
+
+    TEST_ASSERT_EQUAL_UINT8(LoadGovernor::LEVEL_NOMINAL, governor.getLevel());
+
+    /* Min. slack is not critical. */
+    feed(governor, MIN_SLACK, 10U * LoadGovernor::WINDOW);
+    TEST_ASSERT_EQUAL_UINT8(LoadGovernor::LEVEL_NOMINAL, governor.getLevel());
+
+    /* Single critical cycles below the limit don't degrade. */
+    feed(governor, CRITICAL_SLACK, LoadGovernor::DEGRADE_LIMIT - 1U);
+    feed(governor, CONTROL_PERIOD, LoadGovernor::WINDOW);
+    TEST_ASSERT_EQUAL_UINT8(LoadGovernor::LEVEL_NOMINAL, governor.getLevel());
+}
+
+/**
+ * Test that the level is raised immediately and saturates.
+ */
+static void testDegrade()
+{
+    LoadGovernor governor(MIN_SLACK);
+    uint8_t      cycle = 0U;
+
+    for (cycle = 1U; cycle < LoadGovernor::DEGRADE_LIMIT; ++cycle)
+    {
+        TEST_ASSERT_FALSE(governor.update(CRITICAL_SLACK));
+    }
+
+    TEST_ASSERT_TRUE(governor.update(CRITICAL_SLACK));
+    TEST_ASSERT_EQUAL_UINT8(LoadGovernor::LEVEL_REDUCED, governor.getLevel());
+
+    /* A missed deadline counts as critical too. */
+    feed(governor, -3 * CONTROL_PERIOD, LoadGovernor::DEGRADE_LIMIT);
+    TEST_ASSERT_EQUAL_UINT8(LoadGovernor::LEVEL_MINIMAL, governor.getLevel());
+
+    feed(governor, CRITICAL_SLACK, 10U * LoadGovernor::DEGRADE_LIMIT);
+    TEST_ASSERT_EQUAL_UINT8(LoadGovernor::LEVEL_MINIMAL, governor.getLevel());
+
+    governor.reset();
+    TEST_ASSERT_EQUAL_UINT8(LoadGovernor::LEVEL_NOMINAL, governor.getLevel());
+}
+
+/**
+ * Test that the level is lowered step by step, after the slack returned.
+ */
+static void testRestore()
+{
+    const uint16_t RESTORE_CYCLES = LoadGovernor::RESTORE_WINDOWS * LoadGovernor::WINDOW;
+    LoadGovernor   governor(MIN_SLACK);
+
+    feed(governor, CRITICAL_SLACK, 2U * LoadGovernor::DEGRADE_LIMIT);
+    TEST_ASSERT_EQUAL_UINT8(LoadGovernor::LEVEL_MINIMAL, governor.getLevel());
+
+    feed(governor, CONTROL_PERIOD, RESTORE_CYCLES - 1U);
+    TEST_ASSERT_EQUAL_UINT8(LoadGovernor::LEVEL_MINIMAL, governor.getLevel());
+    TEST_ASSERT_TRUE(governor.update(CONTROL_PERIOD));
+    TEST_ASSERT_EQUAL_UINT8(LoadGovernor::LEVEL_REDUCED, governor.getLevel());
+
+    feed(governor, CONTROL_PERIOD, RESTORE_CYCLES);
+    TEST_ASSERT_EQUAL_UINT8(LoadGovernor::LEVEL_NOMINAL, governor.getLevel());
+
+    feed(governor, CONTROL_PERIOD, RESTORE_CYCLES);
+    TEST_ASSERT_EQUAL_UINT8(LoadGovernor::LEVEL_NOMINAL, governor.getLevel());
+}
+
+/**
+ * Test that a single critical cycle delays the restore.
+ */
+static void testHysteresis()
+{
+    const uint16_t RESTORE_CYCLES = LoadGovernor::RESTORE_WINDOWS * LoadGovernor::WINDOW;
+    LoadGovernor   governor(MIN_SLACK);
+
+    feed(governor, CRITICAL_SLACK, LoadGovernor::DEGRADE_LIMIT);
+    TEST_ASSERT_EQUAL_UINT8(LoadGovernor::LEVEL_REDUCED, governor.getLevel());
+
+    /* The critical cycle in the last window breaks the row of relaxed windows. */
+    feed(governor, CONTROL_PERIOD, RESTORE_CYCLES - LoadGovernor::WINDOW);
+    feed(governor, CRITICAL_SLACK, 1U);
+    feed(governor, CONTROL_PERIOD, LoadGovernor::WINDOW - 1U);
+    TEST_ASSERT_EQUAL_UINT8(LoadGovernor::LEVEL_REDUCED, governor.getLevel());
+
+    feed(governor, CONTROL_PERIOD, RESTORE_CYCLES);
+    TEST_ASSERT_EQUAL_UINT8(LoadGovernor::LEVEL_NOMINAL, governor.getLevel());
+}
@@ -0,0 +1,200 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @author  Andreas Merkle <web@blue-andi.de>
+ * @brief   This module contains the Logging tests.
+ */
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <unity.h>
+#include <Logging.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testDefaultLevel();
+static void testTagLevel();
+static void testLevelTableFull();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Program setup routine, which is called once at startup.
+ */
+void setup()
+{
+#ifndef TARGET_NATIVE
+    /* https://docs.platformio.org/en/latest/plus/unit-testing.html#demo */
+    delay(2000);
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Main entry point.
+ */
+void loop()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testDefaultLevel);
+    RUN_TEST(testTagLevel);
+    RUN_TEST(testLevelTableFull);
+
+    UNITY_END();
+
+#ifndef TARGET_NATIVE
+    /* Don't exit on the robot to avoid a endless test loop.
+     * If the test runs on the pc, it must exit.
+     */
+    for (;;)
+    {
+    }
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Initialize the test setup.
+ */
+extern void setUp(void)
+{
+    Logging::enable();
+    Logging::setLevel(nullptr, Logging::LOG_LEVEL_DEBUG);
+}
+
+/**
+ * Clean up test setup.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Test the default runtime log level and the global enable/disable.
+ */
+static void testDefaultLevel()
+{
+    const uint16_t TAG_ID = BinaryLog::getTagId("Default");
+
+    /* By default all log messages, which are enabled at compile time, are logged. */
+    TEST_ASSERT_EQUAL(Logging::LOG_LEVEL_DEBUG, Logging::getLevel("*"));
+    TEST_ASSERT_TRUE(Logging::isEnabled(TAG_ID, Logging::LOG_LEVEL_DEBUG));
+
+    TEST_ASSERT_TRUE(Logging::setLevel("*", Logging::LOG_LEVEL_WARNING));
+    TEST_ASSERT_EQUAL(Logging::LOG_LEVEL_WARNING, Logging::getLevel(nullptr));
+    TEST_ASSERT_EQUAL(Logging::LOG_LEVEL_WARNING, Logging::getLevel("Default"));
+    TEST_ASSERT_FALSE(Logging::isEnabled(TAG_ID, Logging::LOG_LEVEL_INFO));
+    TEST_ASSERT_TRUE(Logging::isEnabled(TAG_ID, Logging::LOG_LEVEL_WARNING));
+    TEST_ASSERT_TRUE(Logging::isEnabled(TAG_ID, Logging::LOG_LEVEL_FATAL));
+
+    /* Disabled logging overrules the log level. */
+    Logging::disable();
+    TEST_ASSERT_FALSE(Logging::isEnabled(TAG_ID, Logging::LOG_LEVEL_FATAL));
+}
+
+/**
+ * Test the individual runtime log level of a log tag.
+ */
+static void testTagLevel()
+{
+    const uint16_t TAG_ID   = BinaryLog::getTagId("RState");
+    const uint16_t OTHER_ID = BinaryLog::getTagId("EState");
+
+    TEST_ASSERT_TRUE(Logging::setLevel("*", Logging::LOG_LEVEL_ERROR));
+    TEST_ASSERT_TRUE(Logging::setLevel("RState", Logging::LOG_LEVEL_DEBUG));
+
+    TEST_ASSERT_EQUAL(Logging::LOG_LEVEL_DEBUG, Logging::getLevel("RState"));
+    TEST_ASSERT_TRUE(Logging::isEnabled(TAG_ID, Logging::LOG_LEVEL_DEBUG));
+    TEST_ASSERT_FALSE(Logging::isEnabled(OTHER_ID, Logging::LOG_LEVEL_WARNING));
+    TEST_ASSERT_TRUE(Logging::isEnabled(OTHER_ID, Logging::LOG_LEVEL_ERROR));
+
+    /* Change the already existing entry. */
+    TEST_ASSERT_TRUE(Logging::setLevel("RState", Logging::LOG_LEVEL_FATAL));
+    TEST_ASSERT_FALSE(Logging::isEnabled(TAG_ID, Logging::LOG_LEVEL_ERROR));
+}
+
+/**
+ * Test that no more log tags than the level table size are accepted.
+ */
+static void testLevelTableFull()
+{
+    char    tag[]    = "Tag0";
+    uint8_t idx      = 0U;
+    uint8_t accepted = 0U;
+
+    /* The previous test uses one entry already. */
+    for (idx = 0U; idx < CONFIG_LOG_LEVEL_TABLE_SIZE; ++idx)
+    {
+        tag[3U] = static_cast<char>('0' + idx);
+
+        if (true == Logging::setLevel(tag, Logging::LOG_LEVEL_INFO))
+        {
+            ++accepted;
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT8(CONFIG_LOG_LEVEL_TABLE_SIZE - 1U, accepted);
+
+    /* The tag without entry uses the default log level. */
+    TEST_ASSERT_EQUAL(Logging::LOG_LEVEL_DEBUG, Logging::getLevel(tag));
+    TEST_ASSERT_EQUAL(Logging::LOG_LEVEL_FATAL, Logging::getLevel("RState"));
+}
@@ -0,0 +1,206 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @author  Andreas Merkle <web@blue-andi.de>
+ * @brief   This module contains the MicroTimer tests.
+ */
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <MicroTimer.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testTimebase();
+static void testMicroTimer();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Program setup routine, which is called once at startup.
+ */
+void setup()
+{
+#ifndef TARGET_NATIVE
+    /* https://docs.platformio.org/en/latest/plus/unit-testing.html#demo */
+    delay(2000);
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Main entry point.
+ */
+void loop()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testTimebase);
+    RUN_TEST(testMicroTimer);
+
+    UNITY_END();
+
+#ifndef TARGET_NATIVE
+    /* Don't exit on the robot to avoid a endless test loop.
+     * If the test runs on the pc, it must exit.
+     */
+    for (;;)
+    {
+    }
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Initialize the test setup.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test setup.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+
+/**
+ * Test the timebase conversions and the wrap around handling.
+ */
+static void testTimebase()
+{
+    const Timebase::Timestamp BEFORE_WRAP = UINT32_MAX - 499U;
+    const Timebase::Timestamp AFTER_WRAP  = 500U;
+    Timebase::Timestamp       timestamp   = Timebase::now();
+
+    /* Conversion between ms and us. The conversion to ms is rounded. */
+    TEST_ASSERT_EQUAL_UINT32(5000U, Timebase::fromMs(5U));
+    TEST_ASSERT_EQUAL_UINT32(5U, Timebase::toMs(5499U));
+    TEST_ASSERT_EQUAL_UINT32(6U, Timebase::toMs(5500U));
+    TEST_ASSERT_EQUAL_UINT32(0U, Timebase::toMs(499U));
+
+    /* The duration is correct across the wrap around. */
+    TEST_ASSERT_EQUAL_UINT32(1000U, Timebase::getDuration(BEFORE_WRAP, AFTER_WRAP));
+
+    /* The timebase is monotonic. */
+    TEST_ASSERT_TRUE(Timebase::isReached(timestamp));
+    TEST_ASSERT_FALSE(Timebase::isReached(timestamp + Timebase::fromMs(100U)));
+
+    delay(100U);
+    TEST_ASSERT_GREATER_OR_EQUAL(Timebase::fromMs(100U), Timebase::getElapsed(timestamp));
+    TEST_ASSERT_TRUE(Timebase::isReached(timestamp + Timebase::fromMs(100U)));
+}
+
+/**
+ * Test the MicroTimer class.
+ */
+static void testMicroTimer()
+{
+    const uint32_t WAIT_TIME = 100;
+    const uint32_t DELTA_MIN = 1;
+    MicroTimer     testTimer;
+
+    /* If timer is not running, it shall not signal timeout. */
+    TEST_ASSERT_FALSE(testTimer.isTimeout());
+
+    /* Start timer with 0. It must signal timeout immediately. */
+    testTimer.start(0U);
+    TEST_ASSERT_TRUE(testTimer.isTimeout());
+    TEST_ASSERT_EQUAL_UINT32(0U, testTimer.getDuration());
+
+    /* Stop timer. It must not signal timeout. */
+    testTimer.stop();
+    TEST_ASSERT_FALSE(testTimer.isTimeout());
+
+    /* Start timer with 100 ms. It must not signal timeout. */
+    testTimer.start(Timebase::fromMs(WAIT_TIME));
+    TEST_ASSERT_FALSE(testTimer.isTimeout());
+    TEST_ASSERT_EQUAL_UINT32(Timebase::fromMs(WAIT_TIME), testTimer.getDuration());
+
+    /* Test timeout signalling. */
+    delay(WAIT_TIME + DELTA_MIN);
+    TEST_ASSERT_TRUE(testTimer.isTimeout());
+
+    /* Restart timer. It must not signal timeout. */
+    testTimer.restart();
+    TEST_ASSERT_FALSE(testTimer.isTimeout());
+
+    /* Test timeout signalling after a restart. */
+    delay(WAIT_TIME + DELTA_MIN);
+    TEST_ASSERT_TRUE(testTimer.isTimeout());
+
+    /* Verify timer duration till now. */
+    TEST_ASSERT_GREATER_OR_EQUAL(Timebase::fromMs(WAIT_TIME + DELTA_MIN), testTimer.getCurrentDuration());
+
+    /* The periodic restart keeps the time grid, therefore the timeout is still signalled. */
+    delay(WAIT_TIME);
+    testTimer.restartPeriodic();
+    TEST_ASSERT_TRUE(testTimer.isTimeout());
+
+    /* Afterwards it catches up and waits again. */
+    testTimer.restartPeriodic();
+    TEST_ASSERT_FALSE(testTimer.isTimeout());
+}
@@ -0,0 +1,284 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @author  Andreas Merkle <web@blue-andi.de>
+ * @brief   This module contains the MotionScript tests.
+ */
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <MotionScript.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testUpload();
+static void testTimedSteps();
+static void testDistanceAndAngleSteps();
+static void testStop();
+static MotionScript::Step createStep(MotionScript::StepType type, int32_t target, int16_t linearSpeed,
+                                     int16_t angularSpeed);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Program setup routine, which is called once at startup.
+ */
+void setup()
+{
+#ifndef TARGET_NATIVE
+    /* https://docs.platformio.org/en/latest/plus/unit-testing.html#demo */
+    delay(2000);
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Main entry point.
+ */
+void loop()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testUpload);
+    RUN_TEST(testTimedSteps);
+    RUN_TEST(testDistanceAndAngleSteps);
+    RUN_TEST(testStop);
+
+    UNITY_END();
+
+#ifndef TARGET_NATIVE
+    /* Don't exit on the robot to avoid a endless test loop.
+     * If the test runs on the pc, it must exit.
+     */
+    for (;;)
+    {
+    }
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Initialize the test setup.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test setup.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test uploading the steps.
+ */
+static void testUpload()
+{
+    MotionScript script;
+    uint8_t      idx = 0U;
+
+    /* An empty script can't be started. */
+    TEST_ASSERT_FALSE(script.start(0U, 0U, 0));
+
+    for (idx = 0U; idx < MotionScript::MAX_STEPS; ++idx)
+    {
+        TEST_ASSERT_TRUE(script.addStep(createStep(MotionScript::STEP_TYPE_TIMED, 10, 100, 0)));
+    }
+
+    TEST_ASSERT_FALSE(script.addStep(createStep(MotionScript::STEP_TYPE_TIMED, 10, 100, 0)));
+    TEST_ASSERT_EQUAL_UINT8(MotionScript::MAX_STEPS, script.getLength());
+
+    script.clear();
+    TEST_ASSERT_EQUAL_UINT8(0U, script.getLength());
+
+    /* Invalid step type. */
+    TEST_ASSERT_FALSE(script.addStep(createStep(MotionScript::STEP_TYPE_COUNT, 10, 100, 0)));
+
+    /* No upload while running. */
+    TEST_ASSERT_TRUE(script.addStep(createStep(MotionScript::STEP_TYPE_TIMED, 10, 100, 0)));
+    TEST_ASSERT_TRUE(script.start(0U, 0U, 0));
+    TEST_ASSERT_FALSE(script.addStep(createStep(MotionScript::STEP_TYPE_TIMED, 10, 100, 0)));
+}
+
+/**
+ * Test the timing of timed steps.
+ */
+static void testTimedSteps()
+{
+    MotionScript script;
+    int16_t      linearSpeed  = 0;
+    int16_t      angularSpeed = 0;
+
+    TEST_ASSERT_TRUE(script.addStep(createStep(MotionScript::STEP_TYPE_TIMED, 100, 200, 0)));
+    TEST_ASSERT_TRUE(script.addStep(createStep(MotionScript::STEP_TYPE_TIMED, 0, 500, 500)));
+    TEST_ASSERT_TRUE(script.addStep(createStep(MotionScript::STEP_TYPE_TIMED, 50, 0, 1000)));
+    TEST_ASSERT_TRUE(script.start(1000U, 0U, 0));
+
+    script.process(1000U, 0U, 0, linearSpeed, angularSpeed);
+    TEST_ASSERT_TRUE(script.isRunning());
+    TEST_ASSERT_EQUAL_UINT8(0U, script.getCurrentStep());
+    TEST_ASSERT_EQUAL_INT16(200, linearSpeed);
+    TEST_ASSERT_EQUAL_INT16(0, angularSpeed);
+
+    /* The step without duration is skipped and the last step is started at the planned time. */
+    script.process(1103U, 0U, 0, linearSpeed, angularSpeed);
+    TEST_ASSERT_EQUAL_UINT8(2U, script.getCurrentStep());
+    TEST_ASSERT_EQUAL_INT16(0, linearSpeed);
+    TEST_ASSERT_EQUAL_INT16(1000, angularSpeed);
+
+    script.process(1149U, 0U, 0, linearSpeed, angularSpeed);
+    TEST_ASSERT_TRUE(script.isRunning());
+
+    script.process(1150U, 0U, 0, linearSpeed, angularSpeed);
+    TEST_ASSERT_FALSE(script.isRunning());
+    TEST_ASSERT_TRUE(script.isFinished());
+    TEST_ASSERT_EQUAL_INT16(0, linearSpeed);
+    TEST_ASSERT_EQUAL_INT16(0, angularSpeed);
+}
+
+/**
+ * Test steps, which end after a distance or an angle.
+ */
+static void testDistanceAndAngleSteps()
+{
+    MotionScript script;
+    int16_t      linearSpeed  = 0;
+    int16_t      angularSpeed = 0;
+
+    TEST_ASSERT_TRUE(script.addStep(createStep(MotionScript::STEP_TYPE_DISTANCE, -100, -200, 0)));
+    TEST_ASSERT_TRUE(script.addStep(createStep(MotionScript::STEP_TYPE_ANGLE, 1000, 0, 500)));
+    TEST_ASSERT_TRUE(script.start(0U, 500U, 5500));
+
+    script.process(100U, 599U, 5500, linearSpeed, angularSpeed);
+    TEST_ASSERT_EQUAL_UINT8(0U, script.getCurrentStep());
+    TEST_ASSERT_EQUAL_INT16(-200, linearSpeed);
+
+    script.process(110U, 600U, 5500, linearSpeed, angularSpeed);
+    TEST_ASSERT_EQUAL_UINT8(1U, script.getCurrentStep());
+    TEST_ASSERT_EQUAL_INT16(500, angularSpeed);
+
+    /* The orientation wraps around from +2 PI to -2 PI. */
+    script.process(500U, 600U, 6200, linearSpeed, angularSpeed);
+    TEST_ASSERT_TRUE(script.isRunning());
+
+    script.process(600U, 600U, -83, linearSpeed, angularSpeed);
+    TEST_ASSERT_TRUE(script.isRunning());
+
+    script.process(700U, 600U, 300, linearSpeed, angularSpeed);
+    TEST_ASSERT_TRUE(script.isFinished());
+}
+
+/**
+ * Test stopping a running script.
+ */
+static void testStop()
+{
+    MotionScript script;
+    int16_t      linearSpeed  = 0;
+    int16_t      angularSpeed = 0;
+
+    TEST_ASSERT_TRUE(script.addStep(createStep(MotionScript::STEP_TYPE_TIMED, 1000, 200, 100)));
+    TEST_ASSERT_TRUE(script.start(0U, 0U, 0));
+
+    script.stop();
+    script.process(10U, 0U, 0, linearSpeed, angularSpeed);
+    TEST_ASSERT_FALSE(script.isRunning());
+    TEST_ASSERT_FALSE(script.isFinished());
+    TEST_ASSERT_EQUAL_INT16(0, linearSpeed);
+    TEST_ASSERT_EQUAL_INT16(0, angularSpeed);
+
+    /* It can be restarted. */
+    TEST_ASSERT_TRUE(script.start(20U, 0U, 0));
+    script.process(20U, 0U, 0, linearSpeed, angularSpeed);
+    TEST_ASSERT_EQUAL_INT16(200, linearSpeed);
+}
+
+/**
+ * Create a motion script step.
+ *
+ * @param[in] type          Step type
+ * @param[in] target        Duration, distance or angle
+ * @param[in] linearSpeed   Linear speed in [mm/s]
+ * @param[in] angularSpeed  Angular speed in [mrad/s]
+ *
+ * @return Step
+ */
+static MotionScript::Step createStep(MotionScript::StepType type, int32_t target, int16_t linearSpeed,
+                                     int16_t angularSpeed)
+{
+    MotionScript::Step step;
+
+    step.type         = type;
+    step.target       = target;
+    step.linearSpeed  = linearSpeed;
+    step.angularSpeed = angularSpeed;
+
+    return step;
+}
@@ -57,6 +57,7 @@
 
 static void  testOrientation();
 static void  testPosition();
+static void  testSubstituteOrientation();
 static float calcStepsToAngle(float angle, bool turnInPlace);
 static float calcStepsToDistance(float distance);
 static void  testTurnInPlace(float angle);
@@ -103,6 +104,7 @@ void loop()
 
     RUN_TEST(testOrientation);
     RUN_TEST(testPosition);
+    RUN_TEST(testSubstituteOrientation);
 
     UNITY_END();
 
@@ -174,6 +176,57 @@ static void testPosition()
                       static_cast<float>(RobotConstants::ENCODER_STEPS_PER_M));
 }
 
+static void testSubstituteOrientation()
+{
+    IEncodersTest& encodersTest = Board::getInstance().getEncodersTest();
+    Odometry&      odometry     = Odometry::getInstance();
+    int16_t        stepsSmall   = static_cast<int16_t>(calcStepsToAngle(0.1f, true));
+    int16_t        stepsLarge   = static_cast<int16_t>(calcStepsToAngle(0.5f, true));
+    int32_t        orientation  = 0;
+    int32_t        epsilon      = static_cast<int32_t>(M_PI * 1000.0f / 180.0f); /* 1° epsilon in mrad */
+
+    encodersTest.setCountsLeft(0);
+    encodersTest.setCountsRight(0);
+    odometry.clearPosition();
+    odometry.setOrientation(0);
+
+    /* The orientation change is below the steps threshold, therefore the steps are pending. */
+    encodersTest.setCountsLeft(-stepsSmall);
+    encodersTest.setCountsRight(stepsSmall);
+    odometry.process();
+    TEST_ASSERT_INT32_WITHIN(epsilon, 100, odometry.getOrientation());
+
+    odometry.substituteOrientationChange(50000);
+    TEST_ASSERT_INT32_WITHIN(1, 50, odometry.getOrientation());
+
+    /* Without encoder change, the substituted orientation shall be kept. */
+    odometry.process();
+    TEST_ASSERT_INT32_WITHIN(1, 50, odometry.getOrientation());
+
+    /* Turn angles below 1 mrad shall not get lost. */
+    odometry.substituteOrientationChange(600);
+    odometry.process();
+    odometry.substituteOrientationChange(600);
+    TEST_ASSERT_INT32_WITHIN(1, 51, odometry.getOrientation());
+
+    /* The orientation change is above the steps threshold, therefore the steps are considered. */
+    orientation = odometry.getOrientation();
+    encodersTest.setCountsLeft(-stepsSmall - stepsLarge);
+    encodersTest.setCountsRight(stepsSmall + stepsLarge);
+    odometry.process();
+    TEST_ASSERT_INT32_WITHIN(epsilon, orientation + 500, odometry.getOrientation());
+
+    odometry.substituteOrientationChange(-100000);
+    TEST_ASSERT_INT32_WITHIN(epsilon, orientation - 100, odometry.getOrientation());
+
+    /* The encoders shall be used again, after the substitution. */
+    orientation = odometry.getOrientation();
+    encodersTest.setCountsLeft(-2 * stepsSmall - stepsLarge);
+    encodersTest.setCountsRight(2 * stepsSmall + stepsLarge);
+    odometry.process();
+    TEST_ASSERT_INT32_WITHIN(epsilon, orientation + 100, odometry.getOrientation());
+}
+
 static float calcStepsToAngle(float angle, bool turnInPlace)
 {
     float wheelBase     = static_cast<float>(RobotConstants::WHEEL_BASE);                    /* [mm] */
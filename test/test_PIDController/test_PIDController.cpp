@@ -53,6 +53,7 @@
  *****************************************************************************/
 
 static void testPIDController();
+static void testSampleTime();
 
 /******************************************************************************
  * Local Variables
@@ -93,6 +94,7 @@ void loop()
     UNITY_BEGIN();
 
     RUN_TEST(testPIDController);
+    RUN_TEST(testSampleTime);
 
     UNITY_END();
 
@@ -181,3 +183,45 @@ static void testPIDController()
         TEST_ASSERT_EQUAL_INT16(output, pidCtrl.calculate(0, index));
     }
 }
+
+/**
+ * Test the sample time in ms and us.
+ */
+static void testSampleTime()
+{
+    PIDController<int16_t> pidCtrl;
+
+    /* Kp = 0, Ki = 0, Kd = 10 */
+    pidCtrl.setPFactor(0, 1);
+    pidCtrl.setIFactor(0, 1);
+    pidCtrl.setDFactor(10, 1);
+
+    /* The derivative is divided by the sample time in ms. */
+    pidCtrl.setSampleTime(5U);
+    TEST_ASSERT_EQUAL_UINT32(5U, pidCtrl.getSampleTime());
+    TEST_ASSERT_EQUAL_UINT32(5000U, pidCtrl.getSampleTimeUs());
+    pidCtrl.clear();
+    TEST_ASSERT_EQUAL_INT16(-20, pidCtrl.calculate(0, 10));
+
+    /* A fraction of a ms is considered. */
+    pidCtrl.setSampleTimeUs(2500U);
+    TEST_ASSERT_EQUAL_UINT32(3U, pidCtrl.getSampleTime());
+    pidCtrl.clear();
+    TEST_ASSERT_EQUAL_INT16(-40, pidCtrl.calculate(0, 10));
+
+    pidCtrl.setSampleTimeUs(4900U);
+    pidCtrl.clear();
+    TEST_ASSERT_EQUAL_INT16(-20, pidCtrl.calculate(0, 10));
+    pidCtrl.clear();
+    TEST_ASSERT_EQUAL_INT16(-204, pidCtrl.calculate(0, 100));
+
+    /* The factor with considered sample time doesn't overflow the calculation. */
+    pidCtrl.clear();
+    TEST_ASSERT_EQUAL_INT16(-20408, pidCtrl.calculate(0, 10000));
+
+    /* If the factor with considered sample time would overflow, the precision of the sample time is reduced. */
+    pidCtrl.setDFactor(1000, 1);
+    pidCtrl.setSampleTimeUs(4999U);
+    pidCtrl.clear();
+    TEST_ASSERT_INT_WITHIN(5, -200, pidCtrl.calculate(0, 1));
+}
@@ -0,0 +1,325 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @author  Andreas Merkle <web@blue-andi.de>
+ * @brief   This module contains the ParameterRegistry tests.
+ */
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <ParameterRegistry.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testAdd();
+static void testGetSet();
+static void testBounds();
+static void testChangeCallback();
+static void testPersistence();
+static void onChange(uint8_t index, void* userData);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Index of the last changed parameter, set by the change callback. */
+static uint8_t gChangedIndex = 0U;
+
+/** Number of change callback calls. */
+static uint8_t gChangeCount = 0U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Program setup routine, which is called once at startup.
+ */
+void setup()
+{
+#ifndef TARGET_NATIVE
+    /* https://docs.platformio.org/en/latest/plus/unit-testing.html#demo */
+    delay(2000);
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Main entry point.
+ */
+void loop()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testAdd);
+    RUN_TEST(testGetSet);
+    RUN_TEST(testBounds);
+    RUN_TEST(testChangeCallback);
+    RUN_TEST(testPersistence);
+
+    UNITY_END();
+
+#ifndef TARGET_NATIVE
+    /* Don't exit on the robot to avoid a endless test loop.
+     * If the test runs on the pc, it must exit.
+     */
+    for (;;)
+    {
+    }
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Initialize the test setup.
+ */
+extern void setUp(void)
+{
+    gChangedIndex = 0U;
+    gChangeCount  = 0U;
+}
+
+/**
+ * Clean up test setup.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test adding and finding parameters.
+ */
+static void testAdd()
+{
+    ParameterRegistry registry;
+    int16_t           value = 0;
+    int16_t           values[ParameterRegistry::MAX_PARAMETERS];
+    char              names[ParameterRegistry::MAX_PARAMETERS][3U];
+    uint8_t           index = 0U;
+    uint8_t           idx   = 0U;
+
+    TEST_ASSERT_TRUE(registry.add("kp", value, 0, 10));
+    TEST_ASSERT_EQUAL_UINT8(1U, registry.getCount());
+    TEST_ASSERT_EQUAL_STRING("kp", registry.getName(0U));
+    TEST_ASSERT_NULL(registry.getName(1U));
+
+    /* Names shall be unique, not empty and not too long. */
+    TEST_ASSERT_FALSE(registry.add("kp", value, 0, 10));
+    TEST_ASSERT_FALSE(registry.add("", value, 0, 10));
+    TEST_ASSERT_FALSE(registry.add("abcdefghijkl", value, 0, 10));
+    TEST_ASSERT_TRUE(registry.add("abcdefghijk", value, 0, 10));
+
+    /* Invalid bounds. */
+    TEST_ASSERT_FALSE(registry.add("kd", value, 10, 0));
+
+    TEST_ASSERT_TRUE(registry.find("abcdefghijk", index));
+    TEST_ASSERT_EQUAL_UINT8(1U, index);
+    TEST_ASSERT_FALSE(registry.find("ki", index));
+
+    /* Fill the registry up. */
+    for (idx = registry.getCount(); idx < ParameterRegistry::MAX_PARAMETERS; ++idx)
+    {
+        names[idx][0U] = 'p';
+        names[idx][1U] = static_cast<char>('a' + idx);
+        names[idx][2U] = '\0';
+        values[idx]    = 0;
+        TEST_ASSERT_TRUE(registry.add(names[idx], values[idx], 0, 10));
+    }
+
+    TEST_ASSERT_FALSE(registry.add("kd", value, 0, 10));
+    TEST_ASSERT_EQUAL_UINT8(ParameterRegistry::MAX_PARAMETERS, registry.getCount());
+}
+
+/**
+ * Test reading and writing parameters of all types.
+ */
+static void testGetSet()
+{
+    ParameterRegistry       registry;
+    int16_t                 valueInt16  = -5;
+    uint16_t                valueUInt16 = 60000U;
+    int32_t                 valueInt32  = -100000;
+    int32_t                 value       = 0;
+    int32_t                 min         = 0;
+    int32_t                 max         = 0;
+    ParameterRegistry::Type type        = ParameterRegistry::TYPE_INT32;
+
+    TEST_ASSERT_TRUE(registry.add("int16", valueInt16, -10, 10));
+    TEST_ASSERT_TRUE(registry.add("uint16", valueUInt16, 0U, UINT16_MAX));
+    TEST_ASSERT_TRUE(registry.add("int32", valueInt32, -200000, 200000));
+
+    TEST_ASSERT_TRUE(registry.getValue(0U, value));
+    TEST_ASSERT_EQUAL_INT32(-5, value);
+    TEST_ASSERT_TRUE(registry.getValue(1U, value));
+    TEST_ASSERT_EQUAL_INT32(60000, value);
+    TEST_ASSERT_TRUE(registry.getValue(2U, value));
+    TEST_ASSERT_EQUAL_INT32(-100000, value);
+    TEST_ASSERT_FALSE(registry.getValue(3U, value));
+
+    TEST_ASSERT_TRUE(registry.getType(1U, type));
+    TEST_ASSERT_EQUAL_UINT8(ParameterRegistry::TYPE_UINT16, type);
+    TEST_ASSERT_TRUE(registry.getLimits(1U, min, max));
+    TEST_ASSERT_EQUAL_INT32(0, min);
+    TEST_ASSERT_EQUAL_INT32(UINT16_MAX, max);
+
+    TEST_ASSERT_EQUAL_UINT8(ParameterRegistry::RESULT_OK, registry.setValue(0U, 7));
+    TEST_ASSERT_EQUAL_INT16(7, valueInt16);
+    TEST_ASSERT_EQUAL_UINT8(ParameterRegistry::RESULT_OK, registry.setValue(1U, 65535));
+    TEST_ASSERT_EQUAL_UINT16(65535U, valueUInt16);
+    TEST_ASSERT_EQUAL_UINT8(ParameterRegistry::RESULT_OK, registry.setValue(2U, 150000));
+    TEST_ASSERT_EQUAL_INT32(150000, valueInt32);
+    TEST_ASSERT_EQUAL_UINT8(ParameterRegistry::RESULT_UNKNOWN, registry.setValue(3U, 0));
+}
+
+/**
+ * Test that values outside the bounds are rejected.
+ */
+static void testBounds()
+{
+    ParameterRegistry registry;
+    int16_t           value = 5;
+
+    TEST_ASSERT_TRUE(registry.add("kp", value, 1, 10));
+
+    TEST_ASSERT_EQUAL_UINT8(ParameterRegistry::RESULT_OUT_OF_RANGE, registry.setValue(0U, 0));
+    TEST_ASSERT_EQUAL_UINT8(ParameterRegistry::RESULT_OUT_OF_RANGE, registry.setValue(0U, 11));
+
+    /* A value, which would be truncated to a valid value. */
+    TEST_ASSERT_EQUAL_UINT8(ParameterRegistry::RESULT_OUT_OF_RANGE, registry.setValue(0U, 65537));
+    TEST_ASSERT_EQUAL_INT16(5, value);
+
+    TEST_ASSERT_EQUAL_UINT8(ParameterRegistry::RESULT_OK, registry.setValue(0U, 1));
+    TEST_ASSERT_EQUAL_INT16(1, value);
+    TEST_ASSERT_EQUAL_UINT8(ParameterRegistry::RESULT_OK, registry.setValue(0U, 10));
+    TEST_ASSERT_EQUAL_INT16(10, value);
+}
+
+/**
+ * Test that the change callback is only called on a change.
+ */
+static void testChangeCallback()
+{
+    ParameterRegistry registry;
+    int16_t           valueA = 0;
+    int16_t           valueB = 0;
+
+    TEST_ASSERT_TRUE(registry.add("a", valueA, 0, 10));
+    TEST_ASSERT_TRUE(registry.add("b", valueB, 0, 10));
+    registry.setChangeCallback(onChange, &registry);
+
+    TEST_ASSERT_EQUAL_UINT8(ParameterRegistry::RESULT_OK, registry.setValue(1U, 3));
+    TEST_ASSERT_EQUAL_UINT8(1U, gChangeCount);
+    TEST_ASSERT_EQUAL_UINT8(1U, gChangedIndex);
+
+    /* Same value, no change. */
+    TEST_ASSERT_EQUAL_UINT8(ParameterRegistry::RESULT_OK, registry.setValue(1U, 3));
+    TEST_ASSERT_EQUAL_UINT8(1U, gChangeCount);
+
+    /* Rejected value, no change. */
+    TEST_ASSERT_EQUAL_UINT8(ParameterRegistry::RESULT_OUT_OF_RANGE, registry.setValue(0U, 11));
+    TEST_ASSERT_EQUAL_UINT8(1U, gChangeCount);
+
+    registry.setChangeCallback(nullptr, nullptr);
+    TEST_ASSERT_EQUAL_UINT8(ParameterRegistry::RESULT_OK, registry.setValue(0U, 4));
+    TEST_ASSERT_EQUAL_UINT8(1U, gChangeCount);
+}
+
+/**
+ * Test the persistent and volatile parameters.
+ */
+static void testPersistence()
+{
+    ParameterRegistry registry;
+    int16_t           valueA = 0;
+    int32_t           valueB = 0;
+
+    /* No parameter is volatile. */
+    TEST_ASSERT_TRUE(registry.areAllPersistent());
+
+    TEST_ASSERT_TRUE(registry.add("a", valueA, 0, 10, true));
+    TEST_ASSERT_TRUE(registry.areAllPersistent());
+
+    /* Parameters are volatile by default. */
+    TEST_ASSERT_TRUE(registry.add("b", valueB, 0, 10));
+    TEST_ASSERT_FALSE(registry.areAllPersistent());
+
+    TEST_ASSERT_TRUE(registry.isPersistent(0U));
+    TEST_ASSERT_FALSE(registry.isPersistent(1U));
+    TEST_ASSERT_FALSE(registry.isPersistent(2U));
+}
+
+/**
+ * Change callback, used by the tests.
+ *
+ * @param[in] index     Index of the changed parameter.
+ * @param[in] userData  Parameter registry
+ */
+static void onChange(uint8_t index, void* userData)
+{
+    int32_t value = 0;
+
+    /* The new value shall be available in the callback. */
+    TEST_ASSERT_TRUE(reinterpret_cast<ParameterRegistry*>(userData)->getValue(index, value));
+    TEST_ASSERT_EQUAL_INT32(3, value);
+
+    gChangedIndex = index;
+    ++gChangeCount;
+}
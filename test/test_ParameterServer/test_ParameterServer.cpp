@@ -0,0 +1,306 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @author  Andreas Merkle <web@blue-andi.de>
+ * @brief   This module contains the ParameterServer tests.
+ */
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <string.h>
+#include <ParameterServer.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testList();
+static void testGetSet();
+static void testStore();
+static void testInvalidRequest();
+static void createRequest(ParameterServer::Request& request, ParameterServer::RequestId requestId, const char* name,
+                          int32_t value);
+static void onStore(void* userData);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Number of store callback calls. */
+static uint8_t gStoreCount = 0U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Program setup routine, which is called once at startup.
+ */
+void setup()
+{
+#ifndef TARGET_NATIVE
+    /* https://docs.platformio.org/en/latest/plus/unit-testing.html#demo */
+    delay(2000);
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Main entry point.
+ */
+void loop()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testList);
+    RUN_TEST(testGetSet);
+    RUN_TEST(testStore);
+    RUN_TEST(testInvalidRequest);
+
+    UNITY_END();
+
+#ifndef TARGET_NATIVE
+    /* Don't exit on the robot to avoid a endless test loop.
+     * If the test runs on the pc, it must exit.
+     */
+    for (;;)
+    {
+    }
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Initialize the test setup.
+ */
+extern void setUp(void)
+{
+    gStoreCount = 0U;
+}
+
+/**
+ * Clean up test setup.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test listing all parameters by their index.
+ */
+static void testList()
+{
+    ParameterRegistry         registry;
+    ParameterServer           server(registry);
+    ParameterServer::Request  request;
+    ParameterServer::Response response;
+    int16_t                   kp = 3;
+    uint16_t                  ki = 400U;
+
+    TEST_ASSERT_TRUE(registry.add("kp", kp, -10, 10, true));
+    TEST_ASSERT_TRUE(registry.add("ki", ki, 0U, 1000U));
+
+    createRequest(request, ParameterServer::REQUEST_LIST, "", 0);
+    request.index = 1U;
+    server.handleRequest(request, response);
+    TEST_ASSERT_EQUAL_UINT8(ParameterServer::REQUEST_LIST, response.requestId);
+    TEST_ASSERT_EQUAL_UINT8(ParameterServer::RESPONSE_OK, response.responseId);
+    TEST_ASSERT_EQUAL_UINT8(1U, response.index);
+    TEST_ASSERT_EQUAL_UINT8(2U, response.count);
+    TEST_ASSERT_EQUAL_UINT8(ParameterRegistry::TYPE_UINT16, response.type);
+    TEST_ASSERT_EQUAL_UINT8(0U, response.flags);
+    TEST_ASSERT_EQUAL_STRING("ki", response.name);
+    TEST_ASSERT_EQUAL_INT32(400, response.value);
+    TEST_ASSERT_EQUAL_INT32(0, response.min);
+    TEST_ASSERT_EQUAL_INT32(1000, response.max);
+
+    /* Behind the last parameter */
+    request.index = 2U;
+    server.handleRequest(request, response);
+    TEST_ASSERT_EQUAL_UINT8(ParameterServer::RESPONSE_UNKNOWN, response.responseId);
+    TEST_ASSERT_EQUAL_UINT8(2U, response.index);
+    TEST_ASSERT_EQUAL_UINT8(2U, response.count);
+
+    /* Persistent parameter */
+    request.index = 0U;
+    server.handleRequest(request, response);
+    TEST_ASSERT_EQUAL_UINT8(ParameterServer::RESPONSE_OK, response.responseId);
+    TEST_ASSERT_EQUAL_STRING("kp", response.name);
+    TEST_ASSERT_EQUAL_UINT8(ParameterServer::FLAG_PERSISTENT, response.flags);
+}
+
+/**
+ * Test reading and writing a parameter by its name.
+ */
+static void testGetSet()
+{
+    ParameterRegistry         registry;
+    ParameterServer           server(registry);
+    ParameterServer::Request  request;
+    ParameterServer::Response response;
+    int32_t                   maxDist = 1000;
+
+    TEST_ASSERT_TRUE(registry.add("maxDist", maxDist, 0, 5000));
+
+    createRequest(request, ParameterServer::REQUEST_GET, "maxDist", 0);
+    server.handleRequest(request, response);
+    TEST_ASSERT_EQUAL_UINT8(ParameterServer::RESPONSE_OK, response.responseId);
+    TEST_ASSERT_EQUAL_UINT8(0U, response.index);
+    TEST_ASSERT_EQUAL_INT32(1000, response.value);
+
+    createRequest(request, ParameterServer::REQUEST_SET, "maxDist", 2000);
+    server.handleRequest(request, response);
+    TEST_ASSERT_EQUAL_UINT8(ParameterServer::RESPONSE_OK, response.responseId);
+    TEST_ASSERT_EQUAL_INT32(2000, response.value);
+    TEST_ASSERT_EQUAL_INT32(2000, maxDist);
+
+    /* A rejected value is answered with the current value. */
+    createRequest(request, ParameterServer::REQUEST_SET, "maxDist", 6000);
+    server.handleRequest(request, response);
+    TEST_ASSERT_EQUAL_UINT8(ParameterServer::RESPONSE_OUT_OF_RANGE, response.responseId);
+    TEST_ASSERT_EQUAL_INT32(2000, response.value);
+    TEST_ASSERT_EQUAL_INT32(2000, maxDist);
+
+    createRequest(request, ParameterServer::REQUEST_GET, "minDist", 0);
+    server.handleRequest(request, response);
+    TEST_ASSERT_EQUAL_UINT8(ParameterServer::RESPONSE_UNKNOWN, response.responseId);
+
+    /* A not terminated name is cut at the max. name length. */
+    createRequest(request, ParameterServer::REQUEST_GET, "", 0);
+    memset(request.name, 'a', sizeof(request.name));
+    server.handleRequest(request, response);
+    TEST_ASSERT_EQUAL_UINT8(ParameterServer::RESPONSE_UNKNOWN, response.responseId);
+}
+
+/**
+ * Test that the store request is forwarded to the store callback and that
+ * volatile parameters are reported.
+ */
+static void testStore()
+{
+    ParameterRegistry         registry;
+    ParameterServer           server(registry);
+    ParameterServer::Request  request;
+    ParameterServer::Response response;
+    int16_t                   maxSpeed = 100;
+    int16_t                   kp       = 3;
+
+    TEST_ASSERT_TRUE(registry.add("maxSpeed", maxSpeed, 1, 1000, true));
+
+    createRequest(request, ParameterServer::REQUEST_STORE, "", 0);
+
+    /* Without callback */
+    server.handleRequest(request, response);
+    TEST_ASSERT_EQUAL_UINT8(0U, gStoreCount);
+
+    server.setStoreCallback(onStore, &gStoreCount);
+    server.handleRequest(request, response);
+    TEST_ASSERT_EQUAL_UINT8(ParameterServer::RESPONSE_OK, response.responseId);
+    TEST_ASSERT_EQUAL_UINT8(1U, gStoreCount);
+
+    /* A volatile parameter can not be stored. */
+    TEST_ASSERT_TRUE(registry.add("kp", kp, 0, 10));
+    server.handleRequest(request, response);
+    TEST_ASSERT_EQUAL_UINT8(ParameterServer::RESPONSE_NOT_PERSISTED, response.responseId);
+    TEST_ASSERT_EQUAL_UINT8(2U, gStoreCount);
+}
+
+/**
+ * Test that an unknown request is rejected.
+ */
+static void testInvalidRequest()
+{
+    ParameterRegistry         registry;
+    ParameterServer           server(registry);
+    ParameterServer::Request  request;
+    ParameterServer::Response response;
+
+    createRequest(request, static_cast<ParameterServer::RequestId>(ParameterServer::REQUEST_STORE + 1U), "", 0);
+    server.handleRequest(request, response);
+    TEST_ASSERT_EQUAL_UINT8(ParameterServer::RESPONSE_ERROR, response.responseId);
+}
+
+/**
+ * Create a request.
+ *
+ * @param[out] request      Request
+ * @param[in]  requestId    Request ID
+ * @param[in]  name         Parameter name
+ * @param[in]  value        Parameter value
+ */
+static void createRequest(ParameterServer::Request& request, ParameterServer::RequestId requestId, const char* name,
+                          int32_t value)
+{
+    memset(&request, 0, sizeof(request));
+    request.requestId = requestId;
+    request.value     = value;
+    strncpy(request.name, name, sizeof(request.name) - 1U);
+}
+
+/**
+ * Count the store callback calls.
+ *
+ * @param[in] userData  Store counter
+ */
+static void onStore(void* userData)
+{
+    uint8_t* storeCount = static_cast<uint8_t*>(userData);
+
+    ++(*storeCount);
+}
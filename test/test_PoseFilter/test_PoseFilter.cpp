@@ -0,0 +1,272 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @author  Andreas Merkle <web@blue-andi.de>
+ * @brief   This module contains the PoseFilter tests.
+ */
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <PoseFilter.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testReset();
+static void testGyroPrediction();
+static void testOdometryCorrection();
+static void testSlip();
+static void testPosition();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Program setup routine, which is called once at startup.
+ */
+void setup()
+{
+#ifndef TARGET_NATIVE
+    /* https://docs.platformio.org/en/latest/plus/unit-testing.html#demo */
+    delay(2000);
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Main entry point.
+ */
+void loop()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testReset);
+    RUN_TEST(testGyroPrediction);
+    RUN_TEST(testOdometryCorrection);
+    RUN_TEST(testSlip);
+    RUN_TEST(testPosition);
+
+    UNITY_END();
+
+#ifndef TARGET_NATIVE
+    /* Don't exit on the robot to avoid a endless test loop.
+     * If the test runs on the pc, it must exit.
+     */
+    for (;;)
+    {
+    }
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Initialize the test setup.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test setup.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test resetting the filter to the odometry pose.
+ */
+static void testReset()
+{
+    PoseFilter filter;
+    int32_t    posX = 0;
+    int32_t    posY = 0;
+
+    filter.reset(10, 20, 7000);
+    filter.getPosition(posX, posY);
+
+    TEST_ASSERT_EQUAL_INT32(10, posX);
+    TEST_ASSERT_EQUAL_INT32(20, posY);
+
+    /* The orientation is wrapped into the range (-PI; PI]. */
+    TEST_ASSERT_EQUAL_INT32(717, filter.getOrientation());
+    TEST_ASSERT_EQUAL_UINT32(0U, filter.getPositionVariance());
+    TEST_ASSERT_EQUAL_UINT32(0U, filter.getOrientationVariance());
+}
+
+/**
+ * Test that the gyro turn rate dominates short-term.
+ */
+static void testGyroPrediction()
+{
+    PoseFilter filter;
+    int32_t    tick = 0;
+
+    filter.reset(0, 0, 0);
+
+    /* Odometry and gyro agree. */
+    for (tick = 1; tick <= 10; ++tick)
+    {
+        filter.process(5U, 1000, 0, 0, tick * 5, false);
+    }
+
+    TEST_ASSERT_EQUAL_INT32(50, filter.getOrientation());
+    TEST_ASSERT_EQUAL_UINT32(10U * 5U * PoseFilter::DEFAULT_ORIENTATION_NOISE, filter.getOrientationVariance());
+
+    /* Only the gyro detects a slow turn. */
+    for (tick = 1; tick <= 10; ++tick)
+    {
+        filter.process(5U, 100, 0, 0, 50, false);
+    }
+
+    TEST_ASSERT_EQUAL_INT32(55, filter.getOrientation());
+}
+
+/**
+ * Test that the odometry orientation corrects the orientation long-term.
+ */
+static void testOdometryCorrection()
+{
+    PoseFilter filter;
+    int32_t    tick = 0;
+
+    filter.reset(0, 0, 0);
+    filter.setOdometryNoise(10000U);
+
+    /* Only the odometry detects a slow turn. */
+    for (tick = 1; tick <= 100; ++tick)
+    {
+        filter.process(5U, 0, 0, 0, tick, false);
+    }
+
+    for (tick = 1; tick <= 1000; ++tick)
+    {
+        filter.process(5U, 0, 0, 0, 100, false);
+    }
+
+    TEST_ASSERT_INT_WITHIN(1, 100, filter.getOrientation());
+
+    /* The variance is limited by the odometry update. */
+    TEST_ASSERT_LESS_THAN(10000U, filter.getOrientationVariance());
+}
+
+/**
+ * Test that the odometry orientation error by wheel slip is compensated.
+ */
+static void testSlip()
+{
+    PoseFilter filter;
+    int32_t    tick = 0;
+
+    filter.reset(0, 0, 0);
+    filter.setOdometryNoise(10000U);
+
+    /* The wheels turn, but the robot doesn't. */
+    filter.process(5U, 0, 0, 0, 50, true);
+    TEST_ASSERT_EQUAL_INT32(0, filter.getOrientation());
+
+    /* The odometry error is kept compensated. */
+    for (tick = 1; tick <= 1000; ++tick)
+    {
+        filter.process(5U, 0, 0, 0, 50, false);
+    }
+
+    TEST_ASSERT_EQUAL_INT32(0, filter.getOrientation());
+
+    /* Without detected slip, the same odometry turn corrects the orientation. */
+    for (tick = 1; tick <= 1000; ++tick)
+    {
+        filter.process(5U, 0, 0, 0, 100, false);
+    }
+
+    TEST_ASSERT_INT_WITHIN(1, 50, filter.getOrientation());
+}
+
+/**
+ * Test the position, which follows the fused orientation.
+ */
+static void testPosition()
+{
+    PoseFilter filter;
+    int32_t    posX = 0;
+    int32_t    posY = 0;
+
+    filter.reset(0, 0, 0);
+
+    filter.process(5U, 0, 100, 0, 0, false);
+    filter.getPosition(posX, posY);
+    TEST_ASSERT_EQUAL_INT32(100, posX);
+    TEST_ASSERT_EQUAL_INT32(0, posY);
+    TEST_ASSERT_EQUAL_UINT32(100U * PoseFilter::DEFAULT_POSITION_NOISE, filter.getPositionVariance());
+
+    /* The odometry turns by 90 degree due to wheel slip and drives along its orientation. */
+    filter.process(5U, 0, 100, 0, 1571, true);
+    filter.process(5U, 0, 100, 100, 1571, false);
+    filter.getPosition(posX, posY);
+    TEST_ASSERT_EQUAL_INT32(200, posX);
+    TEST_ASSERT_EQUAL_INT32(0, posY);
+    TEST_ASSERT_EQUAL_UINT32(200U * PoseFilter::DEFAULT_POSITION_NOISE, filter.getPositionVariance());
+}
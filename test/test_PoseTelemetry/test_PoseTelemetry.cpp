@@ -0,0 +1,282 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @author  Andreas Merkle <web@blue-andi.de>
+ * @brief   This module contains the PoseTelemetry tests.
+ */
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <PoseTelemetry.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/** Stream, which captures the last written message. */
+class TestStream : public Stream
+{
+public:
+    /** Max. message size in bytes. */
+    static const size_t MAX_SIZE = 128U;
+
+    /** Last written message. */
+    uint8_t m_message[MAX_SIZE];
+
+    /** Size of the last written message in bytes. */
+    size_t m_size;
+
+    /** Number of written messages. */
+    uint8_t m_count;
+
+    TestStream() : Stream(), m_message(), m_size(0U), m_count(0U)
+    {
+    }
+
+    int available()
+    {
+        return 0;
+    }
+
+    int read()
+    {
+        return -1;
+    }
+
+    int peek()
+    {
+        return -1;
+    }
+
+    size_t write(uint8_t value)
+    {
+        return write(&value, 1U);
+    }
+
+    size_t write(const uint8_t* buffer, size_t size)
+    {
+        if (MAX_SIZE < size)
+        {
+            size = MAX_SIZE;
+        }
+
+        memcpy(m_message, buffer, size);
+        m_size = size;
+        ++m_count;
+
+        return size;
+    }
+};
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testBatchFrame();
+static void testBatchTimeGap();
+
+static uint32_t getLittleEndian(const uint8_t* data, uint8_t size);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Program setup routine, which is called once at startup.
+ */
+void setup()
+{
+#ifndef TARGET_NATIVE
+    /* https://docs.platformio.org/en/latest/plus/unit-testing.html#demo */
+    delay(2000);
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Main entry point.
+ */
+void loop()
+{
+    UNITY_BEGIN();
+
+#if (0 == CONFIG_POSE_TELEMETRY_TEXT) && (1 < CONFIG_POSE_TELEMETRY_BATCH_SIZE)
+    RUN_TEST(testBatchFrame);
+    RUN_TEST(testBatchTimeGap);
+#endif /* (0 == CONFIG_POSE_TELEMETRY_TEXT) && (1 < CONFIG_POSE_TELEMETRY_BATCH_SIZE) */
+
+    UNITY_END();
+
+#ifndef TARGET_NATIVE
+    /* Don't exit on the robot to avoid a endless test loop.
+     * If the test runs on the pc, it must exit.
+     */
+    for (;;)
+    {
+    }
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Initialize the test setup.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test setup.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Test the batch frame format.
+ */
+static void testBatchFrame()
+{
+    TestStream    stream;
+    PoseTelemetry telemetry(stream);
+    uint8_t       idx;
+    uint8_t       offset;
+
+    for (idx = 0U; idx < CONFIG_POSE_TELEMETRY_BATCH_SIZE; ++idx)
+    {
+        TEST_ASSERT_EQUAL_UINT8(0U, stream.m_count);
+        telemetry.sendPose(1000U + (5U * idx), -10 * idx, 20 * idx, -3 * idx);
+    }
+
+    /* The full batch is sent as one message. */
+    TEST_ASSERT_EQUAL_UINT8(1U, stream.m_count);
+    TEST_ASSERT_EQUAL(PoseTelemetry::BATCH_HEADER_SIZE +
+                          (CONFIG_POSE_TELEMETRY_BATCH_SIZE * PoseTelemetry::BATCH_POSE_SIZE),
+                      stream.m_size);
+    TEST_ASSERT_EQUAL_UINT8(PoseTelemetry::FRAME_TYPE_POSE_BATCH, stream.m_message[0U]);
+    TEST_ASSERT_EQUAL_UINT8(CONFIG_POSE_TELEMETRY_BATCH_SIZE, stream.m_message[1U]);
+    TEST_ASSERT_EQUAL_UINT16(0U, getLittleEndian(&stream.m_message[2U], 2U));
+    TEST_ASSERT_EQUAL_UINT32(1000U, getLittleEndian(&stream.m_message[4U], 4U));
+
+    for (idx = 0U; idx < CONFIG_POSE_TELEMETRY_BATCH_SIZE; ++idx)
+    {
+        offset = PoseTelemetry::BATCH_HEADER_SIZE + (idx * PoseTelemetry::BATCH_POSE_SIZE);
+
+        TEST_ASSERT_EQUAL_UINT8((0U == idx) ? 0U : 5U, stream.m_message[offset]);
+        TEST_ASSERT_EQUAL_INT32(-10 * idx, static_cast<int32_t>(getLittleEndian(&stream.m_message[offset + 1U], 4U)));
+        TEST_ASSERT_EQUAL_INT32(20 * idx, static_cast<int32_t>(getLittleEndian(&stream.m_message[offset + 5U], 4U)));
+        TEST_ASSERT_EQUAL_INT16(-3 * idx, static_cast<int16_t>(getLittleEndian(&stream.m_message[offset + 9U], 2U)));
+    }
+
+    /* The next batch continues the sequence number. */
+    TEST_ASSERT_EQUAL_UINT16(CONFIG_POSE_TELEMETRY_BATCH_SIZE, telemetry.getSequenceNumber());
+    telemetry.sendPose(2000U, 0, 0, 0);
+    telemetry.flush();
+    TEST_ASSERT_EQUAL_UINT8(2U, stream.m_count);
+    TEST_ASSERT_EQUAL_UINT8(1U, stream.m_message[1U]);
+    TEST_ASSERT_EQUAL_UINT16(CONFIG_POSE_TELEMETRY_BATCH_SIZE, getLittleEndian(&stream.m_message[2U], 2U));
+
+    /* Nothing left to flush. */
+    telemetry.flush();
+    TEST_ASSERT_EQUAL_UINT8(2U, stream.m_count);
+
+    /* The reset is sent as text and restarts the sequence number. */
+    telemetry.sendReset();
+    TEST_ASSERT_EQUAL_UINT16(0U, telemetry.getSequenceNumber());
+}
+
+/**
+ * Test that a batch is sent early, if the time difference doesn't fit into the pose.
+ */
+static void testBatchTimeGap()
+{
+    TestStream    stream;
+    PoseTelemetry telemetry(stream);
+
+    telemetry.sendPose(1000U, 1, 2, 3);
+    telemetry.sendPose(1000U + UINT8_MAX + 1U, 4, 5, 6);
+
+    TEST_ASSERT_EQUAL_UINT8(1U, stream.m_count);
+    TEST_ASSERT_EQUAL_UINT8(1U, stream.m_message[1U]);
+
+    telemetry.flush();
+    TEST_ASSERT_EQUAL_UINT8(2U, stream.m_count);
+    TEST_ASSERT_EQUAL_UINT8(1U, stream.m_message[1U]);
+    TEST_ASSERT_EQUAL_UINT16(1U, getLittleEndian(&stream.m_message[2U], 2U));
+    TEST_ASSERT_EQUAL_UINT32(1000U + UINT8_MAX + 1U, getLittleEndian(&stream.m_message[4U], 4U));
+    TEST_ASSERT_EQUAL_UINT8(0U, stream.m_message[PoseTelemetry::BATCH_HEADER_SIZE]);
+}
+
+/**
+ * Get a value in little endian byte order.
+ *
+ * @param[in] data  Data
+ * @param[in] size  Number of bytes
+ *
+ * @return Value
+ */
+static uint32_t getLittleEndian(const uint8_t* data, uint8_t size)
+{
+    uint32_t value = 0U;
+
+    while (0U < size)
+    {
+        --size;
+        value = (value << 8U) | data[size];
+    }
+
+    return value;
+}
@@ -0,0 +1,333 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @author  Andreas Merkle <web@blue-andi.de>
+ * @brief   This module contains the Profiler tests.
+ */
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/* The profiler itself is enabled in the test environment. This module is
+ * compiled like a module with disabled profiler, to test that the profiler
+ * scopes compile away.
+ */
+#undef CONFIG_PROFILER_ENABLE
+#define CONFIG_PROFILER_ENABLE (0)
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <Profiler.h>
+
+#ifdef TARGET_NATIVE
+#include <chrono>
+#endif /* TARGET_NATIVE */
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testBinBoundaries();
+static void testMinMaxMean();
+static void testReset();
+static void testScope();
+static void testDisabledScope();
+static void busyWait(uint32_t duration);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Program setup routine, which is called once at startup.
+ */
+void setup()
+{
+#ifndef TARGET_NATIVE
+    /* https://docs.platformio.org/en/latest/plus/unit-testing.html#demo */
+    delay(2000);
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Main entry point.
+ */
+void loop()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testBinBoundaries);
+    RUN_TEST(testMinMaxMean);
+    RUN_TEST(testReset);
+    RUN_TEST(testScope);
+    RUN_TEST(testDisabledScope);
+
+    UNITY_END();
+
+#ifndef TARGET_NATIVE
+    /* Don't exit on the robot to avoid a endless test loop.
+     * If the test runs on the pc, it must exit.
+     */
+    for (;;)
+    {
+    }
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Initialize the test setup.
+ */
+extern void setUp(void)
+{
+    Profiler::resetAll();
+}
+
+/**
+ * Clean up test setup.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test that every execution time is counted in the right histogram bin.
+ */
+static void testBinBoundaries()
+{
+    Profiler::Statistics statistics;
+    uint32_t             binLimit = Profiler::HISTOGRAM_BIN_0_LIMIT;
+    uint8_t              bin      = 0U;
+
+    /* The first bin starts at 0. */
+    Profiler::record(Profiler::SECTION_BOARD, 0U);
+    TEST_ASSERT_TRUE(Profiler::getStatistics(Profiler::SECTION_BOARD, statistics));
+    TEST_ASSERT_EQUAL_UINT16(1U, statistics.histogram[0U]);
+
+    /* The limit of a bin belongs already to the next bin. */
+    for (bin = 0U; bin < (Profiler::HISTOGRAM_BINS - 1U); ++bin)
+    {
+        Profiler::reset(Profiler::SECTION_BOARD);
+
+        Profiler::record(Profiler::SECTION_BOARD, binLimit - 1U);
+        Profiler::record(Profiler::SECTION_BOARD, binLimit);
+        TEST_ASSERT_TRUE(Profiler::getStatistics(Profiler::SECTION_BOARD, statistics));
+        TEST_ASSERT_EQUAL_UINT16(1U, statistics.histogram[bin]);
+        TEST_ASSERT_EQUAL_UINT16(1U, statistics.histogram[bin + 1U]);
+
+        binLimit *= 2U;
+    }
+
+    /* The last bin contains all greater execution times, even beyond the value range. */
+    Profiler::reset(Profiler::SECTION_BOARD);
+    Profiler::record(Profiler::SECTION_BOARD, UINT16_MAX);
+    Profiler::record(Profiler::SECTION_BOARD, UINT32_MAX);
+    TEST_ASSERT_TRUE(Profiler::getStatistics(Profiler::SECTION_BOARD, statistics));
+    TEST_ASSERT_EQUAL_UINT16(2U, statistics.histogram[Profiler::HISTOGRAM_BINS - 1U]);
+    TEST_ASSERT_EQUAL_UINT16(UINT16_MAX, statistics.max);
+
+    /* Invalid section */
+    Profiler::record(Profiler::SECTION_COUNT, 0U);
+    TEST_ASSERT_FALSE(Profiler::getStatistics(Profiler::SECTION_COUNT, statistics));
+}
+
+/**
+ * Test the min., max. and mean execution time.
+ */
+static void testMinMaxMean()
+{
+    Profiler::Statistics statistics;
+
+    /* No measurement */
+    TEST_ASSERT_TRUE(Profiler::getStatistics(Profiler::SECTION_ODOMETRY, statistics));
+    TEST_ASSERT_EQUAL_UINT16(0U, statistics.count);
+    TEST_ASSERT_EQUAL_UINT16(0U, Profiler::getMean(statistics));
+
+    Profiler::record(Profiler::SECTION_ODOMETRY, 20U);
+    Profiler::record(Profiler::SECTION_ODOMETRY, 10U);
+    Profiler::record(Profiler::SECTION_ODOMETRY, 34U);
+    TEST_ASSERT_TRUE(Profiler::getStatistics(Profiler::SECTION_ODOMETRY, statistics));
+    TEST_ASSERT_EQUAL_UINT16(3U, statistics.count);
+    TEST_ASSERT_EQUAL_UINT16(10U, statistics.min);
+    TEST_ASSERT_EQUAL_UINT16(34U, statistics.max);
+    TEST_ASSERT_EQUAL_UINT32(64U, statistics.sum);
+
+    /* The mean is truncated. */
+    TEST_ASSERT_EQUAL_UINT16(21U, Profiler::getMean(statistics));
+
+    /* A measurement of 0 us is a valid min. */
+    Profiler::record(Profiler::SECTION_ODOMETRY, 0U);
+    TEST_ASSERT_TRUE(Profiler::getStatistics(Profiler::SECTION_ODOMETRY, statistics));
+    TEST_ASSERT_EQUAL_UINT16(0U, statistics.min);
+    TEST_ASSERT_EQUAL_UINT16(16U, Profiler::getMean(statistics));
+}
+
+/**
+ * Test that only the given section is reset.
+ */
+static void testReset()
+{
+    Profiler::Statistics statistics;
+    uint8_t              bin = 0U;
+
+    Profiler::record(Profiler::SECTION_SMP, 100U);
+    Profiler::record(Profiler::SECTION_SMP, 5000U);
+    Profiler::record(Profiler::SECTION_SPEEDOMETER, 200U);
+
+    Profiler::reset(Profiler::SECTION_SMP);
+    TEST_ASSERT_TRUE(Profiler::getStatistics(Profiler::SECTION_SMP, statistics));
+    TEST_ASSERT_EQUAL_UINT16(0U, statistics.count);
+    TEST_ASSERT_EQUAL_UINT16(0U, statistics.min);
+    TEST_ASSERT_EQUAL_UINT16(0U, statistics.max);
+    TEST_ASSERT_EQUAL_UINT32(0U, statistics.sum);
+
+    for (bin = 0U; bin < Profiler::HISTOGRAM_BINS; ++bin)
+    {
+        TEST_ASSERT_EQUAL_UINT16(0U, statistics.histogram[bin]);
+    }
+
+    /* The other sections are kept. */
+    TEST_ASSERT_TRUE(Profiler::getStatistics(Profiler::SECTION_SPEEDOMETER, statistics));
+    TEST_ASSERT_EQUAL_UINT16(1U, statistics.count);
+    TEST_ASSERT_EQUAL_UINT16(200U, statistics.min);
+
+    /* The min. starts again after the reset. */
+    Profiler::record(Profiler::SECTION_SMP, 300U);
+    TEST_ASSERT_TRUE(Profiler::getStatistics(Profiler::SECTION_SMP, statistics));
+    TEST_ASSERT_EQUAL_UINT16(300U, statistics.min);
+    TEST_ASSERT_EQUAL_UINT16(300U, statistics.max);
+
+    Profiler::resetAll();
+    TEST_ASSERT_TRUE(Profiler::getStatistics(Profiler::SECTION_SPEEDOMETER, statistics));
+    TEST_ASSERT_EQUAL_UINT16(0U, statistics.count);
+}
+
+/**
+ * Test that a scope records its execution time.
+ */
+static void testScope()
+{
+    Profiler::Statistics statistics;
+
+    {
+        Profiler::Scope scope(Profiler::SECTION_STATE_MACHINE);
+
+        busyWait(1000U);
+    }
+
+    TEST_ASSERT_TRUE(Profiler::getStatistics(Profiler::SECTION_STATE_MACHINE, statistics));
+    TEST_ASSERT_EQUAL_UINT16(1U, statistics.count);
+    TEST_ASSERT_GREATER_OR_EQUAL(1000U, statistics.min);
+
+#ifdef TARGET_NATIVE
+    /* The simulation time is not measured, only the execution time. */
+    Profiler::reset(Profiler::SECTION_STATE_MACHINE);
+
+    {
+        Profiler::Scope scope(Profiler::SECTION_STATE_MACHINE);
+
+        delay(1000U);
+    }
+
+    TEST_ASSERT_TRUE(Profiler::getStatistics(Profiler::SECTION_STATE_MACHINE, statistics));
+    TEST_ASSERT_EQUAL_UINT16(1U, statistics.count);
+    TEST_ASSERT_TRUE(statistics.min < 1000U);
+#endif /* TARGET_NATIVE */
+}
+
+/**
+ * Test that a profiler scope compiles away, if the profiler is disabled.
+ */
+static void testDisabledScope()
+{
+    Profiler::Statistics statistics;
+
+    {
+        PROFILER_SCOPE(Profiler::SECTION_STATE_MACHINE);
+
+        delay(1U);
+    }
+
+    TEST_ASSERT_TRUE(Profiler::getStatistics(Profiler::SECTION_STATE_MACHINE, statistics));
+    TEST_ASSERT_EQUAL_UINT16(0U, statistics.count);
+}
+
+/**
+ * Wait actively, to spend execution time.
+ *
+ * @param[in] duration  Duration in us.
+ */
+static void busyWait(uint32_t duration)
+{
+#ifdef TARGET_NATIVE
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    while (std::chrono::microseconds(duration) > (std::chrono::steady_clock::now() - start))
+    {
+        ;
+    }
+#else  /* TARGET_NATIVE */
+    delayMicroseconds(duration);
+#endif /* TARGET_NATIVE */
+}
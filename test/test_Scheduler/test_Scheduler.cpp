@@ -0,0 +1,347 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @author  Andreas Merkle <web@blue-andi.de>
+ * @brief   This module contains the Scheduler tests.
+ */
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <Scheduler.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/** Records the order of the task executions. */
+typedef struct
+{
+    char    log[16]; /**< Task names in order of execution. */
+    uint8_t idx;     /**< Write index of the log. */
+
+} ExecutionLog;
+
+/** Test task, which adds its name to the execution log. */
+typedef struct
+{
+    char          name; /**< Task name */
+    ExecutionLog* log;  /**< Execution log */
+
+} TestTask;
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testTaskFunc(void* userData);
+static void testRegistration();
+static void testPriority();
+static void testDriftFree();
+static void testOverrun();
+static void testSetPeriod();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Program setup routine, which is called once at startup.
+ */
+void setup()
+{
+#ifndef TARGET_NATIVE
+    /* https://docs.platformio.org/en/latest/plus/unit-testing.html#demo */
+    delay(2000);
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Main entry point.
+ */
+void loop()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testRegistration);
+    RUN_TEST(testPriority);
+    RUN_TEST(testDriftFree);
+    RUN_TEST(testOverrun);
+    RUN_TEST(testSetPeriod);
+
+    UNITY_END();
+
+#ifndef TARGET_NATIVE
+    /* Don't exit on the robot to avoid a endless test loop.
+     * If the test runs on the pc, it must exit.
+     */
+    for (;;)
+    {
+    }
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Initialize the test setup.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test setup.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test task function, which records its execution.
+ *
+ * @param[in] userData  Test task
+ */
+static void testTaskFunc(void* userData)
+{
+    TestTask* task = reinterpret_cast<TestTask*>(userData);
+
+    if ((sizeof(task->log->log) - 1U) > task->log->idx)
+    {
+        task->log->log[task->log->idx] = task->name;
+        ++task->log->idx;
+        task->log->log[task->log->idx] = '\0';
+    }
+}
+
+/**
+ * Test the task registration.
+ */
+static void testRegistration()
+{
+    Scheduler                 scheduler;
+    Scheduler::TaskStatistics statistics;
+    ExecutionLog              log  = {"", 0U};
+    TestTask                  task = {'A', &log};
+    uint8_t                   idx  = 0U;
+
+    /* Invalid tasks are rejected. */
+    TEST_ASSERT_EQUAL_UINT8(Scheduler::INVALID_TASK_ID, scheduler.addTask(nullptr, &task, 10U, 0U));
+    TEST_ASSERT_EQUAL_UINT8(Scheduler::INVALID_TASK_ID, scheduler.addTask(testTaskFunc, &task, 0U, 0U));
+
+    /* The task ids are given in order of registration. */
+    for (idx = 0U; idx < Scheduler::MAX_TASKS; ++idx)
+    {
+        TEST_ASSERT_EQUAL_UINT8(idx, scheduler.addTask(testTaskFunc, &task, 10U, Scheduler::MAX_TASKS - idx));
+    }
+
+    /* No free task slot anymore. */
+    TEST_ASSERT_EQUAL_UINT8(Scheduler::INVALID_TASK_ID, scheduler.addTask(testTaskFunc, &task, 10U, 0U));
+
+    TEST_ASSERT_TRUE(scheduler.getStatistics(0U, statistics));
+    TEST_ASSERT_FALSE(scheduler.getStatistics(Scheduler::MAX_TASKS, statistics));
+
+    /* Tasks don't run before the scheduler is started. */
+    delay(20U);
+    scheduler.process();
+    TEST_ASSERT_EQUAL_UINT8(0U, log.idx);
+}
+
+/**
+ * Test that due tasks are executed in order of their priority.
+ */
+static void testPriority()
+{
+    Scheduler    scheduler;
+    ExecutionLog log   = {"", 0U};
+    TestTask     taskA = {'A', &log};
+    TestTask     taskB = {'B', &log};
+    TestTask     taskC = {'C', &log};
+
+    /* Lowest priority first registered. */
+    TEST_ASSERT_EQUAL_UINT8(0U, scheduler.addTask(testTaskFunc, &taskC, 10U, 2U));
+    TEST_ASSERT_EQUAL_UINT8(1U, scheduler.addTask(testTaskFunc, &taskA, 5U, Scheduler::PRIORITY_HIGHEST));
+    TEST_ASSERT_EQUAL_UINT8(2U, scheduler.addTask(testTaskFunc, &taskB, 10U, 1U));
+    scheduler.start();
+
+    /* Nothing is due yet. */
+    scheduler.process();
+    TEST_ASSERT_EQUAL_STRING("", log.log);
+
+    delay(5U);
+    scheduler.process();
+    TEST_ASSERT_EQUAL_STRING("A", log.log);
+
+    /* All tasks are due. */
+    delay(5U);
+    scheduler.process();
+    TEST_ASSERT_EQUAL_STRING("AABC", log.log);
+}
+
+/**
+ * Test that the release times don't drift, if the task runs late.
+ */
+static void testDriftFree()
+{
+    Scheduler                 scheduler;
+    Scheduler::TaskStatistics statistics;
+    ExecutionLog              log  = {"", 0U};
+    TestTask                  task = {'A', &log};
+    uint8_t                   id   = scheduler.addTask(testTaskFunc, &task, 10U, 0U);
+
+    scheduler.start();
+
+    /* Run 3 ms late. */
+    delay(13U);
+    scheduler.process();
+    TEST_ASSERT_EQUAL_UINT8(1U, log.idx);
+
+    /* The next release is at 20 ms and not at 23 ms. */
+    delay(7U);
+    scheduler.process();
+    TEST_ASSERT_EQUAL_UINT8(2U, log.idx);
+
+    TEST_ASSERT_TRUE(scheduler.getStatistics(id, statistics));
+    TEST_ASSERT_EQUAL_UINT32(2U, statistics.releases);
+    TEST_ASSERT_EQUAL_UINT16(0U, statistics.overruns);
+    TEST_ASSERT_EQUAL_UINT16(3U, statistics.maxJitter);
+    TEST_ASSERT_EQUAL_UINT32(3U, statistics.sumJitter);
+}
+
+/**
+ * Test that missed periods are skipped and counted as overruns.
+ */
+static void testOverrun()
+{
+    Scheduler                 scheduler;
+    Scheduler::TaskStatistics statistics;
+    ExecutionLog              log  = {"", 0U};
+    TestTask                  task = {'A', &log};
+    uint8_t                   id   = scheduler.addTask(testTaskFunc, &task, 10U, 0U);
+
+    scheduler.start();
+
+    /* The releases at 10 ms and 20 ms are missed. */
+    delay(31U);
+    scheduler.process();
+    TEST_ASSERT_EQUAL_UINT8(1U, log.idx);
+
+    /* The task runs only once, because the next release is at 40 ms. */
+    scheduler.process();
+    TEST_ASSERT_EQUAL_UINT8(1U, log.idx);
+
+    delay(9U);
+    scheduler.process();
+    TEST_ASSERT_EQUAL_UINT8(2U, log.idx);
+
+    TEST_ASSERT_TRUE(scheduler.getStatistics(id, statistics));
+    TEST_ASSERT_EQUAL_UINT32(2U, statistics.releases);
+    TEST_ASSERT_EQUAL_UINT16(2U, statistics.overruns);
+    TEST_ASSERT_EQUAL_UINT16(1U, statistics.maxJitter);
+
+    scheduler.resetStatistics();
+    TEST_ASSERT_TRUE(scheduler.getStatistics(id, statistics));
+    TEST_ASSERT_EQUAL_UINT32(0U, statistics.releases);
+    TEST_ASSERT_EQUAL_UINT16(0U, statistics.overruns);
+}
+
+/**
+ * Test the lateness, the deadline and the change of a task period.
+ */
+static void testSetPeriod()
+{
+    Scheduler           scheduler;
+    ExecutionLog        log  = {"", 0U};
+    TestTask            task = {'A', &log};
+    uint8_t             id   = scheduler.addTask(testTaskFunc, &task, 10U, 0U);
+    Timebase::Timestamp startTimestamp;
+
+    TEST_ASSERT_FALSE(scheduler.setPeriod(Scheduler::INVALID_TASK_ID, 20U));
+    TEST_ASSERT_FALSE(scheduler.setPeriod(id, 0U));
+
+    scheduler.start();
+    startTimestamp = Timebase::now();
+
+    /* Run 3 ms late. The deadline is the end of the period, independent of the lateness. */
+    delay(13U);
+    scheduler.process();
+    TEST_ASSERT_EQUAL_UINT8(1U, log.idx);
+    TEST_ASSERT_EQUAL_UINT32(3U, scheduler.getLateness());
+    TEST_ASSERT_EQUAL_UINT32(startTimestamp + 20000U, scheduler.getDeadline());
+
+    /* The already scheduled release at 20 ms is kept. */
+    TEST_ASSERT_TRUE(scheduler.setPeriod(id, 20U));
+    delay(7U);
+    scheduler.process();
+    TEST_ASSERT_EQUAL_UINT8(2U, log.idx);
+    TEST_ASSERT_EQUAL_UINT32(0U, scheduler.getLateness());
+    TEST_ASSERT_EQUAL_UINT32(startTimestamp + 40000U, scheduler.getDeadline());
+
+    /* The following release is at 40 ms. */
+    delay(10U);
+    scheduler.process();
+    TEST_ASSERT_EQUAL_UINT8(2U, log.idx);
+
+    delay(10U);
+    scheduler.process();
+    TEST_ASSERT_EQUAL_UINT8(3U, log.idx);
+}
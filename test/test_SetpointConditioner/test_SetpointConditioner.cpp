@@ -0,0 +1,275 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @author  Andreas Merkle <web@blue-andi.de>
+ * @brief   This module contains the SetpointConditioner tests.
+ */
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <SetpointConditioner.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testNoSetpoint();
+static void testHold();
+static void testInterpolation();
+static void testExtrapolation();
+static void testTimeout();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Program setup routine, which is called once at startup.
+ */
+void setup()
+{
+#ifndef TARGET_NATIVE
+    /* https://docs.platformio.org/en/latest/plus/unit-testing.html#demo */
+    delay(2000);
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Main entry point.
+ */
+void loop()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testNoSetpoint);
+    RUN_TEST(testHold);
+    RUN_TEST(testInterpolation);
+    RUN_TEST(testExtrapolation);
+    RUN_TEST(testTimeout);
+
+    UNITY_END();
+
+#ifndef TARGET_NATIVE
+    /* Don't exit on the robot to avoid a endless test loop.
+     * If the test runs on the pc, it must exit.
+     */
+    for (;;)
+    {
+    }
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Initialize the test setup.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test setup.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test the output without any setpoint.
+ */
+static void testNoSetpoint()
+{
+    SetpointConditioner conditioner;
+    int16_t             value0 = 1;
+    int16_t             value1 = 1;
+
+    conditioner.process(Timebase::fromMs(1000U), value0, value1);
+    TEST_ASSERT_EQUAL_INT16(0, value0);
+    TEST_ASSERT_EQUAL_INT16(0, value1);
+    TEST_ASSERT_FALSE(conditioner.isTimeout());
+}
+
+/**
+ * Test that the setpoints are held by default.
+ */
+static void testHold()
+{
+    SetpointConditioner conditioner;
+    int16_t             value0 = 0;
+    int16_t             value1 = 0;
+
+    conditioner.write(100, -100, Timebase::fromMs(0U));
+    conditioner.process(Timebase::fromMs(5U), value0, value1);
+    TEST_ASSERT_EQUAL_INT16(100, value0);
+    TEST_ASSERT_EQUAL_INT16(-100, value1);
+
+    conditioner.write(200, -200, Timebase::fromMs(20U));
+    conditioner.process(Timebase::fromMs(30U), value0, value1);
+    TEST_ASSERT_EQUAL_INT16(200, value0);
+    TEST_ASSERT_EQUAL_INT16(-200, value1);
+
+    /* Reset discards the setpoints. */
+    conditioner.reset();
+    conditioner.process(Timebase::fromMs(35U), value0, value1);
+    TEST_ASSERT_EQUAL_INT16(0, value0);
+    TEST_ASSERT_EQUAL_INT16(0, value1);
+}
+
+/**
+ * Test the interpolation between two setpoints with a delay.
+ */
+static void testInterpolation()
+{
+    SetpointConditioner conditioner;
+    int16_t             value0 = 0;
+    int16_t             value1 = 0;
+
+    conditioner.setDelay(20U);
+    conditioner.write(100, 0, Timebase::fromMs(0U));
+    conditioner.write(200, -40, Timebase::fromMs(20U));
+
+    /* Output time 10 ms is in the middle of both setpoints. */
+    conditioner.process(Timebase::fromMs(30U), value0, value1);
+    TEST_ASSERT_EQUAL_INT16(150, value0);
+    TEST_ASSERT_EQUAL_INT16(-20, value1);
+
+    /* Output time 20 ms is the newest setpoint. */
+    conditioner.process(Timebase::fromMs(40U), value0, value1);
+    TEST_ASSERT_EQUAL_INT16(200, value0);
+    TEST_ASSERT_EQUAL_INT16(-40, value1);
+
+    /* Without extrapolation the newest setpoint is held. */
+    conditioner.process(Timebase::fromMs(50U), value0, value1);
+    TEST_ASSERT_EQUAL_INT16(200, value0);
+    TEST_ASSERT_EQUAL_INT16(-40, value1);
+}
+
+/**
+ * Test the limited extrapolation after the newest setpoint.
+ */
+static void testExtrapolation()
+{
+    SetpointConditioner conditioner;
+    int16_t             value0 = 0;
+    int16_t             value1 = 0;
+
+    conditioner.setMaxExtrapolation(10U);
+    conditioner.write(100, 0, Timebase::fromMs(0U));
+    conditioner.write(200, 20, Timebase::fromMs(20U));
+
+    conditioner.process(Timebase::fromMs(25U), value0, value1);
+    TEST_ASSERT_EQUAL_INT16(225, value0);
+    TEST_ASSERT_EQUAL_INT16(25, value1);
+
+    /* Limited to the max. extrapolation time. */
+    conditioner.process(Timebase::fromMs(50U), value0, value1);
+    TEST_ASSERT_EQUAL_INT16(250, value0);
+    TEST_ASSERT_EQUAL_INT16(30, value1);
+
+    /* Setpoints with a too long time in between are handled as a step. */
+    conditioner.write(300, 40, Timebase::fromMs(2000U));
+    conditioner.process(Timebase::fromMs(2005U), value0, value1);
+    TEST_ASSERT_EQUAL_INT16(300, value0);
+    TEST_ASSERT_EQUAL_INT16(40, value1);
+}
+
+/**
+ * Test the ramp down to zero after the watchdog timeout.
+ */
+static void testTimeout()
+{
+    SetpointConditioner conditioner;
+    int16_t             value0 = 0;
+    int16_t             value1 = 0;
+
+    conditioner.setTimeout(100U);
+    conditioner.setRampDuration(100U);
+    conditioner.write(200, -100, Timebase::fromMs(0U));
+
+    conditioner.process(Timebase::fromMs(100U), value0, value1);
+    TEST_ASSERT_FALSE(conditioner.isTimeout());
+    TEST_ASSERT_EQUAL_INT16(200, value0);
+
+    /* Timeout, the ramp starts. */
+    conditioner.process(Timebase::fromMs(101U), value0, value1);
+    TEST_ASSERT_TRUE(conditioner.isTimeout());
+    TEST_ASSERT_EQUAL_INT16(200, value0);
+    TEST_ASSERT_EQUAL_INT16(-100, value1);
+
+    conditioner.process(Timebase::fromMs(151U), value0, value1);
+    TEST_ASSERT_EQUAL_INT16(100, value0);
+    TEST_ASSERT_EQUAL_INT16(-50, value1);
+
+    conditioner.process(Timebase::fromMs(201U), value0, value1);
+    TEST_ASSERT_EQUAL_INT16(0, value0);
+    TEST_ASSERT_EQUAL_INT16(0, value1);
+
+    /* A new setpoint ends the timeout. */
+    conditioner.write(50, 60, Timebase::fromMs(300U));
+    conditioner.process(Timebase::fromMs(305U), value0, value1);
+    TEST_ASSERT_FALSE(conditioner.isTimeout());
+    TEST_ASSERT_EQUAL_INT16(50, value0);
+    TEST_ASSERT_EQUAL_INT16(60, value1);
+}
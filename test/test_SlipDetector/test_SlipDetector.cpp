@@ -0,0 +1,275 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @author  Andreas Merkle <web@blue-andi.de>
+ * @brief   This module contains the SlipDetector tests.
+ */
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <SlipDetector.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testNoSlip();
+static void testTurnRateSlip();
+static void testSpeedSlip();
+static void testSlipEventCount();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Program setup routine, which is called once at startup.
+ */
+void setup()
+{
+#ifndef TARGET_NATIVE
+    /* https://docs.platformio.org/en/latest/plus/unit-testing.html#demo */
+    delay(2000);
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Main entry point.
+ */
+void loop()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testNoSlip);
+    RUN_TEST(testTurnRateSlip);
+    RUN_TEST(testSpeedSlip);
+    RUN_TEST(testSlipEventCount);
+
+    UNITY_END();
+
+#ifndef TARGET_NATIVE
+    /* Don't exit on the robot to avoid a endless test loop.
+     * If the test runs on the pc, it must exit.
+     */
+    for (;;)
+    {
+    }
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Initialize the test setup.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test setup.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test that a consistent movement is not detected as slip.
+ */
+static void testNoSlip()
+{
+    SlipDetector  detector;
+    const int32_t ACCELERATION = 1000; /* [mm/s^2] */
+    int32_t       speed        = 0;    /* [mm/s] */
+    uint16_t      idx          = 0U;
+
+    /* Accelerate consistently with a turn. */
+    for (idx = 0U; idx < 100U; ++idx)
+    {
+        speed += ACCELERATION * 5 / 1000;
+        detector.process(5U, 500, 520, speed, ACCELERATION);
+        TEST_ASSERT_FALSE(detector.isSlipDetected());
+    }
+
+    /* An accelerometer bias shall be compensated. */
+    for (idx = 0U; idx < 1000U; ++idx)
+    {
+        detector.process(5U, 0, 0, speed, 300);
+        TEST_ASSERT_FALSE(detector.isSlipDetected());
+    }
+
+    TEST_ASSERT_EQUAL_UINT16(0U, detector.getSlipEventCount());
+}
+
+/**
+ * Test the slip detection by turn rate deviation.
+ */
+static void testTurnRateSlip()
+{
+    SlipDetector detector;
+    uint16_t     idx = 0U;
+
+    detector.process(5U, 0, 0, 0, 0);
+    TEST_ASSERT_FALSE(detector.isSlipDetected());
+
+    /* The wheels turn the robot in place, but it does not turn. */
+    detector.process(5U, 3000, 100, 0, 0);
+    TEST_ASSERT_TRUE(detector.isSlipDetected());
+
+    /* The slip is hold for a while. */
+    for (idx = 0U; idx < ((SlipDetector::SLIP_HOLD_TIME / 5U) - 1U); ++idx)
+    {
+        detector.process(5U, 0, 0, 0, 0);
+        TEST_ASSERT_TRUE(detector.isSlipDetected());
+    }
+
+    detector.process(5U, 0, 0, 0, 0);
+    TEST_ASSERT_FALSE(detector.isSlipDetected());
+
+    /* A lower threshold. */
+    detector.setTurnRateThreshold(100U);
+    detector.process(5U, 300, 100, 0, 0);
+    TEST_ASSERT_TRUE(detector.isSlipDetected());
+
+    detector.reset();
+    TEST_ASSERT_FALSE(detector.isSlipDetected());
+}
+
+/**
+ * Test the slip detection by speed deviation.
+ */
+static void testSpeedSlip()
+{
+    SlipDetector detector;
+    uint16_t     idx    = 0U;
+    bool         isSlip = false;
+    int32_t      speed  = 0; /* [mm/s] */
+
+    detector.process(5U, 0, 0, 0, 0);
+
+    /* Hard launch: The wheels spin up within some control periods, but the robot
+     * accelerates slowly.
+     */
+    for (idx = 0U; idx < 10U; ++idx)
+    {
+        speed += 50;
+        detector.process(5U, 0, 0, speed, 1000);
+
+        if (true == detector.isSlipDetected())
+        {
+            isSlip = true;
+        }
+    }
+
+    TEST_ASSERT_TRUE(isSlip);
+    TEST_ASSERT_EQUAL_UINT16(1U, detector.getSlipEventCount());
+
+    /* Driving with constant speed releases the slip. */
+    for (idx = 0U; idx < 100U; ++idx)
+    {
+        detector.process(5U, 0, 0, speed, 0);
+    }
+
+    TEST_ASSERT_FALSE(detector.isSlipDetected());
+
+    /* A lower threshold. */
+    detector.setSpeedThreshold(10U);
+    detector.process(5U, 0, 0, speed + 20, 0);
+    TEST_ASSERT_TRUE(detector.isSlipDetected());
+}
+
+/**
+ * Test counting the slip events.
+ */
+static void testSlipEventCount()
+{
+    SlipDetector detector;
+    uint16_t     event = 0U;
+    uint16_t     idx   = 0U;
+
+    for (event = 1U; event <= 3U; ++event)
+    {
+        /* A longer slip is a single event. */
+        for (idx = 0U; idx < 10U; ++idx)
+        {
+            detector.process(5U, 3000, 0, 0, 0);
+        }
+
+        TEST_ASSERT_EQUAL_UINT16(event, detector.getSlipEventCount());
+
+        for (idx = 0U; idx < (SlipDetector::SLIP_HOLD_TIME / 5U); ++idx)
+        {
+            detector.process(5U, 0, 0, 0, 0);
+        }
+
+        TEST_ASSERT_FALSE(detector.isSlipDetected());
+    }
+
+    /* Reset keeps the counter. */
+    detector.reset();
+    TEST_ASSERT_EQUAL_UINT16(3U, detector.getSlipEventCount());
+
+    detector.clearSlipEventCount();
+    TEST_ASSERT_EQUAL_UINT16(0U, detector.getSlipEventCount());
+}
@@ -0,0 +1,181 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @author  Andreas Merkle <web@blue-andi.de>
+ * @brief   This module contains the Sound tests.
+ */
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <Sound.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testSequence();
+static void testQueueFull();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Program setup routine, which is called once at startup.
+ */
+void setup()
+{
+#ifndef TARGET_NATIVE
+    /* https://docs.platformio.org/en/latest/plus/unit-testing.html#demo */
+    delay(2000);
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Main entry point.
+ */
+void loop()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testSequence);
+    RUN_TEST(testQueueFull);
+
+    UNITY_END();
+
+#ifndef TARGET_NATIVE
+    /* Don't exit on the robot to avoid a endless test loop.
+     * If the test runs on the pc, it must exit.
+     */
+    for (;;)
+    {
+    }
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Initialize the test setup.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test setup.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Test that the tones are played one after another, without blocking the caller.
+ */
+static void testSequence()
+{
+    const uint16_t DURATION = 20U;
+    const uint16_t SILENCE  = 10U;
+
+    TEST_ASSERT_FALSE(Sound::isPlaying());
+
+    TEST_ASSERT_TRUE(Sound::playTone(1000U, DURATION, SILENCE));
+    TEST_ASSERT_TRUE(Sound::playTone(1000U, DURATION, 0U));
+    TEST_ASSERT_TRUE(Sound::isPlaying());
+
+    /* The first tone with its silence is still in progress. */
+    delay(DURATION);
+    Sound::process();
+    TEST_ASSERT_TRUE(Sound::isPlaying());
+
+    /* The second tone starts after the silence. */
+    delay(SILENCE);
+    Sound::process();
+    TEST_ASSERT_TRUE(Sound::isPlaying());
+
+    delay(DURATION);
+    Sound::process();
+    TEST_ASSERT_FALSE(Sound::isPlaying());
+}
+
+/**
+ * Test that a full queue rejects further tones.
+ */
+static void testQueueFull()
+{
+    const uint16_t DURATION = 10U;
+    uint8_t        idx      = 0U;
+
+    /* The first tone is started immediately, therefore it doesn't occupy the queue. */
+    for (idx = 0U; idx < (CONFIG_SOUND_QUEUE_SIZE + 1U); ++idx)
+    {
+        TEST_ASSERT_TRUE(Sound::playTone(1000U, DURATION, 0U));
+    }
+
+    TEST_ASSERT_FALSE(Sound::playTone(1000U, DURATION, 0U));
+
+    /* After the queue is discarded, only the tone in progress remains. */
+    Sound::clear();
+    TEST_ASSERT_TRUE(Sound::isPlaying());
+
+    delay(DURATION);
+    Sound::process();
+    TEST_ASSERT_FALSE(Sound::isPlaying());
+}
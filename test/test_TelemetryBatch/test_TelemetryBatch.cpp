@@ -0,0 +1,424 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @author  Andreas Merkle <web@blue-andi.de>
+ * @brief   This module contains the TelemetryBatch tests.
+ */
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <TelemetryBatch.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testVarint();
+static void testKeyframe();
+static void testDeltaAcrossFrames();
+static void testKeyframeInterval();
+static void testStartKeyframe();
+static void testOversizedSample();
+
+static uint8_t readVarint(const uint8_t* buffer, uint32_t& value);
+static uint8_t readSignedVarint(const uint8_t* buffer, int32_t& value);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Number of values per sample, used by the tests. */
+static const uint8_t VALUE_COUNT = 3U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Program setup routine, which is called once at startup.
+ */
+void setup()
+{
+#ifndef TARGET_NATIVE
+    /* https://docs.platformio.org/en/latest/plus/unit-testing.html#demo */
+    delay(2000);
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Main entry point.
+ */
+void loop()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testVarint);
+    RUN_TEST(testKeyframe);
+    RUN_TEST(testDeltaAcrossFrames);
+    RUN_TEST(testKeyframeInterval);
+    RUN_TEST(testStartKeyframe);
+    RUN_TEST(testOversizedSample);
+
+    UNITY_END();
+
+#ifndef TARGET_NATIVE
+    /* Don't exit on the robot to avoid a endless test loop.
+     * If the test runs on the pc, it must exit.
+     */
+    for (;;)
+    {
+    }
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Initialize the test setup.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test setup.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Test the varint and zigzag encoding.
+ */
+static void testVarint()
+{
+    uint8_t buffer[5U];
+    int32_t value = 0;
+
+    TEST_ASSERT_EQUAL_UINT8(1U, TelemetryBatch::writeVarint(buffer, 0U));
+    TEST_ASSERT_EQUAL_UINT8(0x00U, buffer[0U]);
+
+    TEST_ASSERT_EQUAL_UINT8(1U, TelemetryBatch::writeVarint(buffer, 127U));
+    TEST_ASSERT_EQUAL_UINT8(0x7FU, buffer[0U]);
+
+    TEST_ASSERT_EQUAL_UINT8(2U, TelemetryBatch::writeVarint(buffer, 128U));
+    TEST_ASSERT_EQUAL_UINT8(0x80U, buffer[0U]);
+    TEST_ASSERT_EQUAL_UINT8(0x01U, buffer[1U]);
+
+    TEST_ASSERT_EQUAL_UINT8(5U, TelemetryBatch::writeVarint(buffer, UINT32_MAX));
+
+    TEST_ASSERT_EQUAL_UINT8(1U, TelemetryBatch::writeSignedVarint(buffer, -1));
+    TEST_ASSERT_EQUAL_UINT8(1U, buffer[0U]);
+
+    TEST_ASSERT_EQUAL_UINT8(1U, TelemetryBatch::writeSignedVarint(buffer, 1));
+    TEST_ASSERT_EQUAL_UINT8(2U, buffer[0U]);
+
+    TEST_ASSERT_EQUAL_UINT8(1U, TelemetryBatch::writeSignedVarint(buffer, -64));
+    TEST_ASSERT_EQUAL_UINT8(2U, TelemetryBatch::writeSignedVarint(buffer, 64));
+
+    TEST_ASSERT_EQUAL_UINT8(5U, TelemetryBatch::writeSignedVarint(buffer, INT32_MIN));
+    TEST_ASSERT_EQUAL_UINT8(5U, readSignedVarint(buffer, value));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, value);
+
+    TEST_ASSERT_EQUAL_UINT8(5U, TelemetryBatch::writeSignedVarint(buffer, INT32_MAX));
+    TEST_ASSERT_EQUAL_UINT8(5U, readSignedVarint(buffer, value));
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, value);
+}
+
+/**
+ * Test the keyframe, which starts with the absolute values.
+ */
+static void testKeyframe()
+{
+    TelemetryBatch batch(VALUE_COUNT);
+    const int32_t  sample1[VALUE_COUNT] = {1000, -2000, 3};
+    const int32_t  sample2[VALUE_COUNT] = {1005, -2010, 3};
+    const uint8_t* frame                = batch.getFrame();
+    uint8_t        idx                  = TelemetryBatch::HEADER_SIZE;
+    uint32_t       dt                   = 0U;
+    int32_t        value                = 0;
+
+    TEST_ASSERT_TRUE(batch.isKeyframe());
+    TEST_ASSERT_EQUAL_UINT8(0U, batch.getSampleCount());
+
+    TEST_ASSERT_TRUE(batch.addSample(5000U, sample1));
+    TEST_ASSERT_TRUE(batch.addSample(5010U, sample2));
+    TEST_ASSERT_EQUAL_UINT8(2U, batch.getSampleCount());
+
+    /* Header */
+    TEST_ASSERT_EQUAL_UINT8(0U, frame[0U]);
+    TEST_ASSERT_EQUAL_UINT8(0U, frame[1U]);
+    TEST_ASSERT_EQUAL_UINT8(TelemetryBatch::INFO_KEYFRAME | 2U, frame[2U]);
+    TEST_ASSERT_EQUAL_UINT8(5000U & 0xFFU, frame[3U]);
+    TEST_ASSERT_EQUAL_UINT8((5000U >> 8U) & 0xFFU, frame[4U]);
+    TEST_ASSERT_EQUAL_UINT8(0U, frame[5U]);
+    TEST_ASSERT_EQUAL_UINT8(0U, frame[6U]);
+
+    /* First sample with absolute values. */
+    idx += readSignedVarint(&frame[idx], value);
+    TEST_ASSERT_EQUAL_INT32(1000, value);
+    idx += readSignedVarint(&frame[idx], value);
+    TEST_ASSERT_EQUAL_INT32(-2000, value);
+    idx += readSignedVarint(&frame[idx], value);
+    TEST_ASSERT_EQUAL_INT32(3, value);
+
+    /* Second sample with time difference and deltas, a single byte each. */
+    idx += readVarint(&frame[idx], dt);
+    TEST_ASSERT_EQUAL_UINT32(10U, dt);
+    idx += readSignedVarint(&frame[idx], value);
+    TEST_ASSERT_EQUAL_INT32(5, value);
+    idx += readSignedVarint(&frame[idx], value);
+    TEST_ASSERT_EQUAL_INT32(-10, value);
+    idx += readSignedVarint(&frame[idx], value);
+    TEST_ASSERT_EQUAL_INT32(0, value);
+
+    TEST_ASSERT_EQUAL_UINT8(TelemetryBatch::HEADER_SIZE + 5U + 4U, idx);
+
+    /* Unused bytes are 0. */
+    while (TelemetryBatch::FRAME_SIZE > idx)
+    {
+        TEST_ASSERT_EQUAL_UINT8(0U, frame[idx]);
+        ++idx;
+    }
+}
+
+/**
+ * Test that the deltas continue across frames and a full frame rejects the sample.
+ */
+static void testDeltaAcrossFrames()
+{
+    TelemetryBatch batch(VALUE_COUNT);
+    int32_t        sample[VALUE_COUNT] = {100000, 200000, 300000};
+    uint32_t       timestamp           = 0U;
+    int32_t        value               = 0;
+    uint8_t        count               = 0U;
+
+    /* Each following sample needs 4 bytes. */
+    while (true == batch.addSample(timestamp, sample))
+    {
+        ++count;
+        timestamp += 10U;
+        sample[0U] += 1;
+    }
+
+    TEST_ASSERT_EQUAL_UINT8(count, batch.getSampleCount());
+    TEST_ASSERT_TRUE(1U < count);
+
+    batch.nextFrame();
+    TEST_ASSERT_EQUAL_UINT16(1U, batch.getSequenceNumber());
+    TEST_ASSERT_FALSE(batch.isKeyframe());
+    TEST_ASSERT_EQUAL_UINT8(0U, batch.getSampleCount());
+
+    TEST_ASSERT_TRUE(batch.addSample(timestamp, sample));
+    TEST_ASSERT_EQUAL_UINT8(1U, batch.getFrame()[0U]);
+    TEST_ASSERT_EQUAL_UINT8(1U, batch.getFrame()[2U]);
+
+    /* The first sample is the delta to the last sample of the previous frame. */
+    (void)readSignedVarint(&batch.getFrame()[TelemetryBatch::HEADER_SIZE], value);
+    TEST_ASSERT_EQUAL_INT32(1, value);
+}
+
+/**
+ * Test that every n-th frame is a keyframe and reset starts with a keyframe.
+ */
+static void testKeyframeInterval()
+{
+    TelemetryBatch batch(VALUE_COUNT);
+    const int32_t  sample[VALUE_COUNT] = {1, 2, 3};
+    uint8_t        idx;
+
+    /* A keyframe without samples is repeated. */
+    batch.nextFrame();
+    TEST_ASSERT_TRUE(batch.isKeyframe());
+    TEST_ASSERT_EQUAL_UINT16(1U, batch.getSequenceNumber());
+
+    TEST_ASSERT_TRUE(batch.addSample(0U, sample));
+
+    for (idx = 1U; idx < CONFIG_TELEMETRY_BATCH_KEYFRAME_INTERVAL; ++idx)
+    {
+        batch.nextFrame();
+        TEST_ASSERT_FALSE(batch.isKeyframe());
+    }
+
+    batch.nextFrame();
+    TEST_ASSERT_TRUE(batch.isKeyframe());
+    TEST_ASSERT_EQUAL_UINT16(1U + CONFIG_TELEMETRY_BATCH_KEYFRAME_INTERVAL, batch.getSequenceNumber());
+
+    batch.nextFrame();
+    batch.reset();
+    TEST_ASSERT_TRUE(batch.isKeyframe());
+    TEST_ASSERT_EQUAL_UINT16(0U, batch.getSequenceNumber());
+}
+
+/**
+ * Test that a forced keyframe keeps the sequence number and restarts the keyframe interval.
+ */
+static void testStartKeyframe()
+{
+    TelemetryBatch batch(VALUE_COUNT);
+    const int32_t  sample[VALUE_COUNT] = {1, 2, 3};
+    int32_t        value               = 0;
+    uint8_t        idx;
+
+    TEST_ASSERT_TRUE(batch.addSample(1000U, sample));
+    batch.nextFrame();
+    TEST_ASSERT_FALSE(batch.isKeyframe());
+
+    /* The time base jumps backwards, which the unsigned time difference can't express. */
+    batch.startKeyframe();
+    TEST_ASSERT_TRUE(batch.isKeyframe());
+    TEST_ASSERT_EQUAL_UINT16(1U, batch.getSequenceNumber());
+    TEST_ASSERT_EQUAL_UINT8(1U, batch.getFrame()[0U]);
+
+    TEST_ASSERT_TRUE(batch.addSample(500U, sample));
+    TEST_ASSERT_EQUAL_UINT8(500U & 0xFFU, batch.getFrame()[3U]);
+    TEST_ASSERT_EQUAL_UINT8((500U >> 8U) & 0xFFU, batch.getFrame()[4U]);
+
+    /* The first sample has the absolute values. */
+    (void)readSignedVarint(&batch.getFrame()[TelemetryBatch::HEADER_SIZE], value);
+    TEST_ASSERT_EQUAL_INT32(1, value);
+
+    /* The keyframe interval starts again. */
+    for (idx = 1U; idx < CONFIG_TELEMETRY_BATCH_KEYFRAME_INTERVAL; ++idx)
+    {
+        batch.nextFrame();
+        TEST_ASSERT_FALSE(batch.isKeyframe());
+    }
+
+    batch.nextFrame();
+    TEST_ASSERT_TRUE(batch.isKeyframe());
+}
+
+/**
+ * Test that a sample, which doesn't fit into an empty frame, doesn't affect the deltas.
+ */
+static void testOversizedSample()
+{
+    TelemetryBatch batch(TelemetryBatch::MAX_VALUES);
+    int32_t        sample[TelemetryBatch::MAX_VALUES];
+    int32_t        value = 0;
+    uint8_t        idx;
+
+    for (idx = 0U; idx < TelemetryBatch::MAX_VALUES; ++idx)
+    {
+        sample[idx] = 0;
+    }
+
+    TEST_ASSERT_TRUE(batch.addSample(0U, sample));
+    batch.nextFrame();
+
+    /* Every delta needs 5 bytes. */
+    for (idx = 0U; idx < TelemetryBatch::MAX_VALUES; ++idx)
+    {
+        sample[idx] = INT32_MIN;
+    }
+
+    TEST_ASSERT_FALSE(batch.addSample(10U, sample));
+    TEST_ASSERT_EQUAL_UINT8(0U, batch.getSampleCount());
+
+    /* The reference is still the last added sample. */
+    sample[0U] = 7;
+    for (idx = 1U; idx < TelemetryBatch::MAX_VALUES; ++idx)
+    {
+        sample[idx] = 0;
+    }
+
+    TEST_ASSERT_TRUE(batch.addSample(20U, sample));
+    (void)readSignedVarint(&batch.getFrame()[TelemetryBatch::HEADER_SIZE], value);
+    TEST_ASSERT_EQUAL_INT32(7, value);
+}
+
+/**
+ * Decode a varint.
+ *
+ * @param[in]  buffer   Source buffer
+ * @param[out] value    Decoded value
+ *
+ * @return Number of read bytes.
+ */
+static uint8_t readVarint(const uint8_t* buffer, uint32_t& value)
+{
+    uint8_t idx   = 0U;
+    uint8_t shift = 0U;
+
+    value = 0U;
+
+    do
+    {
+        value |= static_cast<uint32_t>(buffer[idx] & 0x7FU) << shift;
+        shift += 7U;
+    } while (0U != (buffer[idx++] & 0x80U));
+
+    return idx;
+}
+
+/**
+ * Decode a zigzag varint.
+ *
+ * @param[in]  buffer   Source buffer
+ * @param[out] value    Decoded value
+ *
+ * @return Number of read bytes.
+ */
+static uint8_t readSignedVarint(const uint8_t* buffer, int32_t& value)
+{
+    uint32_t zigzag = 0U;
+    uint8_t  size   = readVarint(buffer, zigzag);
+
+    value = static_cast<int32_t>((zigzag >> 1U) ^ (0U - (zigzag & 1U)));
+
+    return size;
+}
@@ -0,0 +1,372 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @author  Andreas Merkle <web@blue-andi.de>
+ * @brief   This module contains the TimeSync tests.
+ */
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <TimeSync.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/**
+ * Stand-in for the DCS, which answers the time synchronization requests.
+ * Its clock has an offset and a drift to the local clock. The link has a
+ * configurable delay per direction with a pseudo random jitter.
+ */
+class TestPeer
+{
+public:
+    /**
+     * Constructs the test peer.
+     *
+     * @param[in] offset        Peer clock at local time 0 in us.
+     * @param[in] drift         Drift of the peer clock in ppm.
+     * @param[in] requestDelay  Link delay of the request in us.
+     * @param[in] responseDelay Link delay of the response in us.
+     * @param[in] jitter        Max. additional link delay per direction in us.
+     */
+    TestPeer(uint32_t offset, int32_t drift, uint32_t requestDelay, uint32_t responseDelay, uint32_t jitter) :
+        m_offset(offset),
+        m_drift(drift),
+        m_requestDelay(requestDelay),
+        m_responseDelay(responseDelay),
+        m_jitter(jitter),
+        m_random(12345U)
+    {
+    }
+
+    /**
+     * Get the peer time.
+     *
+     * @param[in] localTime Local time in us.
+     *
+     * @return Peer time in us
+     */
+    uint32_t getPeerTime(uint64_t localTime) const
+    {
+        int64_t drift = (static_cast<int64_t>(localTime) * m_drift) / 1000000;
+
+        return static_cast<uint32_t>(m_offset + localTime + drift);
+    }
+
+    /**
+     * Run a whole exchange: request, response and its processing.
+     *
+     * @param[in] timeSync  Time synchronization under test.
+     * @param[in] localTime Local time of the request in us, not wrapped.
+     *
+     * @return If the response is accepted, it will return true otherwise false.
+     */
+    bool exchange(TimeSync& timeSync, uint64_t localTime)
+    {
+        /* The local clock is 32 bit and wraps around. */
+        uint32_t t1       = static_cast<uint32_t>(localTime);
+        uint8_t  sequence = timeSync.createRequest(t1);
+        uint64_t received = localTime + m_requestDelay + getJitter();
+        uint64_t sent     = received + PROCESSING_TIME;
+        uint64_t answered = sent + m_responseDelay + getJitter();
+
+        return timeSync.processResponse(sequence, t1, getPeerTime(received), getPeerTime(sent),
+                                        static_cast<uint32_t>(answered));
+    }
+
+private:
+    /** Processing time of the peer between request and response in us. */
+    static const uint32_t PROCESSING_TIME = 300U;
+
+    uint32_t m_offset;        /**< Peer clock at local time 0 in us. */
+    int32_t  m_drift;         /**< Drift in ppm. */
+    uint32_t m_requestDelay;  /**< Link delay of the request in us. */
+    uint32_t m_responseDelay; /**< Link delay of the response in us. */
+    uint32_t m_jitter;        /**< Max. jitter in us. */
+    uint32_t m_random;        /**< State of the pseudo random generator. */
+
+    /**
+     * Get the next pseudo random jitter.
+     *
+     * @return Jitter in us
+     */
+    uint32_t getJitter()
+    {
+        uint32_t jitter = 0U;
+
+        m_random = (m_random * 1103515245U) + 12345U;
+
+        if (0U < m_jitter)
+        {
+            jitter = (m_random >> 8U) % m_jitter;
+        }
+
+        return jitter;
+    }
+};
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testOffset();
+static void testInvalidResponse();
+static void testShortestDelay();
+static void testDrift();
+static void testWrapAround();
+
+static int32_t getPeerTimeError(const TimeSync& timeSync, const TestPeer& peer, uint64_t localTime);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/** Interval between two requests in us. */
+static const uint32_t REQUEST_INTERVAL = 500000U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Program setup routine, which is called once at startup.
+ */
+void setup()
+{
+#ifndef TARGET_NATIVE
+    /* https://docs.platformio.org/en/latest/plus/unit-testing.html#demo */
+    delay(2000);
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Main entry point.
+ */
+void loop()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testOffset);
+    RUN_TEST(testInvalidResponse);
+    RUN_TEST(testShortestDelay);
+    RUN_TEST(testDrift);
+    RUN_TEST(testWrapAround);
+
+    UNITY_END();
+
+#ifndef TARGET_NATIVE
+    /* Don't exit on the robot to avoid a endless test loop.
+     * If the test runs on the pc, it must exit.
+     */
+    for (;;)
+    {
+    }
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Initialize the test setup.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test setup.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Test the offset and round trip delay with a symmetric link.
+ */
+static void testOffset()
+{
+    TimeSync timeSync;
+    TestPeer peer(5000000U, 0, 1000U, 1000U, 0U);
+    uint64_t localTime = 1000000U;
+    uint8_t  idx;
+
+    TEST_ASSERT_FALSE(timeSync.isSynced());
+
+    for (idx = 0U; idx < CONFIG_TIME_SYNC_SAMPLES; ++idx)
+    {
+        TEST_ASSERT_FALSE(timeSync.isSynced());
+        TEST_ASSERT_TRUE(peer.exchange(timeSync, localTime));
+        localTime += REQUEST_INTERVAL;
+    }
+
+    TEST_ASSERT_TRUE(timeSync.isSynced());
+    TEST_ASSERT_EQUAL_UINT32(5000000U, timeSync.getOffset());
+    TEST_ASSERT_EQUAL_UINT32(2000U, timeSync.getRoundTripDelay());
+    TEST_ASSERT_EQUAL_INT32(0, getPeerTimeError(timeSync, peer, localTime));
+
+    timeSync.reset();
+    TEST_ASSERT_FALSE(timeSync.isSynced());
+}
+
+/**
+ * Test that responses, which don't belong to the pending request, are rejected.
+ */
+static void testInvalidResponse()
+{
+    TimeSync timeSync;
+    uint8_t  sequence = timeSync.createRequest(1000U);
+
+    /* Wrong sequence number and wrong origin timestamp. */
+    TEST_ASSERT_FALSE(timeSync.processResponse(sequence + 1U, 1000U, 2000U, 2100U, 1200U));
+    TEST_ASSERT_FALSE(timeSync.processResponse(sequence, 1001U, 2000U, 2100U, 1200U));
+
+    /* The response is accepted only once. */
+    TEST_ASSERT_TRUE(timeSync.processResponse(sequence, 1000U, 2000U, 2100U, 1200U));
+    TEST_ASSERT_FALSE(timeSync.processResponse(sequence, 1000U, 2000U, 2100U, 1200U));
+
+    /* A new request drops the pending one. */
+    sequence = timeSync.createRequest(3000U);
+    (void)timeSync.createRequest(4000U);
+    TEST_ASSERT_FALSE(timeSync.processResponse(sequence, 3000U, 4000U, 4100U, 3200U));
+}
+
+/**
+ * Test that the exchange with the shortest round trip delay is used.
+ */
+static void testShortestDelay()
+{
+    TimeSync timeSync;
+    uint8_t  sequence;
+    uint8_t  idx;
+
+    /* Disturbed exchanges with an asymmetric delay of 5000 us in the request direction. */
+    for (idx = 1U; idx < CONFIG_TIME_SYNC_SAMPLES; ++idx)
+    {
+        sequence = timeSync.createRequest(1000U);
+        TEST_ASSERT_TRUE(timeSync.processResponse(sequence, 1000U, 106000U, 106100U, 7100U));
+    }
+
+    /* Undisturbed exchange with 1000 us delay per direction and an offset of 100000 us. */
+    sequence = timeSync.createRequest(1000U);
+    TEST_ASSERT_TRUE(timeSync.processResponse(sequence, 1000U, 102000U, 102100U, 3100U));
+
+    TEST_ASSERT_TRUE(timeSync.isSynced());
+    TEST_ASSERT_EQUAL_UINT32(100000U, timeSync.getOffset());
+    TEST_ASSERT_EQUAL_UINT32(2000U, timeSync.getRoundTripDelay());
+}
+
+/**
+ * Test the drift estimation with link jitter.
+ */
+static void testDrift()
+{
+    const int32_t DRIFT = 250;
+    TimeSync      timeSync;
+    TestPeer      peer(123456789U, DRIFT, 1500U, 1000U, 2000U);
+    uint64_t      localTime = 0U;
+    uint16_t      idx;
+
+    /* About 100 s. */
+    for (idx = 0U; idx < 200U; ++idx)
+    {
+        TEST_ASSERT_TRUE(peer.exchange(timeSync, localTime));
+        localTime += REQUEST_INTERVAL;
+    }
+
+    TEST_ASSERT_TRUE(timeSync.isSynced());
+    TEST_ASSERT_INT32_WITHIN(50, DRIFT, timeSync.getDrift());
+
+    /* The asymmetric link delay causes a systematic error of 250 us, the jitter adds up to 1000 us. */
+    TEST_ASSERT_INT32_WITHIN(1500, 0, getPeerTimeError(timeSync, peer, localTime));
+
+    /* The drift keeps the error low, even 10 s after the last estimation. */
+    TEST_ASSERT_INT32_WITHIN(2000, 0, getPeerTimeError(timeSync, peer, localTime + 10000000U));
+}
+
+/**
+ * Test the wrap around of the local and peer clock.
+ */
+static void testWrapAround()
+{
+    TimeSync timeSync;
+    TestPeer peer(UINT32_MAX - 1000U, 0, 1000U, 1000U, 0U);
+    uint64_t localTime = UINT32_MAX - ((CONFIG_TIME_SYNC_SAMPLES / 2U) * REQUEST_INTERVAL);
+    uint8_t  idx;
+
+    for (idx = 0U; idx < (2U * CONFIG_TIME_SYNC_SAMPLES); ++idx)
+    {
+        TEST_ASSERT_TRUE(peer.exchange(timeSync, localTime));
+        localTime += REQUEST_INTERVAL;
+    }
+
+    TEST_ASSERT_TRUE(timeSync.isSynced());
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX - 1000U, timeSync.getOffset());
+    TEST_ASSERT_EQUAL_INT32(0, timeSync.getDrift());
+    TEST_ASSERT_EQUAL_INT32(0, getPeerTimeError(timeSync, peer, localTime));
+}
+
+/**
+ * Get the error of the peer time, which is estimated by the time synchronization.
+ *
+ * @param[in] timeSync  Time synchronization under test.
+ * @param[in] peer      Test peer
+ * @param[in] localTime Local time in us, not wrapped.
+ *
+ * @return Error in us
+ */
+static int32_t getPeerTimeError(const TimeSync& timeSync, const TestPeer& peer, uint64_t localTime)
+{
+    uint32_t estimated = timeSync.toPeerTime(static_cast<uint32_t>(localTime));
+
+    return static_cast<int32_t>(estimated - peer.getPeerTime(localTime));
+}
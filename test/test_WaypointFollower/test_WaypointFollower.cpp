@@ -0,0 +1,278 @@
+/* MIT License
+ *
+ * Copyright (c) 2023 - 2025 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @author  Andreas Merkle <web@blue-andi.de>
+ * @brief   This module contains the WaypointFollower tests.
+ */
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+
+#include <unity.h>
+#include <Arduino.h>
+#include <WaypointFollower.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void testUpload();
+static void testSteering();
+static void testWaypoints();
+static void testStop();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/**
+ * Program setup routine, which is called once at startup.
+ */
+void setup()
+{
+#ifndef TARGET_NATIVE
+    /* https://docs.platformio.org/en/latest/plus/unit-testing.html#demo */
+    delay(2000);
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Main entry point.
+ */
+void loop()
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(testUpload);
+    RUN_TEST(testSteering);
+    RUN_TEST(testWaypoints);
+    RUN_TEST(testStop);
+
+    UNITY_END();
+
+#ifndef TARGET_NATIVE
+    /* Don't exit on the robot to avoid a endless test loop.
+     * If the test runs on the pc, it must exit.
+     */
+    for (;;)
+    {
+    }
+#endif /* Not defined TARGET_NATIVE */
+}
+
+/**
+ * Initialize the test setup.
+ */
+extern void setUp(void)
+{
+    /* Not used. */
+}
+
+/**
+ * Clean up test setup.
+ */
+extern void tearDown(void)
+{
+    /* Not used. */
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Test uploading the waypoints.
+ */
+static void testUpload()
+{
+    WaypointFollower                 follower;
+    const WaypointFollower::Waypoint waypoint         = {100, 200, 150};
+    const WaypointFollower::Waypoint backwardWaypoint = {100, 200, -150};
+    uint8_t                          idx              = 0U;
+    int16_t                          linearSpeed      = 0;
+    int16_t                          angularSpeed     = 0;
+
+    /* An empty path can't be started. */
+    TEST_ASSERT_FALSE(follower.start(0, 0));
+
+    /* Driving backward is not supported. */
+    TEST_ASSERT_FALSE(follower.addWaypoint(backwardWaypoint));
+
+    for (idx = 0U; idx < WaypointFollower::MAX_WAYPOINTS; ++idx)
+    {
+        TEST_ASSERT_TRUE(follower.addWaypoint(waypoint));
+    }
+
+    TEST_ASSERT_FALSE(follower.addWaypoint(waypoint));
+    TEST_ASSERT_EQUAL_UINT8(WaypointFollower::MAX_WAYPOINTS, follower.getLength());
+
+    /* Not started, no movement. */
+    follower.process(0, 0, 0, linearSpeed, angularSpeed);
+    TEST_ASSERT_EQUAL_INT16(0, linearSpeed);
+    TEST_ASSERT_EQUAL_INT16(0, angularSpeed);
+
+    /* The path can't be changed while it is followed. */
+    TEST_ASSERT_TRUE(follower.start(0, 0));
+    TEST_ASSERT_FALSE(follower.start(0, 0));
+    follower.clear();
+    TEST_ASSERT_FALSE(follower.isRunning());
+    TEST_ASSERT_EQUAL_UINT8(0U, follower.getLength());
+}
+
+/**
+ * Test the pure pursuit steering.
+ */
+static void testSteering()
+{
+    WaypointFollower                 follower;
+    const WaypointFollower::Waypoint waypoint     = {1000, 0, 0};
+    int16_t                          linearSpeed  = 0;
+    int16_t                          angularSpeed = 0;
+
+    TEST_ASSERT_TRUE(follower.addWaypoint(waypoint));
+    TEST_ASSERT_TRUE(follower.start(0, 0));
+
+    /* On the path, straight ahead with the default speed. */
+    follower.process(0, 0, 0, linearSpeed, angularSpeed);
+    TEST_ASSERT_EQUAL_INT16(WaypointFollower::DEFAULT_SPEED, linearSpeed);
+    TEST_ASSERT_EQUAL_INT16(0, angularSpeed);
+
+    /* Right of the path, the goal point is (100, 0) and the curvature 2 * 50 / 12500. */
+    follower.process(0, -50, 0, linearSpeed, angularSpeed);
+    TEST_ASSERT_EQUAL_INT16(WaypointFollower::DEFAULT_SPEED, linearSpeed);
+    TEST_ASSERT_EQUAL_INT16(1600, angularSpeed);
+
+    /* Left of the path, the robot turns right. */
+    follower.process(0, 50, 0, linearSpeed, angularSpeed);
+    TEST_ASSERT_EQUAL_INT16(WaypointFollower::DEFAULT_SPEED, linearSpeed);
+    TEST_ASSERT_EQUAL_INT16(-1600, angularSpeed);
+
+    /* Looking backward, the robot turns on the spot. */
+    follower.setLookaheadDistance(200U);
+    follower.process(0, 0, 3142, linearSpeed, angularSpeed);
+    TEST_ASSERT_EQUAL_INT16(0, linearSpeed);
+    TEST_ASSERT_EQUAL_INT16(2000, angularSpeed);
+}
+
+/**
+ * Test switching the waypoints and reaching the last one.
+ */
+static void testWaypoints()
+{
+    WaypointFollower                 follower;
+    const WaypointFollower::Waypoint waypoint0    = {500, 0, 100};
+    const WaypointFollower::Waypoint waypoint1    = {500, 500, 100};
+    int16_t                          linearSpeed  = 0;
+    int16_t                          angularSpeed = 0;
+
+    TEST_ASSERT_TRUE(follower.addWaypoint(waypoint0));
+    TEST_ASSERT_TRUE(follower.addWaypoint(waypoint1));
+    TEST_ASSERT_TRUE(follower.start(0, 0));
+
+    follower.process(200, 0, 0, linearSpeed, angularSpeed);
+    TEST_ASSERT_EQUAL_UINT8(0U, follower.getCurrentWaypoint());
+    TEST_ASSERT_EQUAL_INT16(100, linearSpeed);
+    TEST_ASSERT_EQUAL_INT16(0, angularSpeed);
+
+    /* Within the lookahead distance, the next segment is followed with the goal point (500, 100). */
+    follower.process(450, 0, 0, linearSpeed, angularSpeed);
+    TEST_ASSERT_EQUAL_UINT8(1U, follower.getCurrentWaypoint());
+    TEST_ASSERT_EQUAL_INT16(100, linearSpeed);
+    TEST_ASSERT_EQUAL_INT16(1600, angularSpeed);
+
+    /* The speed is reduced close to the last waypoint. */
+    follower.process(500, 470, 1571, linearSpeed, angularSpeed);
+    TEST_ASSERT_EQUAL_INT16(60, linearSpeed);
+    TEST_ASSERT_INT_WITHIN(1, 0, angularSpeed);
+    TEST_ASSERT_TRUE(follower.isRunning());
+
+    /* Within the goal tolerance, the path is finished. */
+    follower.process(500, 485, 1571, linearSpeed, angularSpeed);
+    TEST_ASSERT_EQUAL_INT16(0, linearSpeed);
+    TEST_ASSERT_EQUAL_INT16(0, angularSpeed);
+    TEST_ASSERT_FALSE(follower.isRunning());
+    TEST_ASSERT_TRUE(follower.isFinished());
+    TEST_ASSERT_EQUAL_UINT8(1U, follower.getCurrentWaypoint());
+}
+
+/**
+ * Test stopping the path.
+ */
+static void testStop()
+{
+    WaypointFollower                 follower;
+    const WaypointFollower::Waypoint waypoint     = {1000, 0, 100};
+    int16_t                          linearSpeed  = 0;
+    int16_t                          angularSpeed = 0;
+
+    TEST_ASSERT_TRUE(follower.addWaypoint(waypoint));
+    TEST_ASSERT_TRUE(follower.start(0, 0));
+
+    follower.process(0, 0, 0, linearSpeed, angularSpeed);
+    TEST_ASSERT_EQUAL_INT16(100, linearSpeed);
+
+    follower.stop();
+    follower.process(0, 0, 0, linearSpeed, angularSpeed);
+    TEST_ASSERT_EQUAL_INT16(0, linearSpeed);
+    TEST_ASSERT_EQUAL_INT16(0, angularSpeed);
+    TEST_ASSERT_FALSE(follower.isRunning());
+    TEST_ASSERT_FALSE(follower.isFinished());
+
+    /* It can be restarted. */
+    TEST_ASSERT_TRUE(follower.start(0, 0));
+    TEST_ASSERT_TRUE(follower.isRunning());
+}
@@ -112,6 +112,22 @@ class MySupervisor(Supervisor):
 
         return received_string
 
+    def receive_bytes(self) -> Optional[bytes]:
+        """Receive a message as raw bytes from the serial communication device.
+            Use it for binary messages.
+
+        Returns:
+            bytes: Received message or None if no message is available.
+        """
+        received_bytes = None
+
+        if self._com_rx is not None:
+            if self._com_rx.getQueueLength() > 0:
+                received_bytes = self._com_rx.getBytes()
+                self._com_rx.nextPacket()
+
+        return received_bytes
+
 ################################################################################
 # Functions
 ################################################################################
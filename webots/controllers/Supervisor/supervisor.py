@@ -31,6 +31,7 @@
 # pyright: reportMissingImports=false
 
 import math
+import struct
 import sys
 from dataclasses import dataclass
 from my_supervisor import MySupervisor
@@ -53,6 +54,20 @@ SUPERVISOR_TX_NAME = "supervisorComTx"
 SUPERVISOR_RX_CHANNEL_ID = 2
 SUPERVISOR_TX_CHANNEL_ID = 1
 
+# Binary pose frame types, see PoseTelemetry in the Service library.
+# Text commands start with a printable character, which is always above them.
+FRAME_TYPE_POSE = 0x01
+FRAME_TYPE_POSE_BATCH = 0x02
+
+# Single pose frame: type, sequence number, timestamp [ms], x [mm], y [mm], orientation [mrad]
+POSE_FRAME_FORMAT = "<BHIiih"
+
+# Batch frame header: type, number of poses, sequence number and timestamp [ms] of the first pose
+BATCH_HEADER_FORMAT = "<BBHI"
+
+# Pose in a batch frame: time difference to the previous pose [ms], x [mm], y [mm], orientation [mrad]
+BATCH_POSE_FORMAT = "<Biih"
+
 ################################################################################
 # Classes
 ################################################################################
@@ -65,6 +80,9 @@ class OdometryData():
     x: int = 0
     y: int = 0
     yaw_angle: float = 0
+    timestamp: int = 0
+    next_seq: int = 0
+    lost_poses: int = 0
 
     def reset(self) -> None:
         """Reset odometry data.
@@ -72,6 +90,32 @@ class OdometryData():
         self.x = 0
         self.y = 0
         self.yaw_angle = 0
+        self.timestamp = 0
+        self.next_seq = 0
+        self.lost_poses = 0
+
+    def update(self, seq: int, timestamp: int, x: int, y: int, orientation: int) -> None:
+        """Update the odometry data with a received pose and detect lost poses
+            by the sequence number.
+
+        Args:
+            seq (int): Sequence number of the pose.
+            timestamp (int): Timestamp of the pose in ms.
+            x (int): Position x in mm.
+            y (int): Position y in mm.
+            orientation (int): Orientation in mrad.
+        """
+        lost = (seq - self.next_seq) & 0xFFFF
+
+        if lost != 0:
+            self.lost_poses += lost
+            print(f"Supervisor: {lost} pose(s) lost, {self.lost_poses} in total.")
+
+        self.next_seq = (seq + 1) & 0xFFFF
+        self.timestamp = timestamp
+        self.x = x
+        self.y = y
+        self.yaw_angle = orientation / 1000.0
 
 ################################################################################
 # Functions
@@ -128,6 +172,66 @@ def convert_webots_angle_to_ru_angle(webots_angle: float) -> float:
     return webots_angle_2pi
 
 
+def decode_pose_frame(data: bytes) -> list:
+    """Decode a binary pose frame.
+
+    Args:
+        data (bytes): Received frame.
+
+    Returns:
+        list: Poses as tuples of sequence number, timestamp [ms], x [mm], y [mm] and orientation [mrad].
+            It is empty if the frame is invalid.
+    """
+    poses = []
+
+    if (data[0] == FRAME_TYPE_POSE) and (len(data) == struct.calcsize(POSE_FRAME_FORMAT)):
+        _, seq, timestamp, x, y, orientation = struct.unpack(POSE_FRAME_FORMAT, data)
+        poses.append((seq, timestamp, x, y, orientation))
+
+    elif (data[0] == FRAME_TYPE_POSE_BATCH) and (len(data) >= struct.calcsize(BATCH_HEADER_FORMAT)):
+        header_size = struct.calcsize(BATCH_HEADER_FORMAT)
+        pose_size = struct.calcsize(BATCH_POSE_FORMAT)
+        _, count, seq, timestamp = struct.unpack_from(BATCH_HEADER_FORMAT, data)
+
+        if len(data) == (header_size + (count * pose_size)):
+            for idx in range(count):
+                time_diff, x, y, orientation = struct.unpack_from(BATCH_POSE_FORMAT, data,
+                                                                  header_size + (idx * pose_size))
+                timestamp = (timestamp + time_diff) & 0xFFFFFFFF
+                poses.append(((seq + idx) & 0xFFFF, timestamp, x, y, orientation))
+
+    return poses
+
+
+def handle_text_command(rx_data: str, robot_observer: RobotObserver, robot_odometry: OdometryData) -> None:
+    """Handle a text command of the robot.
+
+    Args:
+        rx_data (str): Received command.
+        robot_observer (RobotObserver): Observer of the robot.
+        robot_odometry (OdometryData): Odometry data of the robot.
+    """
+    command = rx_data.split(',')
+
+    # Reset robot position and orientation?
+    if command[0] == "RST":
+        print("Supervisor: RST")
+        robot_observer.set_current_position_as_reference()
+        robot_observer.set_current_orientation_as_reference()
+        robot_odometry.reset()
+
+    # Robot odometry data received? Legacy text protocol.
+    elif command[0] == "ODO":
+        robot_odometry.x = int(command[1])  # [mm]
+        robot_odometry.y = int(command[2])  # [mm]
+        robot_odometry.yaw_angle = float(
+            command[3]) / 1000.0  # [rad]
+
+    # Unknown command.
+    else:
+        print(f"Supervisor: Unknown command: {command[0]}")
+
+
 def main_loop():
     """Main loop:
         - Perform simulation steps until Webots is stopping the controller-
@@ -163,31 +267,24 @@ def main_loop():
         robot_odometry = OdometryData()
 
         while supervisor.step() != -1:
-            rx_data = supervisor.receive()
-
-            if rx_data is None:
-                pass
+            rx_data = supervisor.receive_bytes()
 
-            else:
-                command = rx_data.split(',')
+            # Handle all messages, which were received during the last step.
+            while rx_data is not None:
 
-                # Reset robot position and orientation?
-                if command[0] == "RST":
-                    print("Supervisor: RST")
-                    robot_observer.set_current_position_as_reference()
-                    robot_observer.set_current_orientation_as_reference()
-                    robot_odometry.reset()
+                if len(rx_data) == 0:
+                    pass
 
-                # Robot odometry data received?
-                elif command[0] == "ODO":
-                    robot_odometry.x = int(command[1])  # [mm]
-                    robot_odometry.y = int(command[2])  # [mm]
-                    robot_odometry.yaw_angle = float(
-                        command[3]) / 1000.0  # [rad]
+                # Binary pose frame?
+                elif rx_data[0] in (FRAME_TYPE_POSE, FRAME_TYPE_POSE_BATCH):
+                    for pose in decode_pose_frame(rx_data):
+                        robot_odometry.update(*pose)
 
-                # Unknown command.
                 else:
-                    print(f"Supervisor: Unknown command: {command[0]}")
+                    handle_text_command(rx_data.decode("utf-8", errors="replace").rstrip("\0"),
+                                        robot_observer, robot_odometry)
+
+                rx_data = supervisor.receive_bytes()
 
             robot_position = robot_observer.get_rel_position()
             robot_orientation = robot_observer.get_rel_orientation()